@@ -197,6 +197,62 @@ typedef struct mbedtls_asn1_named_data {
 }
 mbedtls_asn1_named_data;
 
+/**
+ * \brief          Callback type: read data for an ASN.1 stream.
+ *
+ * \param p_read   The context passed to mbedtls_asn1_stream_setup().
+ * \param buf      The buffer to fill.
+ * \param len      The size of \p buf in bytes. This is at least \c 1.
+ *
+ * \return         The number of bytes written to \p buf, at most \p len,
+ *                 if successful. It may be less than \p len even if more
+ *                 data is available.
+ * \return         \c 0 at the end of the input.
+ * \return         A negative error code on failure. It is returned
+ *                 unchanged to the caller of the stream function that
+ *                 needed the data.
+ */
+typedef int mbedtls_asn1_stream_read_t(void *p_read,
+                                       unsigned char *buf, size_t len);
+
+/**
+ * \brief          Callback type: receive the bytes consumed from an ASN.1
+ *                 stream.
+ *
+ * \param p_tap    The context passed to mbedtls_asn1_stream_set_tap().
+ * \param buf      The bytes consumed by the last stream function.
+ * \param len      The size of \p buf in bytes.
+ *
+ * \return         \c 0 if successful. Any other value is returned to the
+ *                 caller of the stream function that consumed the bytes.
+ */
+typedef int mbedtls_asn1_stream_tap_t(void *p_tap,
+                                      const unsigned char *buf, size_t len);
+
+/**
+ * \brief          Context for reading a DER encoding incrementally.
+ *
+ *                 The input is pulled in chunks from a read callback into a
+ *                 window of fixed size. An element can be retrieved whole
+ *                 if it fits in the window; larger elements can only be
+ *                 skipped or entered with mbedtls_asn1_stream_get_tag().
+ *                 The memory used is therefore bounded by the size of the
+ *                 window, whatever the size of the input.
+ */
+typedef struct mbedtls_asn1_stream {
+    mbedtls_asn1_stream_read_t *MBEDTLS_PRIVATE(f_read);
+    void *MBEDTLS_PRIVATE(p_read);
+    mbedtls_asn1_stream_tap_t *MBEDTLS_PRIVATE(f_tap);
+    void *MBEDTLS_PRIVATE(p_tap);
+    unsigned char *MBEDTLS_PRIVATE(buf);   /*!< The window */
+    size_t MBEDTLS_PRIVATE(size);          /*!< The size of the window */
+    size_t MBEDTLS_PRIVATE(start);         /*!< The next byte to consume */
+    size_t MBEDTLS_PRIVATE(end);           /*!< The end of the data read */
+    size_t MBEDTLS_PRIVATE(offset);        /*!< The number of bytes consumed */
+    int MBEDTLS_PRIVATE(eof);              /*!< The read callback returned 0 */
+}
+mbedtls_asn1_stream;
+
 #if defined(MBEDTLS_ASN1_PARSE_C) || defined(MBEDTLS_X509_CREATE_C)
 /**
  * \brief       Get the length of an ASN.1 element.
@@ -629,6 +685,188 @@ void mbedtls_asn1_free_named_data_list(mbedtls_asn1_named_data **head);
  */
 void mbedtls_asn1_free_named_data_list_shallow(mbedtls_asn1_named_data *name);
 
+/**
+ * \brief          Set up a context to read a DER encoding incrementally.
+ *
+ * \param s        The context to set up.
+ * \param f_read   The callback that reads the input.
+ * \param p_read   The context passed to \p f_read.
+ * \param size     The size of the window in bytes. This is the largest
+ *                 element that mbedtls_asn1_stream_get_element() and
+ *                 mbedtls_asn1_stream_traverse_sequence_of() can return.
+ *                 It must be at least \c 6, the size of the largest
+ *                 header supported.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_ASN1_BUF_TOO_SMALL if \p size is too small.
+ * \return         #MBEDTLS_ERR_ASN1_ALLOC_FAILED on memory allocation
+ *                 failure.
+ */
+int mbedtls_asn1_stream_setup(mbedtls_asn1_stream *s,
+                              mbedtls_asn1_stream_read_t *f_read,
+                              void *p_read,
+                              size_t size);
+
+/**
+ * \brief          Free the window of an ASN.1 stream context.
+ *
+ * \param s        The context to free. It must have been set up with
+ *                 mbedtls_asn1_stream_setup(), or be all-bits-zero.
+ */
+void mbedtls_asn1_stream_free(mbedtls_asn1_stream *s);
+
+/**
+ * \brief          Register a callback that receives every byte consumed
+ *                 from an ASN.1 stream, in order, e.g. to hash or to keep
+ *                 part of the input.
+ *
+ * \param s        The stream context.
+ * \param f_tap    The callback, or \c NULL to remove it.
+ * \param p_tap    The context passed to \p f_tap.
+ */
+void mbedtls_asn1_stream_set_tap(mbedtls_asn1_stream *s,
+                                 mbedtls_asn1_stream_tap_t *f_tap,
+                                 void *p_tap);
+
+/**
+ * \brief          Get the number of bytes consumed from an ASN.1 stream.
+ *
+ *                 The position of the end of an element whose header was
+ *                 read with mbedtls_asn1_stream_get_tag() is the value
+ *                 returned by this function after the call, plus the length
+ *                 of the element.
+ *
+ * \param s        The stream context.
+ *
+ * \return         The offset of the next byte of the input.
+ */
+size_t mbedtls_asn1_stream_offset(const mbedtls_asn1_stream *s);
+
+/**
+ * \brief          Get the tag of the next element of an ASN.1 stream,
+ *                 without consuming it.
+ *
+ * \param s        The stream context.
+ * \param tag      On success, the tag of the next element.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_ASN1_OUT_OF_DATA at the end of the input.
+ * \return         An error returned by the read callback.
+ */
+int mbedtls_asn1_stream_peek_tag(mbedtls_asn1_stream *s, int *tag);
+
+/**
+ * \brief          Consume the tag and length of the next element of an
+ *                 ASN.1 stream, the stream equivalent of
+ *                 mbedtls_asn1_get_tag().
+ *
+ *                 Unlike mbedtls_asn1_get_tag(), this function cannot
+ *                 check that the content is present in the input, since
+ *                 it has not been read yet.
+ *
+ * \param s        The stream context.
+ * \param len      On success, the length of the content of the element.
+ * \param tag      The expected tag.
+ *
+ * \return         \c 0 if successful. The next byte of the stream is the
+ *                 first byte of the content of the element.
+ * \return         #MBEDTLS_ERR_ASN1_UNEXPECTED_TAG if the next element
+ *                 has a different tag. Nothing is consumed in this case.
+ * \return         #MBEDTLS_ERR_ASN1_OUT_OF_DATA if the input ends before
+ *                 the end of the header.
+ * \return         #MBEDTLS_ERR_ASN1_INVALID_LENGTH if the length is not
+ *                 encoded in 1 to 4 bytes.
+ * \return         An error returned by the read or tap callback.
+ */
+int mbedtls_asn1_stream_get_tag(mbedtls_asn1_stream *s,
+                                size_t *len, int tag);
+
+/**
+ * \brief          Consume the next element of an ASN.1 stream, header
+ *                 included, and return it in the window.
+ *
+ *                 The element can then be parsed with the
+ *                 mbedtls_asn1_get_xxx() functions, e.g.
+ *                 mbedtls_asn1_get_int(&p, p + len, &val).
+ *
+ * \param s        The stream context.
+ * \param p        On success, the address of the element in the window.
+ *                 It remains valid until the next call that reads from
+ *                 the stream.
+ * \param len      On success, the length of the element, header included.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_ASN1_BUF_TOO_SMALL if the element does not
+ *                 fit in the window. Nothing is consumed in this case.
+ * \return         #MBEDTLS_ERR_ASN1_OUT_OF_DATA if the input ends before
+ *                 the end of the element.
+ * \return         Another error from mbedtls_asn1_stream_get_tag().
+ */
+int mbedtls_asn1_stream_get_element(mbedtls_asn1_stream *s,
+                                    unsigned char **p, size_t *len);
+
+/**
+ * \brief          Consume bytes of an ASN.1 stream without interpreting
+ *                 them, e.g. the content of an element whose header was
+ *                 read with mbedtls_asn1_stream_get_tag(). The bytes still
+ *                 go through the tap callback.
+ *
+ * \param s        The stream context.
+ * \param len      The number of bytes to consume. It may exceed the size
+ *                 of the window.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_ASN1_OUT_OF_DATA if the input ends before.
+ * \return         An error returned by the read or tap callback.
+ */
+int mbedtls_asn1_stream_skip(mbedtls_asn1_stream *s, size_t len);
+
+/**
+ * \brief          Traverse an ASN.1 SEQUENCE from a stream and call a
+ *                 callback for each element, the stream equivalent of
+ *                 mbedtls_asn1_traverse_sequence_of().
+ *
+ *                 The tags are checked and the callback is called as in
+ *                 mbedtls_asn1_traverse_sequence_of(). The SEQUENCE itself
+ *                 may be arbitrarily large: each element is read into the
+ *                 window before the callback is called on it, and
+ *                 discarded afterwards. The elements that do not have a
+ *                 "may" tag are skipped, so only the elements passed to the
+ *                 callback need to fit in the window.
+ *
+ * \warning        This function is still experimental and may change
+ *                 at any time.
+ *
+ * \param s        The stream context. The next element must be the
+ *                 SEQUENCE.
+ * \param tag_must_mask  See mbedtls_asn1_traverse_sequence_of().
+ * \param tag_must_val   See mbedtls_asn1_traverse_sequence_of().
+ * \param tag_may_mask   See mbedtls_asn1_traverse_sequence_of().
+ * \param tag_may_val    See mbedtls_asn1_traverse_sequence_of().
+ * \param cb       The callback, called with the same parameters as in
+ *                 mbedtls_asn1_traverse_sequence_of(). The content it
+ *                 receives is only valid until it returns.
+ * \param ctx      The context to be passed to the callback \p cb.
+ *
+ * \return         \c 0 if the entire SEQUENCE was traversed without
+ *                 parsing or callback errors.
+ * \return         #MBEDTLS_ERR_ASN1_UNEXPECTED_TAG if an element has a
+ *                 tag that is not accepted.
+ * \return         #MBEDTLS_ERR_ASN1_LENGTH_MISMATCH if an element extends
+ *                 beyond the end of the SEQUENCE.
+ * \return         #MBEDTLS_ERR_ASN1_BUF_TOO_SMALL if an element to pass to
+ *                 the callback does not fit in the window.
+ * \return         Another error from the stream functions, or the
+ *                 non-zero value returned by \p cb.
+ */
+int mbedtls_asn1_stream_traverse_sequence_of(
+    mbedtls_asn1_stream *s,
+    unsigned char tag_must_mask, unsigned char tag_must_val,
+    unsigned char tag_may_mask, unsigned char tag_may_val,
+    int (*cb)(void *ctx, int tag,
+              unsigned char *start, size_t len),
+    void *ctx);
+
 /** \} name Functions to parse ASN.1 data structures */
 /** \} addtogroup asn1_module */
 
@@ -61,6 +61,11 @@ int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen,
  *
  * \note           Call this function with *dst = NULL or dlen = 0 to obtain
  *                 the required buffer size in *olen
+ *
+ * \note           Nothing is written to \p dst when the function returns
+ *                 MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL. When it returns
+ *                 MBEDTLS_ERR_BASE64_INVALID_CHARACTER, the content of
+ *                 \p dst is unspecified.
  */
 int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
                           const unsigned char *src, size_t slen);
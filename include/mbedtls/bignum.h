@@ -882,6 +882,13 @@ int mbedtls_mpi_mod_int(mbedtls_mpi_uint *r, const mbedtls_mpi *A,
 /**
  * \brief          Perform a sliding-window exponentiation: X = A^E mod N
  *
+ * \note           For moduli of 1024, 1536 and 2048 bits and exponents of
+ *                 more than 79 bits, this function uses a fixed-size
+ *                 implementation whose working memory is on the heap, or
+ *                 on the stack if #MBEDTLS_MPI_EXP_MOD_FIXED_STACK is
+ *                 enabled. Its window is at most 4 bits and at most
+ *                 #MBEDTLS_MPI_WINDOW_SIZE.
+ *
  * \param X        The destination MPI. This must point to an initialized MPI.
  *                 This must not alias E or N.
  * \param A        The base of the exponentiation.
@@ -802,6 +802,10 @@
 #error "MBEDTLS_PSA_ITS_FILE_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_FS_IO_MMAP) && !defined(MBEDTLS_FS_IO)
+#error "MBEDTLS_FS_IO_MMAP defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_RSA_C) && ( !defined(MBEDTLS_BIGNUM_C) ||         \
     !defined(MBEDTLS_OID_C) )
 #error "MBEDTLS_RSA_C defined, but not all prerequisites"
@@ -936,6 +940,10 @@
 #error "MBEDTLS_SSL_ASYNC_PRIVATE defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_HANDSHAKE_PROFILING defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_SSL_TLS_C) && !defined(MBEDTLS_CIPHER_C)
 #error "MBEDTLS_SSL_TLS_C defined, but not all prerequisites"
 #endif
@@ -1133,6 +1141,14 @@
 #error "MBEDTLS_SSL_CONTEXT_SERIALIZATION defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS) && !defined(MBEDTLS_SSL_TLS_C)
+#error "MBEDTLS_SSL_RELEASE_BUFFERS defined, but not all prerequisites"
+#endif
+
 /* Reject attempts to enable options that have been removed and that could
  * cause a build to succeed but with features removed. */
 
@@ -89,6 +89,34 @@ typedef enum {
     MBEDTLS_DHM_PARAM_K,  /*!<  The shared secret = \c G^(XY) mod \c P. */
 } mbedtls_dhm_parameter;
 
+/**
+ * \name SECTION: Module settings
+ *
+ * The configuration options you can set for this module are in this section.
+ * Either change them in mbedtls_config.h, or define them using the compiler command line.
+ * \{
+ */
+
+#if !defined(MBEDTLS_DHM_FIXED_BASE_OPTIM)
+/*
+ * Trade code size for speed on key generation in the RFC 7919 groups.
+ *
+ * This speeds up the computation of the public value G^X mod P by
+ * mbedtls_dhm_make_params(), mbedtls_dhm_make_public() and the PSA FFDH
+ * key generation by a factor of roughly 3, when P and G are one of the
+ * ffdhe2048 to ffdhe8192 groups. Other groups are not affected.
+ *
+ * This adds 5n/8 bytes of read-only data for each n-bit group, about 15kB
+ * in total, and the computation uses a temporary table of 32 values
+ * modulo P on the heap.
+ *
+ * Change this value to 0 to reduce code size.
+ */
+#define MBEDTLS_DHM_FIXED_BASE_OPTIM  1   /**< Enable fixed-base speed-up. */
+#endif /* MBEDTLS_DHM_FIXED_BASE_OPTIM */
+
+/** \} name SECTION: Module settings */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -227,6 +227,12 @@ typedef struct {
                                                                    non-NULL otherwise.
                                                                    Is 2^MBEDTLS_LMS_H_TREE_HEIGHT(type)
                                                                    in length. */
+    unsigned char *MBEDTLS_PRIVATE(tree); /*!< The Merkle tree, calculated once when the
+                                             key is generated, from which the public key
+                                             and the authentication paths are read.
+                                             NULL when have_private_key is 0 and non-NULL
+                                             otherwise. Is 2^(MBEDTLS_LMS_H_TREE_HEIGHT(type)
+                                             + 1) nodes in length. */
     unsigned char MBEDTLS_PRIVATE(have_private_key); /*!< Whether the context contains a private key.
                                                         Boolean values only. */
 } mbedtls_lms_private_t;
@@ -1178,6 +1178,24 @@
  */
 #define MBEDTLS_GENPRIME
 
+/**
+ * \def MBEDTLS_MPI_EXP_MOD_FIXED_STACK
+ *
+ * Keep the working memory of the fixed-size modular exponentiation, which
+ * mbedtls_mpi_exp_mod() uses for all 1024, 1536 and 2048-bit moduli (the
+ * CRT halves of 2048 to 4096-bit RSA keys, but also e.g. DHM groups of
+ * these sizes), on the stack instead of allocating it on the heap. This
+ * saves one heap allocation per private RSA operation, at the cost of up to
+ * about 5 KiB of extra stack usage. The table of this exponentiation uses a
+ * window of min(4, MBEDTLS_MPI_WINDOW_SIZE) bits, so lowering
+ * MBEDTLS_MPI_WINDOW_SIZE also reduces this stack usage.
+ *
+ * Only enable this option if your threads have enough stack.
+ *
+ * Uncomment this macro to keep the exponentiation workspace on the stack.
+ */
+//#define MBEDTLS_MPI_EXP_MOD_FIXED_STACK
+
 /**
  * \def MBEDTLS_FS_IO
  *
@@ -1185,6 +1203,39 @@
  */
 #define MBEDTLS_FS_IO
 
+/**
+ * \def MBEDTLS_FS_IO_MMAP
+ *
+ * Map files into memory instead of reading them into a heap buffer in the
+ * functions that load keys, certificates, CRLs and DHM parameters from a
+ * file. DER certificates and CRLs loaded with mbedtls_x509_crt_parse_file()
+ * and mbedtls_x509_crl_parse_file() are parsed in place and keep the mapping
+ * until they are freed, so a large bundle loaded before fork() is shared
+ * read-only between the processes.
+ *
+ * Mappings are only used on POSIX platforms, for regular files whose size is
+ * not a multiple of the page size (the parsers need the byte after the
+ * content to be a null byte). Other files are read with the standard I/O
+ * functions as usual.
+ *
+ * \warning The certificates and CRLs that are parsed in place keep pointing
+ *          into a private mapping of the file for their whole lifetime,
+ *          and pages of such a mapping that the process never wrote to
+ *          still show later changes to the file. If the file is rewritten
+ *          in place, the raw and tbs data of these certificates and CRLs
+ *          silently change after they were parsed and verified. If the file
+ *          is truncated, accessing them may cause the process to receive
+ *          SIGBUS. Only enable this option if the files are never modified
+ *          in place while they are in use: always replace them atomically,
+ *          by writing a new file and moving it over the old one with
+ *          rename().
+ *
+ * Requires: MBEDTLS_FS_IO
+ *
+ * Uncomment this macro to map files into memory.
+ */
+//#define MBEDTLS_FS_IO_MMAP
+
 /**
  * \def MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES
  *
@@ -1614,6 +1665,29 @@
  */
 #define MBEDTLS_SSL_CONTEXT_SERIALIZATION
 
+/**
+ * \def MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT
+ *
+ * Enable the export of the record protection keys of an established TLS
+ * connection, through mbedtls_ssl_export_traffic_keys() and
+ * mbedtls_ssl_tls13_next_traffic_keys(), and the function
+ * mbedtls_net_set_ktls() which hands them over to the Linux kernel TLS
+ * (kTLS) implementation.
+ *
+ * Once the record protection is done by the kernel, the application can
+ * send and receive data with plain socket calls, and use sendfile() on
+ * the socket, without copying data through the SSL buffers.
+ *
+ * Enabling this option makes each transform keep a copy of its raw keys,
+ * which adds 72 bytes per transform. When #MBEDTLS_USE_PSA_CRYPTO is
+ * enabled, the keys are then no longer only held by the PSA key store.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment to enable the traffic keys export.
+ */
+//#define MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT
+
 /**
  * \def MBEDTLS_SSL_DEBUG_ALL
  *
@@ -1662,6 +1736,26 @@
  */
 #define MBEDTLS_SSL_EXTENDED_MASTER_SECRET
 
+/**
+ * \def MBEDTLS_SSL_HANDSHAKE_PROFILING
+ *
+ * Enable the handshake profiling callback, see
+ * mbedtls_ssl_conf_handshake_profile().
+ *
+ * The callback is invoked at the start and end of each handshake step and
+ * around the expensive operations of a handshake: (EC)DH(E) computations,
+ * signature generation and verification, certificate chain verification,
+ * key derivation, and calls to the send and receive callbacks. It lets an
+ * application take timestamps and find out where handshake time goes.
+ *
+ * When the callback is not set, the cost is one pointer test per event.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment this macro to enable the handshake profiling callback.
+ */
+//#define MBEDTLS_SSL_HANDSHAKE_PROFILING
+
 /**
  * \def MBEDTLS_SSL_KEEP_PEER_CERTIFICATE
  *
@@ -2000,6 +2094,25 @@
  */
 //#define MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH
 
+/**
+ * \def MBEDTLS_SSL_RELEASE_BUFFERS
+ *
+ * Enable mbedtls_ssl_release_buffers(), which frees the input and output
+ * buffers of an idle TLS connection. The buffers are allocated again when
+ * the connection is next used, optionally from a pool of buffers shared by
+ * many connections (see mbedtls_ssl_conf_buffer_pool()).
+ *
+ * This is useful for servers that hold many mostly idle connections, since
+ * each connection otherwise keeps both buffers, about 33 kB with the default
+ * #MBEDTLS_SSL_IN_CONTENT_LEN and #MBEDTLS_SSL_OUT_CONTENT_LEN, for its whole
+ * lifetime.
+ *
+ * Requires: MBEDTLS_SSL_TLS_C
+ *
+ * Uncomment this macro to enable releasing the buffers of idle connections.
+ */
+//#define MBEDTLS_SSL_RELEASE_BUFFERS
+
 /**
  * \def MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN
  *
@@ -3824,6 +3937,9 @@
 //#define MBEDTLS_HMAC_DRBG_MAX_REQUEST        1024 /**< Maximum number of requested bytes per call */
 //#define MBEDTLS_HMAC_DRBG_MAX_SEED_INPUT      384 /**< Maximum size of (re)seed buffer */
 
+/* DHM options */
+//#define MBEDTLS_DHM_FIXED_BASE_OPTIM       1 /**< Enable fixed-base speed-up for the RFC 7919 groups */
+
 /* ECP options */
 //#define MBEDTLS_ECP_WINDOW_SIZE            4 /**< Maximum window size used */
 //#define MBEDTLS_ECP_FIXED_POINT_OPTIM      1 /**< Enable fixed-point speed-up */
@@ -4036,6 +4152,15 @@
  */
 //#define MBEDTLS_SSL_DTLS_MAX_BUFFERING             32768
 
+/** \def MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX
+ *
+ * Default maximum number of free buffers kept by a buffer pool, see
+ * mbedtls_ssl_buffer_pool_set_max_free(). Each buffer holds about
+ * MBEDTLS_SSL_IN_CONTENT_LEN bytes.
+ *
+ */
+//#define MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX        64
+
 //#define MBEDTLS_PSK_MAX_LEN               32 /**< Max size of TLS pre-shared keys, in bytes (default 256 or 384 bits) */
 //#define MBEDTLS_SSL_COOKIE_TIMEOUT        60 /**< Default expiration delay of DTLS cookies, in seconds if HAVE_TIME, or in number of cookies issued */
 
@@ -248,9 +248,27 @@ typedef struct mbedtls_md_context_t {
 #if defined(MBEDTLS_MD_C)
     /** The HMAC part of the context. */
     void *MBEDTLS_PRIVATE(hmac_ctx);
+
+    /** The prepared HMAC key in use, or \c NULL. */
+    const struct mbedtls_md_hmac_key *MBEDTLS_PRIVATE(hmac_key);
 #endif
 } mbedtls_md_context_t;
 
+#if defined(MBEDTLS_MD_C)
+/**
+ * A prepared HMAC key: the hash states after processing the inner and the
+ * outer padded key. Using it saves hashing the key and two blocks for each
+ * message.
+ *
+ * Once set up, a prepared key is only read, so it can be shared between
+ * threads and used for any number of concurrent HMAC operations.
+ */
+typedef struct mbedtls_md_hmac_key {
+    mbedtls_md_context_t MBEDTLS_PRIVATE(inner);
+    mbedtls_md_context_t MBEDTLS_PRIVATE(outer);
+} mbedtls_md_hmac_key;
+#endif /* MBEDTLS_MD_C */
+
 /**
  * \brief           This function returns the message-digest information
  *                  associated with the given digest type.
@@ -451,6 +469,33 @@ MBEDTLS_CHECK_RETURN_TYPICAL
 int mbedtls_md(const mbedtls_md_info_t *md_info, const unsigned char *input, size_t ilen,
                unsigned char *output);
 
+/**
+ * \brief          This function calculates the message-digests of several
+ *                 independent buffers with the same algorithm.
+ *
+ *                 The result is the same as calling mbedtls_md() on each
+ *                 buffer. For the SHA-2 algorithms, this uses
+ *                 mbedtls_sha256_batch() or mbedtls_sha512_batch(), which
+ *                 can hash several buffers in parallel.
+ *
+ * \param md_info  The information structure of the message-digest algorithm
+ *                 to use.
+ * \param count    The number of buffers to hash.
+ * \param input    An array of \p count pointers to the buffers to hash.
+ * \param ilen     An array of \p count input lengths.
+ * \param output   An array of \p count pointers to the generic
+ *                 message-digest checksum results. Output buffers must not
+ *                 overlap with each other or with the input buffers.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                 failure.
+ */
+MBEDTLS_CHECK_RETURN_TYPICAL
+int mbedtls_md_batch(const mbedtls_md_info_t *md_info, size_t count,
+                     const unsigned char *const input[], const size_t ilen[],
+                     unsigned char *const output[]);
+
 /**
  * \brief           This function returns the list of digests supported by the
  *                  generic digest module.
@@ -633,6 +678,99 @@ int mbedtls_md_hmac(const mbedtls_md_info_t *md_info, const unsigned char *key,
                     const unsigned char *input, size_t ilen,
                     unsigned char *output);
 
+#if defined(MBEDTLS_MD_C)
+/**
+ * \brief          This function initializes a prepared HMAC key.
+ *
+ * \param key      The prepared HMAC key to initialize.
+ */
+void mbedtls_md_hmac_key_init(mbedtls_md_hmac_key *key);
+
+/**
+ * \brief          This function clears a prepared HMAC key.
+ *
+ *                 It must not be in use by any MD context.
+ *
+ * \param key      The prepared HMAC key to clear. If this is \c NULL,
+ *                 this function does nothing.
+ */
+void mbedtls_md_hmac_key_free(mbedtls_md_hmac_key *key);
+
+/**
+ * \brief          This function prepares an HMAC key for repeated use.
+ *
+ *                 It hashes the key into the inner and outer hash states,
+ *                 which mbedtls_md_hmac_starts_key() and
+ *                 mbedtls_md_hmac_prepared() copy for each message.
+ *
+ * \note           If \p key was already set up, its previous state is
+ *                 released first. It must not be in use by another thread
+ *                 or by an HMAC context started with
+ *                 mbedtls_md_hmac_starts_key() at that point.
+ *
+ * \param key      The prepared HMAC key, initialized with
+ *                 mbedtls_md_hmac_key_init().
+ * \param md_info  The information structure of the message-digest algorithm
+ *                 to use.
+ * \param secret   The HMAC secret key.
+ * \param keylen   The length of the HMAC secret key in Bytes.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                 failure.
+ * \return         #MBEDTLS_ERR_MD_ALLOC_FAILED on memory-allocation failure.
+ */
+MBEDTLS_CHECK_RETURN_TYPICAL
+int mbedtls_md_hmac_key_setup(mbedtls_md_hmac_key *key,
+                              const mbedtls_md_info_t *md_info,
+                              const unsigned char *secret, size_t keylen);
+
+/**
+ * \brief          This function prepares to authenticate a new message
+ *                 with a prepared HMAC key.
+ *
+ *                 This is equivalent to mbedtls_md_hmac_starts() with the
+ *                 key that \p key was set up with, but it only copies the
+ *                 hash state. Subsequent calls to mbedtls_md_hmac_finish()
+ *                 and mbedtls_md_hmac_reset() also use \p key, until the
+ *                 next call to mbedtls_md_hmac_starts().
+ *
+ * \param ctx      The message digest context containing an embedded HMAC
+ *                 context, set up with the same algorithm as \p key.
+ * \param key      The prepared HMAC key. It must remain valid and
+ *                 unmodified while \p ctx uses it.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                 failure.
+ */
+MBEDTLS_CHECK_RETURN_TYPICAL
+int mbedtls_md_hmac_starts_key(mbedtls_md_context_t *ctx,
+                               const mbedtls_md_hmac_key *key);
+
+/**
+ * \brief          This function calculates the HMAC of a buffer with a
+ *                 prepared HMAC key.
+ *
+ *                 The result is the same as mbedtls_md_hmac() with the key
+ *                 that \p key was set up with.
+ *
+ * \param key      The prepared HMAC key.
+ * \param input    The buffer holding the input data.
+ * \param ilen     The length of the input data.
+ * \param output   The generic HMAC result.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                 failure.
+ * \return         #MBEDTLS_ERR_MD_ALLOC_FAILED on memory-allocation failure.
+ */
+MBEDTLS_CHECK_RETURN_TYPICAL
+int mbedtls_md_hmac_prepared(const mbedtls_md_hmac_key *key,
+                             const unsigned char *input, size_t ilen,
+                             unsigned char *output);
+#endif /* MBEDTLS_MD_C */
+
 #ifdef __cplusplus
 }
 #endif
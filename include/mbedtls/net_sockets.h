@@ -60,6 +60,8 @@
 #define MBEDTLS_ERR_NET_POLL_FAILED                       -0x0047
 /** Input invalid. */
 #define MBEDTLS_ERR_NET_BAD_INPUT_DATA                    -0x0049
+/** Enabling kernel TLS on the socket failed. */
+#define MBEDTLS_ERR_NET_KTLS_FAILED                       -0x004B
 
 #define MBEDTLS_NET_LISTEN_BACKLOG         10 /**< The backlog that listen() should use. */
 
@@ -69,6 +71,12 @@
 #define MBEDTLS_NET_POLL_READ  1 /**< Used in \c mbedtls_net_poll to check for pending data  */
 #define MBEDTLS_NET_POLL_WRITE 2 /**< Used in \c mbedtls_net_poll to check if write possible */
 
+/* The mbedtls_net_poller_xxx() functions are backed by epoll, so they are
+ * only declared on Linux. */
+#if defined(__linux__)
+#define MBEDTLS_NET_POLLER_AVAILABLE
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -91,6 +99,32 @@ typedef struct mbedtls_net_context {
 }
 mbedtls_net_context;
 
+#if defined(MBEDTLS_NET_POLLER_AVAILABLE)
+/**
+ * Set of sockets to wait for with mbedtls_net_poller_wait().
+ *
+ * This is backed by an epoll instance, so that the cost of waiting does not
+ * depend on the number of sockets in the set and there is no limit on the
+ * file descriptor numbers. It is only available on Linux, where
+ * #MBEDTLS_NET_POLLER_AVAILABLE is defined.
+ */
+typedef struct mbedtls_net_poller {
+    int MBEDTLS_PRIVATE(fd); /* The epoll file descriptor. */
+}
+mbedtls_net_poller;
+
+/**
+ * An event reported by mbedtls_net_poller_wait().
+ */
+typedef struct mbedtls_net_poll_event {
+    /** The pointer passed to mbedtls_net_poller_add() for the socket. */
+    void *user_data;
+    /** Bitmask composed of MBEDTLS_NET_POLL_READ/WRITE. */
+    uint32_t rw;
+}
+mbedtls_net_poll_event;
+#endif /* MBEDTLS_NET_POLLER_AVAILABLE */
+
 /**
  * \brief          Initialize a context
  *                 Just makes the context ready to be used or freed safely.
@@ -161,9 +195,9 @@ int mbedtls_net_accept(mbedtls_net_context *bind_ctx,
 /**
  * \brief          Check and wait for the context to be ready for read/write
  *
- * \note           The current implementation of this function uses
- *                 select() and returns an error if the file descriptor
- *                 is \c FD_SETSIZE or greater.
+ * \note           On Windows, the current implementation of this function
+ *                 uses select(). On other platforms, it uses poll(), so
+ *                 any file descriptor number is supported.
  *
  * \param ctx      Socket to check
  * \param rw       Bitflag composed of MBEDTLS_NET_POLL_READ and
@@ -182,9 +216,113 @@ int mbedtls_net_accept(mbedtls_net_context *bind_ctx,
  *
  * \return         Bitmask composed of MBEDTLS_NET_POLL_READ/WRITE
  *                 on success or timeout, or a negative return code otherwise.
+ *                 An error or hangup on the socket is reported as readiness
+ *                 for the requested events, so that the next read or write
+ *                 returns it. MBEDTLS_ERR_NET_POLL_FAILED is returned if
+ *                 the socket is not open, or if an error is pending and
+ *                 \p rw requests no event.
  */
 int mbedtls_net_poll(mbedtls_net_context *ctx, uint32_t rw, uint32_t timeout);
 
+#if defined(MBEDTLS_NET_POLLER_AVAILABLE)
+/**
+ * \brief          Initialize a set of sockets.
+ *                 Just makes the context ready to be set up or freed safely.
+ *
+ * \param poller   The set to initialize.
+ */
+void mbedtls_net_poller_init(mbedtls_net_poller *poller);
+
+/**
+ * \brief          Set up a set of sockets.
+ *
+ * \param poller   The set to set up. It must have been initialized with
+ *                 mbedtls_net_poller_init().
+ *
+ * \return         0 if successful, or
+ *                 MBEDTLS_ERR_NET_POLL_FAILED on failure.
+ */
+int mbedtls_net_poller_setup(mbedtls_net_poller *poller);
+
+/**
+ * \brief          Add a socket to a set, in edge-triggered mode.
+ *
+ *                 mbedtls_net_poller_wait() only reports a socket when its
+ *                 state changes: after an event, the application must read
+ *                 or write until the operation returns
+ *                 MBEDTLS_ERR_SSL_WANT_READ or MBEDTLS_ERR_SSL_WANT_WRITE
+ *                 before it may wait for the socket again. With a TLS
+ *                 connection, this means calling the SSL function until it
+ *                 returns one of these errors. The socket should be
+ *                 non-blocking, see mbedtls_net_set_nonblock().
+ *
+ * \param poller   The set of sockets.
+ * \param ctx      The socket to add.
+ * \param rw       Bitflag composed of MBEDTLS_NET_POLL_READ and
+ *                 MBEDTLS_NET_POLL_WRITE specifying the events to wait for.
+ *                 Usually both, since a TLS connection may need to write
+ *                 when the application reads and vice versa.
+ * \param user_data The pointer to report in the events for this socket.
+ *
+ * \return         0 if successful, or
+ *                 MBEDTLS_ERR_NET_BAD_INPUT_DATA if \p rw is invalid, or
+ *                 MBEDTLS_ERR_NET_POLL_FAILED on failure, for example if
+ *                 the socket is already in the set.
+ */
+int mbedtls_net_poller_add(mbedtls_net_poller *poller,
+                           const mbedtls_net_context *ctx,
+                           uint32_t rw, void *user_data);
+
+/**
+ * \brief          Remove a socket from a set.
+ *
+ * \note           Closing the socket with mbedtls_net_free() also removes
+ *                 it from all the sets it belongs to.
+ *
+ * \param poller   The set of sockets.
+ * \param ctx      The socket to remove.
+ *
+ * \return         0 if successful, or
+ *                 MBEDTLS_ERR_NET_POLL_FAILED on failure.
+ */
+int mbedtls_net_poller_remove(mbedtls_net_poller *poller,
+                              const mbedtls_net_context *ctx);
+
+/**
+ * \brief          Wait for events on a set of sockets.
+ *
+ *                 Errors and hangups are reported as readiness for both
+ *                 reading and writing, so that the next read or write
+ *                 returns the error.
+ *
+ * \param poller   The set of sockets.
+ * \param events   The array to fill with the events.
+ * \param max_events The size of \p events, in events. The function
+ *                 may report fewer events than are pending; the others
+ *                 are reported by the next call.
+ * \param timeout  Maximal amount of time to wait before returning,
+ *                 in milliseconds. If \c timeout is zero, the
+ *                 function returns immediately. If \c timeout is
+ *                 -1u, the function blocks potentially indefinitely.
+ *
+ * \return         The number of events written to \p events, which is 0
+ *                 on timeout or if interrupted by a signal, or
+ *                 MBEDTLS_ERR_NET_BAD_INPUT_DATA if \p max_events is 0, or
+ *                 MBEDTLS_ERR_NET_POLL_FAILED on failure.
+ */
+int mbedtls_net_poller_wait(mbedtls_net_poller *poller,
+                            mbedtls_net_poll_event *events,
+                            size_t max_events, uint32_t timeout);
+
+/**
+ * \brief          Free a set of sockets. The sockets themselves are not
+ *                 closed.
+ *
+ * \param poller   The set to free.
+ */
+void mbedtls_net_poller_free(mbedtls_net_poller *poller);
+#endif /* MBEDTLS_NET_POLLER_AVAILABLE */
+
 /**
  * \brief          Set the socket blocking
  *
@@ -203,6 +341,46 @@ int mbedtls_net_set_block(mbedtls_net_context *ctx);
  */
 int mbedtls_net_set_nonblock(mbedtls_net_context *ctx);
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+/**
+ * \brief          Hand over the record protection of one direction of a
+ *                 TLS connection to the Linux kernel TLS implementation.
+ *
+ *                 After this call, data is sent (for
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_TX) or received (for
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_RX) in plaintext with
+ *                 mbedtls_net_send(), mbedtls_net_recv() or other socket
+ *                 calls such as sendfile(), and the kernel encrypts or
+ *                 decrypts the records.
+ *
+ * \note           Calling this function again for the same direction
+ *                 installs new keys, for example after a TLS 1.3 KeyUpdate,
+ *                 see mbedtls_ssl_tls13_next_traffic_keys(). This requires
+ *                 a kernel that supports rekeying.
+ *
+ * \note           The kernel supports AES-128-GCM, AES-256-GCM, AES-128-CCM
+ *                 and ChaCha20-Poly1305 with a 16-byte tag, in TLS 1.2 and
+ *                 TLS 1.3. Received records other than application data,
+ *                 such as alerts, are reported by recvmsg() with a
+ *                 \c TLS_GET_RECORD_TYPE control message, and make plain
+ *                 recv() calls fail with \c EIO.
+ *
+ * \param ctx      The socket of the connection.
+ * \param direction #MBEDTLS_SSL_TRAFFIC_KEYS_TX or
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_RX.
+ * \param keys     The keys, as exported by mbedtls_ssl_export_traffic_keys()
+ *                 or mbedtls_ssl_tls13_next_traffic_keys().
+ *
+ * \return         0 if successful, or
+ *                 MBEDTLS_ERR_NET_BAD_INPUT_DATA if \p direction is invalid
+ *                 or the kernel does not support the cipher, or
+ *                 MBEDTLS_ERR_NET_KTLS_FAILED if the platform does not
+ *                 support kernel TLS or the socket could not be configured.
+ */
+int mbedtls_net_set_ktls(mbedtls_net_context *ctx, int direction,
+                         const mbedtls_ssl_traffic_keys *keys);
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 /**
  * \brief          Portable usleep helper
  *
@@ -246,9 +424,9 @@ int mbedtls_net_send(void *ctx, const unsigned char *buf, size_t len);
  *                 'timeout' seconds. If no error occurs, the actual amount
  *                 read is returned.
  *
- * \note           The current implementation of this function uses
- *                 select() and returns an error if the file descriptor
- *                 is \c FD_SETSIZE or greater.
+ * \note           On Windows, the current implementation of this function
+ *                 uses select(). On other platforms, it uses poll(), so
+ *                 any file descriptor number is supported.
  *
  * \param ctx      Socket
  * \param buf      The buffer to write to
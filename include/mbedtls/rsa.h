@@ -585,6 +585,52 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
                         const unsigned char *input,
                         unsigned char *output);
 
+/**
+ * \brief          This function performs a batch of RSA private key
+ *                 operations with the same key.
+ *
+ *                 Each operation is equivalent to a call to
+ *                 mbedtls_rsa_private() and produces the same output, but
+ *                 the context is locked only once, and the values that
+ *                 depend only on the key are computed once for the whole
+ *                 batch. Each operation still uses its own base and
+ *                 exponent blinding values, but the base blinding values
+ *                 are updated without a reduction modulo N, and are only
+ *                 converted back and stored in the context once per batch.
+ *                 This is faster than calling mbedtls_rsa_private() in a
+ *                 loop when signing or decrypting many inputs.
+ *
+ * \note           The operations of a batch run one after the other in the
+ *                 calling thread, and the context is locked for the whole
+ *                 batch. To spread work across several threads, give each
+ *                 thread its own copy of the context (see mbedtls_rsa_copy())
+ *                 and its own part of the batch.
+ *
+ * \note           On failure, the operations before the failing one have
+ *                 completed and their output is valid. The content of the
+ *                 other output buffers is unspecified.
+ *
+ * \param ctx      The initialized RSA context to use.
+ * \param f_rng    The RNG function, used for blinding. It is mandatory.
+ * \param p_rng    The RNG context to pass to \p f_rng. This may be \c NULL
+ *                 if \p f_rng doesn't need a context.
+ * \param count    The number of operations to perform. This may be \c 0.
+ * \param input    An array of \p count input buffers. Each must be a
+ *                 readable buffer of length \c ctx->len Bytes.
+ * \param output   An array of \p count output buffers. Each must be a
+ *                 writable buffer of length \c ctx->len Bytes. An output
+ *                 buffer may be the same as the corresponding input buffer.
+ *
+ * \return         \c 0 on success.
+ * \return         An \c MBEDTLS_ERR_RSA_XXX error code on failure.
+ */
+int mbedtls_rsa_private_batch(mbedtls_rsa_context *ctx,
+                              int (*f_rng)(void *, unsigned char *, size_t),
+                              void *p_rng,
+                              size_t count,
+                              const unsigned char *const input[],
+                              unsigned char *const output[]);
+
 /**
  * \brief          This function adds the message padding, then performs an RSA
  *                 operation.
@@ -167,6 +167,38 @@ int mbedtls_sha256(const unsigned char *input,
                    unsigned char *output,
                    int is224);
 
+/**
+ * \brief          This function calculates the SHA-224 or SHA-256
+ *                 checksums of several independent buffers.
+ *
+ *                 The result is the same as calling mbedtls_sha256() on
+ *                 each buffer. On x86-64 CPUs with AVX2, up to 8 buffers
+ *                 are hashed in parallel, one per SIMD lane, which is
+ *                 faster than hashing them one after the other when there
+ *                 are many short buffers.
+ *
+ * \param count    The number of buffers to hash.
+ * \param input    An array of \p count pointers to the buffers to hash.
+ *                 Buffer \c i must be readable and of length
+ *                 \p ilen[i] Bytes.
+ * \param ilen     An array of \p count input lengths in Bytes.
+ * \param output   An array of \p count pointers to the checksum results.
+ *                 Each one must be a writable buffer of length \c 32 bytes
+ *                 for SHA-256, \c 28 bytes for SHA-224. Output buffers
+ *                 must not overlap with each other or with the input
+ *                 buffers.
+ * \param is224    Determines which function to use. This must be
+ *                 either \c 0 for SHA-256, or \c 1 for SHA-224.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha256_batch(size_t count,
+                         const unsigned char *const input[],
+                         const size_t ilen[],
+                         unsigned char *const output[],
+                         int is224);
+
 #if defined(MBEDTLS_SELF_TEST)
 
 #if defined(MBEDTLS_SHA224_C)
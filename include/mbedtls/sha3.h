@@ -40,6 +40,8 @@ typedef enum {
     MBEDTLS_SHA3_256, /*!< SHA3-256 */
     MBEDTLS_SHA3_384, /*!< SHA3-384 */
     MBEDTLS_SHA3_512, /*!< SHA3-512 */
+    MBEDTLS_SHA3_SHAKE128, /*!< SHAKE128 */
+    MBEDTLS_SHA3_SHAKE256, /*!< SHAKE256 */
 } mbedtls_sha3_id;
 
 /**
@@ -52,6 +54,7 @@ typedef struct {
     uint32_t MBEDTLS_PRIVATE(index);
     uint16_t MBEDTLS_PRIVATE(olen);
     uint16_t MBEDTLS_PRIVATE(max_block_size);
+    uint8_t MBEDTLS_PRIVATE(squeezing);
 }
 mbedtls_sha3_context;
 
@@ -119,7 +122,8 @@ int mbedtls_sha3_update(mbedtls_sha3_context *ctx,
  *                 This must be a writable buffer of length \c olen bytes.
  * \param olen     Defines the length of output buffer (in bytes). For SHA-3 224, SHA-3 256,
  *                 SHA-3 384 and SHA-3 512 \c olen must equal to 28, 32, 48 and 64,
- *                 respectively.
+ *                 respectively. For SHAKE128 and SHAKE256, this is the number
+ *                 of output bytes, which can be any value.
  *
  * \return         \c 0 on success.
  * \return         A negative error code on failure.
@@ -127,6 +131,29 @@ int mbedtls_sha3_update(mbedtls_sha3_context *ctx,
 int mbedtls_sha3_finish(mbedtls_sha3_context *ctx,
                         uint8_t *output, size_t olen);
 
+/**
+ * \brief          This function extracts output from a SHAKE128 or
+ *                 SHAKE256 operation.
+ *
+ *                 The first call ends the input. It can be called any
+ *                 number of times, and the output of successive calls
+ *                 is the continuation of the output stream, as if it was
+ *                 extracted in one call. Call mbedtls_sha3_free() or
+ *                 mbedtls_sha3_starts() when done.
+ *
+ * \param ctx      The SHA-3 context. This must be initialized and have a
+ *                 SHAKE128 or SHAKE256 operation started.
+ * \param output   The buffer for the output.
+ *                 This must be a writable buffer of length \c olen bytes.
+ * \param olen     The number of bytes to extract.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_SHA3_BAD_INPUT_DATA if the operation is a
+ *                 SHA-3 hash with a fixed output length.
+ */
+int mbedtls_sha3_squeeze(mbedtls_sha3_context *ctx,
+                         uint8_t *output, size_t olen);
+
 /**
  * \brief          This function calculates the SHA-3
  *                 checksum of a buffer.
@@ -145,7 +172,8 @@ int mbedtls_sha3_finish(mbedtls_sha3_context *ctx,
  *                 This must be a writable buffer of length \c olen bytes.
  * \param olen     Defines the length of output buffer (in bytes). For SHA-3 224, SHA-3 256,
  *                 SHA-3 384 and SHA-3 512 \c olen must equal to 28, 32, 48 and 64,
- *                 respectively.
+ *                 respectively. For SHAKE128 and SHAKE256, this is the number
+ *                 of output bytes, which can be any value.
  *
  * \return         \c 0 on success.
  * \return         A negative error code on failure.
@@ -155,6 +183,32 @@ int mbedtls_sha3(mbedtls_sha3_id id, const uint8_t *input,
                  uint8_t *output,
                  size_t olen);
 
+/**
+ * \brief          This function calculates the SHA-3 checksum, or the
+ *                 SHAKE output, of four buffers of the same length.
+ *
+ *                 This gives the same results as four calls to
+ *                 mbedtls_sha3(), but where the CPU allows it, the four
+ *                 messages are processed in parallel, which is faster.
+ *                 This is the case on x86-64 CPUs with AVX2, and on Arm
+ *                 CPUs when the library is built with the Armv8.2 SHA3
+ *                 extension enabled.
+ *
+ * \param id       The id of the SHA-3 family.
+ * \param input    The four input buffers. Each must be a readable buffer
+ *                 of length \p ilen Bytes.
+ * \param ilen     The length of each input buffer in Bytes.
+ * \param output   The four output buffers. Each must be a writable
+ *                 buffer of length \c olen bytes.
+ * \param olen     The length of each output buffer, as for mbedtls_sha3().
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha3_x4(mbedtls_sha3_id id,
+                    const uint8_t *const input[4], size_t ilen,
+                    uint8_t *const output[4], size_t olen);
+
 #if defined(MBEDTLS_SELF_TEST)
 /**
  * \brief          Checkup routine for the algorithms implemented
@@ -177,6 +177,38 @@ int mbedtls_sha512(const unsigned char *input,
                    unsigned char *output,
                    int is384);
 
+/**
+ * \brief          This function calculates the SHA-384 or SHA-512
+ *                 checksums of several independent buffers.
+ *
+ *                 The result is the same as calling mbedtls_sha512() on
+ *                 each buffer. On x86-64 CPUs with AVX2, up to 4 buffers
+ *                 are hashed in parallel, one per SIMD lane, which is
+ *                 faster than hashing them one after the other when there
+ *                 are many short buffers.
+ *
+ * \param count    The number of buffers to hash.
+ * \param input    An array of \p count pointers to the buffers to hash.
+ *                 Buffer \c i must be readable and of length
+ *                 \p ilen[i] Bytes.
+ * \param ilen     An array of \p count input lengths in Bytes.
+ * \param output   An array of \p count pointers to the checksum results.
+ *                 Each one must be a writable buffer of length \c 64 bytes
+ *                 for SHA-512, \c 48 bytes for SHA-384. Output buffers
+ *                 must not overlap with each other or with the input
+ *                 buffers.
+ * \param is384    Determines which function to use. This must be either
+ *                 \c 0 for SHA-512, or \c 1 for SHA-384.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha512_batch(size_t count,
+                         const unsigned char *const input[],
+                         const size_t ilen[],
+                         unsigned char *const output[],
+                         int is384);
+
 #if defined(MBEDTLS_SELF_TEST)
 
 #if defined(MBEDTLS_SHA384_C)
@@ -40,6 +40,10 @@
 
 #include "psa/crypto.h"
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS) && defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
 /*
  * SSL Error codes
  */
@@ -320,6 +324,9 @@
 #define MBEDTLS_SSL_CERT_REQ_CA_LIST_ENABLED       1
 #define MBEDTLS_SSL_CERT_REQ_CA_LIST_DISABLED      0
 
+#define MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_DISABLED  0
+#define MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_ENABLED   1
+
 #define MBEDTLS_SSL_EARLY_DATA_DISABLED        0
 #define MBEDTLS_SSL_EARLY_DATA_ENABLED         1
 
@@ -378,6 +385,13 @@
 #define MBEDTLS_SSL_DTLS_MAX_BUFFERING 32768
 #endif
 
+/*
+ * Default maximum number of free buffers in a buffer pool.
+ */
+#if !defined(MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX)
+#define MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX 64
+#endif
+
 /*
  * Maximum length of CIDs for incoming and outgoing messages.
  */
@@ -938,6 +952,19 @@ typedef int mbedtls_ssl_cache_set_t(void *data,
  *                  `Ecdsa-Sig-Value` defined in
  *                  [RFC 4492 section 5.4](https://tools.ietf.org/html/rfc4492#section-5.4).
  *
+ * \note            In TLS 1.3, this callback is only called if it was
+ *                  enabled with mbedtls_ssl_conf_async_private_tls13(),
+ *                  for the signature in the server's CertificateVerify
+ *                  message, and \p hash is the hash of the content to sign
+ *                  with \p md_alg. The signature algorithm is then
+ *                  determined by the type of the key and \p md_alg: RSA
+ *                  signatures must be RSASSA-PSS signatures as specified in
+ *                  RFC 8446 section 4.2.3 (rsa_pss_rsae_xxx), in the same
+ *                  way as mbedtls_pk_sign_ext() with #MBEDTLS_PK_RSASSA_PSS,
+ *                  instead of PKCS#1 v1.5 signatures. Call
+ *                  mbedtls_ssl_get_version_number() to find out which
+ *                  protocol version is being negotiated.
+ *
  * \param ssl             The SSL connection instance. It should not be
  *                        modified other than via
  *                        mbedtls_ssl_set_async_operation_data().
@@ -1106,6 +1133,70 @@ typedef int mbedtls_ssl_async_resume_t(mbedtls_ssl_context *ssl,
 typedef void mbedtls_ssl_async_cancel_t(mbedtls_ssl_context *ssl);
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+/**
+ * \brief           Phases reported to the handshake profiling callback.
+ */
+typedef enum {
+    /** One call to mbedtls_ssl_handshake_step(), including all the other
+     *  phases that happen during that call.                              */
+    MBEDTLS_SSL_PROFILE_HANDSHAKE_STEP = 0,
+    /** (EC)DH(E) key pair generation or shared secret computation.       */
+    MBEDTLS_SSL_PROFILE_KEY_EXCHANGE,
+    /** Signature with the local private key.                             */
+    MBEDTLS_SSL_PROFILE_SIGN,
+    /** Verification of the signature made by the peer.                   */
+    MBEDTLS_SSL_PROFILE_VERIFY_SIGNATURE,
+    /** Verification of the peer's certificate chain.                     */
+    MBEDTLS_SSL_PROFILE_VERIFY_CHAIN,
+    /** Derivation of secrets and traffic keys (key schedule).            */
+    MBEDTLS_SSL_PROFILE_KEY_SCHEDULE,
+    /** Call to the send callback.                                        */
+    MBEDTLS_SSL_PROFILE_SEND,
+    /** Call to the receive callback.                                     */
+    MBEDTLS_SSL_PROFILE_RECV,
+    /** Number of phases; not a phase.                                    */
+    MBEDTLS_SSL_PROFILE_PHASE_COUNT
+} mbedtls_ssl_profile_phase;
+
+/**
+ * \brief           Callback type: handshake profiling event.
+ *
+ *                  This callback is called at the start and at the end of
+ *                  each phase listed in ::mbedtls_ssl_profile_phase. Phases
+ *                  nest: every phase other than
+ *                  #MBEDTLS_SSL_PROFILE_HANDSHAKE_STEP happens during a
+ *                  handshake step, except for #MBEDTLS_SSL_PROFILE_SEND and
+ *                  #MBEDTLS_SSL_PROFILE_RECV, which are also reported after
+ *                  the handshake.
+ *
+ *                  The library does not measure time itself: the callback
+ *                  is expected to read whatever clock suits the application
+ *                  (wall clock, CPU time, cycle counter) and keep its own
+ *                  statistics.
+ *
+ * \note            The callback must not call any function on \p ssl
+ *                  other than mbedtls_ssl_get_user_data_p() and
+ *                  mbedtls_ssl_get_user_data_n(), which may be used to
+ *                  find per-connection statistics.
+ *
+ * \param p_profile The opaque context set with
+ *                  mbedtls_ssl_conf_handshake_profile().
+ * \param ssl       The SSL context in which the event happens.
+ * \param phase     The phase that starts or ends.
+ * \param state     The handshake state (one of ::mbedtls_ssl_states).
+ *                  For #MBEDTLS_SSL_PROFILE_HANDSHAKE_STEP, this is the
+ *                  state processed by the step, both at the start and at the
+ *                  end of the step.
+ * \param end       \c 0 at the start of the phase, \c 1 at its end.
+ */
+typedef void mbedtls_ssl_profile_t(void *p_profile,
+                                   mbedtls_ssl_context *ssl,
+                                   mbedtls_ssl_profile_phase phase,
+                                   int state,
+                                   int end);
+#endif /* MBEDTLS_SSL_HANDSHAKE_PROFILING */
+
 #if defined(MBEDTLS_KEY_EXCHANGE_WITH_CERT_ENABLED) &&        \
     !defined(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE)
 #define MBEDTLS_SSL_PEER_CERT_DIGEST_MAX_LEN  48
@@ -1296,6 +1387,36 @@ typedef void mbedtls_ssl_export_keys_t(void *p_expkey,
                                        const unsigned char server_random[32],
                                        mbedtls_tls_prf_types tls_prf_type);
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+#define MBEDTLS_SSL_TRAFFIC_KEYS_TX             0   /*!< Keys protecting sent records     */
+#define MBEDTLS_SSL_TRAFFIC_KEYS_RX             1   /*!< Keys protecting received records */
+
+/**
+ * \brief          Record protection state for one direction of an
+ *                 established connection, as exported by
+ *                 mbedtls_ssl_export_traffic_keys().
+ *
+ *                 The layout follows the crypto information that the Linux
+ *                 kernel TLS implementation expects, see
+ *                 mbedtls_net_set_ktls().
+ */
+typedef struct mbedtls_ssl_traffic_keys {
+    mbedtls_ssl_protocol_version tls_version;   /*!< TLS 1.2 or TLS 1.3        */
+    mbedtls_cipher_type_t cipher;               /*!< The AEAD cipher           */
+    unsigned char key[32];                      /*!< The traffic key           */
+    size_t key_len;                             /*!< Length of \c key          */
+    unsigned char iv[12];                       /*!< The static IV: the 4-byte
+                                                     salt for TLS 1.2 AES-GCM
+                                                     and AES-CCM, or the full
+                                                     12-byte IV otherwise     */
+    size_t iv_len;                              /*!< Length of \c iv           */
+    size_t tag_len;                             /*!< Length of the AEAD tag    */
+    unsigned char rec_seq[8];                   /*!< Big-endian sequence number
+                                                     of the next record       */
+}
+mbedtls_ssl_traffic_keys;
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 #if defined(MBEDTLS_SSL_SRV_C)
 /**
  * \brief           Callback type: generic handshake callback
@@ -1326,6 +1447,23 @@ typedef union {
     void *p;                    /* typically a pointer to extra data */
 } mbedtls_ssl_user_data_t;
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+/**
+ * \brief          A pool of I/O buffers shared by the connections that
+ *                 release their buffers while idle, see
+ *                 mbedtls_ssl_release_buffers().
+ */
+typedef struct mbedtls_ssl_buffer_pool {
+    unsigned char *MBEDTLS_PRIVATE(head);   /*!< first free buffer         */
+    size_t MBEDTLS_PRIVATE(count);          /*!< number of free buffers    */
+    size_t MBEDTLS_PRIVATE(max_free);       /*!< maximum of free buffers   */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t MBEDTLS_PRIVATE(mutex);
+#endif
+}
+mbedtls_ssl_buffer_pool;
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 /**
  * SSL/TLS configuration to be shared between mbedtls_ssl_context structures.
  */
@@ -1392,6 +1530,10 @@ struct mbedtls_ssl_config {
     uint8_t MBEDTLS_PRIVATE(dtls_srtp_mki_support); /* support having mki_value
                                                        in the use_srtp extension? */
 #endif
+#if defined(MBEDTLS_SSL_ASYNC_PRIVATE) && defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    uint8_t MBEDTLS_PRIVATE(async_private_tls13); /*!< use the asynchronous
+                                                       sign callback in TLS 1.3? */
+#endif
 
     /*
      * Pointers
@@ -1409,6 +1551,12 @@ struct mbedtls_ssl_config {
     void(*MBEDTLS_PRIVATE(f_dbg))(void *, int, const char *, int, const char *);
     void *MBEDTLS_PRIVATE(p_dbg);                    /*!< context for the debug function     */
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+    /** Callback for handshake profiling events                             */
+    mbedtls_ssl_profile_t *MBEDTLS_PRIVATE(f_profile);
+    void *MBEDTLS_PRIVATE(p_profile);                /*!< context for the profiling callback */
+#endif
+
     /** Callback for getting (pseudo-)random numbers                        */
     int(*MBEDTLS_PRIVATE(f_rng))(void *, unsigned char *, size_t);
     void *MBEDTLS_PRIVATE(p_rng);                    /*!< context for the RNG function       */
@@ -1483,6 +1631,10 @@ struct mbedtls_ssl_config {
     void *MBEDTLS_PRIVATE(p_async_config_data); /*!< Configuration data set by mbedtls_ssl_conf_async_private_cb(). */
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    mbedtls_ssl_buffer_pool *MBEDTLS_PRIVATE(buffer_pool); /*!< pool for released buffers */
+#endif
+
 #if defined(MBEDTLS_SSL_HANDSHAKE_WITH_CERT_ENABLED)
 
 #if !defined(MBEDTLS_DEPRECATED_REMOVED)
@@ -1770,6 +1922,12 @@ struct mbedtls_ssl_context {
 
     unsigned char MBEDTLS_PRIVATE(cur_out_ctr)[MBEDTLS_SSL_SEQUENCE_NUMBER_LEN]; /*!<  Outgoing record sequence  number. */
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    unsigned char MBEDTLS_PRIVATE(in_ctr_saved)[MBEDTLS_SSL_SEQUENCE_NUMBER_LEN]; /*!< Incoming record
+                                                    sequence number while the
+                                                    buffers are released.    */
+#endif
+
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
     uint16_t MBEDTLS_PRIVATE(mtu);               /*!< path mtu, used to fragment outgoing messages */
 #endif /* MBEDTLS_SSL_PROTO_DTLS */
@@ -2083,6 +2241,22 @@ void mbedtls_ssl_conf_dbg(mbedtls_ssl_config *conf,
                           void (*f_dbg)(void *, int, const char *, int, const char *),
                           void  *p_dbg);
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+/**
+ * \brief          Set the handshake profiling callback.
+ *
+ *                 See ::mbedtls_ssl_profile_t for when the callback is
+ *                 called and with which arguments.
+ *
+ * \param conf     SSL configuration
+ * \param f_profile The profiling callback, or \c NULL to disable profiling.
+ * \param p_profile Opaque context passed to the callback.
+ */
+void mbedtls_ssl_conf_handshake_profile(mbedtls_ssl_config *conf,
+                                        mbedtls_ssl_profile_t *f_profile,
+                                        void *p_profile);
+#endif /* MBEDTLS_SSL_HANDSHAKE_PROFILING */
+
 /**
  * \brief          Return the SSL configuration structure associated
  *                 with the given SSL context.
@@ -2743,6 +2917,26 @@ void mbedtls_ssl_conf_async_private_cb(mbedtls_ssl_config *conf,
                                        mbedtls_ssl_async_cancel_t *f_async_cancel,
                                        void *config_data);
 
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+/**
+ * \brief           Enable or disable the asynchronous sign callback in
+ *                  TLS 1.3 handshakes (server only).
+ *
+ *                  A TLS 1.3 server signs its CertificateVerify message
+ *                  with RSASSA-PSS when its key is an RSA key, whereas the
+ *                  TLS 1.2 signatures that the sign callback has always
+ *                  computed are PKCS#1 v1.5 signatures. So the callback is
+ *                  only called in TLS 1.3 once the application declares
+ *                  that it supports this. See ::mbedtls_ssl_async_sign_t.
+ *
+ * \param conf      SSL configuration context
+ * \param enable    #MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_ENABLED or
+ *                  #MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_DISABLED (the default)
+ */
+void mbedtls_ssl_conf_async_private_tls13(mbedtls_ssl_config *conf,
+                                          int enable);
+#endif /* MBEDTLS_SSL_PROTO_TLS1_3 */
+
 /**
  * \brief           Retrieve the configuration data set by
  *                  mbedtls_ssl_conf_async_private_cb().
@@ -4999,6 +5193,73 @@ int mbedtls_ssl_send_alert_message(mbedtls_ssl_context *ssl,
  */
 int mbedtls_ssl_close_notify(mbedtls_ssl_context *ssl);
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+/**
+ * \brief          Free the input and output buffers of an idle connection.
+ *
+ *                 The buffers are allocated again, from the pool configured
+ *                 with mbedtls_ssl_conf_buffer_pool() if any, by the next
+ *                 call to a function that uses them, such as
+ *                 mbedtls_ssl_read(), mbedtls_ssl_write(),
+ *                 mbedtls_ssl_close_notify() or mbedtls_ssl_session_reset().
+ *                 These functions then return #MBEDTLS_ERR_SSL_ALLOC_FAILED
+ *                 if the allocation fails, and the call can be retried later.
+ *
+ * \note           A typical event-driven server calls this function when
+ *                 mbedtls_ssl_read() returns #MBEDTLS_ERR_SSL_WANT_READ and
+ *                 nothing is left to send, and calls mbedtls_ssl_read() again
+ *                 when the socket becomes readable.
+ *
+ * \param ssl      The SSL context. The handshake must be complete.
+ *
+ * \return         \c 0 if successful, including if the buffers were
+ *                 already released.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if a handshake is in
+ *                 progress, or there is pending data for reading or sending.
+ * \return         #MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE if the connection
+ *                 uses DTLS.
+ */
+int mbedtls_ssl_release_buffers(mbedtls_ssl_context *ssl);
+
+/**
+ * \brief          Set the pool that released buffers are returned to and
+ *                 taken from. The pool may be shared by several
+ *                 configurations and threads.
+ *
+ * \param conf     The SSL configuration.
+ * \param pool     The buffer pool, or \c NULL to allocate buffers with
+ *                 mbedtls_calloc() each time (default). It must remain valid
+ *                 until all the contexts using \p conf have been freed.
+ */
+void mbedtls_ssl_conf_buffer_pool(mbedtls_ssl_config *conf,
+                                  mbedtls_ssl_buffer_pool *pool);
+
+/**
+ * \brief          Initialize a buffer pool. The pool keeps up to
+ *                 #MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX free buffers.
+ *
+ * \param pool     The pool to initialize.
+ */
+void mbedtls_ssl_buffer_pool_init(mbedtls_ssl_buffer_pool *pool);
+
+/**
+ * \brief          Set the maximum number of free buffers that the pool
+ *                 keeps. Buffers returned to a full pool are freed.
+ *
+ * \param pool     The pool, not yet in use.
+ * \param max_free The maximum number of free buffers.
+ */
+void mbedtls_ssl_buffer_pool_set_max_free(mbedtls_ssl_buffer_pool *pool,
+                                          size_t max_free);
+
+/**
+ * \brief          Free a buffer pool and the free buffers it holds.
+ *
+ * \param pool     The pool to free. No context may use it any more.
+ */
+void mbedtls_ssl_buffer_pool_free(mbedtls_ssl_buffer_pool *pool);
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 #if defined(MBEDTLS_SSL_EARLY_DATA)
 
 #if defined(MBEDTLS_SSL_SRV_C)
@@ -5286,6 +5547,76 @@ int mbedtls_ssl_context_load(mbedtls_ssl_context *ssl,
                              size_t len);
 #endif /* MBEDTLS_SSL_CONTEXT_SERIALIZATION */
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+/**
+ * \brief          Export the record protection keys of an established
+ *                 connection, in order to hand over the record layer to
+ *                 another implementation such as the Linux kernel TLS.
+ *
+ * \see            mbedtls_net_set_ktls()
+ *
+ * \note           The exported state is only valid as long as no record is
+ *                 sent (for #MBEDTLS_SSL_TRAFFIC_KEYS_TX) or received (for
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_RX) with \p ssl. Once the keys
+ *                 have been handed over, the application must no longer call
+ *                 mbedtls_ssl_write() or mbedtls_ssl_read() respectively,
+ *                 except that mbedtls_ssl_free() may be called as usual.
+ *
+ * \note           With TLS 1.3, the server sends NewSessionTicket messages
+ *                 after the handshake. If the client exports its receive keys
+ *                 before reading them with mbedtls_ssl_read(), they are
+ *                 delivered by the other implementation as handshake records.
+ *
+ * \param ssl      The SSL context. The handshake must be complete.
+ * \param direction #MBEDTLS_SSL_TRAFFIC_KEYS_TX or
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_RX.
+ * \param keys     The structure to fill.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the handshake is not
+ *                 complete, or there is pending data for reading or sending.
+ * \return         #MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE if the connection
+ *                 uses DTLS or does not use an AEAD ciphersuite.
+ */
+int mbedtls_ssl_export_traffic_keys(const mbedtls_ssl_context *ssl,
+                                    int direction,
+                                    mbedtls_ssl_traffic_keys *keys);
+
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+/**
+ * \brief          Derive the keys for one direction of a TLS 1.3
+ *                 connection after a KeyUpdate message (RFC 8446 §7.2).
+ *
+ *                 The application traffic secret of the given direction is
+ *                 replaced by the next one, and \p keys is filled with the
+ *                 keys derived from it, with a sequence number of 0.
+ *
+ * \note           This function is meant for connections whose record layer
+ *                 has been handed over with mbedtls_ssl_export_traffic_keys().
+ *                 The transforms used by \p ssl are not updated, so \p ssl
+ *                 must not be used to send or receive records any more. The
+ *                 KeyUpdate messages themselves are sent and received by the
+ *                 application: call this function for
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_TX after sending a KeyUpdate, and
+ *                 for #MBEDTLS_SSL_TRAFFIC_KEYS_RX after receiving one.
+ *
+ * \param ssl      The SSL context. The handshake must be complete and must
+ *                 have negotiated TLS 1.3.
+ * \param direction #MBEDTLS_SSL_TRAFFIC_KEYS_TX or
+ *                 #MBEDTLS_SSL_TRAFFIC_KEYS_RX.
+ * \param keys     The structure to fill.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_SSL_BAD_INPUT_DATA if the handshake is not
+ *                 complete or the connection does not use TLS 1.3.
+ * \return         Another negative error code on failure.
+ */
+int mbedtls_ssl_tls13_next_traffic_keys(mbedtls_ssl_context *ssl,
+                                        int direction,
+                                        mbedtls_ssl_traffic_keys *keys);
+#endif /* MBEDTLS_SSL_PROTO_TLS1_3 */
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 /**
  * \brief          Initialize an SSL configuration context
  *                 Just makes the context ready for
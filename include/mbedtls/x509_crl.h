@@ -63,7 +63,7 @@ mbedtls_x509_crl_entry;
  */
 typedef struct mbedtls_x509_crl {
     mbedtls_x509_buf raw;           /**< The raw certificate data (DER). */
-    mbedtls_x509_buf tbs;           /**< The raw certificate body (DER). The part that is To Be Signed. */
+    mbedtls_x509_buf tbs;           /**< The raw certificate body (DER). The part that is To Be Signed. For a CRL parsed with mbedtls_x509_crl_parse_stream(), the body without its entries. */
 
     int version;            /**< CRL version (1=v1, 2=v2) */
     mbedtls_x509_buf sig_oid;       /**< CRL signature type identifier */
@@ -89,6 +89,10 @@ typedef struct mbedtls_x509_crl {
      * \p NULL indicates the end of the list.
      * Do not modify this field directly. */
     struct mbedtls_x509_crl *next;
+
+    unsigned char *MBEDTLS_PRIVATE(tbs_hash);    /**< Hash of the original body of a CRL parsed with mbedtls_x509_crl_parse_stream(), or NULL */
+    size_t MBEDTLS_PRIVATE(tbs_hash_len);        /**< Length of tbs_hash, or 0 if the CRL was parsed whole */
+    size_t MBEDTLS_PRIVATE(raw_map_len);         /**< Size of the file mapping that \c raw points to, or 0 if \c raw is a heap buffer */
 }
 mbedtls_x509_crl;
 
@@ -144,6 +148,85 @@ int mbedtls_x509_crl_parse(mbedtls_x509_crl *chain, const unsigned char *buf, si
 int mbedtls_x509_crl_parse_file(mbedtls_x509_crl *chain, const char *path);
 #endif /* MBEDTLS_FS_IO */
 
+/**
+ * \brief          Callback type: receive an entry of a CRL parsed with
+ *                 mbedtls_x509_crl_parse_stream().
+ *
+ * \param p_entry  The context passed to mbedtls_x509_crl_parse_stream().
+ * \param entry    The entry. Its \c next field is \c NULL. The entry and
+ *                 the data it points to are only valid until the callback
+ *                 returns.
+ *
+ * \return         \c 0 to continue parsing. Any other value aborts
+ *                 mbedtls_x509_crl_parse_stream(), which returns it.
+ */
+typedef int mbedtls_x509_crl_entry_cb_t(void *p_entry,
+                                        const mbedtls_x509_crl_entry *entry);
+
+/**
+ * \brief          Parse a DER-encoded CRL read incrementally, pass its
+ *                 entries to a callback and append the rest of it to the
+ *                 chained list.
+ *
+ *                 The memory used does not depend on the number of
+ *                 entries: the CRL is read in chunks, each entry is passed
+ *                 to \p f_entry and then discarded, and the body of the
+ *                 CRL is hashed as it is read. The entries of the CRL added
+ *                 to the chain are therefore empty. Apart from the list of
+ *                 entries, each element of the CRL, and each entry, must
+ *                 fit in 4096 bytes.
+ *
+ * \note           The entries are passed to \p f_entry before the end of
+ *                 the CRL has been parsed. Discard them if this function
+ *                 fails, and check the signature of the CRL with
+ *                 mbedtls_x509_crl_verify() before relying on them.
+ *
+ * \note           mbedtls_x509_crt_verify() cannot check the revocation
+ *                 status of a certificate against a CRL parsed with this
+ *                 function. It reports such a CRL issued by the CA of the
+ *                 certificate as untrusted (#MBEDTLS_X509_BADCRL_NOT_TRUSTED).
+ *
+ * \note           If #MBEDTLS_USE_PSA_CRYPTO is enabled, the PSA crypto
+ *                 subsystem must have been initialized by calling
+ *                 psa_crypto_init() before calling this function.
+ *
+ * \param chain    points to the start of the chain
+ * \param f_read   The callback that reads the CRL. This function reads
+ *                 exactly one CRL, in DER format, and nothing after it.
+ * \param p_read   The context passed to \p f_read.
+ * \param f_entry  The callback that receives the entries, or \c NULL to
+ *                 only check their format.
+ * \param p_entry  The context passed to \p f_entry.
+ *
+ * \return         0 if successful, a specific X509 or ASN1 error code, or
+ *                 an error returned by \p f_read or \p f_entry.
+ */
+int mbedtls_x509_crl_parse_stream(mbedtls_x509_crl *chain,
+                                  mbedtls_asn1_stream_read_t *f_read,
+                                  void *p_read,
+                                  mbedtls_x509_crl_entry_cb_t *f_entry,
+                                  void *p_entry);
+
+#if defined(MBEDTLS_FS_IO)
+/**
+ * \brief          Load a DER-encoded CRL with
+ *                 mbedtls_x509_crl_parse_stream().
+ *
+ * \param chain    points to the start of the chain
+ * \param path     filename to read the CRL from (in DER encoding)
+ * \param f_entry  The callback that receives the entries, or \c NULL to
+ *                 only check their format.
+ * \param p_entry  The context passed to \p f_entry.
+ *
+ * \return         0 if successful, or an error code as for
+ *                 mbedtls_x509_crl_parse_stream().
+ */
+int mbedtls_x509_crl_parse_file_stream(mbedtls_x509_crl *chain,
+                                       const char *path,
+                                       mbedtls_x509_crl_entry_cb_t *f_entry,
+                                       void *p_entry);
+#endif /* MBEDTLS_FS_IO */
+
 #if !defined(MBEDTLS_X509_REMOVE_INFO)
 /**
  * \brief          Returns an informational string about the CRL.
@@ -88,6 +88,8 @@ typedef struct mbedtls_x509_crt {
      * \p NULL indicates the end of the list.
      * Do not modify this field directly. */
     struct mbedtls_x509_crt *next;
+
+    size_t MBEDTLS_PRIVATE(raw_map_len);         /**< Size of the file mapping that \c raw points to, or 0 if \c raw is a heap buffer */
 }
 mbedtls_x509_crt;
 
@@ -866,10 +868,50 @@ int mbedtls_x509_crt_check_extended_key_usage(const mbedtls_x509_crt *crt,
  * \param crt      a certificate to be verified
  * \param crl      the CRL to verify against
  *
- * \return         1 if the certificate is revoked, 0 otherwise
+ * \return         1 if the certificate is revoked, 0 otherwise.
+ *                 If \p crl was parsed with mbedtls_x509_crl_parse_stream(),
+ *                 which does not keep the list of revoked certificates,
+ *                 this function always returns 1: the revocation status
+ *                 must then be checked from the entries passed to the
+ *                 callback of mbedtls_x509_crl_parse_stream().
  *
  */
 int mbedtls_x509_crt_is_revoked(const mbedtls_x509_crt *crt, const mbedtls_x509_crl *crl);
+
+/**
+ * \brief          Verify that a CRL is signed by a trusted CA and is
+ *                 current.
+ *
+ *                 This is the check that mbedtls_x509_crt_verify() does on
+ *                 the CRLs of the CAs in a chain, without a certificate.
+ *                 In particular it can check a CRL parsed with
+ *                 mbedtls_x509_crl_parse_stream() before its entries are
+ *                 used.
+ *
+ * \note           The CA is taken from \p trust_ca as is: its own
+ *                 validity is not checked.
+ *
+ * \param crl      The CRL to verify. Only the first CRL of the chain is
+ *                 verified.
+ * \param trust_ca The list of trusted CAs. The CRL is checked against the
+ *                 first one whose subject is the issuer of the CRL.
+ * \param profile  The security profile to use for the verification.
+ * \param flags    The address at which to store the result of the
+ *                 verification: a combination of the
+ *                 MBEDTLS_X509_BADCRL_XXX flags and
+ *                 #MBEDTLS_X509_BADCERT_BAD_KEY, or \c 0 if the CRL is
+ *                 trusted. #MBEDTLS_X509_BADCRL_NOT_TRUSTED is set if no CA
+ *                 in \p trust_ca issued the CRL.
+ *
+ * \return         \c 0 if the CRL is trusted.
+ * \return         #MBEDTLS_ERR_X509_CERT_VERIFY_FAILED if \p flags is not
+ *                 \c 0.
+ * \return         Another negative error code in case of a fatal error.
+ */
+int mbedtls_x509_crl_verify(const mbedtls_x509_crl *crl,
+                            mbedtls_x509_crt *trust_ca,
+                            const mbedtls_x509_crt_profile *profile,
+                            uint32_t *flags);
 #endif /* MBEDTLS_X509_CRL_PARSE_C */
 
 /**
@@ -43,11 +43,11 @@ typedef struct {
     psa_algorithm_t MBEDTLS_PRIVATE(alg);
     /** The hash context. */
     struct psa_hash_operation_s hash_ctx;
-    /** The HMAC part of the context. */
-    uint8_t MBEDTLS_PRIVATE(opad)[PSA_HMAC_MAX_HASH_BLOCK_SIZE];
+    /** The outer hash context, which has already processed the opad. */
+    struct psa_hash_operation_s MBEDTLS_PRIVATE(outer_ctx);
 } mbedtls_psa_hmac_operation_t;
 
-#define MBEDTLS_PSA_HMAC_OPERATION_INIT { 0, PSA_HASH_OPERATION_INIT, { 0 } }
+#define MBEDTLS_PSA_HMAC_OPERATION_INIT { 0, PSA_HASH_OPERATION_INIT, PSA_HASH_OPERATION_INIT }
 #endif /* MBEDTLS_PSA_BUILTIN_ALG_HMAC */
 
 typedef struct {
@@ -464,4 +464,292 @@ const mbedtls_asn1_named_data *mbedtls_asn1_find_named_data(const mbedtls_asn1_n
     return list;
 }
 
+/*
+ * Incremental reading of a DER encoding
+ */
+int mbedtls_asn1_stream_setup(mbedtls_asn1_stream *s,
+                              mbedtls_asn1_stream_read_t *f_read,
+                              void *p_read,
+                              size_t size)
+{
+    memset(s, 0, sizeof(*s));
+
+    /* One tag byte and up to five length bytes */
+    if (size < 6) {
+        return MBEDTLS_ERR_ASN1_BUF_TOO_SMALL;
+    }
+
+    s->buf = mbedtls_calloc(1, size);
+    if (s->buf == NULL) {
+        return MBEDTLS_ERR_ASN1_ALLOC_FAILED;
+    }
+
+    s->size = size;
+    s->f_read = f_read;
+    s->p_read = p_read;
+
+    return 0;
+}
+
+void mbedtls_asn1_stream_free(mbedtls_asn1_stream *s)
+{
+    if (s->buf != NULL) {
+        mbedtls_zeroize_and_free(s->buf, s->size);
+    }
+
+    mbedtls_platform_zeroize(s, sizeof(*s));
+}
+
+void mbedtls_asn1_stream_set_tap(mbedtls_asn1_stream *s,
+                                 mbedtls_asn1_stream_tap_t *f_tap,
+                                 void *p_tap)
+{
+    s->f_tap = f_tap;
+    s->p_tap = p_tap;
+}
+
+size_t mbedtls_asn1_stream_offset(const mbedtls_asn1_stream *s)
+{
+    return s->offset;
+}
+
+/*
+ * Make sure that the next n bytes of the input are in the window.
+ * The caller checks that n fits in the window.
+ */
+static int asn1_stream_fill(mbedtls_asn1_stream *s, size_t n)
+{
+    int ret;
+
+    if (s->end - s->start >= n) {
+        return 0;
+    }
+
+    if (s->start != 0) {
+        memmove(s->buf, s->buf + s->start, s->end - s->start);
+        s->end -= s->start;
+        s->start = 0;
+    }
+
+    while (s->end < n) {
+        if (s->eof) {
+            return MBEDTLS_ERR_ASN1_OUT_OF_DATA;
+        }
+
+        ret = s->f_read(s->p_read, s->buf + s->end, s->size - s->end);
+        if (ret < 0) {
+            return ret;
+        }
+        if (ret == 0) {
+            s->eof = 1;
+        }
+        s->end += (size_t) ret;
+    }
+
+    return 0;
+}
+
+static int asn1_stream_consume(mbedtls_asn1_stream *s, size_t n)
+{
+    int ret;
+
+    if (s->f_tap != NULL) {
+        if ((ret = s->f_tap(s->p_tap, s->buf + s->start, n)) != 0) {
+            return ret;
+        }
+    }
+
+    s->start += n;
+    s->offset += n;
+
+    return 0;
+}
+
+/*
+ * Decode the header of the next element without consuming it.
+ */
+static int asn1_stream_get_header(mbedtls_asn1_stream *s, int *tag,
+                                  size_t *hlen, size_t *len)
+{
+    int ret;
+    const unsigned char *p;
+    size_t n;
+
+    if ((ret = asn1_stream_fill(s, 2)) != 0) {
+        return ret;
+    }
+
+    p = s->buf + s->start;
+    if ((p[1] & 0x80) == 0) {
+        n = 0;
+        *len = p[1];
+    } else {
+        n = p[1] & 0x7F;
+        if (n == 0 || n > 4) {
+            return MBEDTLS_ERR_ASN1_INVALID_LENGTH;
+        }
+        if ((ret = asn1_stream_fill(s, 2 + n)) != 0) {
+            return ret;
+        }
+        p = s->buf + s->start;
+        *len = 0;
+        for (size_t i = 0; i < n; i++) {
+            *len = (*len << 8) | p[2 + i];
+        }
+    }
+
+    *tag = p[0];
+    *hlen = 2 + n;
+
+    return 0;
+}
+
+int mbedtls_asn1_stream_peek_tag(mbedtls_asn1_stream *s, int *tag)
+{
+    int ret;
+
+    if ((ret = asn1_stream_fill(s, 1)) != 0) {
+        return ret;
+    }
+
+    *tag = s->buf[s->start];
+
+    return 0;
+}
+
+int mbedtls_asn1_stream_get_tag(mbedtls_asn1_stream *s,
+                                size_t *len, int tag)
+{
+    int ret;
+    int actual_tag;
+    size_t hlen;
+
+    if ((ret = mbedtls_asn1_stream_peek_tag(s, &actual_tag)) != 0) {
+        return ret;
+    }
+
+    if (actual_tag != tag) {
+        return MBEDTLS_ERR_ASN1_UNEXPECTED_TAG;
+    }
+
+    if ((ret = asn1_stream_get_header(s, &actual_tag, &hlen, len)) != 0) {
+        return ret;
+    }
+
+    return asn1_stream_consume(s, hlen);
+}
+
+int mbedtls_asn1_stream_get_element(mbedtls_asn1_stream *s,
+                                    unsigned char **p, size_t *len)
+{
+    int ret;
+    int tag;
+    size_t hlen, content_len;
+
+    if ((ret = asn1_stream_get_header(s, &tag, &hlen, &content_len)) != 0) {
+        return ret;
+    }
+
+    if (content_len > s->size - hlen) {
+        return MBEDTLS_ERR_ASN1_BUF_TOO_SMALL;
+    }
+
+    if ((ret = asn1_stream_fill(s, hlen + content_len)) != 0) {
+        return ret;
+    }
+
+    *p = s->buf + s->start;
+    *len = hlen + content_len;
+
+    return asn1_stream_consume(s, *len);
+}
+
+int mbedtls_asn1_stream_skip(mbedtls_asn1_stream *s, size_t len)
+{
+    int ret;
+    size_t n;
+
+    while (len > 0) {
+        if (s->start == s->end &&
+            (ret = asn1_stream_fill(s, 1)) != 0) {
+            return ret;
+        }
+
+        n = s->end - s->start;
+        if (n > len) {
+            n = len;
+        }
+
+        if ((ret = asn1_stream_consume(s, n)) != 0) {
+            return ret;
+        }
+
+        len -= n;
+    }
+
+    return 0;
+}
+
+int mbedtls_asn1_stream_traverse_sequence_of(
+    mbedtls_asn1_stream *s,
+    unsigned char tag_must_mask, unsigned char tag_must_val,
+    unsigned char tag_may_mask, unsigned char tag_may_val,
+    int (*cb)(void *ctx, int tag,
+              unsigned char *start, size_t len),
+    void *ctx)
+{
+    int ret;
+    int tag;
+    size_t len, hlen, end;
+    unsigned char *content;
+
+    /* Get main sequence tag */
+    if ((ret = mbedtls_asn1_stream_get_tag(s, &len,
+                                           MBEDTLS_ASN1_CONSTRUCTED |
+                                           MBEDTLS_ASN1_SEQUENCE)) != 0) {
+        return ret;
+    }
+
+    end = s->offset + len;
+
+    while (s->offset < end) {
+        if ((ret = asn1_stream_get_header(s, &tag, &hlen, &len)) != 0) {
+            return ret;
+        }
+
+        if ((tag & tag_must_mask) != tag_must_val) {
+            return MBEDTLS_ERR_ASN1_UNEXPECTED_TAG;
+        }
+
+        if (hlen > end - s->offset || len > end - s->offset - hlen) {
+            return MBEDTLS_ERR_ASN1_LENGTH_MISMATCH;
+        }
+
+        if (cb == NULL || (tag & tag_may_mask) != tag_may_val) {
+            if ((ret = asn1_stream_consume(s, hlen)) != 0 ||
+                (ret = mbedtls_asn1_stream_skip(s, len)) != 0) {
+                return ret;
+            }
+            continue;
+        }
+
+        if (len > s->size - hlen) {
+            return MBEDTLS_ERR_ASN1_BUF_TOO_SMALL;
+        }
+
+        if ((ret = asn1_stream_fill(s, hlen + len)) != 0) {
+            return ret;
+        }
+
+        content = s->buf + s->start + hlen;
+
+        if ((ret = asn1_stream_consume(s, hlen + len)) != 0 ||
+            (ret = cb(ctx, tag, content, len)) != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 #endif /* MBEDTLS_ASN1_PARSE_C */
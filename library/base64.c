@@ -14,6 +14,7 @@
 #include "mbedtls/base64.h"
 #include "base64_internal.h"
 #include "constant_time_internal.h"
+#include "cpu_features.h"
 
 #include <stdint.h>
 
@@ -22,6 +23,20 @@
 #include "mbedtls/platform.h"
 #endif /* MBEDTLS_SELF_TEST */
 
+/*
+ * Decoding with AVX2 on x86-64, 32 digits at a time. The digits are
+ * translated with byte shuffles inside registers rather than with a table
+ * in memory, so this is as constant-time as mbedtls_ct_base64_dec_value().
+ * The function that uses AVX2 has a target attribute, so the library does
+ * not need to be built with -mavx2, and it is only called if the CPU and the
+ * OS support AVX2.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64)
+#define MBEDTLS_BASE64_DECODE_AVX2
+#include <immintrin.h>
+#endif
+
 MBEDTLS_STATIC_TESTABLE
 unsigned char mbedtls_ct_base64_enc_char(unsigned char value)
 {
@@ -122,22 +137,144 @@ int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen,
     return 0;
 }
 
+#if defined(MBEDTLS_BASE64_DECODE_AVX2)
 /*
- * Decode a base64-formatted buffer
+ * Decode 32 base64 digits from src into 24 bytes at dst.
+ * Return 0 without writing anything if one of the characters is not a
+ * base64 digit (including '=' and white space).
+ *
+ * The high nibble of each character selects a set of bits in lut_hi and its
+ * low nibble in lut_lo: the two sets intersect for invalid characters
+ * only. The high nibble then selects the offset from the character to its
+ * value, with a special case for '/', which has the same high nibble as '+'.
  */
-int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
-                          const unsigned char *src, size_t slen)
+__attribute__((target("avx2")))
+static int base64_decode_avx2(unsigned char *dst, const unsigned char *src)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+    __m256i in, hi_nibbles, lo_nibbles, roll, out;
+
+    in = _mm256_loadu_si256((const __m256i *) src);
+    hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+    lo_nibbles = _mm256_and_si256(in, mask_2f);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles),
+                            _mm256_shuffle_epi8(lut_hi, hi_nibbles))) {
+        return 0;
+    }
+    roll = _mm256_shuffle_epi8(lut_roll,
+                               _mm256_add_epi8(_mm256_cmpeq_epi8(in, mask_2f),
+                                               hi_nibbles));
+    in = _mm256_add_epi8(in, roll);
+
+    /* Each 32-bit lane now holds four 6-bit values a, b, c, d: merge them
+     * into (a << 18) | (b << 12) | (c << 6) | d and keep the three
+     * significant bytes of each lane, in big-endian order. */
+    out = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+    out = _mm256_madd_epi16(out, _mm256_set1_epi32(0x00011000));
+    out = _mm256_shuffle_epi8(out, _mm256_setr_epi8(
+                                  2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                  2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    out = _mm256_permutevar8x32_epi32(out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm_storeu_si128((__m128i *) dst, _mm256_castsi256_si128(out));
+    _mm_storel_epi64((__m128i *) (dst + 16), _mm256_extracti128_si256(out, 1));
+
+    return 1;
+}
+#endif /* MBEDTLS_BASE64_DECODE_AVX2 */
+
+/*
+ * Decode 4 base64 digits from src into 3 bytes at dst.
+ * Return 0 without writing anything if one of the characters is not a
+ * base64 digit (including '=' and white space).
+ */
+static int base64_decode_quad(unsigned char *dst, const unsigned char *src)
+{
+    signed char a = mbedtls_ct_base64_dec_value(src[0]);
+    signed char b = mbedtls_ct_base64_dec_value(src[1]);
+    signed char c = mbedtls_ct_base64_dec_value(src[2]);
+    signed char d = mbedtls_ct_base64_dec_value(src[3]);
+    uint32_t x;
+
+    if ((a | b | c | d) < 0) {
+        return 0;
+    }
+
+    x = ((uint32_t) a << 18) | ((uint32_t) b << 12) |
+        ((uint32_t) c << 6) | (uint32_t) d;
+    dst[0] = MBEDTLS_BYTE_2(x);
+    dst[1] = MBEDTLS_BYTE_1(x);
+    dst[2] = MBEDTLS_BYTE_0(x);
+
+    return 1;
+}
+
+/*
+ * Number of bytes encoded by n base64 digits, computed without risk of
+ * integer overflow in n:
+ *     ( ( n * 6 ) + 7 ) >> 3
+ */
+static size_t base64_decoded_len(size_t n)
+{
+    return (6 * (n >> 3)) + ((6 * (n & 0x7) + 7) >> 3);
+}
+
+/*
+ * Validate src and decode it into the first room bytes of dst.
+ *
+ * Runs of digits between line breaks are decoded in blocks, the rest one
+ * character at a time. Once the output does not fit in room bytes, the
+ * rest of the input is only validated. On success, *needed is the length
+ * of the decoded data and *written the number of bytes written to dst.
+ */
+static int base64_decode_pass(unsigned char *dst, size_t room,
+                              size_t *needed, size_t *written_out,
+                              const unsigned char *src, size_t slen)
 {
     size_t i; /* index in source */
-    size_t n; /* number of digits or trailing = in source */
-    uint32_t x; /* value accumulator */
+    size_t n = 0; /* number of digits or trailing = in source */
+    size_t written = 0; /* number of bytes written to dst */
+    size_t k;
+    uint32_t x = 0; /* value accumulator */
     unsigned accumulated_digits = 0;
     unsigned equals = 0;
     int spaces_present = 0;
-    unsigned char *p;
+    signed char value;
+#if defined(MBEDTLS_BASE64_DECODE_AVX2)
+    const int use_avx2 = mbedtls_cpu_has_avx2();
+#endif
+
+    for (i = 0; i < slen; i++) {
+        /* Decode whole groups of digits while there are some */
+        if (accumulated_digits == 0 && equals == 0) {
+#if defined(MBEDTLS_BASE64_DECODE_AVX2)
+            while (use_avx2 && slen - i >= 32 && room - written >= 24 &&
+                   base64_decode_avx2(dst + written, src + i)) {
+                i += 32;
+                n += 32;
+                written += 24;
+            }
+#endif
+            while (slen - i >= 4 && room - written >= 3 &&
+                   base64_decode_quad(dst + written, src + i)) {
+                i += 4;
+                n += 4;
+                written += 3;
+            }
+        }
 
-    /* First pass: check for validity and get output length */
-    for (i = n = 0; i < slen; i++) {
         /* Skip spaces before checking for EOL */
         spaces_present = 0;
         while (i < slen && src[i] == ' ') {
@@ -168,6 +305,7 @@ int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
             return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
         }
 
+        x = x << 6;
         if (src[i] == '=') {
             if (++equals > 2) {
                 return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
@@ -176,56 +314,84 @@ int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
             if (equals != 0) {
                 return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
             }
-            if (mbedtls_ct_base64_dec_value(src[i]) < 0) {
+            value = mbedtls_ct_base64_dec_value(src[i]);
+            if (value < 0) {
                 return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
             }
+            x |= (uint32_t) value;
         }
         n++;
+
+        if (++accumulated_digits == 4) {
+            accumulated_digits = 0;
+            k = 3 - equals;
+            if (room - written >= k) {
+                dst[written++] = MBEDTLS_BYTE_2(x);
+                if (equals <= 1) {
+                    dst[written++] = MBEDTLS_BYTE_1(x);
+                }
+                if (equals <= 0) {
+                    dst[written++] = MBEDTLS_BYTE_0(x);
+                }
+            } else {
+                /* The output is too small: keep validating only */
+                room = written;
+            }
+        }
     }
 
-    if (n == 0) {
-        *olen = 0;
+    *needed = (n == 0) ? 0 : base64_decoded_len(n) - equals;
+    *written_out = written;
+
+    return 0;
+}
+
+/*
+ * Decode a base64-formatted buffer
+ *
+ * When dst is large enough for any data that slen characters can encode,
+ * the input is validated and decoded in a single pass. Otherwise it is
+ * validated first, so that nothing is written to dst when the function
+ * fails, and only decoded once the output is known to fit.
+ */
+int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
+                          const unsigned char *src, size_t slen)
+{
+    int ret;
+    size_t needed;
+    size_t written;
+
+    if (dst != NULL && dlen >= base64_decoded_len(slen)) {
+        ret = base64_decode_pass(dst, dlen, &needed, &written, src, slen);
+        if (ret != 0) {
+            return ret;
+        }
+
+        *olen = written;
         return 0;
     }
 
-    /* The following expression is to calculate the following formula without
-     * risk of integer overflow in n:
-     *     n = ( ( n * 6 ) + 7 ) >> 3;
-     */
-    n = (6 * (n >> 3)) + ((6 * (n & 0x7) + 7) >> 3);
-    n -= equals;
-
-    if (dst == NULL || dlen < n) {
-        *olen = n;
-        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    ret = base64_decode_pass(NULL, 0, &needed, &written, src, slen);
+    if (ret != 0) {
+        return ret;
     }
 
-    equals = 0;
-    for (x = 0, p = dst; i > 0; i--, src++) {
-        if (*src == '\r' || *src == '\n' || *src == ' ') {
-            continue;
-        }
+    if (needed == 0) {
+        *olen = 0;
+        return 0;
+    }
 
-        x = x << 6;
-        if (*src == '=') {
-            ++equals;
-        } else {
-            x |= mbedtls_ct_base64_dec_value(*src);
-        }
+    if (dst == NULL || dlen < needed) {
+        *olen = needed;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
 
-        if (++accumulated_digits == 4) {
-            accumulated_digits = 0;
-            *p++ = MBEDTLS_BYTE_2(x);
-            if (equals <= 1) {
-                *p++ = MBEDTLS_BYTE_1(x);
-            }
-            if (equals <= 0) {
-                *p++ = MBEDTLS_BYTE_0(x);
-            }
-        }
+    ret = base64_decode_pass(dst, dlen, &needed, &written, src, slen);
+    if (ret != 0) {
+        return ret;
     }
 
-    *olen = p - dst;
+    *olen = written;
 
     return 0;
 }
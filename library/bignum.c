@@ -1884,6 +1884,27 @@ int mbedtls_mpi_exp_mod(mbedtls_mpi *X, const mbedtls_mpi *A,
         MBEDTLS_MPI_CHK(mbedtls_mpi_copy(&W[1], A));
     }
 
+    /*
+     * Moduli of 1024, 1536 and 2048 bits have a faster fixed-size
+     * implementation that does not need the table below. This covers the
+     * CRT halves of common RSA key sizes, but also any other caller with
+     * such a modulus, e.g. DHM with a 1024 to 2048-bit group. Its window
+     * only pays off for large exponents, so short exponents such as RSA
+     * public exponents stay on the sliding-window path.
+     */
+    if (mbedtls_mpi_bitlen(E) > 79 && RR.n >= N->n) {
+        ret = mbedtls_mpi_core_exp_mod_fixed(W[x_index].p, W[1].p, N->p, N->n,
+                                             E->p,
+                                             BITS_TO_LIMBS(mbedtls_mpi_bitlen(E)),
+                                             RR.p);
+        if (ret == 0) {
+            goto result;
+        }
+        if (ret != MBEDTLS_ERR_MPI_BAD_INPUT_DATA) {
+            goto cleanup;
+        }
+    }
+
     /* Note that this is safe because W[1] always has at least N->n limbs
      * (it grew above and was preserved by mbedtls_mpi_copy()). */
     mpi_montmul(&W[1], &RR, N, mm, &T);
@@ -2013,6 +2034,7 @@ int mbedtls_mpi_exp_mod(mbedtls_mpi *X, const mbedtls_mpi *A,
      */
     mpi_montred(&W[x_index], N, mm, &T);
 
+result:
     if (neg && E->n != 0 && (E->p[0] & 1) != 0) {
         W[x_index].s = -1;
         MBEDTLS_MPI_CHK(mbedtls_mpi_add_mpi(&W[x_index], N, &W[x_index]));
@@ -2488,6 +2510,75 @@ int mbedtls_mpi_is_prime_ext(const mbedtls_mpi *X, int rounds,
     return mpi_miller_rabin(&XX, rounds, f_rng, p_rng);
 }
 
+/*
+ * Incremental prime search
+ *
+ * After a random odd start X, the candidates X, X + 2, ...,
+ * X + 2 * (GEN_PRIME_SIEVE_WINDOW - 1) are sieved at once with the odd primes
+ * below GEN_PRIME_SIEVE_BOUND, and only the survivors go through
+ * Miller-Rabin. This costs one division per small prime and per window
+ * instead of one per small prime and per candidate, and the bound is large
+ * enough to avoid about a third of the Miller-Rabin runs compared to
+ * mpi_check_small_factors(). It is only used when X is larger than the bound.
+ */
+#define GEN_PRIME_SIEVE_BOUND       8192
+#define GEN_PRIME_SIEVE_WINDOW      1024
+#define GEN_PRIME_SIEVE_MIN_BITS    16
+
+/*
+ * Sieve of Eratosthenes below GEN_PRIME_SIEVE_BOUND:
+ * set bit i of odd_composite if 2 * i + 1 is not prime.
+ */
+static void mpi_gen_prime_init_sieve(unsigned char *odd_composite)
+{
+    size_t i, j, p;
+
+    memset(odd_composite, 0, GEN_PRIME_SIEVE_BOUND / 16);
+    odd_composite[0] = 1; /* 1 is not prime */
+
+    for (i = 1; (2 * i + 1) * (2 * i + 1) < GEN_PRIME_SIEVE_BOUND; i++) {
+        if (odd_composite[i / 8] & (1 << (i % 8))) {
+            continue;
+        }
+        p = 2 * i + 1;
+        for (j = p * p / 2; j < GEN_PRIME_SIEVE_BOUND / 2; j += p) {
+            odd_composite[j / 8] |= (unsigned char) (1 << (j % 8));
+        }
+    }
+}
+
+/*
+ * Set bit k of window if X + 2 * k has an odd prime factor below
+ * GEN_PRIME_SIEVE_BOUND. X must be odd, positive and larger than the bound.
+ */
+static int mpi_gen_prime_sieve(const mbedtls_mpi *X,
+                               const unsigned char *odd_composite,
+                               unsigned char *window)
+{
+    int ret = 0;
+    size_t i, k, p;
+    mbedtls_mpi_uint r;
+
+    memset(window, 0, GEN_PRIME_SIEVE_WINDOW / 8);
+
+    for (i = 1; i < GEN_PRIME_SIEVE_BOUND / 2; i++) {
+        if (odd_composite[i / 8] & (1 << (i % 8))) {
+            continue;
+        }
+        p = 2 * i + 1;
+        MBEDTLS_MPI_CHK(mbedtls_mpi_mod_int(&r, X, (mbedtls_mpi_sint) p));
+
+        /* X + 2k = 0 mod p  <=>  k = -X / 2 = (p - r) * (p + 1) / 2 mod p */
+        k = ((p - (size_t) r) * ((p + 1) / 2)) % p;
+        for (; k < GEN_PRIME_SIEVE_WINDOW; k += p) {
+            window[k / 8] |= (unsigned char) (1 << (k % 8));
+        }
+    }
+
+cleanup:
+    return ret;
+}
+
 /*
  * Prime number generation
  *
@@ -2507,10 +2598,12 @@ int mbedtls_mpi_gen_prime(mbedtls_mpi *X, size_t nbits, int flags,
 #define CEIL_MAXUINT_DIV_SQRT2 0xb504f334U
 #endif
     int ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
-    size_t k, n;
+    size_t k, n, i, prev;
     int rounds;
     mbedtls_mpi_uint r;
     mbedtls_mpi Y;
+    unsigned char odd_composite[GEN_PRIME_SIEVE_BOUND / 16];
+    unsigned char window[GEN_PRIME_SIEVE_WINDOW / 8];
 
     MPI_VALIDATE_RET(X     != NULL);
     MPI_VALIDATE_RET(f_rng != NULL);
@@ -2541,9 +2634,20 @@ int mbedtls_mpi_gen_prime(mbedtls_mpi *X, size_t nbits, int flags,
                   (nbits >=  250) ? 28 : (nbits >=   150) ? 40 : 51);
     }
 
+    if (nbits > GEN_PRIME_SIEVE_MIN_BITS) {
+        mpi_gen_prime_init_sieve(odd_composite);
+    }
+
     while (1) {
         MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(X, n * ciL, f_rng, p_rng));
-        /* make sure generated number is at least (nbits-1)+0.5 bits (FIPS 186-4 §B.3.3 steps 4.4, 5.5) */
+        /*
+         * Make sure the random start is at least (nbits-1)+0.5 bits, as
+         * in FIPS 186-4 §B.3.3 steps 4.4 and 5.5. The candidates tested
+         * from this start only move upwards from it, so they keep that
+         * lower bound, and the sieved search starts over as soon as one
+         * exceeds nbits bits. Unlike in §B.3.3, the sieved candidates are
+         * not drawn independently: they are the odd numbers that follow X.
+         */
         if (X->p[n-1] < CEIL_MAXUINT_DIV_SQRT2) {
             continue;
         }
@@ -2554,12 +2658,36 @@ int mbedtls_mpi_gen_prime(mbedtls_mpi *X, size_t nbits, int flags,
         }
         X->p[0] |= 1;
 
-        if ((flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH) == 0) {
+        if ((flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH) == 0 &&
+            nbits <= GEN_PRIME_SIEVE_MIN_BITS) {
             ret = mbedtls_mpi_is_prime_ext(X, rounds, f_rng, p_rng);
 
             if (ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE) {
                 goto cleanup;
             }
+        } else if ((flags & MBEDTLS_MPI_GEN_PRIME_FLAG_DH) == 0) {
+            MBEDTLS_MPI_CHK(mpi_gen_prime_sieve(X, odd_composite, window));
+
+            for (i = 0, prev = 0; i < GEN_PRIME_SIEVE_WINDOW; i++) {
+                if (window[i / 8] & (1 << (i % 8))) {
+                    continue;
+                }
+
+                /* Move on to the next candidate that survived the sieve,
+                 * and start over from a new random X if it is too large. */
+                MBEDTLS_MPI_CHK(mbedtls_mpi_add_int(X, X,
+                                                    (mbedtls_mpi_sint) (2 * (i - prev))));
+                prev = i;
+                if (mbedtls_mpi_bitlen(X) > nbits) {
+                    break;
+                }
+
+                ret = mpi_miller_rabin(X, rounds, f_rng, p_rng);
+
+                if (ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE) {
+                    goto cleanup;
+                }
+            }
         } else {
             /*
              * A necessary condition for Y and X = 2Y + 1 to be prime
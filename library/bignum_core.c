@@ -19,6 +19,7 @@
 
 #include "bignum_core.h"
 #include "bn_mul.h"
+#include "cpu_features.h"
 #include "constant_time_internal.h"
 
 size_t mbedtls_mpi_core_clz(mbedtls_mpi_uint a)
@@ -458,6 +459,92 @@ mbedtls_mpi_uint mbedtls_mpi_core_sub(mbedtls_mpi_uint *X,
     return c;
 }
 
+/*
+ * On x86-64 CPUs with BMI2 and ADX, multiply-accumulate with MULX, which
+ * does not touch the flags, and two independent carry chains: ADCX adds the
+ * low halves of the products (carry in CF) while ADOX adds the high half of
+ * the previous product (carry in OF). The generic MULADDC code serializes
+ * everything on a single carry chain.
+ *
+ * The instructions used here take constant time, and the only branches
+ * depend on the length, so this has the same side channel properties as
+ * the generic code.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64) && defined(MBEDTLS_HAVE_INT64)
+#define MBEDTLS_MPI_CORE_HAVE_MULX_ADX
+
+/*
+ * d[0..len-1] += s[0..len-1] * b, returning the carry limb. The carry limb
+ * cannot overflow: d + s * b < 2^(biL * (len + 1)).
+ */
+static mbedtls_mpi_uint mpi_core_mla_mulx_adx(mbedtls_mpi_uint *d,
+                                              const mbedtls_mpi_uint *s,
+                                              size_t len,
+                                              mbedtls_mpi_uint b)
+{
+    size_t steps_x4 = len / 4;
+    size_t steps_x1 = len & 3;
+    mbedtls_mpi_uint c;
+
+    /* Only LEA, MOV, MULX, ADCX, ADOX and JRCXZ between the first XOR and
+     * the end, so that CF and OF survive across loop iterations. */
+    asm volatile (
+        "xorl   %%r8d, %%r8d            \n\t"
+        "1:                             \n\t"
+        "jrcxz  2f                      \n\t"
+        "mulx   (%%rsi), %%rax, %%r9    \n\t"
+        "movq   (%%rdi), %%r10          \n\t"
+        "adcx   %%rax, %%r10            \n\t"
+        "adox   %%r8, %%r10             \n\t"
+        "movq   %%r10, (%%rdi)          \n\t"
+        "mulx   8(%%rsi), %%rax, %%r8   \n\t"
+        "movq   8(%%rdi), %%r10         \n\t"
+        "adcx   %%rax, %%r10            \n\t"
+        "adox   %%r9, %%r10             \n\t"
+        "movq   %%r10, 8(%%rdi)         \n\t"
+        "mulx   16(%%rsi), %%rax, %%r9  \n\t"
+        "movq   16(%%rdi), %%r10        \n\t"
+        "adcx   %%rax, %%r10            \n\t"
+        "adox   %%r8, %%r10             \n\t"
+        "movq   %%r10, 16(%%rdi)        \n\t"
+        "mulx   24(%%rsi), %%rax, %%r8  \n\t"
+        "movq   24(%%rdi), %%r10        \n\t"
+        "adcx   %%rax, %%r10            \n\t"
+        "adox   %%r9, %%r10             \n\t"
+        "movq   %%r10, 24(%%rdi)        \n\t"
+        "leaq   32(%%rsi), %%rsi        \n\t"
+        "leaq   32(%%rdi), %%rdi        \n\t"
+        "leaq   -1(%%rcx), %%rcx        \n\t"
+        "jmp    1b                      \n\t"
+        "2:                             \n\t"
+        "movq   %[x1], %%rcx            \n\t"
+        "3:                             \n\t"
+        "jrcxz  4f                      \n\t"
+        "mulx   (%%rsi), %%rax, %%r9    \n\t"
+        "movq   (%%rdi), %%r10          \n\t"
+        "adcx   %%rax, %%r10            \n\t"
+        "adox   %%r8, %%r10             \n\t"
+        "movq   %%r10, (%%rdi)          \n\t"
+        "movq   %%r9, %%r8              \n\t"
+        "leaq   8(%%rsi), %%rsi         \n\t"
+        "leaq   8(%%rdi), %%rdi         \n\t"
+        "leaq   -1(%%rcx), %%rcx        \n\t"
+        "jmp    3b                      \n\t"
+        "4:                             \n\t"
+        "movl   $0, %%eax               \n\t"
+        "adcx   %%rax, %%r8             \n\t"
+        "adox   %%rax, %%r8             \n\t"
+        "movq   %%r8, %[c]              \n\t"
+        : [c] "=&r" (c), "+D" (d), "+S" (s), "+c" (steps_x4)
+        : [x1] "r" (steps_x1), "d" (b)
+        : "rax", "r8", "r9", "r10", "cc", "memory"
+        );
+
+    return c;
+}
+#endif /* MBEDTLS_HAVE_ASM && __GNUC__ && MBEDTLS_ARCH_IS_X64 && MBEDTLS_HAVE_INT64 */
+
 mbedtls_mpi_uint mbedtls_mpi_core_mla(mbedtls_mpi_uint *d, size_t d_len,
                                       const mbedtls_mpi_uint *s, size_t s_len,
                                       mbedtls_mpi_uint b)
@@ -475,6 +562,14 @@ mbedtls_mpi_uint mbedtls_mpi_core_mla(mbedtls_mpi_uint *d, size_t d_len,
     size_t steps_x8 = s_len / 8;
     size_t steps_x1 = s_len & 7;
 
+#if defined(MBEDTLS_MPI_CORE_HAVE_MULX_ADX)
+    if (mbedtls_cpu_has_mulx_adx()) {
+        c = mpi_core_mla_mulx_adx(d, s, s_len, b);
+        d += s_len;
+        steps_x8 = steps_x1 = 0;
+    }
+#endif
+
     while (steps_x8--) {
         MULADDC_X8_INIT
         MULADDC_X8_CORE
@@ -523,14 +618,18 @@ mbedtls_mpi_uint mbedtls_mpi_core_montmul_init(const mbedtls_mpi_uint *N)
     return ~x + 1;
 }
 
-void mbedtls_mpi_core_montmul(mbedtls_mpi_uint *X,
-                              const mbedtls_mpi_uint *A,
-                              const mbedtls_mpi_uint *B,
-                              size_t B_limbs,
-                              const mbedtls_mpi_uint *N,
-                              size_t AN_limbs,
-                              mbedtls_mpi_uint mm,
-                              mbedtls_mpi_uint *T)
+/*
+ * Body of mbedtls_mpi_core_montmul(), inlined into the exponentiation code
+ * so that the loops can be specialized when the sizes are constants.
+ */
+static inline void core_montmul(mbedtls_mpi_uint *X,
+                                const mbedtls_mpi_uint *A,
+                                const mbedtls_mpi_uint *B,
+                                size_t B_limbs,
+                                const mbedtls_mpi_uint *N,
+                                size_t AN_limbs,
+                                mbedtls_mpi_uint mm,
+                                mbedtls_mpi_uint *T)
 {
     memset(T, 0, (2 * AN_limbs + 1) * ciL);
 
@@ -579,6 +678,18 @@ void mbedtls_mpi_core_montmul(mbedtls_mpi_uint *X,
                          AN_limbs * sizeof(mbedtls_mpi_uint));
 }
 
+void mbedtls_mpi_core_montmul(mbedtls_mpi_uint *X,
+                              const mbedtls_mpi_uint *A,
+                              const mbedtls_mpi_uint *B,
+                              size_t B_limbs,
+                              const mbedtls_mpi_uint *N,
+                              size_t AN_limbs,
+                              mbedtls_mpi_uint mm,
+                              mbedtls_mpi_uint *T)
+{
+    core_montmul(X, A, B, B_limbs, N, AN_limbs, mm, T);
+}
+
 int mbedtls_mpi_core_get_mont_r2_unsafe(mbedtls_mpi *X,
                                         const mbedtls_mpi *N)
 {
@@ -593,7 +704,6 @@ cleanup:
     return ret;
 }
 
-MBEDTLS_STATIC_TESTABLE
 void mbedtls_mpi_core_ct_uint_table_lookup(mbedtls_mpi_uint *dest,
                                            const mbedtls_mpi_uint *table,
                                            size_t limbs,
@@ -719,19 +829,19 @@ size_t mbedtls_mpi_core_exp_mod_working_limbs(size_t AN_limbs, size_t E_limbs)
     return table_limbs + select_limbs + temp_limbs;
 }
 
-static void exp_mod_precompute_window(const mbedtls_mpi_uint *A,
-                                      const mbedtls_mpi_uint *N,
-                                      size_t AN_limbs,
-                                      mbedtls_mpi_uint mm,
-                                      const mbedtls_mpi_uint *RR,
-                                      size_t welem,
-                                      mbedtls_mpi_uint *Wtable,
-                                      mbedtls_mpi_uint *temp)
+static inline void exp_mod_precompute_window(const mbedtls_mpi_uint *A,
+                                             const mbedtls_mpi_uint *N,
+                                             size_t AN_limbs,
+                                             mbedtls_mpi_uint mm,
+                                             const mbedtls_mpi_uint *RR,
+                                             size_t welem,
+                                             mbedtls_mpi_uint *Wtable,
+                                             mbedtls_mpi_uint *temp)
 {
     /* W[0] = 1 (in Montgomery presentation) */
     memset(Wtable, 0, AN_limbs * ciL);
     Wtable[0] = 1;
-    mbedtls_mpi_core_montmul(Wtable, Wtable, RR, AN_limbs, N, AN_limbs, mm, temp);
+    core_montmul(Wtable, Wtable, RR, AN_limbs, N, AN_limbs, mm, temp);
 
     /* W[1] = A (already in Montgomery presentation) */
     mbedtls_mpi_uint *W1 = Wtable + AN_limbs;
@@ -741,12 +851,12 @@ static void exp_mod_precompute_window(const mbedtls_mpi_uint *A,
     mbedtls_mpi_uint *Wprev = W1;
     for (size_t i = 2; i < welem; i++) {
         mbedtls_mpi_uint *Wcur = Wprev + AN_limbs;
-        mbedtls_mpi_core_montmul(Wcur, Wprev, W1, AN_limbs, N, AN_limbs, mm, temp);
+        core_montmul(Wcur, Wprev, W1, AN_limbs, N, AN_limbs, mm, temp);
         Wprev = Wcur;
     }
 }
 
-/* Exponentiation: X := A^E mod N.
+/* Exponentiation: X := A^E mod N, with a window of wsize bits.
  *
  * A must already be in Montgomery form.
  *
@@ -757,17 +867,20 @@ static void exp_mod_precompute_window(const mbedtls_mpi_uint *A,
  * The algorithm is a variant of Left-to-right k-ary exponentiation: HAC 14.82
  * (The difference is that the body in our loop processes a single bit instead
  * of a full window.)
+ *
+ * This is inlined both in mbedtls_mpi_core_exp_mod() and in the fixed-size
+ * variants below, where AN_limbs and wsize are compile-time constants.
  */
-void mbedtls_mpi_core_exp_mod(mbedtls_mpi_uint *X,
-                              const mbedtls_mpi_uint *A,
-                              const mbedtls_mpi_uint *N,
-                              size_t AN_limbs,
-                              const mbedtls_mpi_uint *E,
-                              size_t E_limbs,
-                              const mbedtls_mpi_uint *RR,
-                              mbedtls_mpi_uint *T)
+static inline void exp_mod_window(mbedtls_mpi_uint *X,
+                                  const mbedtls_mpi_uint *A,
+                                  const mbedtls_mpi_uint *N,
+                                  size_t AN_limbs,
+                                  const mbedtls_mpi_uint *E,
+                                  size_t E_limbs,
+                                  const mbedtls_mpi_uint *RR,
+                                  mbedtls_mpi_uint *T,
+                                  size_t wsize)
 {
-    const size_t wsize = exp_mod_get_window_size(E_limbs * biL);
     const size_t welem = ((size_t) 1) << wsize;
 
     /* This is how we will use the temporary storage T, which must have space
@@ -810,7 +923,7 @@ void mbedtls_mpi_core_exp_mod(mbedtls_mpi_uint *X,
 
     do {
         /* Square */
-        mbedtls_mpi_core_montmul(X, X, X, AN_limbs, N, AN_limbs, mm, temp);
+        core_montmul(X, X, X, AN_limbs, N, AN_limbs, mm, temp);
 
         /* Move to the next bit of the exponent */
         if (E_bit_index == 0) {
@@ -833,14 +946,134 @@ void mbedtls_mpi_core_exp_mod(mbedtls_mpi_uint *X,
             mbedtls_mpi_core_ct_uint_table_lookup(Wselect, Wtable,
                                                   AN_limbs, welem, window);
             /* Multiply X by the selected element. */
-            mbedtls_mpi_core_montmul(X, X, Wselect, AN_limbs, N, AN_limbs, mm,
-                                     temp);
+            core_montmul(X, X, Wselect, AN_limbs, N, AN_limbs, mm, temp);
             window = 0;
             window_bits = 0;
         }
     } while (!(E_bit_index == 0 && E_limb_index == 0));
 }
 
+void mbedtls_mpi_core_exp_mod(mbedtls_mpi_uint *X,
+                              const mbedtls_mpi_uint *A,
+                              const mbedtls_mpi_uint *N,
+                              size_t AN_limbs,
+                              const mbedtls_mpi_uint *E,
+                              size_t E_limbs,
+                              const mbedtls_mpi_uint *RR,
+                              mbedtls_mpi_uint *T)
+{
+    exp_mod_window(X, A, N, AN_limbs, E, E_limbs, RR, T,
+                   exp_mod_get_window_size(E_limbs * biL));
+}
+
+/*
+ * Fixed-size exponentiation for the moduli of the CRT halves of RSA-2048,
+ * RSA-3072 and RSA-4096. Each size gets its own copy of the exponentiation
+ * loop with constant sizes. Its working memory is on the stack if
+ * MBEDTLS_MPI_EXP_MOD_FIXED_STACK is enabled, and on the heap otherwise.
+ *
+ * The window is always EXP_MOD_FIXED_WSIZE bits: 4 bits, capped at
+ * MBEDTLS_MPI_WINDOW_SIZE so that lowering that option also shrinks the
+ * table. With exponents of 1024 bits and more a 4-bit window needs fewer
+ * multiplications than smaller windows, and its table (16 elements) stays
+ * small enough for the stack: 4 KiB for a 2048-bit modulus.
+ */
+#if MBEDTLS_MPI_WINDOW_SIZE < 4
+#define EXP_MOD_FIXED_WSIZE     MBEDTLS_MPI_WINDOW_SIZE
+#else
+#define EXP_MOD_FIXED_WSIZE     4
+#endif
+#define EXP_MOD_FIXED_LIMBS(limbs) \
+    ((((size_t) 1) << EXP_MOD_FIXED_WSIZE) * (limbs) + 3 * (limbs) + 1)
+
+static inline void exp_mod_fixed(mbedtls_mpi_uint *X,
+                                 const mbedtls_mpi_uint *A,
+                                 const mbedtls_mpi_uint *N,
+                                 size_t AN_limbs,
+                                 const mbedtls_mpi_uint *E,
+                                 size_t E_limbs,
+                                 const mbedtls_mpi_uint *RR,
+                                 mbedtls_mpi_uint *AM,
+                                 mbedtls_mpi_uint *T)
+{
+    const mbedtls_mpi_uint mm = mbedtls_mpi_core_montmul_init(N);
+    const mbedtls_mpi_uint one = 1;
+
+    core_montmul(AM, A, RR, AN_limbs, N, AN_limbs, mm, T);
+    exp_mod_window(X, AM, N, AN_limbs, E, E_limbs, RR, T, EXP_MOD_FIXED_WSIZE);
+    core_montmul(X, X, &one, 1, N, AN_limbs, mm, T);
+}
+
+#if defined(MBEDTLS_MPI_EXP_MOD_FIXED_STACK)
+#define EXP_MOD_FIXED_DEFINE(bits)                                          \
+    static int exp_mod_fixed_##bits(mbedtls_mpi_uint *X,                    \
+                                    const mbedtls_mpi_uint *A,              \
+                                    const mbedtls_mpi_uint *N,              \
+                                    const mbedtls_mpi_uint *E,              \
+                                    size_t E_limbs,                         \
+                                    const mbedtls_mpi_uint *RR)             \
+    {                                                                       \
+        mbedtls_mpi_uint AM[BITS_TO_LIMBS(bits)];                           \
+        mbedtls_mpi_uint T[EXP_MOD_FIXED_LIMBS(BITS_TO_LIMBS(bits))];       \
+                                                                            \
+        exp_mod_fixed(X, A, N, BITS_TO_LIMBS(bits), E, E_limbs, RR, AM, T); \
+                                                                            \
+        mbedtls_platform_zeroize(AM, sizeof(AM));                           \
+        mbedtls_platform_zeroize(T, sizeof(T));                             \
+        return 0;                                                           \
+    }
+#else /* MBEDTLS_MPI_EXP_MOD_FIXED_STACK */
+#define EXP_MOD_FIXED_DEFINE(bits)                                          \
+    static int exp_mod_fixed_##bits(mbedtls_mpi_uint *X,                    \
+                                    const mbedtls_mpi_uint *A,              \
+                                    const mbedtls_mpi_uint *N,              \
+                                    const mbedtls_mpi_uint *E,              \
+                                    size_t E_limbs,                         \
+                                    const mbedtls_mpi_uint *RR)             \
+    {                                                                       \
+        const size_t limbs = BITS_TO_LIMBS(bits);                           \
+        const size_t ws_limbs = limbs + EXP_MOD_FIXED_LIMBS(limbs);         \
+        mbedtls_mpi_uint *AM = mbedtls_calloc(ws_limbs, ciL);               \
+                                                                            \
+        if (AM == NULL) {                                                   \
+            return MBEDTLS_ERR_MPI_ALLOC_FAILED;                            \
+        }                                                                   \
+                                                                            \
+        exp_mod_fixed(X, A, N, limbs, E, E_limbs, RR, AM, AM + limbs);      \
+                                                                            \
+        mbedtls_zeroize_and_free(AM, ws_limbs * ciL);                       \
+        return 0;                                                           \
+    }
+#endif /* MBEDTLS_MPI_EXP_MOD_FIXED_STACK */
+
+EXP_MOD_FIXED_DEFINE(1024)
+EXP_MOD_FIXED_DEFINE(1536)
+EXP_MOD_FIXED_DEFINE(2048)
+
+int mbedtls_mpi_core_exp_mod_fixed(mbedtls_mpi_uint *X,
+                                   const mbedtls_mpi_uint *A,
+                                   const mbedtls_mpi_uint *N,
+                                   size_t AN_limbs,
+                                   const mbedtls_mpi_uint *E,
+                                   size_t E_limbs,
+                                   const mbedtls_mpi_uint *RR)
+{
+    if (E_limbs == 0) {
+        return MBEDTLS_ERR_MPI_BAD_INPUT_DATA;
+    }
+
+    switch (AN_limbs) {
+        case BITS_TO_LIMBS(1024):
+            return exp_mod_fixed_1024(X, A, N, E, E_limbs, RR);
+        case BITS_TO_LIMBS(1536):
+            return exp_mod_fixed_1536(X, A, N, E, E_limbs, RR);
+        case BITS_TO_LIMBS(2048):
+            return exp_mod_fixed_2048(X, A, N, E, E_limbs, RR);
+        default:
+            return MBEDTLS_ERR_MPI_BAD_INPUT_DATA;
+    }
+}
+
 mbedtls_mpi_uint mbedtls_mpi_core_sub_int(mbedtls_mpi_uint *X,
                                           const mbedtls_mpi_uint *A,
                                           mbedtls_mpi_uint c,  /* doubles as carry */
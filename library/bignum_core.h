@@ -504,7 +504,6 @@ void mbedtls_mpi_core_montmul(mbedtls_mpi_uint *X,
 int mbedtls_mpi_core_get_mont_r2_unsafe(mbedtls_mpi *X,
                                         const mbedtls_mpi *N);
 
-#if defined(MBEDTLS_TEST_HOOKS)
 /**
  * Copy an MPI from a table without leaking the index.
  *
@@ -522,7 +521,6 @@ void mbedtls_mpi_core_ct_uint_table_lookup(mbedtls_mpi_uint *dest,
                                            size_t limbs,
                                            size_t count,
                                            size_t index);
-#endif /* MBEDTLS_TEST_HOOKS */
 
 /**
  * \brief          Fill an integer with a number of random bytes.
@@ -638,6 +636,48 @@ void mbedtls_mpi_core_exp_mod(mbedtls_mpi_uint *X,
                               const mbedtls_mpi_uint *RR,
                               mbedtls_mpi_uint *T);
 
+/**
+ * \brief            Perform a modular exponentiation with secret exponent
+ *                   for the common RSA CRT modulus sizes: X = A^E mod N.
+ *
+ * This is equivalent to converting \p A to Montgomery form, calling
+ * mbedtls_mpi_core_exp_mod() and converting the result back, but it is
+ * specialized for moduli of 1024, 1536 and 2048 bits (the CRT halves of
+ * RSA-2048, RSA-3072 and RSA-4096). It uses a window of
+ * min(4, #MBEDTLS_MPI_WINDOW_SIZE) bits. Its working memory (up to about
+ * 5 KiB) is on the stack if #MBEDTLS_MPI_EXP_MOD_FIXED_STACK is enabled, and
+ * is allocated on the heap otherwise.
+ *
+ * \p X may be aliased to \p A, but not to \p RR or \p E.
+ *
+ * \param[out] X     The destination MPI, as a little endian array of length
+ *                   \p AN_limbs.
+ * \param[in] A      The base MPI, as a little endian array of length
+ *                   \p AN_limbs. It must be less than \p N and must not be
+ *                   in Montgomery form.
+ * \param[in] N      The modulus, as a little endian array of length
+ *                   \p AN_limbs.
+ * \param AN_limbs   The number of limbs in \p X, \p A, \p N, \p RR.
+ * \param[in] E      The exponent, as a little endian array of length
+ *                   \p E_limbs.
+ * \param E_limbs    The number of limbs in \p E.
+ * \param[in] RR     The precomputed residue of 2^{2*biL} modulo N, as a
+ *                   little endian array of length \p AN_limbs.
+ *
+ * \return           \c 0 on success.
+ * \return           #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \p AN_limbs is not one
+ *                   of the supported sizes or \p E_limbs is 0. \p X is not
+ *                   modified in this case.
+ * \return           #MBEDTLS_ERR_MPI_ALLOC_FAILED if the working memory
+ *                   could not be allocated. \p X is not modified in this
+ *                   case.
+ */
+int mbedtls_mpi_core_exp_mod_fixed(mbedtls_mpi_uint *X,
+                                   const mbedtls_mpi_uint *A,
+                                   const mbedtls_mpi_uint *N, size_t AN_limbs,
+                                   const mbedtls_mpi_uint *E, size_t E_limbs,
+                                   const mbedtls_mpi_uint *RR);
+
 /**
  * \brief Subtract unsigned integer from known-size large unsigned integers.
  *        Return the borrow.
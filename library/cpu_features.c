@@ -0,0 +1,81 @@
+/*
+ *  Run-time detection of optional x86-64 instruction set extensions
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#include "common.h"
+
+#include "cpu_features.h"
+
+#if defined(MBEDTLS_CPU_FEATURES_HAVE_X86_CPUID)
+
+#define CPU_FEATURE_DETECTED    0x1u
+#define CPU_FEATURE_AVX2        0x2u
+#define CPU_FEATURE_MULX_ADX    0x4u
+
+/*
+ * Detected features, or 0 before the first detection. Detection always
+ * gives the same result and is stored with a single write, so concurrent
+ * first calls at worst run it more than once.
+ */
+static volatile unsigned int cpu_features = 0;
+
+static unsigned int cpu_features_detect(void)
+{
+    unsigned int eax, ebx, ecx, edx, max_leaf, leaf1_ecx, leaf7_ebx = 0;
+    unsigned int features = CPU_FEATURE_DETECTED;
+
+    asm ("cpuid" : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (0), "c" (0));
+    max_leaf = eax;
+    if (max_leaf < 7) {
+        return features;
+    }
+
+    asm ("cpuid" : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (1), "c" (0));
+    leaf1_ecx = ecx;
+    asm ("cpuid" : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) : "a" (7), "c" (0));
+    leaf7_ebx = ebx;
+
+    /* CPUID.(EAX=7,ECX=0):EBX bit 8 is BMI2 (MULX), bit 19 is ADX. */
+    if ((leaf7_ebx & (1u << 8)) != 0 && (leaf7_ebx & (1u << 19)) != 0) {
+        features |= CPU_FEATURE_MULX_ADX;
+    }
+
+    /* CPUID.1:ECX bit 27 is OSXSAVE and bit 28 is AVX. The OS must also
+     * save the XMM and YMM registers (XCR0 bits 1 and 2).
+     * CPUID.(EAX=7,ECX=0):EBX bit 5 is AVX2. */
+    if ((leaf1_ecx & (1u << 27)) != 0 && (leaf1_ecx & (1u << 28)) != 0) {
+        asm ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+        if ((eax & 6) == 6 && (leaf7_ebx & (1u << 5)) != 0) {
+            features |= CPU_FEATURE_AVX2;
+        }
+    }
+
+    return features;
+}
+
+static unsigned int cpu_features_get(void)
+{
+    unsigned int features = cpu_features;
+
+    if (features == 0) {
+        features = cpu_features_detect();
+        cpu_features = features;
+    }
+
+    return features;
+}
+
+int mbedtls_cpu_has_avx2(void)
+{
+    return (cpu_features_get() & CPU_FEATURE_AVX2) != 0;
+}
+
+int mbedtls_cpu_has_mulx_adx(void)
+{
+    return (cpu_features_get() & CPU_FEATURE_MULX_ADX) != 0;
+}
+
+#endif /* MBEDTLS_CPU_FEATURES_HAVE_X86_CPUID */
@@ -0,0 +1,58 @@
+/**
+ * \file cpu_features.h
+ *
+ * \brief Run-time detection of optional x86-64 instruction set extensions
+ *
+ * \warning These functions are only for internal use by other library
+ *          functions; you must not call them directly.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+#ifndef MBEDTLS_CPU_FEATURES_H
+#define MBEDTLS_CPU_FEATURES_H
+
+#include "mbedtls/build_info.h"
+
+/*
+ * Detection uses the CPUID and XGETBV instructions through GNUC inline
+ * assembly, so it is only available on x86-64 with MBEDTLS_HAVE_ASM.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64)
+
+#define MBEDTLS_CPU_FEATURES_HAVE_X86_CPUID
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Internal function to detect AVX2 support.
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \return         1 if the CPU supports AVX2 and the operating system
+ *                 saves the YMM registers, 0 otherwise
+ */
+int mbedtls_cpu_has_avx2(void);
+
+/**
+ * \brief          Internal function to detect BMI2 (MULX) and ADX support.
+ *
+ * \note           This function is only for internal use by other library
+ *                 functions; you must not call it directly.
+ *
+ * \return         1 if the CPU supports both BMI2 and ADX, 0 otherwise
+ */
+int mbedtls_cpu_has_mulx_adx(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_HAVE_ASM && __GNUC__ && MBEDTLS_ARCH_IS_X64 */
+
+#endif /* MBEDTLS_CPU_FEATURES_H */
@@ -21,6 +21,9 @@
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
 
+#include "dhm_ffdhe.h"
+#include "platform_util_internal.h"
+
 #include <string.h>
 
 #if defined(MBEDTLS_PEM_PARSE_C)
@@ -206,6 +209,12 @@ static int dhm_make_common(mbedtls_dhm_context *ctx, int x_size,
     /*
      * Calculate GX = G^X mod P
      */
+#if MBEDTLS_DHM_FIXED_BASE_OPTIM == 1
+    const mbedtls_dhm_ffdhe_group *grp = mbedtls_dhm_ffdhe_find(&ctx->P, &ctx->G);
+    if (grp != NULL) {
+        MBEDTLS_MPI_CHK(mbedtls_dhm_ffdhe_exp_g(&ctx->GX, &ctx->X, grp));
+    } else
+#endif
     MBEDTLS_MPI_CHK(mbedtls_mpi_exp_mod(&ctx->GX, &ctx->G, &ctx->X,
                                         &ctx->P, &ctx->RP));
 
@@ -576,12 +585,21 @@ exit:
  * The file is expected to contain either PEM or DER encoded data.
  * A terminating null byte is always appended. It is included in the announced
  * length only if the data looks like it is PEM encoded.
+ *
+ * The file is mapped into memory if possible, in which case *map_len is the
+ * size of the mapping. Otherwise *map_len is 0 and *buf is a heap buffer.
  */
-static int load_file(const char *path, unsigned char **buf, size_t *n)
+static int load_file(const char *path, unsigned char **buf, size_t *n,
+                     size_t *map_len)
 {
     FILE *f;
     long size;
 
+    if (mbedtls_platform_map_file(path, buf, n, map_len) == 0) {
+        goto loaded;
+    }
+    *map_len = 0;
+
     if ((f = fopen(path, "rb")) == NULL) {
         return MBEDTLS_ERR_DHM_FILE_IO_ERROR;
     }
@@ -614,6 +632,7 @@ static int load_file(const char *path, unsigned char **buf, size_t *n)
 
     (*buf)[*n] = '\0';
 
+loaded:
     if (strstr((const char *) *buf, "-----BEGIN ") != NULL) {
         ++*n;
     }
@@ -627,16 +646,20 @@ static int load_file(const char *path, unsigned char **buf, size_t *n)
 int mbedtls_dhm_parse_dhmfile(mbedtls_dhm_context *dhm, const char *path)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
+    size_t n, map_len;
     unsigned char *buf;
 
-    if ((ret = load_file(path, &buf, &n)) != 0) {
+    if ((ret = load_file(path, &buf, &n, &map_len)) != 0) {
         return ret;
     }
 
     ret = mbedtls_dhm_parse_dhm(dhm, buf, n);
 
-    mbedtls_zeroize_and_free(buf, n);
+    if (map_len != 0) {
+        mbedtls_platform_unmap_file(buf, map_len);
+    } else {
+        mbedtls_zeroize_and_free(buf, n);
+    }
 
     return ret;
 }
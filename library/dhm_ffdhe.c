@@ -0,0 +1,2057 @@
+/*
+ *  Fixed-base exponentiation in the RFC 7919 finite field groups
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+/*
+ *  References:
+ *
+ *  RFC 7919: Negotiated Finite Field Diffie-Hellman Ephemeral Parameters
+ *            for Transport Layer Security (TLS)
+ *
+ *  HAC 14.117: Handbook of Applied Cryptography, fixed-base comb method
+ */
+
+#include "common.h"
+
+#include "dhm_ffdhe.h"
+
+#if defined(MBEDTLS_BIGNUM_C) && MBEDTLS_DHM_FIXED_BASE_OPTIM == 1
+
+#include "mbedtls/error.h"
+#include "mbedtls/platform.h"
+
+#include "bignum_core.h"
+
+#include <string.h>
+
+/*
+ * Number of teeth of the comb, that is the number of blocks the exponent is
+ * split into. The working table has 2^DHM_FFDHE_COMB_TEETH entries of the
+ * size of the prime, and each group stores DHM_FFDHE_COMB_TEETH values.
+ */
+#define DHM_FFDHE_COMB_TEETH    5
+
+struct mbedtls_dhm_ffdhe_group {
+    size_t bits;                /* Size of the prime in bits */
+    const unsigned char *P;     /* The prime, big-endian on bits / 8 bytes */
+    const unsigned char *T;     /* DHM_FFDHE_COMB_TEETH entries of the same
+                                 * size, see ffdhe_comb_table.py */
+};
+
+static const unsigned char ffdhe2048_P[] = MBEDTLS_DHM_RFC7919_FFDHE2048_P_BIN;
+static const unsigned char ffdhe3072_P[] = MBEDTLS_DHM_RFC7919_FFDHE3072_P_BIN;
+static const unsigned char ffdhe4096_P[] = MBEDTLS_DHM_RFC7919_FFDHE4096_P_BIN;
+static const unsigned char ffdhe6144_P[] = MBEDTLS_DHM_RFC7919_FFDHE6144_P_BIN;
+static const unsigned char ffdhe8192_P[] = MBEDTLS_DHM_RFC7919_FFDHE8192_P_BIN;
+
+/*
+ * Entry i of ffdhe<bits>_T is 2^(2^(i * d)) * R mod P, where
+ * d = ceil(bits / DHM_FFDHE_COMB_TEETH) and R = 2^bits.
+ *
+ * Generated by scripts/ffdhe_comb_table.py.
+ */
+static const unsigned char ffdhe2048_T[5 * 256] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA4, 0x0F, 0x57, 0x4E, 0xBA, 0x89, 0x6A, 0xCA,
+    0xA0, 0x47, 0x53, 0xBF, 0xB1, 0x85, 0x86, 0x1C,
+    0x4E, 0x8C, 0x74, 0xF8, 0x63, 0xA5, 0x92, 0xD4,
+    0xAC, 0x3D, 0x93, 0x7D, 0xD7, 0x37, 0x98, 0x08,
+    0x66, 0xD8, 0xC4, 0x63, 0xB6, 0xC9, 0x82, 0x0D,
+    0x05, 0xA0, 0x39, 0x39, 0x39, 0xE7, 0x14, 0x4E,
+    0x12, 0xFC, 0x9B, 0xFA, 0xA2, 0x77, 0x3D, 0x0A,
+    0x58, 0x41, 0xC2, 0x54, 0x54, 0x05, 0x35, 0x3D,
+    0xB7, 0x98, 0x15, 0xC1, 0x41, 0xF3, 0x22, 0x5E,
+    0xF5, 0x39, 0x35, 0x55, 0x84, 0x25, 0xCA, 0x18,
+    0x95, 0x51, 0xD9, 0x43, 0x01, 0x50, 0x6D, 0x94,
+    0xCF, 0x61, 0xE7, 0x1E, 0x3E, 0x32, 0xE9, 0x10,
+    0x3A, 0xB2, 0xEC, 0x4A, 0x18, 0x20, 0x2F, 0x1B,
+    0xC4, 0x1D, 0x4E, 0xBD, 0x92, 0xA4, 0x31, 0x95,
+    0x9E, 0xA6, 0x6B, 0x61, 0x6F, 0x8B, 0x0D, 0x0A,
+    0x87, 0xEA, 0x9C, 0xFA, 0x99, 0xB6, 0x09, 0x3C,
+    0x5D, 0xEE, 0xAD, 0x68, 0x9A, 0x6E, 0x38, 0x08,
+    0x8D, 0x2A, 0x4A, 0x91, 0x3E, 0x50, 0x17, 0x2F,
+    0xC5, 0x61, 0x7A, 0xB8, 0x43, 0x8D, 0x64, 0x16,
+    0xA3, 0x52, 0x24, 0x31, 0x39, 0x1A, 0x89, 0xCD,
+    0xE9, 0xF0, 0xB0, 0x6E, 0x23, 0xEB, 0x25, 0x1E,
+    0xC3, 0xFA, 0x06, 0x3C, 0x64, 0x10, 0x3A, 0x26,
+    0x7F, 0x97, 0xF6, 0x65, 0xAF, 0x97, 0xA1, 0x3C,
+    0xDD, 0x1A, 0x02, 0xC6, 0x2C, 0xF4, 0xF8, 0x00,
+    0xE3, 0x61, 0xDB, 0x9A, 0x22, 0x1A, 0xFC, 0xF8,
+    0x78, 0x03, 0x89, 0xC9, 0x67, 0x20, 0xA5, 0x19,
+    0x88, 0x94, 0x06, 0x87, 0xA2, 0x7B, 0xBF, 0xF4,
+    0x74, 0xE2, 0x1C, 0xF9, 0x05, 0xD2, 0xF8, 0x9A,
+    0x72, 0x19, 0x6B, 0xB2, 0x7C, 0x9A, 0x20, 0x0A,
+    0xEF, 0x29, 0x7B, 0x8F, 0x3D, 0xAF, 0x46, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+
+    0x79, 0x21, 0x53, 0x30, 0x1F, 0xE1, 0x50, 0x2C,
+    0xB7, 0xCF, 0xF9, 0x29, 0xC6, 0x38, 0xB5, 0x34,
+    0x63, 0x06, 0x61, 0xC9, 0xB5, 0xDD, 0xDE, 0xD6,
+    0xB9, 0xCC, 0x61, 0xFC, 0x20, 0xC1, 0xE8, 0x0F,
+    0xE2, 0xAC, 0xF9, 0xE1, 0xEA, 0x30, 0x47, 0x70,
+    0x34, 0x0D, 0xDE, 0x60, 0x1B, 0x94, 0x69, 0xC7,
+    0x46, 0x6C, 0xB8, 0xDE, 0x1A, 0xE7, 0xB6, 0x52,
+    0x24, 0x5F, 0xF4, 0x7C, 0x6F, 0x27, 0xC5, 0xD8,
+    0xC0, 0xF4, 0x2D, 0x74, 0x32, 0xEA, 0x6F, 0x57,
+    0xB1, 0x4F, 0xC7, 0x74, 0x68, 0xBE, 0x39, 0xAF,
+    0x4A, 0x87, 0xD3, 0x9C, 0xB2, 0xEB, 0xBA, 0xC3,
+    0xCF, 0x59, 0x1E, 0x9B, 0xDE, 0x9E, 0xC8, 0x29,
+    0xD0, 0x66, 0x7C, 0xE7, 0x99, 0x35, 0x32, 0x30,
+    0x36, 0xC1, 0xB0, 0x2C, 0x7E, 0xF5, 0xFE, 0xAA,
+    0xF8, 0x0A, 0x1E, 0xBF, 0x8C, 0xDF, 0x2D, 0xC0,
+    0x66, 0xFE, 0xA7, 0x95, 0x92, 0x3D, 0x78, 0x38,
+    0xB1, 0x67, 0x98, 0x44, 0x22, 0x14, 0x84, 0x6F,
+    0xEA, 0x86, 0x19, 0x7E, 0x3C, 0x12, 0xEE, 0x48,
+    0xFB, 0x70, 0xFC, 0xA4, 0x6C, 0x11, 0x68, 0x6B,
+    0x17, 0x35, 0x46, 0x66, 0xE4, 0xD9, 0x79, 0x2F,
+    0x99, 0x69, 0x7B, 0x64, 0x8E, 0x36, 0xCC, 0x86,
+    0x02, 0x30, 0x01, 0x51, 0x57, 0x61, 0xCF, 0xDD,
+    0xEA, 0x25, 0x40, 0x7F, 0x7E, 0xEF, 0x9D, 0x13,
+    0xCB, 0x39, 0x67, 0xB3, 0x6C, 0xCA, 0x61, 0x57,
+    0x5E, 0xD9, 0xE9, 0xAC, 0x8A, 0x90, 0x7B, 0x81,
+    0x25, 0xA2, 0x9F, 0xC1, 0xBF, 0x51, 0x9B, 0xF9,
+    0xC9, 0xC7, 0x95, 0xA2, 0x88, 0x66, 0xA6, 0x50,
+    0x4C, 0x0B, 0xF8, 0x60, 0xE8, 0xD2, 0xE0, 0x77,
+    0xD5, 0x4F, 0x53, 0xF9, 0x7D, 0xA1, 0xA4, 0xEE,
+    0x50, 0x91, 0x93, 0xF6, 0x1A, 0xC9, 0x61, 0xFD,
+    0x1B, 0x29, 0x1A, 0x4F, 0xE9, 0x22, 0x2A, 0x12,
+    0x6A, 0x77, 0xB7, 0x2F, 0xCE, 0xFF, 0x0C, 0x9B,
+
+    0xC1, 0x29, 0x7C, 0xAE, 0x59, 0xE8, 0x8E, 0xAB,
+    0xD3, 0xE5, 0xEF, 0xBD, 0x3B, 0xE5, 0x1C, 0xEB,
+    0x62, 0x59, 0xFA, 0x89, 0xE4, 0xD9, 0x73, 0x1C,
+    0x20, 0x07, 0x74, 0x91, 0x28, 0xBD, 0x0B, 0x48,
+    0x75, 0x36, 0x20, 0xF7, 0x1E, 0xE6, 0x82, 0x9A,
+    0xAA, 0x0E, 0x20, 0xB6, 0x17, 0x05, 0x04, 0x56,
+    0x2B, 0x4F, 0x3D, 0x11, 0xD1, 0x27, 0x90, 0xDA,
+    0x61, 0x1D, 0x70, 0xEE, 0x09, 0xFE, 0x11, 0xBB,
+    0xE6, 0xC1, 0xAD, 0x77, 0x74, 0x6D, 0x48, 0x0D,
+    0x14, 0x9B, 0xB2, 0x1B, 0x4C, 0x4D, 0xE7, 0x1A,
+    0x99, 0xFC, 0x2B, 0x9B, 0x77, 0x3A, 0x09, 0x40,
+    0xE8, 0x94, 0x1E, 0xFC, 0xA4, 0x21, 0xBA, 0x23,
+    0xE1, 0x67, 0x9B, 0xF1, 0x3F, 0xF9, 0x66, 0xF2,
+    0x04, 0x2A, 0xA6, 0x09, 0x40, 0xFD, 0x1E, 0x55,
+    0x24, 0xD4, 0x0F, 0x92, 0xA9, 0xDA, 0xD1, 0x73,
+    0x32, 0x88, 0x37, 0x84, 0x48, 0x9B, 0x48, 0x40,
+    0xFF, 0x36, 0xBA, 0x31, 0x35, 0xDE, 0x29, 0xE9,
+    0xE4, 0xBD, 0x0C, 0xDA, 0x18, 0x3A, 0xB0, 0xCA,
+    0xEE, 0xCE, 0xE5, 0x5B, 0x9F, 0x25, 0x56, 0x30,
+    0xC0, 0xF3, 0x7E, 0xA4, 0x17, 0x7B, 0x21, 0x17,
+    0x30, 0x05, 0xB7, 0x34, 0xAB, 0xE4, 0x77, 0x4D,
+    0x25, 0x88, 0xDB, 0x1B, 0xE2, 0xBB, 0xF4, 0xB7,
+    0xC2, 0x3D, 0xEF, 0xFE, 0x52, 0x30, 0x22, 0x43,
+    0xCC, 0x4F, 0x9F, 0x7E, 0x99, 0x76, 0xCC, 0xFA,
+    0x4F, 0xAC, 0x1A, 0x29, 0x2E, 0x54, 0x8E, 0x2D,
+    0xEC, 0x16, 0x15, 0x6A, 0xF0, 0x28, 0x90, 0x1B,
+    0xE9, 0x97, 0xD8, 0xAA, 0xAA, 0x92, 0xAF, 0xBD,
+    0xE2, 0xF8, 0x1B, 0x8B, 0x5B, 0x32, 0xA3, 0x08,
+    0xF0, 0xD8, 0x32, 0x9A, 0xBF, 0x46, 0x4F, 0xD7,
+    0xB3, 0xF7, 0xAC, 0x6F, 0xBF, 0xD5, 0x3D, 0x28,
+    0x88, 0x16, 0x84, 0x42, 0xC9, 0x09, 0x4A, 0x43,
+    0xDF, 0x15, 0x26, 0xBB, 0xFC, 0xE8, 0x17, 0x89,
+
+    0xEF, 0xDB, 0x45, 0xC4, 0xCA, 0x43, 0x5B, 0x2E,
+    0x4F, 0x96, 0x9E, 0xFF, 0xE9, 0x64, 0x3C, 0xDA,
+    0x7B, 0x96, 0xBE, 0xFC, 0xC9, 0x7D, 0x70, 0xEF,
+    0x71, 0x08, 0xAE, 0x52, 0x23, 0x16, 0x3F, 0x1E,
+    0x52, 0xF3, 0x0D, 0xE5, 0x33, 0x65, 0x10, 0xF1,
+    0x3F, 0x1E, 0x94, 0xCC, 0xE8, 0x5F, 0x80, 0xA8,
+    0x15, 0x51, 0x5E, 0xB1, 0x0E, 0xE2, 0x88, 0x33,
+    0xE3, 0xD5, 0x57, 0x53, 0x11, 0xD6, 0xCB, 0x98,
+    0x8B, 0x2B, 0x71, 0x21, 0x32, 0x97, 0xE2, 0x3B,
+    0x94, 0xA9, 0xFD, 0x0D, 0x05, 0x0A, 0xB6, 0x5E,
+    0x1F, 0x0E, 0x23, 0xD6, 0x2B, 0x27, 0xC6, 0xCA,
+    0x72, 0x2C, 0xF5, 0x28, 0xDC, 0x79, 0x95, 0x76,
+    0x23, 0x44, 0x37, 0xB2, 0x8D, 0x78, 0x9B, 0xBD,
+    0x74, 0x70, 0x87, 0xFF, 0xA2, 0x91, 0x63, 0xA4,
+    0x3A, 0x19, 0x6F, 0x29, 0x14, 0xEA, 0x74, 0xC8,
+    0xDC, 0x02, 0xE5, 0xF9, 0x65, 0xF4, 0x14, 0x52,
+    0x3C, 0xB6, 0x7E, 0x9C, 0x04, 0xDA, 0x84, 0xBA,
+    0xC9, 0x5F, 0x1B, 0x12, 0x49, 0x5B, 0xBE, 0xE8,
+    0x60, 0x90, 0x76, 0xEC, 0xB5, 0x18, 0x5D, 0x3A,
+    0xB3, 0x03, 0x30, 0x6E, 0x54, 0x93, 0x29, 0x49,
+    0x1B, 0x4C, 0x94, 0x9A, 0x01, 0xE7, 0x93, 0xC0,
+    0x17, 0x69, 0x76, 0x93, 0x37, 0xEF, 0x7E, 0xAC,
+    0xD7, 0xA6, 0x00, 0x8B, 0x26, 0xF7, 0x63, 0xE2,
+    0xAC, 0x77, 0xEE, 0x1F, 0xE1, 0xF1, 0x43, 0xAE,
+    0x59, 0x51, 0xF5, 0x15, 0x2E, 0xD9, 0x8B, 0x44,
+    0x55, 0x42, 0xD8, 0xA5, 0xDF, 0x5B, 0xA9, 0x3F,
+    0xBB, 0x97, 0x34, 0x2E, 0x1B, 0x3E, 0xEE, 0xA9,
+    0x65, 0xBC, 0xB3, 0x03, 0x5C, 0x4B, 0x6F, 0x17,
+    0x76, 0xE1, 0x68, 0xEF, 0x05, 0xF5, 0x6E, 0xF4,
+    0x8E, 0x96, 0xFA, 0xC9, 0x27, 0x1A, 0x1B, 0x58,
+    0x26, 0xFA, 0xB8, 0x56, 0x27, 0x5C, 0xD7, 0x54,
+    0x10, 0x0B, 0x3F, 0xD5, 0xE3, 0x26, 0x63, 0x64,
+
+    0x32, 0x74, 0x12, 0xAD, 0xD8, 0xDB, 0x0E, 0x0F,
+    0x82, 0xD3, 0x5F, 0x8E, 0xED, 0x9D, 0x5C, 0x96,
+    0x74, 0xF6, 0xA0, 0x85, 0xA3, 0x4D, 0xAE, 0x40,
+    0x00, 0x86, 0xB8, 0xB1, 0xDB, 0x92, 0x56, 0x51,
+    0xFD, 0xC2, 0x7A, 0x4D, 0x7C, 0x29, 0x4F, 0x53,
+    0x4D, 0xB9, 0xF6, 0xC7, 0x8B, 0x7F, 0xEC, 0x94,
+    0x38, 0x42, 0xB1, 0x1D, 0x51, 0x58, 0xA5, 0x19,
+    0xBA, 0x75, 0xAE, 0xF5, 0x1F, 0x31, 0xBD, 0x3C,
+    0xA6, 0x9E, 0xFC, 0x4C, 0xCE, 0x85, 0xA6, 0x10,
+    0x44, 0x5C, 0xCF, 0x2B, 0xA1, 0xBF, 0x49, 0x13,
+    0x1A, 0xDD, 0x2F, 0x27, 0x94, 0x85, 0xFB, 0x1A,
+    0xE1, 0x6F, 0x2A, 0xA4, 0x5C, 0xB8, 0x7E, 0x48,
+    0xD5, 0x94, 0x7B, 0xC0, 0xA2, 0x3A, 0xA2, 0x2B,
+    0x98, 0x08, 0x42, 0x93, 0x12, 0x9E, 0xB8, 0x27,
+    0x17, 0x72, 0x6A, 0x6A, 0xCC, 0x5C, 0x83, 0x73,
+    0x47, 0xFC, 0x2A, 0x38, 0x69, 0x5A, 0xBE, 0xCE,
+    0xF6, 0x06, 0xA8, 0xCC, 0xDD, 0x92, 0xB0, 0x63,
+    0x4E, 0x0F, 0x9A, 0x3B, 0x13, 0xBA, 0x75, 0x7B,
+    0xA0, 0xDC, 0x0D, 0xAE, 0x46, 0x8B, 0x08, 0xF4,
+    0x09, 0x80, 0x10, 0x0F, 0xC8, 0x97, 0x89, 0xD2,
+    0x85, 0x88, 0x31, 0x00, 0xAF, 0x6D, 0x02, 0x2F,
+    0x84, 0xD3, 0xAA, 0xD4, 0x11, 0xAE, 0x21, 0x38,
+    0xC7, 0xDB, 0x3A, 0xFF, 0x35, 0x69, 0x81, 0x60,
+    0xD6, 0xAF, 0x75, 0x98, 0xF4, 0x88, 0x51, 0x9C,
+    0x91, 0xCE, 0x27, 0x58, 0x7E, 0x66, 0xA2, 0xEE,
+    0xAA, 0x8B, 0x69, 0x56, 0x97, 0x0F, 0xC6, 0xD5,
+    0xF4, 0xB2, 0x1B, 0x13, 0xB2, 0x74, 0x81, 0x89,
+    0x12, 0xD3, 0x85, 0x71, 0xE1, 0xF5, 0x31, 0xE7,
+    0x90, 0xFF, 0xE8, 0xD8, 0x3E, 0xFA, 0xB2, 0x96,
+    0x2D, 0xDB, 0x4C, 0xD1, 0x4F, 0xCE, 0xEA, 0x10,
+    0x2B, 0xD0, 0xE8, 0xA8, 0x84, 0x09, 0x5E, 0x20,
+    0xCF, 0xE4, 0x08, 0xA7, 0xAC, 0x02, 0x52, 0x76,
+};
+
+static const unsigned char ffdhe3072_T[5 * 384] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA4, 0x0F, 0x57, 0x4E, 0xBA, 0x89, 0x6A, 0xCA,
+    0xA0, 0x47, 0x53, 0xBF, 0xB1, 0x85, 0x86, 0x1C,
+    0x4E, 0x8C, 0x74, 0xF8, 0x63, 0xA5, 0x92, 0xD4,
+    0xAC, 0x3D, 0x93, 0x7D, 0xD7, 0x37, 0x98, 0x08,
+    0x66, 0xD8, 0xC4, 0x63, 0xB6, 0xC9, 0x82, 0x0D,
+    0x05, 0xA0, 0x39, 0x39, 0x39, 0xE7, 0x14, 0x4E,
+    0x12, 0xFC, 0x9B, 0xFA, 0xA2, 0x77, 0x3D, 0x0A,
+    0x58, 0x41, 0xC2, 0x54, 0x54, 0x05, 0x35, 0x3D,
+    0xB7, 0x98, 0x15, 0xC1, 0x41, 0xF3, 0x22, 0x5E,
+    0xF5, 0x39, 0x35, 0x55, 0x84, 0x25, 0xCA, 0x18,
+    0x95, 0x51, 0xD9, 0x43, 0x01, 0x50, 0x6D, 0x94,
+    0xCF, 0x61, 0xE7, 0x1E, 0x3E, 0x32, 0xE9, 0x10,
+    0x3A, 0xB2, 0xEC, 0x4A, 0x18, 0x20, 0x2F, 0x1B,
+    0xC4, 0x1D, 0x4E, 0xBD, 0x92, 0xA4, 0x31, 0x95,
+    0x9E, 0xA6, 0x6B, 0x61, 0x6F, 0x8B, 0x0D, 0x0A,
+    0x87, 0xEA, 0x9C, 0xFA, 0x99, 0xB6, 0x09, 0x3C,
+    0x5D, 0xEE, 0xAD, 0x68, 0x9A, 0x6E, 0x38, 0x08,
+    0x8D, 0x2A, 0x4A, 0x91, 0x3E, 0x50, 0x17, 0x2F,
+    0xC5, 0x61, 0x7A, 0xB8, 0x43, 0x8D, 0x64, 0x16,
+    0xA3, 0x52, 0x24, 0x31, 0x39, 0x1A, 0x89, 0xCD,
+    0xE9, 0xF0, 0xB0, 0x6E, 0x23, 0xEB, 0x25, 0x1E,
+    0xC3, 0xFA, 0x06, 0x3C, 0x64, 0x10, 0x3A, 0x26,
+    0x7F, 0x97, 0xF6, 0x65, 0xAF, 0x97, 0xA1, 0x3C,
+    0xDD, 0x1A, 0x02, 0xC6, 0x2C, 0xF4, 0xF8, 0x00,
+    0xE3, 0x61, 0xDB, 0x9A, 0x22, 0x1A, 0xFC, 0xF8,
+    0x78, 0x03, 0x89, 0xC9, 0x67, 0x20, 0xA5, 0x19,
+    0x88, 0x94, 0x06, 0x87, 0xA2, 0x7B, 0xBF, 0xF4,
+    0x74, 0xE2, 0x1C, 0xF9, 0x05, 0xD2, 0xF8, 0x9A,
+    0x72, 0x19, 0x6B, 0xB2, 0x7C, 0x9A, 0x20, 0x0A,
+    0xEF, 0x29, 0x7B, 0x8F, 0x3D, 0xC0, 0x60, 0x46,
+    0x43, 0x95, 0x49, 0x89, 0x35, 0xCD, 0xF9, 0x48,
+    0x87, 0x96, 0x16, 0x42, 0x0C, 0xC7, 0xFB, 0x8F,
+    0x3C, 0x97, 0x20, 0x6C, 0x52, 0x32, 0x6D, 0xF1,
+    0x0A, 0x4D, 0xC5, 0xB2, 0xDC, 0x10, 0x10, 0x23,
+    0x4C, 0xE6, 0x9E, 0x0A, 0x7C, 0xF2, 0x4D, 0xC6,
+    0xA2, 0x03, 0xD9, 0xEC, 0xF5, 0xD8, 0xDB, 0x1E,
+    0x97, 0xD9, 0xE6, 0xD8, 0x87, 0x79, 0x0D, 0x76,
+    0x16, 0x05, 0x77, 0x5A, 0x3A, 0x51, 0x64, 0x59,
+    0x36, 0x1A, 0x3B, 0xC3, 0x1C, 0x15, 0x68, 0x01,
+    0x46, 0xA2, 0xFA, 0xA8, 0xC6, 0xC4, 0x12, 0xC2,
+    0x2F, 0x25, 0xA8, 0x75, 0xBB, 0x93, 0x8B, 0xE4,
+    0xA8, 0x75, 0xBC, 0xD0, 0xC9, 0xE4, 0x2A, 0x4B,
+    0xC4, 0x80, 0xCB, 0x7A, 0x54, 0x77, 0x6F, 0x63,
+    0xEA, 0x86, 0x5F, 0x28, 0x0B, 0x58, 0x44, 0x21,
+    0x87, 0xC9, 0xBE, 0x23, 0x80, 0x54, 0xC5, 0x07,
+    0xB4, 0x37, 0xC5, 0xA9, 0x32, 0x73, 0xA3, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+
+    0x9B, 0x83, 0x79, 0x4F, 0xCF, 0x43, 0xF0, 0xCA,
+    0x7F, 0x09, 0xBE, 0xAE, 0x08, 0x7E, 0x4D, 0x65,
+    0x9B, 0x23, 0x71, 0xD1, 0x78, 0x20, 0xFE, 0x52,
+    0x1B, 0x15, 0xB4, 0x0A, 0x2A, 0x69, 0xC1, 0x1D,
+    0xEC, 0xEF, 0x51, 0xA5, 0xEF, 0x99, 0x21, 0xE3,
+    0x4F, 0xA8, 0xC3, 0x6C, 0x17, 0xEC, 0xD1, 0xF0,
+    0x7F, 0x4C, 0x2C, 0x70, 0x06, 0x0A, 0x4B, 0x12,
+    0x77, 0xC5, 0x81, 0x5A, 0x03, 0xA5, 0xDB, 0x21,
+    0x12, 0x83, 0xBF, 0x02, 0xBA, 0x10, 0x66, 0x53,
+    0xB9, 0x71, 0xF8, 0x25, 0x3A, 0x0D, 0x8E, 0xF5,
+    0x79, 0x74, 0x28, 0xB1, 0x0F, 0xAF, 0x5F, 0xD7,
+    0x5E, 0xA7, 0xAC, 0xBF, 0x11, 0x69, 0x00, 0x0F,
+    0x66, 0x95, 0xCA, 0x1C, 0x02, 0xF9, 0x35, 0x22,
+    0x6D, 0x44, 0x91, 0x93, 0xF6, 0xED, 0xBC, 0xFC,
+    0x37, 0xD9, 0x49, 0x10, 0xF3, 0x56, 0x28, 0x33,
+    0x8E, 0x93, 0xD7, 0xB3, 0xE9, 0xC1, 0x43, 0x65,
+    0xD4, 0x4B, 0x8D, 0x21, 0xF5, 0x09, 0x2B, 0x09,
+    0x96, 0xE4, 0xE9, 0x8D, 0x4F, 0xFC, 0x4F, 0xD3,
+    0x50, 0xC4, 0x4A, 0xBC, 0xB4, 0x52, 0x88, 0x11,
+    0x5B, 0x04, 0x0E, 0x91, 0x9E, 0xE2, 0xBA, 0xCE,
+    0x63, 0x4B, 0x88, 0x7E, 0xB6, 0x79, 0x7D, 0x90,
+    0xE6, 0x4E, 0xB4, 0x9F, 0x57, 0xFD, 0x77, 0x08,
+    0x18, 0x81, 0x3F, 0x94, 0x07, 0x82, 0xE8, 0x66,
+    0xAC, 0xE9, 0x47, 0x95, 0x04, 0x8A, 0xC1, 0x26,
+    0x00, 0x5D, 0xED, 0xE5, 0x8C, 0x7C, 0x52, 0xFC,
+    0xA8, 0x55, 0xC0, 0xFB, 0xB5, 0x3E, 0x7A, 0x4E,
+    0x0C, 0x98, 0xFE, 0x0D, 0x8D, 0x9A, 0x06, 0xCA,
+    0xFB, 0x4B, 0x2B, 0x97, 0x0D, 0x19, 0xC8, 0xAC,
+    0x03, 0x12, 0xAB, 0x4D, 0x47, 0x56, 0xAC, 0x90,
+    0xB6, 0xC7, 0xEA, 0x6C, 0x0F, 0x37, 0x93, 0x7D,
+    0x14, 0x07, 0xFE, 0xE7, 0x15, 0xBD, 0xC0, 0x7F,
+    0x8D, 0xAF, 0x62, 0x66, 0x9F, 0x8F, 0xA3, 0x80,
+    0x73, 0x5B, 0x78, 0x43, 0x6E, 0x28, 0xAA, 0x36,
+    0x09, 0x7A, 0xEA, 0x92, 0xAB, 0xF1, 0xC1, 0x2B,
+    0x4B, 0x34, 0xC3, 0xDF, 0xA4, 0x2F, 0xFB, 0x29,
+    0x31, 0x3B, 0x4E, 0x8B, 0x3D, 0x02, 0xD2, 0x3A,
+    0xD7, 0xFB, 0x1C, 0x3E, 0x69, 0x78, 0xB5, 0xC4,
+    0x2D, 0x6C, 0x0B, 0x06, 0x6B, 0x3D, 0x60, 0x2A,
+    0xE1, 0xAF, 0xE5, 0xAF, 0x1C, 0x50, 0x9E, 0x8D,
+    0x3D, 0x17, 0x6A, 0x45, 0xE1, 0xEC, 0x37, 0x97,
+    0x5C, 0x6C, 0x98, 0xA8, 0xAE, 0xB0, 0x46, 0xAC,
+    0x86, 0x81, 0x55, 0xAB, 0x93, 0x40, 0x29, 0x23,
+    0x01, 0x9A, 0xAC, 0xBA, 0x15, 0xF9, 0xDB, 0x61,
+    0x1A, 0x98, 0xEC, 0xAF, 0x70, 0x37, 0x62, 0xD0,
+    0x8D, 0x45, 0x70, 0x60, 0x0B, 0xB3, 0x57, 0xD3,
+    0xB8, 0x60, 0x28, 0x3D, 0x79, 0xC6, 0x90, 0x59,
+    0x07, 0x33, 0xCB, 0x05, 0xB8, 0x05, 0x17, 0xD3,
+    0xE4, 0x4E, 0x4B, 0xC5, 0xC1, 0xF1, 0xEC, 0x0B,
+
+    0x95, 0xA3, 0x60, 0x0A, 0xC3, 0xBC, 0x11, 0x21,
+    0x84, 0xF5, 0x58, 0x05, 0x8F, 0x00, 0x00, 0xF2,
+    0x79, 0x11, 0xB9, 0x16, 0xE7, 0xA8, 0x40, 0x72,
+    0xA7, 0xFA, 0xFA, 0x96, 0xAE, 0xC8, 0x2A, 0xD7,
+    0xB1, 0x8A, 0x20, 0xB2, 0xA8, 0x56, 0x4C, 0xC6,
+    0xBE, 0x3D, 0x71, 0x8D, 0x6B, 0x6B, 0x0C, 0x19,
+    0xC5, 0xEA, 0x94, 0x1D, 0x38, 0x14, 0xAA, 0x71,
+    0x08, 0xFE, 0xDC, 0xC1, 0xA4, 0x85, 0x90, 0x62,
+    0xE6, 0xF2, 0x78, 0x93, 0x18, 0x7D, 0x55, 0xEF,
+    0x6C, 0x48, 0x11, 0x54, 0x6A, 0xED, 0x33, 0xB6,
+    0x09, 0x02, 0xE6, 0xD8, 0x2D, 0xDF, 0x80, 0x5E,
+    0x16, 0x17, 0x36, 0x1D, 0xEF, 0xA5, 0x63, 0xDB,
+    0x63, 0x97, 0x30, 0x19, 0xDF, 0x9D, 0x01, 0x24,
+    0x7D, 0xE0, 0xD1, 0xEF, 0xDA, 0x17, 0xD5, 0x73,
+    0x2D, 0xBD, 0xC6, 0xC8, 0x66, 0x50, 0x9E, 0x2F,
+    0x40, 0xF3, 0xE1, 0x78, 0xC5, 0x7A, 0x52, 0xF0,
+    0xE6, 0xFA, 0xA1, 0x20, 0xF0, 0xAF, 0x60, 0xBD,
+    0x9B, 0xEA, 0x61, 0x8E, 0x82, 0x6F, 0x59, 0x75,
+    0x3D, 0x56, 0x4C, 0xAA, 0xCB, 0x17, 0x58, 0xD0,
+    0xBB, 0x12, 0x59, 0x2D, 0xDB, 0x3B, 0x70, 0xB0,
+    0xAD, 0xF3, 0x40, 0x13, 0xAC, 0x74, 0xB8, 0xA2,
+    0xDD, 0xAA, 0xDC, 0x37, 0x46, 0x89, 0xDA, 0xA2,
+    0xA2, 0xAE, 0x17, 0x84, 0x67, 0x46, 0xE9, 0x41,
+    0x32, 0x4B, 0x0D, 0x00, 0xF9, 0xA2, 0x35, 0x1B,
+    0x3C, 0xAB, 0xA6, 0x11, 0x39, 0xCC, 0x6F, 0x89,
+    0xCC, 0x78, 0xBF, 0x7D, 0x2C, 0x5F, 0xD8, 0xA3,
+    0x98, 0x1A, 0xC8, 0xA3, 0xA2, 0x4F, 0x10, 0x45,
+    0x6B, 0x90, 0x4A, 0x82, 0xC3, 0xD2, 0x30, 0x97,
+    0x70, 0x54, 0xCF, 0xD1, 0x10, 0x79, 0x61, 0xF2,
+    0x58, 0x28, 0x82, 0xBE, 0x18, 0x69, 0x17, 0xA6,
+    0xE7, 0x36, 0xFD, 0x26, 0x2C, 0x00, 0x2B, 0xB2,
+    0x7E, 0x38, 0x03, 0xC4, 0xFD, 0x15, 0x4F, 0x86,
+    0x04, 0x81, 0x73, 0x3F, 0x4A, 0x9C, 0x2A, 0x1B,
+    0x79, 0x76, 0xFE, 0x66, 0x17, 0x5C, 0x7C, 0xFC,
+    0x81, 0x84, 0x25, 0x79, 0x25, 0x2F, 0x01, 0x39,
+    0x57, 0x5F, 0x0C, 0xE3, 0xF6, 0x16, 0x13, 0xAB,
+    0x67, 0x70, 0xF4, 0x7E, 0xBB, 0x53, 0xC8, 0xE2,
+    0xA3, 0xD2, 0xC8, 0x0E, 0xB2, 0x32, 0x25, 0x61,
+    0x00, 0xA9, 0x7F, 0x24, 0x82, 0x8D, 0x22, 0xC8,
+    0x43, 0x8D, 0xEE, 0x93, 0x2B, 0xB7, 0xE1, 0x1F,
+    0xF9, 0x57, 0x43, 0x75, 0x8F, 0x02, 0x0B, 0x4F,
+    0x56, 0xDF, 0x0D, 0x66, 0xD9, 0x5F, 0xF2, 0x3B,
+    0xA6, 0xDA, 0x59, 0x2A, 0xCF, 0x4A, 0x07, 0x59,
+    0xF3, 0x69, 0x9E, 0x16, 0xF5, 0x78, 0xE8, 0x11,
+    0x1D, 0x84, 0xB3, 0xB0, 0xB9, 0x51, 0x01, 0xBE,
+    0xC9, 0x47, 0x03, 0xC4, 0xBF, 0xB3, 0xBF, 0xD0,
+    0xD1, 0x3B, 0x6C, 0xD0, 0x16, 0xFB, 0x32, 0xD2,
+    0x9E, 0xA6, 0x52, 0x87, 0x76, 0xDF, 0x1A, 0xA6,
+
+    0x3C, 0xB8, 0x29, 0xC0, 0x28, 0xD5, 0xEB, 0x0A,
+    0x80, 0x75, 0xB4, 0xCA, 0x61, 0x61, 0x74, 0xAB,
+    0xB1, 0xAA, 0x5C, 0x1D, 0x7E, 0xFB, 0x15, 0x31,
+    0xA4, 0x37, 0x6F, 0x44, 0x70, 0x3D, 0xD0, 0xD0,
+    0x46, 0xC7, 0x99, 0x74, 0xE3, 0xB6, 0xB4, 0xD0,
+    0x63, 0x82, 0x53, 0xB7, 0x4D, 0x6A, 0xCA, 0xC1,
+    0x19, 0x4F, 0x7A, 0xAF, 0x73, 0x67, 0x47, 0x27,
+    0xEB, 0x9B, 0xE8, 0xED, 0xCE, 0xCA, 0x3D, 0xB8,
+    0xF1, 0x23, 0xCA, 0x78, 0x85, 0x0D, 0xB2, 0x8F,
+    0xB9, 0x1A, 0x27, 0x97, 0x64, 0xEF, 0x07, 0x5F,
+    0xB7, 0x98, 0x30, 0x11, 0x0C, 0x16, 0xE3, 0x85,
+    0xEA, 0x32, 0x58, 0x99, 0x28, 0x98, 0xD5, 0x2D,
+    0x5B, 0xDF, 0x47, 0x67, 0x13, 0x79, 0x91, 0x92,
+    0x5B, 0x63, 0x26, 0xED, 0x59, 0xA6, 0x69, 0x81,
+    0xC9, 0x4B, 0x9E, 0x6C, 0x1F, 0x8C, 0x8A, 0x53,
+    0xD3, 0x61, 0x32, 0x89, 0x3C, 0x9A, 0x53, 0xF3,
+    0x86, 0x96, 0xA0, 0xD7, 0x15, 0x35, 0x88, 0xCF,
+    0x3A, 0xFB, 0xFF, 0x10, 0xF7, 0x41, 0xF4, 0xB8,
+    0xD0, 0x09, 0xC3, 0x58, 0xF4, 0x50, 0xEC, 0x52,
+    0xF4, 0x7A, 0xB5, 0x1A, 0x83, 0x2F, 0x28, 0x04,
+    0x02, 0x6C, 0xA1, 0x30, 0xBA, 0x65, 0x8C, 0xCF,
+    0xF8, 0x02, 0xE4, 0xE2, 0xCE, 0x70, 0xBC, 0xC8,
+    0x2C, 0x90, 0x74, 0x0D, 0x95, 0x8F, 0x4A, 0xE1,
+    0x05, 0x83, 0x0F, 0x1B, 0x30, 0xDB, 0xFD, 0x01,
+    0x77, 0x54, 0x70, 0xB6, 0x4C, 0x7A, 0x3B, 0xD1,
+    0xE0, 0x2F, 0x6C, 0x55, 0x25, 0xA6, 0x0D, 0xDA,
+    0x5E, 0x3D, 0x3D, 0xAB, 0x76, 0xA5, 0xD5, 0xDD,
+    0xC4, 0xCD, 0xD9, 0x2F, 0xAD, 0xFA, 0x91, 0x53,
+    0xC8, 0x17, 0xFC, 0x5F, 0xF6, 0x86, 0xCF, 0x41,
+    0x9F, 0x5F, 0x30, 0xA5, 0xD4, 0x19, 0x11, 0x87,
+    0xB0, 0x5C, 0x3F, 0x1D, 0x20, 0x22, 0xFD, 0x58,
+    0xF3, 0x4D, 0x89, 0x68, 0x15, 0x55, 0xAA, 0x8D,
+    0x72, 0x7C, 0xF9, 0xDD, 0xF8, 0x41, 0xDB, 0x51,
+    0xBA, 0xFB, 0x29, 0x50, 0x5F, 0x87, 0xAA, 0x44,
+    0x87, 0xA5, 0x57, 0xEF, 0x0A, 0x34, 0x3F, 0x98,
+    0x36, 0xD3, 0xEA, 0x5D, 0x4D, 0x80, 0xD9, 0xC3,
+    0x58, 0x78, 0x51, 0x60, 0xF8, 0xD5, 0x21, 0xC8,
+    0x51, 0xFE, 0xCB, 0x6C, 0x1B, 0x23, 0x98, 0xFF,
+    0x01, 0x75, 0xCA, 0x5E, 0x04, 0x93, 0xB5, 0x0E,
+    0x6A, 0xC0, 0x4F, 0x36, 0x91, 0xCE, 0xD9, 0x58,
+    0x23, 0x26, 0x01, 0xC1, 0xC7, 0x4C, 0xFA, 0x79,
+    0xCF, 0x44, 0x54, 0xC3, 0x26, 0xC2, 0xDC, 0xC6,
+    0xB5, 0x5A, 0x25, 0x6E, 0x2E, 0xCC, 0x6F, 0xB9,
+    0x92, 0x5B, 0x0F, 0xE2, 0xA8, 0x4A, 0xC5, 0x04,
+    0xE0, 0x0A, 0xD4, 0x7A, 0x9E, 0x88, 0x08, 0x83,
+    0x6D, 0xD7, 0x0D, 0xFA, 0x2E, 0x3A, 0x1A, 0x51,
+    0xEC, 0xC6, 0xDB, 0x0B, 0x33, 0x02, 0xD8, 0x0E,
+    0x3C, 0x88, 0x41, 0x8C, 0x17, 0xE4, 0xDD, 0x05,
+
+    0xC6, 0xB6, 0x1E, 0x78, 0x1B, 0x8C, 0x10, 0xB1,
+    0x7A, 0x15, 0x03, 0x64, 0x95, 0x8D, 0x98, 0x84,
+    0xF3, 0xC8, 0xDC, 0xC1, 0x1E, 0xD0, 0xF5, 0x7A,
+    0xAA, 0x52, 0xA6, 0x25, 0x69, 0x82, 0xFB, 0xA7,
+    0xC9, 0xFB, 0x59, 0x25, 0x09, 0xF9, 0x13, 0xE6,
+    0x46, 0x7B, 0x18, 0x74, 0x1A, 0x92, 0xB3, 0x32,
+    0x98, 0x30, 0xE9, 0x4B, 0x5E, 0xA8, 0x71, 0x8E,
+    0x7B, 0xAD, 0xD4, 0x4E, 0xDE, 0xA2, 0x42, 0x71,
+    0x97, 0xCF, 0xBB, 0x65, 0xDF, 0xBD, 0x7D, 0x71,
+    0x12, 0x22, 0x33, 0xA2, 0x9B, 0x69, 0x56, 0xD8,
+    0xE6, 0xF8, 0xB0, 0xA6, 0x0A, 0xDA, 0x41, 0x8D,
+    0x5D, 0x9D, 0xBC, 0x56, 0xF4, 0x7B, 0xA2, 0x4A,
+    0x55, 0x76, 0x7E, 0xFD, 0xF7, 0x10, 0xA2, 0xF3,
+    0x1F, 0x32, 0xCD, 0x78, 0x71, 0xE5, 0x79, 0x80,
+    0x8F, 0xD8, 0x8F, 0x4E, 0xD1, 0x1F, 0x3D, 0xF1,
+    0x7B, 0xD4, 0x93, 0xCB, 0x2B, 0x9D, 0xFB, 0x84,
+    0xAD, 0x8A, 0x6F, 0xA0, 0xFD, 0xB1, 0xDA, 0x50,
+    0xA0, 0x05, 0xD1, 0xBD, 0xE2, 0xC1, 0xED, 0x15,
+    0xD5, 0x35, 0x9E, 0x47, 0xDB, 0x94, 0x55, 0x3F,
+    0x2A, 0x1D, 0xF5, 0x27, 0x05, 0xBD, 0x4B, 0xEF,
+    0x27, 0x8B, 0xF2, 0xBD, 0x2E, 0x62, 0x1A, 0x34,
+    0xF5, 0xF4, 0xEB, 0xE8, 0xDD, 0xD9, 0x4A, 0x05,
+    0x5B, 0x25, 0x8B, 0x6B, 0xE8, 0x55, 0xA7, 0x01,
+    0x14, 0xC7, 0x26, 0x7B, 0xEB, 0x27, 0x6F, 0x04,
+    0x79, 0x9F, 0x87, 0xD5, 0xD6, 0xD5, 0x28, 0xC8,
+    0xB3, 0x8F, 0x2D, 0x4F, 0xDB, 0x41, 0xDD, 0x1B,
+    0x57, 0x03, 0x22, 0xD5, 0x9E, 0xDD, 0xF7, 0xC2,
+    0x77, 0x51, 0x61, 0x03, 0xB8, 0x6F, 0x8B, 0xB3,
+    0xEE, 0xDB, 0x0A, 0x8E, 0x9F, 0x3E, 0x99, 0xCF,
+    0xCB, 0xD5, 0x29, 0x9F, 0x6D, 0xF8, 0x97, 0xFC,
+    0xBC, 0xAE, 0xBF, 0x1A, 0x75, 0x44, 0x41, 0xCF,
+    0xA8, 0xDA, 0xC0, 0xAB, 0xE3, 0xD7, 0x64, 0x2C,
+    0x04, 0xBA, 0x3E, 0xDE, 0xCF, 0xC8, 0x19, 0xC3,
+    0x69, 0x19, 0x4F, 0xB3, 0x48, 0x67, 0x60, 0xB2,
+    0x17, 0xDA, 0xAA, 0x76, 0x4D, 0xE5, 0xC0, 0x3F,
+    0xD4, 0x5A, 0xAB, 0xA9, 0x6C, 0x03, 0xF2, 0x8D,
+    0x86, 0x49, 0x6C, 0xEB, 0x2A, 0xF2, 0x13, 0xD8,
+    0xDB, 0x44, 0xB9, 0x53, 0x92, 0xFB, 0xF9, 0xF5,
+    0x09, 0xE3, 0x4C, 0x9B, 0x56, 0xCD, 0xCF, 0x04,
+    0x35, 0xED, 0x80, 0x85, 0xD9, 0x6D, 0x4D, 0x66,
+    0x0B, 0xE7, 0x61, 0xDC, 0x67, 0x5F, 0xF8, 0x29,
+    0xC9, 0x54, 0x19, 0xDB, 0xBA, 0x81, 0xA0, 0xE6,
+    0x67, 0xF0, 0x57, 0xE7, 0xA4, 0x8D, 0xCB, 0x57,
+    0x18, 0xF2, 0xD1, 0x38, 0xFB, 0xAB, 0x54, 0x4C,
+    0x19, 0xFE, 0x21, 0xB3, 0xB0, 0x7F, 0x3C, 0x0C,
+    0x5F, 0x10, 0xEA, 0xEE, 0xF7, 0x65, 0x16, 0x2B,
+    0x08, 0xB8, 0x84, 0x90, 0x77, 0x10, 0xBE, 0x84,
+    0x3D, 0xBD, 0xCA, 0xDA, 0x34, 0xE1, 0x0F, 0x7B,
+};
+
+static const unsigned char ffdhe4096_T[5 * 512] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA4, 0x0F, 0x57, 0x4E, 0xBA, 0x89, 0x6A, 0xCA,
+    0xA0, 0x47, 0x53, 0xBF, 0xB1, 0x85, 0x86, 0x1C,
+    0x4E, 0x8C, 0x74, 0xF8, 0x63, 0xA5, 0x92, 0xD4,
+    0xAC, 0x3D, 0x93, 0x7D, 0xD7, 0x37, 0x98, 0x08,
+    0x66, 0xD8, 0xC4, 0x63, 0xB6, 0xC9, 0x82, 0x0D,
+    0x05, 0xA0, 0x39, 0x39, 0x39, 0xE7, 0x14, 0x4E,
+    0x12, 0xFC, 0x9B, 0xFA, 0xA2, 0x77, 0x3D, 0x0A,
+    0x58, 0x41, 0xC2, 0x54, 0x54, 0x05, 0x35, 0x3D,
+    0xB7, 0x98, 0x15, 0xC1, 0x41, 0xF3, 0x22, 0x5E,
+    0xF5, 0x39, 0x35, 0x55, 0x84, 0x25, 0xCA, 0x18,
+    0x95, 0x51, 0xD9, 0x43, 0x01, 0x50, 0x6D, 0x94,
+    0xCF, 0x61, 0xE7, 0x1E, 0x3E, 0x32, 0xE9, 0x10,
+    0x3A, 0xB2, 0xEC, 0x4A, 0x18, 0x20, 0x2F, 0x1B,
+    0xC4, 0x1D, 0x4E, 0xBD, 0x92, 0xA4, 0x31, 0x95,
+    0x9E, 0xA6, 0x6B, 0x61, 0x6F, 0x8B, 0x0D, 0x0A,
+    0x87, 0xEA, 0x9C, 0xFA, 0x99, 0xB6, 0x09, 0x3C,
+    0x5D, 0xEE, 0xAD, 0x68, 0x9A, 0x6E, 0x38, 0x08,
+    0x8D, 0x2A, 0x4A, 0x91, 0x3E, 0x50, 0x17, 0x2F,
+    0xC5, 0x61, 0x7A, 0xB8, 0x43, 0x8D, 0x64, 0x16,
+    0xA3, 0x52, 0x24, 0x31, 0x39, 0x1A, 0x89, 0xCD,
+    0xE9, 0xF0, 0xB0, 0x6E, 0x23, 0xEB, 0x25, 0x1E,
+    0xC3, 0xFA, 0x06, 0x3C, 0x64, 0x10, 0x3A, 0x26,
+    0x7F, 0x97, 0xF6, 0x65, 0xAF, 0x97, 0xA1, 0x3C,
+    0xDD, 0x1A, 0x02, 0xC6, 0x2C, 0xF4, 0xF8, 0x00,
+    0xE3, 0x61, 0xDB, 0x9A, 0x22, 0x1A, 0xFC, 0xF8,
+    0x78, 0x03, 0x89, 0xC9, 0x67, 0x20, 0xA5, 0x19,
+    0x88, 0x94, 0x06, 0x87, 0xA2, 0x7B, 0xBF, 0xF4,
+    0x74, 0xE2, 0x1C, 0xF9, 0x05, 0xD2, 0xF8, 0x9A,
+    0x72, 0x19, 0x6B, 0xB2, 0x7C, 0x9A, 0x20, 0x0A,
+    0xEF, 0x29, 0x7B, 0x8F, 0x3D, 0xC0, 0x60, 0x46,
+    0x43, 0x95, 0x49, 0x89, 0x35, 0xCD, 0xF9, 0x48,
+    0x87, 0x96, 0x16, 0x42, 0x0C, 0xC7, 0xFB, 0x8F,
+    0x3C, 0x97, 0x20, 0x6C, 0x52, 0x32, 0x6D, 0xF1,
+    0x0A, 0x4D, 0xC5, 0xB2, 0xDC, 0x10, 0x10, 0x23,
+    0x4C, 0xE6, 0x9E, 0x0A, 0x7C, 0xF2, 0x4D, 0xC6,
+    0xA2, 0x03, 0xD9, 0xEC, 0xF5, 0xD8, 0xDB, 0x1E,
+    0x97, 0xD9, 0xE6, 0xD8, 0x87, 0x79, 0x0D, 0x76,
+    0x16, 0x05, 0x77, 0x5A, 0x3A, 0x51, 0x64, 0x59,
+    0x36, 0x1A, 0x3B, 0xC3, 0x1C, 0x15, 0x68, 0x01,
+    0x46, 0xA2, 0xFA, 0xA8, 0xC6, 0xC4, 0x12, 0xC2,
+    0x2F, 0x25, 0xA8, 0x75, 0xBB, 0x93, 0x8B, 0xE4,
+    0xA8, 0x75, 0xBC, 0xD0, 0xC9, 0xE4, 0x2A, 0x4B,
+    0xC4, 0x80, 0xCB, 0x7A, 0x54, 0x77, 0x6F, 0x63,
+    0xEA, 0x86, 0x5F, 0x28, 0x0B, 0x58, 0x44, 0x21,
+    0x87, 0xC9, 0xBE, 0x23, 0x80, 0x54, 0xC5, 0x07,
+    0xB4, 0x37, 0xC5, 0xA9, 0x32, 0xC3, 0xC2, 0x1D,
+    0x23, 0x21, 0x5A, 0x79, 0xD3, 0x64, 0x16, 0x09,
+    0x0D, 0x9E, 0x2C, 0x36, 0x34, 0xEF, 0x50, 0x92,
+    0xA7, 0x05, 0x41, 0x7A, 0x52, 0xC1, 0x25, 0xCF,
+    0x11, 0x38, 0x61, 0xC5, 0x55, 0xF9, 0x7F, 0xF6,
+    0xF0, 0x15, 0x48, 0xB5, 0x03, 0x9C, 0x67, 0x0B,
+    0x1D, 0x94, 0x6E, 0xF2, 0x20, 0x97, 0x9C, 0xEA,
+    0x25, 0x2B, 0xC3, 0xFD, 0xA4, 0xC3, 0x2F, 0x9A,
+    0xAD, 0xF1, 0x3F, 0xEA, 0xDC, 0xFD, 0x9E, 0x77,
+    0x24, 0x71, 0x0E, 0x0D, 0x1C, 0xA5, 0xFF, 0x8F,
+    0xED, 0xAC, 0xCC, 0xB9, 0x98, 0x68, 0xE9, 0x0B,
+    0xCB, 0xC4, 0x8D, 0x85, 0x1D, 0x7F, 0xFF, 0x87,
+    0xAB, 0x62, 0x62, 0xAC, 0x0C, 0xE5, 0xEA, 0x67,
+    0xEA, 0xFA, 0xDC, 0x64, 0x62, 0x6D, 0x04, 0x60,
+    0xE2, 0x6C, 0x95, 0x4B, 0x00, 0xEE, 0xB7, 0x29,
+    0x64, 0x94, 0xAF, 0x5C, 0x17, 0x7C, 0xFA, 0x3C,
+    0x72, 0xEB, 0xFF, 0x03, 0x43, 0x35, 0x41, 0x2A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+
+    0x27, 0x76, 0xE4, 0x95, 0xDF, 0x6A, 0xE1, 0x25,
+    0xD4, 0xBB, 0xCB, 0xC4, 0xD6, 0x23, 0x6F, 0xB1,
+    0xDE, 0x1F, 0x53, 0x05, 0xE9, 0x5E, 0xA5, 0xF1,
+    0x1A, 0x15, 0x20, 0xCF, 0x57, 0x5F, 0xF5, 0xB8,
+    0x48, 0x8A, 0xD1, 0xE2, 0xB2, 0x4F, 0x01, 0x68,
+    0x68, 0x26, 0x43, 0x8F, 0x20, 0x13, 0xB6, 0x47,
+    0x39, 0xC4, 0x34, 0x66, 0x95, 0x23, 0xF7, 0x64,
+    0x1D, 0xBD, 0xBF, 0xF8, 0x9B, 0x83, 0x10, 0xBA,
+    0x89, 0x23, 0x01, 0x82, 0xDF, 0xDB, 0xCD, 0x19,
+    0xB4, 0xAB, 0x6F, 0xD5, 0xDC, 0x6A, 0x4B, 0x64,
+    0x1D, 0x7F, 0x6A, 0x40, 0x43, 0xA9, 0x9F, 0xB6,
+    0x7C, 0x18, 0xFF, 0x2B, 0x08, 0x80, 0x3C, 0x5A,
+    0x3F, 0x5D, 0x90, 0x36, 0x08, 0x28, 0x95, 0x93,
+    0xB1, 0x49, 0x0B, 0xB6, 0x0A, 0xDA, 0xC7, 0xAB,
+    0xBA, 0xA3, 0xE8, 0x75, 0x25, 0x82, 0xCF, 0xBB,
+    0xD8, 0x85, 0x56, 0x99, 0xF3, 0xC5, 0x15, 0xDD,
+    0x40, 0xD0, 0x35, 0xAA, 0xCF, 0x4E, 0xF6, 0x9C,
+    0xB1, 0x51, 0xA9, 0x75, 0x9E, 0xD3, 0x00, 0xCB,
+    0x3E, 0x68, 0xAE, 0x2D, 0xB0, 0x62, 0x5C, 0xC7,
+    0x10, 0x05, 0xB2, 0xBB, 0xB7, 0x0E, 0x88, 0x60,
+    0x3A, 0x2A, 0x88, 0x68, 0x8E, 0xF6, 0xE2, 0xF5,
+    0xA0, 0x09, 0x8D, 0xF0, 0xD4, 0xB3, 0x64, 0x8A,
+    0x39, 0x1C, 0x01, 0xAE, 0xFA, 0x28, 0xA8, 0x2C,
+    0x7C, 0xBC, 0xE7, 0xD5, 0x20, 0xFD, 0xD1, 0x74,
+    0x0F, 0xC7, 0xAF, 0xCB, 0x7D, 0x33, 0x04, 0x7F,
+    0x2B, 0x89, 0xEB, 0x39, 0x58, 0x72, 0xF3, 0xDB,
+    0x5A, 0x0B, 0xE4, 0x23, 0xD4, 0x9A, 0xCF, 0x06,
+    0x47, 0xD6, 0xE9, 0x96, 0x17, 0x89, 0x0D, 0x03,
+    0xBB, 0x8F, 0x85, 0x27, 0xB0, 0xCF, 0xE1, 0x9E,
+    0x12, 0xFE, 0xBF, 0x21, 0x07, 0xCD, 0x46, 0xBE,
+    0x60, 0x80, 0x01, 0x68, 0xDB, 0xCF, 0x57, 0xC4,
+    0x17, 0xB8, 0xC9, 0xD9, 0xF6, 0x5B, 0x7B, 0xEF,
+    0x5C, 0xC2, 0x1A, 0x4F, 0x82, 0x73, 0xF4, 0x03,
+    0xC5, 0x60, 0xC3, 0x33, 0xED, 0xFE, 0xBE, 0x8F,
+    0x16, 0x65, 0xDF, 0xFD, 0xA9, 0xA3, 0xDA, 0x0F,
+    0x8B, 0x06, 0x51, 0xA4, 0x5E, 0x8C, 0x99, 0x2F,
+    0x16, 0x49, 0x8E, 0xBD, 0x8F, 0xC7, 0x36, 0xF4,
+    0x29, 0x20, 0x89, 0x9C, 0x0B, 0xCA, 0x46, 0x1E,
+    0x9E, 0xDB, 0xFB, 0x29, 0xDC, 0x2B, 0x98, 0x00,
+    0x41, 0xDB, 0x29, 0xC4, 0xBB, 0x6E, 0x36, 0xD8,
+    0x54, 0x18, 0xD7, 0x3D, 0x41, 0xAC, 0x03, 0xE7,
+    0x4B, 0xAA, 0xD3, 0x33, 0x78, 0xE2, 0xAD, 0xFA,
+    0x9D, 0xBD, 0x81, 0x8B, 0x94, 0x51, 0x0B, 0x80,
+    0xCC, 0xBC, 0xDB, 0x3A, 0x1B, 0x9A, 0x71, 0x5C,
+    0x15, 0x1D, 0xFB, 0x60, 0x64, 0x1A, 0x6D, 0x28,
+    0x81, 0x89, 0xA0, 0x09, 0xE0, 0xA7, 0x7B, 0x0C,
+    0x3C, 0xEB, 0x34, 0xD5, 0xD5, 0xE5, 0x91, 0x0C,
+    0x7D, 0xE3, 0x09, 0xCA, 0x43, 0xA8, 0x43, 0x28,
+    0xCD, 0xB0, 0x29, 0xCD, 0xCD, 0x76, 0xDC, 0xB9,
+    0xD4, 0x75, 0xC6, 0xF1, 0x33, 0xF4, 0x05, 0x45,
+    0x21, 0xC1, 0xFE, 0x5B, 0x87, 0x78, 0xD7, 0xC3,
+    0xC3, 0xCE, 0xEF, 0x4B, 0xEB, 0xB0, 0x03, 0x11,
+    0x89, 0x27, 0x19, 0x8B, 0xDE, 0x69, 0xFD, 0xDD,
+    0x71, 0xBE, 0xBE, 0x07, 0x5B, 0xDC, 0x16, 0x17,
+    0xD8, 0xB0, 0x6C, 0x0E, 0x8C, 0x2E, 0xC0, 0x1D,
+    0x2C, 0x10, 0x9A, 0x55, 0x03, 0xE7, 0x63, 0x12,
+    0x2D, 0xB7, 0xE0, 0xFF, 0xBF, 0x0E, 0xC3, 0xA6,
+    0xA1, 0xB0, 0x23, 0xA0, 0xDF, 0xA4, 0x7C, 0x07,
+    0x7B, 0x96, 0x3F, 0x80, 0xF4, 0xAF, 0xC1, 0x99,
+    0xE0, 0x57, 0xE9, 0x07, 0x2B, 0x50, 0x59, 0x5D,
+    0x0C, 0x06, 0xD9, 0xBD, 0xC3, 0x29, 0x1E, 0x0D,
+    0x51, 0x49, 0x98, 0xDE, 0x41, 0xEB, 0x80, 0x7D,
+    0xE5, 0x51, 0x61, 0x68, 0x16, 0xB5, 0x16, 0x51,
+    0xB8, 0x7A, 0x06, 0x2B, 0xB7, 0x32, 0x69, 0x00,
+
+    0xB2, 0xAE, 0xB0, 0x57, 0xAA, 0x79, 0x1C, 0x01,
+    0x4C, 0x28, 0xF6, 0xEA, 0xDB, 0xB5, 0xFC, 0xA8,
+    0x32, 0xA6, 0x38, 0x3B, 0xA0, 0xF2, 0x23, 0x87,
+    0xCA, 0x72, 0x15, 0x02, 0xF5, 0x83, 0x5C, 0x02,
+    0x3A, 0x25, 0xE7, 0x72, 0xE0, 0xB0, 0xE4, 0xB1,
+    0x73, 0xEE, 0xA1, 0x82, 0xEC, 0x00, 0xA9, 0x4F,
+    0x8A, 0x4B, 0xA0, 0x0B, 0xC9, 0x5C, 0xB9, 0xEA,
+    0x0A, 0xCB, 0xFE, 0x1F, 0xFB, 0x81, 0xFC, 0xCB,
+    0xD9, 0x93, 0x99, 0xEF, 0x43, 0xF7, 0x94, 0x70,
+    0xBD, 0x03, 0x9A, 0xBC, 0xC9, 0x2B, 0x55, 0xF3,
+    0xBB, 0x41, 0x70, 0xB8, 0x8B, 0x4D, 0x32, 0xD7,
+    0x6E, 0x51, 0x67, 0xD1, 0xD4, 0xE9, 0x22, 0xF5,
+    0x93, 0xFD, 0x34, 0x31, 0x40, 0xA7, 0xEF, 0x8A,
+    0x17, 0xAC, 0xEF, 0xD2, 0x59, 0x63, 0x01, 0x33,
+    0x7F, 0x4C, 0xE4, 0x7C, 0x1B, 0x63, 0xED, 0xD3,
+    0xAE, 0xF8, 0x2E, 0x82, 0x94, 0x9B, 0xFC, 0xCE,
+    0x35, 0x5D, 0x6D, 0x80, 0xA9, 0xFB, 0x28, 0x2B,
+    0x95, 0x53, 0x9A, 0xE0, 0xB7, 0xB9, 0x0E, 0x4F,
+    0x4B, 0x57, 0x0C, 0x1A, 0xE3, 0xFE, 0x38, 0x24,
+    0x2E, 0xDC, 0x3F, 0xAB, 0xEF, 0x85, 0x55, 0xD4,
+    0x1B, 0x82, 0xA0, 0x0E, 0x4C, 0x7B, 0xC1, 0x6D,
+    0x3B, 0x10, 0xC2, 0x01, 0x1A, 0xA3, 0xB6, 0x93,
+    0x23, 0x5C, 0x78, 0x60, 0x82, 0x18, 0xFD, 0x67,
+    0xF9, 0xE7, 0x1D, 0xD3, 0x20, 0xA2, 0x87, 0xBC,
+    0x7B, 0xB4, 0x49, 0xCF, 0x3D, 0x5C, 0x99, 0x05,
+    0x0E, 0x0E, 0xA4, 0xB1, 0x2A, 0xD4, 0x09, 0xB7,
+    0x1B, 0xBA, 0x9C, 0x70, 0xD1, 0x8E, 0x4F, 0x5F,
+    0x5C, 0x59, 0xD3, 0x07, 0x23, 0x12, 0xC4, 0xF6,
+    0x0F, 0x39, 0x55, 0xB9, 0xC6, 0xDF, 0xDF, 0x86,
+    0x4F, 0xAF, 0xD1, 0x57, 0x52, 0x31, 0xCC, 0x03,
+    0xA7, 0x1C, 0xDF, 0x0B, 0xEF, 0xE4, 0x67, 0xC7,
+    0x5F, 0xDA, 0x6E, 0x93, 0x7A, 0x3B, 0x05, 0xB3,
+    0x60, 0xEB, 0x8F, 0xD8, 0x45, 0xD4, 0x3F, 0x24,
+    0x85, 0xA3, 0xC3, 0x59, 0x45, 0xC8, 0x6D, 0x4C,
+    0x50, 0x45, 0x32, 0x31, 0xBF, 0x1A, 0xBD, 0x61,
+    0x24, 0x90, 0x0F, 0x9C, 0x49, 0x65, 0xE5, 0x18,
+    0x4A, 0xE2, 0x23, 0xF4, 0x4B, 0xFF, 0x4B, 0x02,
+    0x08, 0x30, 0x28, 0x39, 0x00, 0xA6, 0x3F, 0x03,
+    0x36, 0x6A, 0x1B, 0x1D, 0x06, 0x75, 0xB0, 0xCB,
+    0x1B, 0x72, 0x22, 0xB1, 0x75, 0xE3, 0x94, 0xE9,
+    0x08, 0xED, 0xB8, 0x0D, 0xBC, 0x4F, 0xD3, 0x40,
+    0xC4, 0xF2, 0x46, 0x38, 0x4F, 0x0B, 0xD7, 0x35,
+    0x97, 0x1C, 0xB3, 0xAB, 0x22, 0x90, 0xD3, 0x5B,
+    0xE5, 0xB8, 0xEC, 0x50, 0xE8, 0x9A, 0x01, 0x96,
+    0x9A, 0x00, 0x25, 0x87, 0x35, 0x9B, 0xF2, 0x98,
+    0x20, 0x70, 0x6E, 0x1A, 0x5A, 0x4A, 0x28, 0x7E,
+    0x40, 0xA9, 0x3C, 0xF6, 0x2E, 0x8C, 0xDF, 0xF9,
+    0x53, 0x49, 0x56, 0x37, 0x18, 0xE2, 0x37, 0xAE,
+    0xCA, 0x02, 0x0E, 0x32, 0xC8, 0x7F, 0x77, 0x07,
+    0x7B, 0x95, 0x85, 0xB6, 0xD0, 0x5D, 0x98, 0x8B,
+    0x58, 0xB5, 0x64, 0x61, 0xE0, 0x70, 0xBC, 0xA1,
+    0x1D, 0x2E, 0xC8, 0xAA, 0x06, 0x78, 0xC9, 0xBF,
+    0x39, 0xD5, 0x59, 0x3F, 0xE3, 0xDF, 0x77, 0x19,
+    0x2E, 0x39, 0xB8, 0x56, 0xA0, 0xAC, 0x48, 0x9C,
+    0x3F, 0xF5, 0x0A, 0x3C, 0x30, 0xDA, 0xC8, 0xB2,
+    0x11, 0x12, 0xB1, 0x91, 0x53, 0x26, 0x0F, 0x73,
+    0x49, 0x97, 0x00, 0x5B, 0xAE, 0x56, 0x38, 0x10,
+    0x83, 0x26, 0x96, 0xD4, 0xCD, 0x4B, 0xC8, 0xCC,
+    0x34, 0x5D, 0xFC, 0x71, 0x5F, 0x12, 0x86, 0x00,
+    0x0B, 0xAC, 0x74, 0x9F, 0x50, 0x43, 0x10, 0x2E,
+    0x7C, 0xB6, 0xC1, 0x55, 0x91, 0x18, 0x0E, 0xD0,
+    0x50, 0x59, 0xE9, 0x29, 0xE5, 0xEA, 0x0B, 0xE0,
+    0x62, 0x38, 0x1E, 0x5E, 0x69, 0x58, 0x8D, 0x88,
+    0xFD, 0xE8, 0x9B, 0x6C, 0x92, 0x00, 0xB1, 0x4D,
+
+    0x74, 0x88, 0xC2, 0xD5, 0x78, 0x33, 0x7A, 0xEE,
+    0x2F, 0xC9, 0x87, 0xE0, 0x93, 0xC6, 0x05, 0x8C,
+    0xBE, 0xD0, 0xB9, 0xC5, 0xB7, 0xD8, 0xF5, 0xC6,
+    0x60, 0x05, 0x59, 0x48, 0x7D, 0x72, 0x16, 0xF2,
+    0x50, 0xED, 0x33, 0x37, 0x48, 0x5B, 0xDA, 0x1E,
+    0xBE, 0xFA, 0x76, 0xCA, 0x1E, 0x68, 0xA8, 0x14,
+    0x44, 0xCE, 0x12, 0x14, 0x66, 0x60, 0xDC, 0xA6,
+    0x23, 0x77, 0x2F, 0xB9, 0x1C, 0x8F, 0xBB, 0xC5,
+    0xDE, 0x13, 0xAC, 0x0B, 0x82, 0xD7, 0xAC, 0x90,
+    0xDB, 0xEB, 0xC7, 0x67, 0xD8, 0xD3, 0xC6, 0x34,
+    0x02, 0xCD, 0x23, 0x4A, 0x2A, 0x1F, 0x56, 0xE7,
+    0x1E, 0x27, 0x93, 0x92, 0x78, 0x74, 0x4E, 0xC1,
+    0xE7, 0x9F, 0x10, 0xCA, 0x94, 0x98, 0xB4, 0x94,
+    0x1E, 0xB9, 0xA6, 0xAE, 0x8F, 0x29, 0x0F, 0xE6,
+    0x11, 0x34, 0xDA, 0x99, 0x81, 0x33, 0x5F, 0xBD,
+    0x56, 0xA5, 0xA1, 0xD4, 0xED, 0x9B, 0xA5, 0x27,
+    0xB0, 0xCE, 0x23, 0xD5, 0xFC, 0xB8, 0x9D, 0x3D,
+    0x45, 0xEC, 0xCF, 0x1E, 0xD7, 0x1E, 0x79, 0x32,
+    0x9B, 0xAE, 0xE2, 0xBE, 0x3A, 0x59, 0xF5, 0xB0,
+    0xD5, 0x10, 0xCD, 0x8C, 0x7E, 0x65, 0xE7, 0xE1,
+    0x91, 0xB7, 0xE2, 0x6F, 0xC8, 0x42, 0x7E, 0x03,
+    0x21, 0xF2, 0x6E, 0x0B, 0xE3, 0x61, 0x32, 0x38,
+    0x06, 0xA6, 0xBF, 0xE6, 0x77, 0x6A, 0x25, 0xB2,
+    0xF2, 0xB1, 0x00, 0xDC, 0x34, 0x34, 0xE0, 0x94,
+    0xD8, 0x2F, 0xEB, 0x57, 0x61, 0x83, 0xE8, 0x97,
+    0x87, 0xEF, 0x6B, 0x20, 0xF8, 0x09, 0x1A, 0xC8,
+    0x11, 0xCF, 0x56, 0xBA, 0x3F, 0xEC, 0x57, 0x91,
+    0xD3, 0xC8, 0x7D, 0x0E, 0xB1, 0xE4, 0x58, 0x05,
+    0x86, 0x84, 0x08, 0xCB, 0x88, 0x47, 0x03, 0x7A,
+    0x82, 0x77, 0x1A, 0xDA, 0xED, 0x78, 0xBD, 0x4A,
+    0x8F, 0xD8, 0x7B, 0xC1, 0xA3, 0x3E, 0xE3, 0x97,
+    0xBB, 0xDC, 0x66, 0x41, 0x90, 0x59, 0x18, 0xEF,
+    0xEC, 0x27, 0xFE, 0xEC, 0x15, 0xB2, 0x9A, 0xBA,
+    0xEA, 0x3A, 0x42, 0x43, 0x5C, 0x67, 0xA1, 0x6E,
+    0x61, 0x88, 0x1F, 0x17, 0xF2, 0x23, 0x6D, 0x85,
+    0x97, 0x13, 0xB0, 0xBE, 0x39, 0x03, 0x52, 0xEB,
+    0x7A, 0x4D, 0x1F, 0x34, 0xFE, 0x94, 0x41, 0xA1,
+    0x9B, 0x40, 0x34, 0xCD, 0x00, 0x5E, 0x92, 0x5D,
+    0x29, 0x4B, 0xCF, 0x16, 0x28, 0xDF, 0xFF, 0x13,
+    0x27, 0x86, 0xF7, 0x1C, 0x3C, 0xD9, 0x68, 0x5F,
+    0x79, 0x69, 0x2B, 0xC6, 0x54, 0x20, 0x72, 0x65,
+    0x19, 0x78, 0xEB, 0x13, 0x81, 0x8C, 0x4E, 0x45,
+    0x99, 0x70, 0xC5, 0xFB, 0x5C, 0xCB, 0x34, 0x39,
+    0xAC, 0x16, 0xA9, 0x68, 0xD2, 0x8A, 0x80, 0xAF,
+    0xB9, 0x46, 0x9A, 0x49, 0x86, 0xCF, 0x1F, 0xD8,
+    0x0D, 0x99, 0xDE, 0x6C, 0x48, 0xB9, 0x2E, 0x50,
+    0x01, 0xA7, 0x98, 0x5E, 0x3A, 0x38, 0xCD, 0x1D,
+    0x83, 0xEE, 0xE6, 0x87, 0xC2, 0xF8, 0x60, 0xAB,
+    0xF5, 0x2E, 0x6B, 0xA1, 0xA1, 0xAA, 0xAA, 0x53,
+    0xE3, 0xC5, 0x10, 0x66, 0xC4, 0xFB, 0x8C, 0x5A,
+    0x63, 0xFD, 0x0F, 0x66, 0x5E, 0xF6, 0x2C, 0x48,
+    0x4F, 0xA0, 0x54, 0x5A, 0xDD, 0xBE, 0x1C, 0xD9,
+    0x17, 0xA7, 0x1C, 0x7B, 0x4D, 0x06, 0x8B, 0xB1,
+    0xDA, 0x67, 0x97, 0x5B, 0x9B, 0xAE, 0xD6, 0xFB,
+    0x07, 0x96, 0x97, 0x9E, 0xB4, 0x9F, 0x1B, 0xCC,
+    0xF7, 0xBA, 0xFC, 0xB6, 0x77, 0x2E, 0x5C, 0x2D,
+    0xA6, 0xE5, 0x28, 0x00, 0xAD, 0xC3, 0x5C, 0x0F,
+    0x8D, 0xEA, 0x8D, 0xBC, 0xDA, 0xE2, 0x12, 0xDA,
+    0x49, 0x8B, 0x3B, 0xDF, 0xF4, 0x59, 0xFD, 0x3B,
+    0x12, 0xF0, 0xB7, 0xA0, 0x0A, 0x9E, 0xAA, 0x40,
+    0x41, 0x4C, 0x60, 0x44, 0xC9, 0x4C, 0xB7, 0x8D,
+    0x42, 0x27, 0xB4, 0x59, 0xE5, 0x49, 0xFC, 0x27,
+    0x41, 0x9C, 0xC9, 0xB9, 0x13, 0x4B, 0xFE, 0x82,
+    0x6B, 0xC8, 0x29, 0x6F, 0x17, 0xE8, 0xA2, 0x55,
+
+    0x89, 0x18, 0x66, 0x17, 0x7F, 0xA4, 0x9B, 0x25,
+    0xC8, 0x22, 0xF7, 0xAA, 0x53, 0xB9, 0x16, 0xD0,
+    0x1C, 0x81, 0x9F, 0xE0, 0x5F, 0x0D, 0xE2, 0xDE,
+    0x6C, 0x5B, 0x2B, 0x13, 0xBC, 0x50, 0x77, 0x1D,
+    0xBA, 0x73, 0x67, 0x19, 0xE7, 0x5C, 0xFE, 0x92,
+    0xF7, 0xB0, 0x08, 0x56, 0xFF, 0x80, 0xBD, 0x3B,
+    0x6A, 0x87, 0x8B, 0x24, 0x44, 0x7E, 0x9C, 0x4F,
+    0x20, 0x70, 0x12, 0x27, 0xF0, 0xD4, 0x0B, 0xF9,
+    0xD3, 0x8A, 0x73, 0x80, 0x60, 0x5D, 0xFC, 0xD6,
+    0xE0, 0x7C, 0xAA, 0x8C, 0x60, 0x39, 0x64, 0x1A,
+    0x03, 0x08, 0x2C, 0xF5, 0x37, 0x51, 0x80, 0xFA,
+    0x8D, 0x2A, 0xDB, 0x44, 0x00, 0x64, 0x2D, 0x57,
+    0xF5, 0x1A, 0x17, 0x63, 0x58, 0x4F, 0x82, 0x22,
+    0xAF, 0x18, 0xF8, 0xC0, 0x93, 0xD8, 0xE1, 0xB6,
+    0xA2, 0x74, 0x94, 0x5B, 0x99, 0xC8, 0x1E, 0x7C,
+    0x68, 0x79, 0x2B, 0xD3, 0x20, 0x7E, 0x39, 0x14,
+    0x11, 0x5E, 0x2E, 0x5B, 0x4C, 0xAC, 0x03, 0x38,
+    0x8E, 0x15, 0xDC, 0x8B, 0xA3, 0xCF, 0x0A, 0x59,
+    0x83, 0xDC, 0xC2, 0xD7, 0x12, 0xE5, 0x6C, 0x4E,
+    0x1E, 0x49, 0xE4, 0x22, 0xAC, 0xEF, 0x47, 0x44,
+    0x10, 0x16, 0x42, 0x16, 0xDE, 0x1B, 0x39, 0x2A,
+    0xB2, 0x67, 0x61, 0x90, 0xD6, 0x9E, 0x07, 0x0D,
+    0x84, 0xD8, 0x90, 0xD1, 0x8B, 0xF4, 0xE3, 0x05,
+    0xF5, 0xB7, 0xFE, 0x34, 0x18, 0x96, 0xA3, 0x35,
+    0x43, 0xA6, 0xF1, 0x78, 0x06, 0x67, 0x81, 0x4A,
+    0xDD, 0x9F, 0xC5, 0xBE, 0x07, 0xB9, 0x33, 0x89,
+    0xAF, 0x37, 0xA9, 0x49, 0x53, 0x9B, 0xC5, 0x3E,
+    0x0B, 0x1C, 0x02, 0x8C, 0xB7, 0x73, 0x09, 0xF8,
+    0x3C, 0x6A, 0xE8, 0x96, 0xDC, 0x17, 0x69, 0xA2,
+    0x81, 0xB5, 0x7B, 0x39, 0x55, 0xF5, 0xB8, 0xC4,
+    0x99, 0x57, 0xBF, 0xF9, 0xBB, 0xB0, 0x1A, 0x2A,
+    0xB1, 0xF3, 0xE1, 0xF0, 0x7E, 0x78, 0x70, 0x3E,
+    0x1B, 0x74, 0xD5, 0xBE, 0x50, 0x9B, 0xE7, 0xF4,
+    0x99, 0xA7, 0x76, 0x5F, 0xA6, 0x69, 0xD7, 0xA0,
+    0x48, 0x34, 0xFA, 0xB4, 0xAA, 0x31, 0x3A, 0xEC,
+    0x10, 0x9F, 0xC2, 0x39, 0x3B, 0x1C, 0x39, 0x41,
+    0x9A, 0xFE, 0xF4, 0x9E, 0xB8, 0x1B, 0x2A, 0x70,
+    0xA7, 0xC0, 0x66, 0x72, 0x12, 0x80, 0x5D, 0x68,
+    0x05, 0x50, 0xCF, 0xB5, 0xCA, 0x1A, 0x9A, 0x71,
+    0x3C, 0xAF, 0x72, 0xBE, 0x64, 0x95, 0x21, 0x36,
+    0xEA, 0xA7, 0x08, 0x07, 0xF2, 0x3B, 0xE5, 0x7F,
+    0x35, 0x81, 0xE1, 0xE1, 0x45, 0xBE, 0x0C, 0x49,
+    0x21, 0xA8, 0xD5, 0xBF, 0x0A, 0x55, 0x47, 0x9D,
+    0x4A, 0x83, 0x68, 0xE9, 0x6A, 0xEA, 0xAF, 0x9B,
+    0xC2, 0x93, 0x44, 0x7C, 0xDC, 0x60, 0x4E, 0xBD,
+    0x9F, 0xD4, 0x48, 0xD0, 0x55, 0xE1, 0x42, 0xA2,
+    0x77, 0x51, 0xE2, 0x79, 0x0E, 0x62, 0xA4, 0x0F,
+    0xA5, 0xCD, 0x0E, 0xC8, 0xA5, 0x38, 0x11, 0x7A,
+    0xCB, 0x2F, 0xA0, 0xB5, 0x25, 0xD6, 0x04, 0x4A,
+    0x76, 0x3A, 0xCE, 0xB1, 0x52, 0xD5, 0xC0, 0x11,
+    0x1F, 0x21, 0x49, 0x56, 0x60, 0xC0, 0x7B, 0xAA,
+    0x40, 0xED, 0x37, 0x35, 0x57, 0xC0, 0x30, 0x77,
+    0xC1, 0xDE, 0x94, 0x4E, 0x44, 0x44, 0x5F, 0x9A,
+    0xE8, 0x29, 0xE6, 0x2A, 0x60, 0xC4, 0xFF, 0xEC,
+    0xB7, 0xC5, 0x6B, 0x0D, 0x0C, 0xA7, 0x71, 0xE6,
+    0x6D, 0x32, 0x3B, 0x0E, 0x7D, 0xF0, 0x5B, 0x85,
+    0x91, 0x3D, 0x7F, 0xFA, 0x9F, 0xA8, 0x8C, 0xC7,
+    0x1C, 0x54, 0xA5, 0xD1, 0xAA, 0x0F, 0x61, 0x3A,
+    0xCD, 0x38, 0xC8, 0xDD, 0x16, 0x73, 0xB0, 0x25,
+    0x62, 0x2D, 0xF9, 0x7A, 0x62, 0xF3, 0x82, 0x45,
+    0x71, 0xED, 0x0A, 0x92, 0x77, 0xE4, 0x42, 0x8E,
+    0x63, 0xAE, 0x48, 0xA9, 0x47, 0x3F, 0x2C, 0x7C,
+    0xD6, 0x11, 0xB9, 0xAD, 0xE9, 0xA4, 0xA5, 0xBE,
+    0xB3, 0x85, 0xEC, 0xCB, 0xB7, 0x50, 0x67, 0xC4,
+};
+
+static const unsigned char ffdhe6144_T[5 * 768] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA4, 0x0F, 0x57, 0x4E, 0xBA, 0x89, 0x6A, 0xCA,
+    0xA0, 0x47, 0x53, 0xBF, 0xB1, 0x85, 0x86, 0x1C,
+    0x4E, 0x8C, 0x74, 0xF8, 0x63, 0xA5, 0x92, 0xD4,
+    0xAC, 0x3D, 0x93, 0x7D, 0xD7, 0x37, 0x98, 0x08,
+    0x66, 0xD8, 0xC4, 0x63, 0xB6, 0xC9, 0x82, 0x0D,
+    0x05, 0xA0, 0x39, 0x39, 0x39, 0xE7, 0x14, 0x4E,
+    0x12, 0xFC, 0x9B, 0xFA, 0xA2, 0x77, 0x3D, 0x0A,
+    0x58, 0x41, 0xC2, 0x54, 0x54, 0x05, 0x35, 0x3D,
+    0xB7, 0x98, 0x15, 0xC1, 0x41, 0xF3, 0x22, 0x5E,
+    0xF5, 0x39, 0x35, 0x55, 0x84, 0x25, 0xCA, 0x18,
+    0x95, 0x51, 0xD9, 0x43, 0x01, 0x50, 0x6D, 0x94,
+    0xCF, 0x61, 0xE7, 0x1E, 0x3E, 0x32, 0xE9, 0x10,
+    0x3A, 0xB2, 0xEC, 0x4A, 0x18, 0x20, 0x2F, 0x1B,
+    0xC4, 0x1D, 0x4E, 0xBD, 0x92, 0xA4, 0x31, 0x95,
+    0x9E, 0xA6, 0x6B, 0x61, 0x6F, 0x8B, 0x0D, 0x0A,
+    0x87, 0xEA, 0x9C, 0xFA, 0x99, 0xB6, 0x09, 0x3C,
+    0x5D, 0xEE, 0xAD, 0x68, 0x9A, 0x6E, 0x38, 0x08,
+    0x8D, 0x2A, 0x4A, 0x91, 0x3E, 0x50, 0x17, 0x2F,
+    0xC5, 0x61, 0x7A, 0xB8, 0x43, 0x8D, 0x64, 0x16,
+    0xA3, 0x52, 0x24, 0x31, 0x39, 0x1A, 0x89, 0xCD,
+    0xE9, 0xF0, 0xB0, 0x6E, 0x23, 0xEB, 0x25, 0x1E,
+    0xC3, 0xFA, 0x06, 0x3C, 0x64, 0x10, 0x3A, 0x26,
+    0x7F, 0x97, 0xF6, 0x65, 0xAF, 0x97, 0xA1, 0x3C,
+    0xDD, 0x1A, 0x02, 0xC6, 0x2C, 0xF4, 0xF8, 0x00,
+    0xE3, 0x61, 0xDB, 0x9A, 0x22, 0x1A, 0xFC, 0xF8,
+    0x78, 0x03, 0x89, 0xC9, 0x67, 0x20, 0xA5, 0x19,
+    0x88, 0x94, 0x06, 0x87, 0xA2, 0x7B, 0xBF, 0xF4,
+    0x74, 0xE2, 0x1C, 0xF9, 0x05, 0xD2, 0xF8, 0x9A,
+    0x72, 0x19, 0x6B, 0xB2, 0x7C, 0x9A, 0x20, 0x0A,
+    0xEF, 0x29, 0x7B, 0x8F, 0x3D, 0xC0, 0x60, 0x46,
+    0x43, 0x95, 0x49, 0x89, 0x35, 0xCD, 0xF9, 0x48,
+    0x87, 0x96, 0x16, 0x42, 0x0C, 0xC7, 0xFB, 0x8F,
+    0x3C, 0x97, 0x20, 0x6C, 0x52, 0x32, 0x6D, 0xF1,
+    0x0A, 0x4D, 0xC5, 0xB2, 0xDC, 0x10, 0x10, 0x23,
+    0x4C, 0xE6, 0x9E, 0x0A, 0x7C, 0xF2, 0x4D, 0xC6,
+    0xA2, 0x03, 0xD9, 0xEC, 0xF5, 0xD8, 0xDB, 0x1E,
+    0x97, 0xD9, 0xE6, 0xD8, 0x87, 0x79, 0x0D, 0x76,
+    0x16, 0x05, 0x77, 0x5A, 0x3A, 0x51, 0x64, 0x59,
+    0x36, 0x1A, 0x3B, 0xC3, 0x1C, 0x15, 0x68, 0x01,
+    0x46, 0xA2, 0xFA, 0xA8, 0xC6, 0xC4, 0x12, 0xC2,
+    0x2F, 0x25, 0xA8, 0x75, 0xBB, 0x93, 0x8B, 0xE4,
+    0xA8, 0x75, 0xBC, 0xD0, 0xC9, 0xE4, 0x2A, 0x4B,
+    0xC4, 0x80, 0xCB, 0x7A, 0x54, 0x77, 0x6F, 0x63,
+    0xEA, 0x86, 0x5F, 0x28, 0x0B, 0x58, 0x44, 0x21,
+    0x87, 0xC9, 0xBE, 0x23, 0x80, 0x54, 0xC5, 0x07,
+    0xB4, 0x37, 0xC5, 0xA9, 0x32, 0xC3, 0xC2, 0x1D,
+    0x23, 0x21, 0x5A, 0x79, 0xD3, 0x64, 0x16, 0x09,
+    0x0D, 0x9E, 0x2C, 0x36, 0x34, 0xEF, 0x50, 0x92,
+    0xA7, 0x05, 0x41, 0x7A, 0x52, 0xC1, 0x25, 0xCF,
+    0x11, 0x38, 0x61, 0xC5, 0x55, 0xF9, 0x7F, 0xF6,
+    0xF0, 0x15, 0x48, 0xB5, 0x03, 0x9C, 0x67, 0x0B,
+    0x1D, 0x94, 0x6E, 0xF2, 0x20, 0x97, 0x9C, 0xEA,
+    0x25, 0x2B, 0xC3, 0xFD, 0xA4, 0xC3, 0x2F, 0x9A,
+    0xAD, 0xF1, 0x3F, 0xEA, 0xDC, 0xFD, 0x9E, 0x77,
+    0x24, 0x71, 0x0E, 0x0D, 0x1C, 0xA5, 0xFF, 0x8F,
+    0xED, 0xAC, 0xCC, 0xB9, 0x98, 0x68, 0xE9, 0x0B,
+    0xCB, 0xC4, 0x8D, 0x85, 0x1D, 0x7F, 0xFF, 0x87,
+    0xAB, 0x62, 0x62, 0xAC, 0x0C, 0xE5, 0xEA, 0x67,
+    0xEA, 0xFA, 0xDC, 0x64, 0x62, 0x6D, 0x04, 0x60,
+    0xE2, 0x6C, 0x95, 0x4B, 0x00, 0xEE, 0xB7, 0x29,
+    0x64, 0x94, 0xAF, 0x5C, 0x17, 0x7C, 0xFA, 0x3C,
+    0x72, 0xEB, 0xFF, 0x03, 0x43, 0xE4, 0x4D, 0xFB,
+    0xE8, 0x05, 0x36, 0x93, 0x75, 0xF9, 0x27, 0x0B,
+    0x63, 0x31, 0x05, 0xA7, 0x8F, 0x59, 0xAB, 0x8B,
+    0xB8, 0x8B, 0x77, 0x7A, 0x6A, 0x15, 0x82, 0xB3,
+    0x88, 0x97, 0x57, 0x9A, 0xC9, 0x13, 0xB6, 0x6E,
+    0xDD, 0x08, 0x45, 0x36, 0x9C, 0x7E, 0x05, 0x66,
+    0x98, 0xE2, 0xE7, 0x99, 0x67, 0x1F, 0xC7, 0x8A,
+    0x64, 0xA5, 0xF3, 0x50, 0x06, 0x60, 0x27, 0x1C,
+    0xC9, 0xC1, 0x47, 0x83, 0x63, 0x73, 0xF7, 0xC1,
+    0x8E, 0xFD, 0x70, 0x09, 0x66, 0x04, 0x97, 0x10,
+    0xB5, 0xB7, 0x1C, 0x10, 0xAC, 0xAD, 0x2D, 0xDE,
+    0x8F, 0x55, 0x9B, 0xA2, 0x49, 0x39, 0x7E, 0x4E,
+    0xBF, 0xE2, 0x1E, 0xDB, 0x95, 0xF5, 0xDC, 0x39,
+    0xEA, 0x82, 0x7C, 0x00, 0x0C, 0x38, 0xBB, 0x23,
+    0x00, 0x9A, 0xC0, 0xE7, 0xCF, 0x9F, 0xB8, 0x79,
+    0x4F, 0x03, 0x8E, 0x4B, 0xFF, 0x10, 0x4C, 0x97,
+    0x13, 0x83, 0x63, 0x68, 0xD6, 0x9A, 0x88, 0x7C,
+    0xD6, 0x73, 0x35, 0xC3, 0x10, 0x6A, 0x0C, 0xDA,
+    0x22, 0xAA, 0x7F, 0xB9, 0xAB, 0xAF, 0xC8, 0x12,
+    0x98, 0xB1, 0x8C, 0x7D, 0xBB, 0x3D, 0xD2, 0xFB,
+    0xEA, 0x2E, 0x49, 0x4F, 0x70, 0xB3, 0x06, 0x82,
+    0x0C, 0x6D, 0xED, 0xC9, 0x73, 0xA5, 0x58, 0xE6,
+    0x51, 0xA9, 0xF9, 0x17, 0x2A, 0x31, 0x01, 0x43,
+    0x3B, 0xAD, 0xA7, 0x9D, 0xD5, 0x3A, 0xAF, 0x73,
+    0x5F, 0x44, 0x6F, 0xA4, 0x8F, 0x57, 0x98, 0xEA,
+    0x36, 0xC1, 0x5B, 0x94, 0x6D, 0x48, 0xDD, 0xD0,
+    0xE6, 0x61, 0xA4, 0x54, 0x6A, 0x62, 0x17, 0xF8,
+    0x26, 0xC5, 0xCF, 0xDE, 0x73, 0xB1, 0xA9, 0xF7,
+    0x49, 0x89, 0x1C, 0x0C, 0x47, 0x28, 0xFE, 0x53,
+    0x80, 0x45, 0x6A, 0xE2, 0xCA, 0x49, 0xC3, 0x2D,
+    0x3A, 0xB2, 0xD5, 0xB2, 0x57, 0x9D, 0x3C, 0x7C,
+    0xB7, 0xC5, 0x51, 0xE5, 0x0D, 0x8E, 0x4A, 0x56,
+    0xB7, 0xE3, 0x9A, 0xC6, 0x5E, 0x37, 0xE3, 0x34,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+
+    0xBF, 0xB0, 0x29, 0xD9, 0xB0, 0x26, 0x6D, 0x96,
+    0xB6, 0x88, 0xDF, 0x02, 0x30, 0xDF, 0x7D, 0x76,
+    0xBF, 0xAF, 0xEF, 0xD5, 0xC6, 0xDA, 0x12, 0x0E,
+    0x5B, 0x06, 0x29, 0x70, 0x77, 0xA5, 0x80, 0xE6,
+    0xEB, 0x32, 0x5D, 0xA1, 0x92, 0xA2, 0xF0, 0x82,
+    0xC6, 0xCE, 0x15, 0xBE, 0x76, 0xCE, 0x72, 0x9E,
+    0x78, 0x36, 0x80, 0x0B, 0x24, 0x83, 0x1C, 0x3D,
+    0x07, 0xB1, 0xB5, 0x80, 0xFF, 0x1D, 0x70, 0xC3,
+    0x8D, 0xEE, 0x96, 0xCB, 0x70, 0xC9, 0xC9, 0x16,
+    0x04, 0xDF, 0xC8, 0xF6, 0x09, 0x7F, 0x87, 0x60,
+    0x3A, 0xF5, 0xEE, 0x4C, 0xAE, 0xD7, 0x49, 0x31,
+    0x3F, 0x06, 0x8E, 0x53, 0x99, 0x5C, 0xA0, 0x74,
+    0x8F, 0xEA, 0x69, 0x3D, 0x02, 0x0F, 0xAE, 0x54,
+    0x4C, 0x73, 0xE7, 0xB2, 0xA1, 0x23, 0xB1, 0xEF,
+    0x3A, 0x11, 0x0B, 0x05, 0x7D, 0x9A, 0x4C, 0xFA,
+    0xDA, 0xA1, 0xC2, 0x3B, 0x18, 0xF5, 0x72, 0x65,
+    0x0D, 0x66, 0x14, 0xFF, 0x34, 0x90, 0x2E, 0x57,
+    0xF2, 0xFD, 0xC6, 0x99, 0xF9, 0x22, 0x4B, 0x74,
+    0xD3, 0x96, 0xF7, 0xBC, 0x5D, 0xB6, 0xA9, 0x6F,
+    0x73, 0x14, 0x2C, 0x83, 0xF3, 0x10, 0x31, 0x23,
+    0xC6, 0xFF, 0x66, 0x73, 0xDB, 0xA6, 0x26, 0xA0,
+    0x83, 0x08, 0xAB, 0xE3, 0xD8, 0xD4, 0x76, 0x2F,
+    0x9D, 0xA3, 0xE4, 0xED, 0xDE, 0x5A, 0xFA, 0xFF,
+    0x8B, 0x4D, 0xB1, 0x9B, 0xFE, 0x0D, 0x6B, 0x81,
+    0x95, 0xC4, 0xED, 0xED, 0x79, 0x27, 0x5A, 0x97,
+    0xC5, 0xAB, 0x87, 0x80, 0x57, 0x3F, 0x92, 0x8A,
+    0x6A, 0x2D, 0x7F, 0x17, 0x2D, 0xDD, 0x82, 0x4A,
+    0x69, 0x12, 0xC5, 0xC8, 0xC5, 0xCF, 0x1D, 0x6F,
+    0xEF, 0xBE, 0x01, 0x5E, 0xA4, 0xD7, 0x90, 0xEC,
+    0x38, 0x86, 0xEE, 0x59, 0x9F, 0xA7, 0x34, 0x38,
+    0x0B, 0x76, 0xE2, 0xCE, 0x67, 0x38, 0xAB, 0x13,
+    0x3A, 0xF9, 0x63, 0x3E, 0x09, 0x47, 0x32, 0x59,
+    0x4B, 0x5D, 0x6C, 0xD9, 0x0A, 0xDA, 0x1F, 0x95,
+    0x3D, 0xC6, 0x36, 0x22, 0xD4, 0xF3, 0x0E, 0xFC,
+    0x5D, 0xC9, 0x56, 0xD5, 0x93, 0xEC, 0x45, 0xCE,
+    0x94, 0x77, 0x3A, 0x32, 0xEC, 0xC1, 0x5B, 0x36,
+    0x99, 0x35, 0x31, 0xF5, 0xBA, 0x3E, 0x6B, 0xF0,
+    0xB6, 0x41, 0x75, 0xDF, 0x10, 0xE8, 0x11, 0xF4,
+    0x97, 0xF8, 0x48, 0x83, 0xA9, 0xC7, 0xC4, 0x32,
+    0xE4, 0x1F, 0xAB, 0xFF, 0xDA, 0xE6, 0xC8, 0xBE,
+    0x6D, 0x52, 0x4B, 0x7A, 0x78, 0x5F, 0xDB, 0xFC,
+    0x86, 0x52, 0xFF, 0xFC, 0xE3, 0xDE, 0xC1, 0x3A,
+    0xE8, 0x10, 0xFA, 0x68, 0xF8, 0x50, 0x49, 0xFB,
+    0xFA, 0x80, 0x69, 0x80, 0x59, 0x33, 0x03, 0xA7,
+    0x4F, 0x29, 0x81, 0x84, 0x5E, 0xBF, 0x0E, 0xE0,
+    0x84, 0x6A, 0x16, 0x06, 0xDF, 0xBF, 0xC1, 0xC1,
+    0x17, 0xA6, 0x52, 0xB0, 0x7E, 0x21, 0x2D, 0x4A,
+    0x42, 0xED, 0x1C, 0x75, 0x12, 0x2C, 0xDB, 0x9F,
+    0x3F, 0x5B, 0x27, 0x91, 0xBE, 0x8B, 0xB2, 0xDE,
+    0x4C, 0x9D, 0xC6, 0xE0, 0x24, 0x80, 0x3A, 0x4F,
+    0x1B, 0x6C, 0xDD, 0x87, 0xB6, 0x6E, 0x69, 0xF1,
+    0x21, 0xAE, 0x96, 0xA6, 0x9D, 0x89, 0xD3, 0x37,
+    0x20, 0xFF, 0x6C, 0x42, 0x24, 0x3C, 0x10, 0xB4,
+    0x13, 0x6D, 0x92, 0xE6, 0x8C, 0x93, 0xBA, 0xC7,
+    0x66, 0x02, 0x6D, 0xC4, 0x2C, 0x6C, 0xD7, 0xF1,
+    0x39, 0xB2, 0xAC, 0xD6, 0x21, 0x2F, 0x1B, 0x4B,
+    0xC4, 0x02, 0x1E, 0xF3, 0x2D, 0x5C, 0x33, 0xAF,
+    0xE3, 0x88, 0x08, 0xBB, 0x1E, 0xED, 0xB6, 0x8B,
+    0x45, 0x19, 0xA5, 0xB6, 0x5C, 0xCB, 0x47, 0x2B,
+    0xEF, 0xE6, 0x19, 0x78, 0x67, 0x86, 0x80, 0x6F,
+    0xFA, 0x4C, 0x79, 0x4E, 0x30, 0x96, 0xAA, 0x34,
+    0xE3, 0x6D, 0xB7, 0x45, 0x09, 0x75, 0x40, 0x94,
+    0x16, 0xDD, 0xA4, 0x2D, 0xA1, 0xC2, 0x59, 0x31,
+    0xC7, 0x88, 0x37, 0xC9, 0xEF, 0x00, 0x58, 0x32,
+    0x84, 0x0E, 0x48, 0x23, 0x71, 0x76, 0xBC, 0x4D,
+    0x14, 0xD7, 0x02, 0x72, 0x46, 0x9D, 0x00, 0x37,
+    0xE9, 0x0F, 0xB5, 0x93, 0xCB, 0x70, 0x1F, 0x9D,
+    0xAF, 0x8E, 0xDA, 0xC3, 0xA9, 0x14, 0x2C, 0xFA,
+    0x3F, 0xAD, 0x41, 0xDE, 0xED, 0x00, 0x0A, 0xE7,
+    0x96, 0xB1, 0x81, 0x1E, 0x10, 0x71, 0x3C, 0xB1,
+    0xBF, 0x22, 0xCC, 0x0E, 0xAF, 0x31, 0x3B, 0x46,
+    0xCD, 0x92, 0x98, 0x01, 0x28, 0x86, 0xBF, 0xE6,
+    0xD9, 0x0E, 0x71, 0x31, 0x6F, 0x7F, 0x72, 0x94,
+    0x32, 0x9B, 0x6F, 0x94, 0x83, 0xCF, 0xEA, 0xCE,
+    0xC5, 0x04, 0x88, 0x5A, 0x5B, 0x4F, 0xAC, 0xEC,
+    0x10, 0xED, 0x3D, 0xA8, 0xBD, 0x70, 0xBF, 0x4F,
+    0x9E, 0x88, 0xD5, 0xDD, 0x45, 0x6F, 0x31, 0x69,
+    0x7D, 0x5B, 0x05, 0xEF, 0xBA, 0xC4, 0x26, 0xA0,
+    0x2C, 0x53, 0x80, 0xCD, 0x14, 0xD8, 0x67, 0xE5,
+    0x5A, 0xB8, 0xBD, 0xCB, 0x03, 0xCF, 0x35, 0x87,
+    0x19, 0x2F, 0x53, 0x35, 0xE2, 0x6D, 0x72, 0xD4,
+    0x19, 0x01, 0xE0, 0x84, 0xBE, 0x4D, 0xF4, 0x68,
+    0x3A, 0xE0, 0xBA, 0x54, 0x47, 0xBB, 0x67, 0xF3,
+    0x65, 0x94, 0x72, 0x35, 0x22, 0x95, 0x1B, 0x90,
+    0x09, 0x7A, 0xB5, 0x61, 0x7D, 0x99, 0xB3, 0x13,
+    0x7A, 0xFF, 0xAA, 0xBE, 0x66, 0x1E, 0x65, 0xB6,
+    0xEB, 0x97, 0xF2, 0x99, 0xBB, 0x64, 0x52, 0x4F,
+    0x99, 0xFB, 0xD9, 0xB3, 0xA0, 0x3E, 0xF9, 0x7B,
+    0x1F, 0xD8, 0x21, 0x50, 0xA7, 0xCF, 0xD3, 0xD6,
+    0x62, 0x2B, 0xE2, 0x0B, 0x6F, 0x1F, 0x31, 0xB3,
+    0x37, 0x7D, 0x3B, 0xDF, 0xED, 0xD7, 0x08, 0x9D,
+    0xFD, 0xE7, 0x5E, 0x7F, 0xD2, 0x32, 0xF2, 0xCB,
+    0xAC, 0xA9, 0x05, 0x5D, 0x20, 0xEA, 0x99, 0x9F,
+    0x60, 0x88, 0x46, 0xB6, 0xE4, 0x8F, 0x95, 0x5D,
+    0xA2, 0x99, 0x98, 0x5D, 0x73, 0x99, 0x55, 0x82,
+    0xBD, 0x69, 0xAB, 0x1E, 0x92, 0x35, 0xB2, 0xAF,
+
+    0x95, 0xAC, 0x4D, 0x08, 0xCB, 0x16, 0xFC, 0xFA,
+    0x2D, 0x49, 0xD3, 0x09, 0x0F, 0x63, 0x9A, 0x02,
+    0x01, 0xBF, 0x38, 0xCF, 0xF6, 0x65, 0x0D, 0xC7,
+    0x6A, 0x07, 0xCE, 0x39, 0x30, 0x21, 0x2B, 0x08,
+    0xDE, 0xDF, 0xB5, 0x4D, 0xFF, 0xB1, 0x63, 0x85,
+    0x72, 0x95, 0xBB, 0xE6, 0xC2, 0x92, 0x27, 0x70,
+    0xB6, 0x77, 0xF0, 0x15, 0xA4, 0x2C, 0x79, 0x1B,
+    0xF8, 0x97, 0xC4, 0x1C, 0x1D, 0x14, 0x4B, 0x83,
+    0xE6, 0x6F, 0xF6, 0xBF, 0x63, 0x04, 0x22, 0xFD,
+    0xF9, 0x00, 0xC0, 0xDD, 0x2C, 0x58, 0x26, 0x58,
+    0x74, 0x44, 0x21, 0xFC, 0x2C, 0x8C, 0x5B, 0x05,
+    0x50, 0xC9, 0xD9, 0xE3, 0x40, 0x2C, 0x81, 0xAB,
+    0x00, 0xBE, 0xC9, 0x1C, 0xFF, 0x57, 0xF2, 0xC9,
+    0xB3, 0x64, 0x0D, 0x8B, 0x4F, 0x9C, 0xA6, 0x2B,
+    0x68, 0xD7, 0xA9, 0xB0, 0x46, 0x3E, 0x06, 0xE4,
+    0x4C, 0xD0, 0xCA, 0x6A, 0x96, 0x47, 0xA0, 0x71,
+    0x02, 0x5C, 0xB3, 0xBB, 0x5B, 0x16, 0xAB, 0x41,
+    0x8F, 0xAD, 0x72, 0x31, 0x8B, 0x6C, 0xA2, 0x60,
+    0xE3, 0x00, 0x2D, 0x2B, 0x63, 0xDA, 0xDA, 0x53,
+    0x62, 0xD5, 0x42, 0x3F, 0x5D, 0x18, 0x18, 0x60,
+    0xB6, 0x02, 0x56, 0xE0, 0xEE, 0xB4, 0x17, 0x87,
+    0x6A, 0xFC, 0x33, 0xDE, 0xA2, 0x7E, 0xA8, 0x85,
+    0x09, 0x50, 0x11, 0x2E, 0xA4, 0x9D, 0xC3, 0xF5,
+    0x3D, 0x2C, 0xF8, 0x06, 0xF7, 0xA4, 0xAC, 0x39,
+    0xBF, 0x33, 0x30, 0xC5, 0x31, 0x71, 0x70, 0x36,
+    0x9E, 0x4B, 0x36, 0x55, 0x9C, 0x7F, 0x37, 0x46,
+    0x43, 0x96, 0xB8, 0xE7, 0x9D, 0xE6, 0x57, 0x74,
+    0xF0, 0x1E, 0xF7, 0x96, 0xD1, 0xA7, 0x97, 0x94,
+    0x8E, 0xA0, 0x14, 0x49, 0x1A, 0xDB, 0x02, 0x38,
+    0xC1, 0x99, 0xC7, 0x73, 0x1E, 0xAC, 0x09, 0x8B,
+    0x69, 0xBC, 0xDF, 0x9E, 0xB6, 0xC4, 0xCA, 0x30,
+    0x73, 0x1E, 0x17, 0x97, 0x0E, 0xE0, 0xD5, 0xD7,
+    0x4A, 0x51, 0x7A, 0x49, 0x7F, 0x05, 0xAC, 0x85,
+    0x68, 0x6D, 0xD3, 0x2C, 0xB2, 0x12, 0x6C, 0x23,
+    0xFD, 0x09, 0x21, 0x11, 0x06, 0xDF, 0x50, 0x51,
+    0x4C, 0xCE, 0xEE, 0x2B, 0xD2, 0xF9, 0x91, 0xC4,
+    0x84, 0x4D, 0x6A, 0x67, 0x26, 0x6E, 0x24, 0x7D,
+    0xB9, 0xDA, 0xA8, 0xE8, 0x55, 0x48, 0xE5, 0x90,
+    0x75, 0x07, 0x6F, 0xFB, 0xEA, 0xC9, 0x31, 0x8A,
+    0xDD, 0xD4, 0x1F, 0xC0, 0x0D, 0xE6, 0xD9, 0x35,
+    0x4D, 0x52, 0x18, 0x24, 0x20, 0x76, 0xBA, 0x7B,
+    0x74, 0x78, 0x72, 0x42, 0x26, 0xD3, 0x30, 0x98,
+    0x1E, 0x85, 0x95, 0x67, 0xC1, 0x14, 0x34, 0x1C,
+    0x51, 0xB0, 0x04, 0x9A, 0xE7, 0x53, 0xDE, 0x5B,
+    0x48, 0x8B, 0x7C, 0x70, 0xD1, 0x63, 0x4B, 0xB5,
+    0x1E, 0x9A, 0x77, 0x77, 0xD8, 0xC2, 0xFD, 0xCF,
+    0x2C, 0xEB, 0xA9, 0xDB, 0x3E, 0x20, 0xCF, 0x48,
+    0xAC, 0x86, 0x7B, 0x47, 0x23, 0x02, 0x2B, 0x20,
+    0x30, 0x3A, 0x62, 0xA6, 0x50, 0x33, 0x1F, 0x81,
+    0xF9, 0x87, 0xCD, 0xA3, 0x9F, 0x5A, 0x67, 0xE7,
+    0x04, 0xBE, 0x90, 0x2F, 0xDD, 0x24, 0xA0, 0xC0,
+    0x28, 0x6A, 0xEB, 0x00, 0x95, 0x81, 0x5A, 0xC1,
+    0x79, 0xF5, 0x58, 0x15, 0x39, 0x33, 0xC3, 0x5C,
+    0x82, 0x54, 0xEC, 0xC2, 0x43, 0xF6, 0x2D, 0x25,
+    0x67, 0xF9, 0x53, 0x39, 0xAA, 0x42, 0x6A, 0xE1,
+    0xA3, 0xCB, 0xD0, 0xB3, 0x32, 0xB6, 0x96, 0x86,
+    0xB7, 0x99, 0x51, 0x28, 0x73, 0xA5, 0xA1, 0x34,
+    0xBF, 0x46, 0xCF, 0x79, 0x5D, 0x87, 0x3E, 0x73,
+    0x46, 0xC0, 0xA9, 0xE0, 0xC0, 0x24, 0x47, 0x57,
+    0xBF, 0x67, 0x40, 0xC5, 0x6B, 0x7F, 0xA8, 0x96,
+    0x1C, 0xDF, 0x8C, 0x28, 0x27, 0xA4, 0x06, 0x66,
+    0xB7, 0x04, 0x1E, 0xD6, 0x29, 0x48, 0x44, 0x20,
+    0x18, 0xF3, 0x1E, 0x44, 0x6C, 0xB9, 0x48, 0xDC,
+    0xEC, 0x44, 0x38, 0x3B, 0xD8, 0x67, 0x84, 0xA9,
+    0x6C, 0x5C, 0x5C, 0x8D, 0xA8, 0x43, 0x9E, 0xF4,
+    0xDC, 0x17, 0xA1, 0xD9, 0x6B, 0x2D, 0x92, 0x88,
+    0xF1, 0x1A, 0x0B, 0xBD, 0xB3, 0xE7, 0x1D, 0xDF,
+    0xBA, 0xE8, 0xD2, 0x6F, 0xFD, 0xA6, 0xC3, 0xF9,
+    0x38, 0x35, 0xC8, 0xA1, 0x24, 0x34, 0x13, 0xF4,
+    0xCE, 0xDA, 0x64, 0x4B, 0x01, 0x1F, 0x24, 0x40,
+    0x88, 0x5D, 0x86, 0x24, 0x35, 0x2C, 0xDA, 0x13,
+    0x73, 0xD9, 0xD0, 0x83, 0xA1, 0xB8, 0x17, 0x1E,
+    0x2D, 0x38, 0x96, 0x99, 0x0B, 0x12, 0xC3, 0x71,
+    0xCE, 0x78, 0x86, 0x57, 0x76, 0xCD, 0x9A, 0x11,
+    0x52, 0xA8, 0xBC, 0xB0, 0xC3, 0xD5, 0x40, 0xC6,
+    0xD0, 0xBD, 0x4D, 0xBB, 0xB9, 0x88, 0x18, 0x84,
+    0x21, 0xA3, 0xE5, 0x5B, 0x0C, 0x07, 0xFC, 0x64,
+    0x60, 0x25, 0x19, 0x1C, 0x97, 0xAE, 0xDC, 0x00,
+    0x7F, 0x72, 0xEE, 0xBF, 0xBE, 0x48, 0xB2, 0x1D,
+    0xE1, 0x79, 0x2A, 0xE3, 0x21, 0x2C, 0x75, 0x37,
+    0x47, 0xBB, 0xAF, 0x0A, 0xEB, 0xE7, 0x39, 0xEE,
+    0x9F, 0x0B, 0x0E, 0xEC, 0xDE, 0x7C, 0x6A, 0xC7,
+    0x70, 0xA7, 0xA9, 0x99, 0xFE, 0x2E, 0xC0, 0xFB,
+    0x56, 0x93, 0xEB, 0xFF, 0x96, 0x74, 0x48, 0x71,
+    0x1A, 0xF9, 0x82, 0xEC, 0xBB, 0xBF, 0xDC, 0x56,
+    0x74, 0x9A, 0xD5, 0xC0, 0xE2, 0xB6, 0xA2, 0xC5,
+    0xC6, 0x56, 0x9F, 0x57, 0x6A, 0x63, 0x2C, 0xD4,
+    0xB5, 0x51, 0xEA, 0x39, 0xD3, 0x46, 0x7F, 0x89,
+    0xB8, 0x3E, 0x30, 0xA5, 0x27, 0xDE, 0x58, 0x7B,
+    0xBD, 0xB0, 0x53, 0x74, 0x1B, 0x58, 0x9A, 0x33,
+    0x04, 0xEC, 0x25, 0x3A, 0x9E, 0x38, 0x71, 0x30,
+    0x72, 0xBE, 0x01, 0x59, 0x2D, 0x58, 0xD2, 0x62,
+    0x29, 0x1A, 0x90, 0xC9, 0x29, 0x18, 0x62, 0x58,
+    0xCC, 0xD4, 0xB2, 0xEA, 0xDA, 0xE5, 0x5F, 0x55,
+    0x5D, 0x5F, 0xE4, 0xD9, 0x38, 0xC8, 0xDE, 0xA6,
+    0x3F, 0x9C, 0xAF, 0x9E, 0x13, 0xFE, 0x97, 0x60,
+
+    0x32, 0x11, 0x2A, 0xDE, 0xCA, 0x58, 0xDE, 0xE8,
+    0x05, 0x41, 0x46, 0xFE, 0x8E, 0x4A, 0x1D, 0x56,
+    0x94, 0xE6, 0x9E, 0xEF, 0xD0, 0x62, 0x6E, 0x5D,
+    0xB5, 0x19, 0x3A, 0x46, 0x1B, 0x13, 0xA0, 0x7C,
+    0xC6, 0x40, 0xD5, 0x1B, 0xD6, 0x65, 0xB5, 0x2D,
+    0xFA, 0xED, 0xF4, 0x6D, 0x25, 0x48, 0xAE, 0xE0,
+    0xDD, 0x07, 0xA8, 0xB9, 0x99, 0xE1, 0x48, 0x1C,
+    0xC5, 0xBB, 0x35, 0x60, 0xF2, 0x62, 0x26, 0x62,
+    0xC8, 0xF1, 0x8F, 0x08, 0xA3, 0x79, 0xD5, 0xE4,
+    0x1A, 0x6F, 0xD0, 0xAF, 0xCF, 0xA8, 0x6E, 0xE0,
+    0xBF, 0x2B, 0x42, 0xF4, 0x4C, 0x78, 0xBE, 0x7F,
+    0xCF, 0x59, 0x97, 0x23, 0xFD, 0x89, 0x0E, 0x7B,
+    0xC7, 0x80, 0x0F, 0xFB, 0x7F, 0x60, 0x1F, 0xF1,
+    0x9C, 0x71, 0xB9, 0xF6, 0x5F, 0xB4, 0xFB, 0x7A,
+    0x25, 0xCF, 0xEA, 0xEF, 0x46, 0x54, 0xD8, 0xF1,
+    0xBE, 0xB5, 0x85, 0x97, 0xC8, 0xCD, 0x0B, 0x2E,
+    0x6E, 0xE4, 0xC9, 0x0A, 0x18, 0x47, 0xC9, 0xEA,
+    0x47, 0xC3, 0x66, 0x8B, 0xA4, 0x37, 0x1E, 0x52,
+    0x49, 0x6B, 0xDA, 0xC5, 0x3B, 0x0B, 0x18, 0x83,
+    0xDB, 0x38, 0xCC, 0x87, 0x32, 0x6A, 0xB6, 0x7A,
+    0x6A, 0xDC, 0x55, 0x59, 0xED, 0xF7, 0x20, 0x77,
+    0xFD, 0xDC, 0x41, 0x7B, 0xF2, 0xBE, 0x9A, 0xC8,
+    0x83, 0x69, 0xCF, 0x20, 0x06, 0x3C, 0xA7, 0x29,
+    0x28, 0xF2, 0x4C, 0x0E, 0xAC, 0xA5, 0x85, 0x43,
+    0x57, 0xEA, 0xC2, 0x84, 0xFD, 0x7A, 0x33, 0xBE,
+    0x86, 0x49, 0xAB, 0x31, 0xA1, 0xE7, 0x4D, 0x38,
+    0xBA, 0x00, 0x6B, 0x94, 0x9E, 0x05, 0x7A, 0xB7,
+    0x65, 0x0B, 0x04, 0xA5, 0x4B, 0xFE, 0x7A, 0x55,
+    0x71, 0x76, 0x25, 0x62, 0xD4, 0xDA, 0x2B, 0x65,
+    0x0D, 0x75, 0x2E, 0xA8, 0xBA, 0x99, 0x1A, 0xBA,
+    0x20, 0x9D, 0x00, 0xBD, 0x9D, 0x81, 0x5F, 0xCD,
+    0xDC, 0x00, 0x5B, 0x38, 0x1D, 0x7E, 0x15, 0xC3,
+    0x39, 0xF0, 0x5F, 0x39, 0x9F, 0xD3, 0xA4, 0x73,
+    0xA7, 0xF6, 0x13, 0xEB, 0xB9, 0xCF, 0x63, 0x46,
+    0x75, 0x41, 0xAC, 0x47, 0xBA, 0xEF, 0x08, 0xF9,
+    0xB1, 0x56, 0x46, 0x48, 0x3E, 0xA4, 0x1E, 0x09,
+    0x38, 0x9E, 0x5E, 0xDD, 0x2D, 0xBE, 0xB3, 0x63,
+    0xE0, 0xFB, 0xD9, 0x96, 0xD6, 0x64, 0x13, 0x0C,
+    0xA6, 0xDF, 0x3B, 0xDD, 0x3E, 0x8F, 0xF6, 0x3F,
+    0xE9, 0x95, 0x5C, 0x4D, 0x01, 0x1F, 0x6F, 0xAD,
+    0x55, 0x7E, 0x59, 0xB6, 0xA1, 0xA4, 0x17, 0xA0,
+    0xE7, 0x83, 0xF8, 0x51, 0x16, 0x1B, 0x51, 0xDC,
+    0xB2, 0x35, 0x67, 0x0B, 0xBA, 0x77, 0x10, 0x0B,
+    0x92, 0x91, 0xB1, 0x5C, 0x31, 0x7C, 0xCD, 0x80,
+    0xBD, 0x4A, 0xC2, 0x57, 0x1F, 0xD5, 0xB4, 0x96,
+    0xE0, 0x0F, 0x97, 0x42, 0x1A, 0xB6, 0xCD, 0xBF,
+    0xFA, 0x22, 0x07, 0x8A, 0x43, 0xAD, 0x9E, 0x89,
+    0x78, 0x5F, 0x5D, 0x76, 0x41, 0xCD, 0xCE, 0x05,
+    0xE0, 0xE4, 0x1A, 0x89, 0x7F, 0xCF, 0xCF, 0xCC,
+    0x6B, 0x88, 0x71, 0xEF, 0xAE, 0xD5, 0x34, 0xFB,
+    0xB4, 0x9D, 0x76, 0xAA, 0x54, 0xF8, 0x25, 0x83,
+    0xB2, 0x7A, 0x06, 0x63, 0x5E, 0xEB, 0xA8, 0x37,
+    0xF1, 0xCC, 0x15, 0xDB, 0xC3, 0x01, 0xF0, 0x5A,
+    0x1C, 0xFB, 0xDC, 0xB4, 0xAD, 0xD8, 0x44, 0x6B,
+    0x6B, 0x8B, 0xC6, 0x5F, 0x96, 0xB9, 0x9D, 0x2D,
+    0x33, 0xDF, 0x88, 0xD0, 0xE8, 0x04, 0x84, 0x04,
+    0xAB, 0x97, 0x54, 0x67, 0x3B, 0x86, 0xD6, 0xB5,
+    0x2B, 0xF3, 0xD2, 0xE8, 0x43, 0xD9, 0xE6, 0x05,
+    0x31, 0xA6, 0x35, 0x5F, 0x24, 0x73, 0x4D, 0x75,
+    0xEE, 0x48, 0xBF, 0x3C, 0xE5, 0x40, 0x23, 0x7C,
+    0x2D, 0x21, 0xB5, 0x11, 0xB2, 0xC5, 0x8F, 0x54,
+    0x9A, 0x24, 0x0E, 0x1E, 0x80, 0x17, 0x01, 0x22,
+    0xB7, 0x10, 0xC2, 0x68, 0x98, 0x73, 0x42, 0x3F,
+    0xE8, 0x78, 0x8E, 0x6E, 0x82, 0x85, 0x80, 0xC5,
+    0xF9, 0x33, 0xFE, 0x80, 0xA1, 0x33, 0x3B, 0xDA,
+    0xB3, 0x16, 0x78, 0x24, 0xB0, 0xF5, 0xB7, 0xB9,
+    0x64, 0x2A, 0xBD, 0x09, 0xAC, 0xA3, 0xD1, 0x07,
+    0xC5, 0x65, 0xB8, 0x5D, 0x2B, 0x2A, 0xCB, 0x25,
+    0x21, 0xAF, 0xA8, 0xFA, 0x74, 0xD3, 0xA8, 0x36,
+    0x7D, 0x44, 0x39, 0x0E, 0x7B, 0x0F, 0xB2, 0xCF,
+    0xCB, 0x7B, 0xE7, 0xE7, 0xEF, 0x59, 0x91, 0xE5,
+    0x8D, 0x4C, 0xFA, 0xC9, 0x70, 0xC1, 0x59, 0x29,
+    0x90, 0xF7, 0x9E, 0x69, 0x96, 0x84, 0x22, 0x1A,
+    0x4A, 0x97, 0x6B, 0x4F, 0xEC, 0xDD, 0xD2, 0x12,
+    0xE8, 0x55, 0x10, 0x00, 0xA7, 0xBE, 0x9C, 0x6B,
+    0x06, 0xFD, 0xA7, 0xBB, 0xE3, 0x84, 0x1E, 0xBE,
+    0x18, 0xA5, 0x6C, 0x09, 0x56, 0x8C, 0xAC, 0xBC,
+    0x3B, 0x35, 0x22, 0xA9, 0x09, 0x5D, 0x17, 0x99,
+    0x0F, 0x05, 0x50, 0x58, 0x59, 0x65, 0x22, 0x0D,
+    0xF3, 0x01, 0x75, 0xBA, 0x65, 0x8B, 0x2F, 0x2B,
+    0x91, 0x53, 0x92, 0x77, 0x84, 0x6D, 0x60, 0xA1,
+    0x0B, 0xAF, 0x60, 0x15, 0x71, 0xD5, 0xBA, 0x01,
+    0x3B, 0x5B, 0xC6, 0x8B, 0x7B, 0x41, 0x33, 0xB7,
+    0x41, 0x2C, 0xF6, 0xB9, 0x35, 0xD2, 0xC0, 0x55,
+    0x8A, 0x41, 0xF9, 0xA9, 0xFB, 0x9D, 0xAF, 0x10,
+    0x49, 0x12, 0x01, 0x83, 0x75, 0x88, 0x9A, 0x9E,
+    0xF1, 0x93, 0x7C, 0x6F, 0xA3, 0xB7, 0x52, 0xC7,
+    0x8C, 0x24, 0x71, 0xD4, 0xBD, 0x27, 0x18, 0xF5,
+    0x33, 0xB6, 0x20, 0x8D, 0x30, 0x04, 0x79, 0x97,
+    0x4D, 0xD0, 0xED, 0x31, 0x70, 0xF2, 0xAC, 0x8E,
+    0x4D, 0x7F, 0x81, 0x53, 0xCA, 0x30, 0x38, 0x29,
+    0x85, 0x98, 0x5F, 0x40, 0xF1, 0xBA, 0x85, 0x0C,
+    0x00, 0xA7, 0x77, 0x22, 0xFD, 0x5C, 0xB1, 0x13,
+    0xE6, 0x5F, 0xCF, 0xAD, 0x85, 0xB1, 0xA1, 0xB2,
+    0x3E, 0x3B, 0xCB, 0xBE, 0x19, 0x20, 0x2D, 0x52,
+    0xC5, 0xA6, 0x22, 0xAB, 0x2A, 0xD8, 0x4D, 0x07,
+
+    0x5D, 0x44, 0x61, 0x40, 0xD4, 0xDD, 0x1D, 0xBA,
+    0xA2, 0x34, 0x4C, 0x76, 0xA8, 0x2D, 0x28, 0x6E,
+    0x30, 0x4A, 0x80, 0x81, 0x39, 0xBB, 0xC1, 0x89,
+    0xA9, 0x4D, 0x94, 0x72, 0x32, 0x5F, 0x67, 0xDC,
+    0x9F, 0x6A, 0x39, 0xC3, 0x23, 0xD6, 0x66, 0xD2,
+    0x4D, 0x39, 0x9B, 0x3B, 0x45, 0x4D, 0x8A, 0xD6,
+    0x60, 0x20, 0xD7, 0x83, 0x4A, 0x4D, 0xFF, 0x87,
+    0x75, 0x31, 0xD0, 0x80, 0x61, 0xA7, 0xB2, 0x78,
+    0xA3, 0x8F, 0x82, 0x7C, 0x15, 0xFC, 0x0D, 0xFB,
+    0x32, 0x20, 0xD9, 0x9B, 0xB6, 0x4E, 0xC2, 0x4F,
+    0x80, 0x4D, 0x28, 0x38, 0x54, 0x77, 0x8B, 0x7F,
+    0x52, 0x11, 0x5A, 0x4C, 0xEE, 0xD1, 0x82, 0x29,
+    0x88, 0xCA, 0x7D, 0x86, 0x44, 0xBB, 0x5C, 0x31,
+    0x48, 0x4C, 0xDE, 0x3C, 0xA8, 0x36, 0xC8, 0xE3,
+    0x74, 0xA5, 0xF0, 0x2D, 0x27, 0x26, 0x28, 0x22,
+    0x91, 0xF6, 0xC1, 0xF1, 0xDB, 0x99, 0x69, 0x7C,
+    0xD5, 0x0A, 0x71, 0x79, 0x74, 0x92, 0x69, 0x87,
+    0x65, 0x3D, 0x45, 0xE9, 0x3B, 0xA0, 0xDB, 0xD5,
+    0x23, 0x97, 0x55, 0xB0, 0xD1, 0xC9, 0x08, 0x14,
+    0x85, 0x19, 0x40, 0x60, 0x8E, 0x4D, 0x09, 0xA7,
+    0x31, 0x2D, 0xC9, 0x3B, 0x10, 0xEC, 0xD0, 0xE4,
+    0x6D, 0x28, 0x66, 0x0E, 0xA8, 0x40, 0x8D, 0x60,
+    0x72, 0x23, 0x55, 0xE8, 0x0D, 0xCC, 0xE0, 0x9F,
+    0xA6, 0xA5, 0xDC, 0x36, 0xA1, 0x43, 0x79, 0x59,
+    0x7D, 0xF5, 0xD8, 0xA3, 0x75, 0xF9, 0xD8, 0xA5,
+    0xE7, 0x5A, 0x19, 0x3E, 0x71, 0x87, 0x43, 0xA6,
+    0x7B, 0x69, 0x21, 0x9B, 0xF1, 0xEC, 0xDC, 0xBA,
+    0x40, 0x5A, 0xFA, 0x61, 0xC5, 0x73, 0x71, 0xB5,
+    0xEA, 0x8F, 0x57, 0x88, 0xC0, 0x8B, 0x73, 0xFF,
+    0x9D, 0x78, 0xAB, 0x36, 0x13, 0x32, 0xBC, 0xA4,
+    0x11, 0xAD, 0xD6, 0x88, 0x96, 0x0A, 0xA5, 0x9B,
+    0x0C, 0x3A, 0xCB, 0x5B, 0x78, 0xFE, 0xBE, 0xF5,
+    0xA3, 0x10, 0xA6, 0x5B, 0x19, 0x11, 0xA3, 0xD1,
+    0x73, 0x77, 0xCE, 0x4F, 0x19, 0x5A, 0x67, 0xF4,
+    0xD5, 0xCA, 0xB9, 0xC4, 0x90, 0xE0, 0xF4, 0x2B,
+    0x16, 0x00, 0x98, 0x08, 0x6D, 0x8A, 0xBD, 0x0E,
+    0xF9, 0x12, 0x99, 0xA0, 0xAF, 0xDD, 0xD8, 0x7C,
+    0x08, 0x0D, 0x37, 0x9F, 0x5D, 0x47, 0x87, 0x91,
+    0x09, 0xC0, 0xA5, 0xFB, 0xE3, 0x52, 0xD2, 0xDF,
+    0xE2, 0x5B, 0xEB, 0xFD, 0xA7, 0x00, 0x2D, 0xE4,
+    0x5F, 0x47, 0x0F, 0xB7, 0x03, 0x1C, 0xB0, 0x99,
+    0x2B, 0x27, 0x70, 0x2B, 0x5F, 0x4B, 0xB8, 0xC2,
+    0x2D, 0xE2, 0xD2, 0x11, 0xFE, 0x80, 0x09, 0x37,
+    0x61, 0xC1, 0xF9, 0x68, 0xE6, 0x97, 0xAE, 0xB9,
+    0x75, 0x2E, 0x6D, 0x73, 0x49, 0x51, 0xA0, 0xE8,
+    0x96, 0x76, 0x5C, 0xE5, 0xF9, 0x6B, 0x84, 0x2F,
+    0xF5, 0x45, 0x04, 0x72, 0x07, 0x6A, 0x73, 0xAE,
+    0xFD, 0xFF, 0xAF, 0xB9, 0x85, 0x8C, 0x81, 0xD9,
+    0x13, 0xC8, 0x04, 0x2F, 0x97, 0xF0, 0xF4, 0x99,
+    0x54, 0xBD, 0x8F, 0x5E, 0xE2, 0x50, 0x04, 0xAF,
+    0x4A, 0xB2, 0x13, 0xCA, 0x5D, 0x4C, 0xE2, 0xA4,
+    0xBA, 0x13, 0x44, 0xF6, 0x6F, 0xD6, 0x08, 0x7D,
+    0xE4, 0xE6, 0xB2, 0x80, 0x14, 0x84, 0x99, 0x63,
+    0xB7, 0xC5, 0x81, 0xE4, 0x43, 0xA3, 0x76, 0x60,
+    0xF3, 0x09, 0x23, 0xEB, 0x44, 0xE8, 0x87, 0x2A,
+    0x58, 0x2B, 0x4E, 0x6C, 0x89, 0x7D, 0x06, 0x3D,
+    0x68, 0x91, 0x46, 0x5C, 0xBF, 0x8D, 0xF5, 0x9B,
+    0x35, 0x3A, 0xE9, 0x0A, 0xDC, 0xB1, 0x36, 0xF6,
+    0x87, 0xD6, 0xF0, 0xA5, 0x10, 0x39, 0xE4, 0x8A,
+    0xA0, 0x45, 0xD4, 0x77, 0x23, 0x69, 0xEC, 0x97,
+    0x58, 0x26, 0xA7, 0xD7, 0x64, 0xA6, 0x9A, 0xF6,
+    0x51, 0x4D, 0xF6, 0xF9, 0xBB, 0x4A, 0x88, 0x6D,
+    0x39, 0xD2, 0x64, 0x3C, 0xA6, 0xB5, 0xF1, 0x8C,
+    0x13, 0x7F, 0x84, 0x2E, 0x8D, 0x28, 0xDC, 0x20,
+    0x4E, 0x1C, 0x29, 0x33, 0xC0, 0xB7, 0x6C, 0xDE,
+    0x1E, 0x37, 0xCE, 0x79, 0x4C, 0xCF, 0x72, 0xFA,
+    0xBD, 0x14, 0x08, 0xC6, 0x6A, 0x74, 0x15, 0x0F,
+    0x40, 0x8A, 0xAB, 0xE0, 0xF3, 0xC3, 0xF4, 0x69,
+    0x8A, 0x77, 0x9E, 0x24, 0x68, 0x7E, 0x0D, 0xB2,
+    0xB6, 0x3A, 0x80, 0x94, 0xAA, 0x61, 0x6B, 0x0D,
+    0x05, 0x55, 0xD6, 0x17, 0xA3, 0x95, 0x21, 0x4A,
+    0x53, 0xAE, 0x88, 0x9A, 0xDA, 0xE7, 0x3A, 0xA0,
+    0xC2, 0x6D, 0x21, 0x28, 0x3B, 0xAC, 0xE6, 0x94,
+    0xF5, 0x73, 0x37, 0x0D, 0x88, 0x1B, 0xE5, 0x0B,
+    0x18, 0x00, 0xD2, 0xAD, 0xB0, 0x96, 0xDB, 0xFD,
+    0x2A, 0x3F, 0x30, 0xDC, 0xED, 0xDD, 0x45, 0xA1,
+    0x6D, 0xE0, 0x11, 0x3F, 0x3A, 0xE8, 0x2C, 0x88,
+    0x72, 0x27, 0xC6, 0xFB, 0x5B, 0x1D, 0x75, 0x56,
+    0x74, 0x6E, 0x54, 0x3F, 0x24, 0xDE, 0xC1, 0x93,
+    0x82, 0x20, 0xD1, 0x63, 0x9B, 0x9C, 0x41, 0xC5,
+    0x6E, 0x4B, 0x61, 0xF6, 0x4D, 0x82, 0x62, 0xBD,
+    0xC9, 0xA5, 0x62, 0xC8, 0x1E, 0xE5, 0xE6, 0x29,
+    0x48, 0xBB, 0x5F, 0x56, 0x33, 0xF9, 0x74, 0x58,
+    0x41, 0xEC, 0xB1, 0x8B, 0x20, 0x58, 0x19, 0x88,
+    0x41, 0xC1, 0xF7, 0x60, 0xAB, 0xCA, 0x8D, 0x35,
+    0xBE, 0xF8, 0x47, 0xF4, 0x50, 0xA2, 0xBD, 0x0B,
+    0x14, 0xAB, 0x41, 0x01, 0x25, 0x1E, 0xAC, 0xA5,
+    0x5C, 0x26, 0x85, 0xC0, 0xEA, 0xCB, 0x29, 0xF8,
+    0x2B, 0x84, 0xFA, 0x0E, 0x92, 0x22, 0xCD, 0x13,
+    0x6C, 0xA8, 0x04, 0xE8, 0x37, 0xDB, 0xC8, 0xE3,
+    0x14, 0xF6, 0x60, 0xCE, 0x3F, 0x12, 0xB7, 0x23,
+    0xB5, 0x13, 0xD2, 0xD8, 0x4D, 0x3B, 0xF4, 0x6A,
+    0x74, 0x86, 0x59, 0xFA, 0xE0, 0x90, 0xD8, 0x08,
+    0x9E, 0x7C, 0x14, 0x86, 0x0F, 0xC6, 0x51, 0x2A,
+    0xE1, 0xED, 0x23, 0xA5, 0xDE, 0x3F, 0x14, 0x2C,
+    0x94, 0x2D, 0xD4, 0xA5, 0x04, 0x95, 0x7F, 0xD2,
+};
+
+static const unsigned char ffdhe8192_T[5 * 1024] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA4, 0x0F, 0x57, 0x4E, 0xBA, 0x89, 0x6A, 0xCA,
+    0xA0, 0x47, 0x53, 0xBF, 0xB1, 0x85, 0x86, 0x1C,
+    0x4E, 0x8C, 0x74, 0xF8, 0x63, 0xA5, 0x92, 0xD4,
+    0xAC, 0x3D, 0x93, 0x7D, 0xD7, 0x37, 0x98, 0x08,
+    0x66, 0xD8, 0xC4, 0x63, 0xB6, 0xC9, 0x82, 0x0D,
+    0x05, 0xA0, 0x39, 0x39, 0x39, 0xE7, 0x14, 0x4E,
+    0x12, 0xFC, 0x9B, 0xFA, 0xA2, 0x77, 0x3D, 0x0A,
+    0x58, 0x41, 0xC2, 0x54, 0x54, 0x05, 0x35, 0x3D,
+    0xB7, 0x98, 0x15, 0xC1, 0x41, 0xF3, 0x22, 0x5E,
+    0xF5, 0x39, 0x35, 0x55, 0x84, 0x25, 0xCA, 0x18,
+    0x95, 0x51, 0xD9, 0x43, 0x01, 0x50, 0x6D, 0x94,
+    0xCF, 0x61, 0xE7, 0x1E, 0x3E, 0x32, 0xE9, 0x10,
+    0x3A, 0xB2, 0xEC, 0x4A, 0x18, 0x20, 0x2F, 0x1B,
+    0xC4, 0x1D, 0x4E, 0xBD, 0x92, 0xA4, 0x31, 0x95,
+    0x9E, 0xA6, 0x6B, 0x61, 0x6F, 0x8B, 0x0D, 0x0A,
+    0x87, 0xEA, 0x9C, 0xFA, 0x99, 0xB6, 0x09, 0x3C,
+    0x5D, 0xEE, 0xAD, 0x68, 0x9A, 0x6E, 0x38, 0x08,
+    0x8D, 0x2A, 0x4A, 0x91, 0x3E, 0x50, 0x17, 0x2F,
+    0xC5, 0x61, 0x7A, 0xB8, 0x43, 0x8D, 0x64, 0x16,
+    0xA3, 0x52, 0x24, 0x31, 0x39, 0x1A, 0x89, 0xCD,
+    0xE9, 0xF0, 0xB0, 0x6E, 0x23, 0xEB, 0x25, 0x1E,
+    0xC3, 0xFA, 0x06, 0x3C, 0x64, 0x10, 0x3A, 0x26,
+    0x7F, 0x97, 0xF6, 0x65, 0xAF, 0x97, 0xA1, 0x3C,
+    0xDD, 0x1A, 0x02, 0xC6, 0x2C, 0xF4, 0xF8, 0x00,
+    0xE3, 0x61, 0xDB, 0x9A, 0x22, 0x1A, 0xFC, 0xF8,
+    0x78, 0x03, 0x89, 0xC9, 0x67, 0x20, 0xA5, 0x19,
+    0x88, 0x94, 0x06, 0x87, 0xA2, 0x7B, 0xBF, 0xF4,
+    0x74, 0xE2, 0x1C, 0xF9, 0x05, 0xD2, 0xF8, 0x9A,
+    0x72, 0x19, 0x6B, 0xB2, 0x7C, 0x9A, 0x20, 0x0A,
+    0xEF, 0x29, 0x7B, 0x8F, 0x3D, 0xC0, 0x60, 0x46,
+    0x43, 0x95, 0x49, 0x89, 0x35, 0xCD, 0xF9, 0x48,
+    0x87, 0x96, 0x16, 0x42, 0x0C, 0xC7, 0xFB, 0x8F,
+    0x3C, 0x97, 0x20, 0x6C, 0x52, 0x32, 0x6D, 0xF1,
+    0x0A, 0x4D, 0xC5, 0xB2, 0xDC, 0x10, 0x10, 0x23,
+    0x4C, 0xE6, 0x9E, 0x0A, 0x7C, 0xF2, 0x4D, 0xC6,
+    0xA2, 0x03, 0xD9, 0xEC, 0xF5, 0xD8, 0xDB, 0x1E,
+    0x97, 0xD9, 0xE6, 0xD8, 0x87, 0x79, 0x0D, 0x76,
+    0x16, 0x05, 0x77, 0x5A, 0x3A, 0x51, 0x64, 0x59,
+    0x36, 0x1A, 0x3B, 0xC3, 0x1C, 0x15, 0x68, 0x01,
+    0x46, 0xA2, 0xFA, 0xA8, 0xC6, 0xC4, 0x12, 0xC2,
+    0x2F, 0x25, 0xA8, 0x75, 0xBB, 0x93, 0x8B, 0xE4,
+    0xA8, 0x75, 0xBC, 0xD0, 0xC9, 0xE4, 0x2A, 0x4B,
+    0xC4, 0x80, 0xCB, 0x7A, 0x54, 0x77, 0x6F, 0x63,
+    0xEA, 0x86, 0x5F, 0x28, 0x0B, 0x58, 0x44, 0x21,
+    0x87, 0xC9, 0xBE, 0x23, 0x80, 0x54, 0xC5, 0x07,
+    0xB4, 0x37, 0xC5, 0xA9, 0x32, 0xC3, 0xC2, 0x1D,
+    0x23, 0x21, 0x5A, 0x79, 0xD3, 0x64, 0x16, 0x09,
+    0x0D, 0x9E, 0x2C, 0x36, 0x34, 0xEF, 0x50, 0x92,
+    0xA7, 0x05, 0x41, 0x7A, 0x52, 0xC1, 0x25, 0xCF,
+    0x11, 0x38, 0x61, 0xC5, 0x55, 0xF9, 0x7F, 0xF6,
+    0xF0, 0x15, 0x48, 0xB5, 0x03, 0x9C, 0x67, 0x0B,
+    0x1D, 0x94, 0x6E, 0xF2, 0x20, 0x97, 0x9C, 0xEA,
+    0x25, 0x2B, 0xC3, 0xFD, 0xA4, 0xC3, 0x2F, 0x9A,
+    0xAD, 0xF1, 0x3F, 0xEA, 0xDC, 0xFD, 0x9E, 0x77,
+    0x24, 0x71, 0x0E, 0x0D, 0x1C, 0xA5, 0xFF, 0x8F,
+    0xED, 0xAC, 0xCC, 0xB9, 0x98, 0x68, 0xE9, 0x0B,
+    0xCB, 0xC4, 0x8D, 0x85, 0x1D, 0x7F, 0xFF, 0x87,
+    0xAB, 0x62, 0x62, 0xAC, 0x0C, 0xE5, 0xEA, 0x67,
+    0xEA, 0xFA, 0xDC, 0x64, 0x62, 0x6D, 0x04, 0x60,
+    0xE2, 0x6C, 0x95, 0x4B, 0x00, 0xEE, 0xB7, 0x29,
+    0x64, 0x94, 0xAF, 0x5C, 0x17, 0x7C, 0xFA, 0x3C,
+    0x72, 0xEB, 0xFF, 0x03, 0x43, 0xE4, 0x4D, 0xFB,
+    0xE8, 0x05, 0x36, 0x93, 0x75, 0xF9, 0x27, 0x0B,
+    0x63, 0x31, 0x05, 0xA7, 0x8F, 0x59, 0xAB, 0x8B,
+    0xB8, 0x8B, 0x77, 0x7A, 0x6A, 0x15, 0x82, 0xB3,
+    0x88, 0x97, 0x57, 0x9A, 0xC9, 0x13, 0xB6, 0x6E,
+    0xDD, 0x08, 0x45, 0x36, 0x9C, 0x7E, 0x05, 0x66,
+    0x98, 0xE2, 0xE7, 0x99, 0x67, 0x1F, 0xC7, 0x8A,
+    0x64, 0xA5, 0xF3, 0x50, 0x06, 0x60, 0x27, 0x1C,
+    0xC9, 0xC1, 0x47, 0x83, 0x63, 0x73, 0xF7, 0xC1,
+    0x8E, 0xFD, 0x70, 0x09, 0x66, 0x04, 0x97, 0x10,
+    0xB5, 0xB7, 0x1C, 0x10, 0xAC, 0xAD, 0x2D, 0xDE,
+    0x8F, 0x55, 0x9B, 0xA2, 0x49, 0x39, 0x7E, 0x4E,
+    0xBF, 0xE2, 0x1E, 0xDB, 0x95, 0xF5, 0xDC, 0x39,
+    0xEA, 0x82, 0x7C, 0x00, 0x0C, 0x38, 0xBB, 0x23,
+    0x00, 0x9A, 0xC0, 0xE7, 0xCF, 0x9F, 0xB8, 0x79,
+    0x4F, 0x03, 0x8E, 0x4B, 0xFF, 0x10, 0x4C, 0x97,
+    0x13, 0x83, 0x63, 0x68, 0xD6, 0x9A, 0x88, 0x7C,
+    0xD6, 0x73, 0x35, 0xC3, 0x10, 0x6A, 0x0C, 0xDA,
+    0x22, 0xAA, 0x7F, 0xB9, 0xAB, 0xAF, 0xC8, 0x12,
+    0x98, 0xB1, 0x8C, 0x7D, 0xBB, 0x3D, 0xD2, 0xFB,
+    0xEA, 0x2E, 0x49, 0x4F, 0x70, 0xB3, 0x06, 0x82,
+    0x0C, 0x6D, 0xED, 0xC9, 0x73, 0xA5, 0x58, 0xE6,
+    0x51, 0xA9, 0xF9, 0x17, 0x2A, 0x31, 0x01, 0x43,
+    0x3B, 0xAD, 0xA7, 0x9D, 0xD5, 0x3A, 0xAF, 0x73,
+    0x5F, 0x44, 0x6F, 0xA4, 0x8F, 0x57, 0x98, 0xEA,
+    0x36, 0xC1, 0x5B, 0x94, 0x6D, 0x48, 0xDD, 0xD0,
+    0xE6, 0x61, 0xA4, 0x54, 0x6A, 0x62, 0x17, 0xF8,
+    0x26, 0xC5, 0xCF, 0xDE, 0x73, 0xB1, 0xA9, 0xF7,
+    0x49, 0x89, 0x1C, 0x0C, 0x47, 0x28, 0xFE, 0x53,
+    0x80, 0x45, 0x6A, 0xE2, 0xCA, 0x49, 0xC3, 0x2D,
+    0x3A, 0xB2, 0xD5, 0xB2, 0x57, 0x9D, 0x3C, 0x7C,
+    0xB7, 0xC5, 0x51, 0xE5, 0x0D, 0x8E, 0x4A, 0x56,
+    0xB7, 0xE3, 0x9A, 0xC6, 0x60, 0x17, 0x2A, 0xAB,
+    0x92, 0xA5, 0xFF, 0x66, 0x13, 0xFE, 0x6F, 0x8F,
+    0xC3, 0x7B, 0x4B, 0x9C, 0x4D, 0x5C, 0xA3, 0x36,
+    0x04, 0x9B, 0x80, 0x62, 0x6D, 0x5E, 0xC5, 0x79,
+    0x2F, 0x00, 0x29, 0x2C, 0x24, 0x5C, 0x67, 0x43,
+    0xE8, 0xE6, 0x78, 0x84, 0x13, 0x69, 0xDE, 0x20,
+    0xF2, 0x93, 0x9D, 0x7A, 0xB8, 0xA8, 0xEF, 0xAD,
+    0x55, 0x49, 0xA1, 0x17, 0x06, 0xD9, 0xB3, 0x34,
+    0x69, 0xA7, 0xE1, 0xC6, 0x7F, 0xC8, 0x51, 0xFB,
+    0xAD, 0x8E, 0xEF, 0x8C, 0x5A, 0xA1, 0xF4, 0x37,
+    0x57, 0x5F, 0x6A, 0x70, 0xE9, 0x14, 0xFA, 0xFB,
+    0xAF, 0x72, 0x7E, 0x8B, 0x94, 0x79, 0x41, 0x47,
+    0x4D, 0xD3, 0xE6, 0x7F, 0x72, 0x04, 0xFB, 0x5D,
+    0x57, 0xC0, 0x72, 0xE6, 0xC6, 0xF2, 0x9F, 0xBA,
+    0x89, 0x1E, 0xCC, 0xF1, 0x2B, 0x73, 0xE3, 0x17,
+    0x5C, 0xAE, 0xAD, 0x9D, 0xED, 0x1F, 0x80, 0x23,
+    0xC7, 0xBD, 0x03, 0x27, 0x8F, 0xB2, 0x35, 0xA7,
+    0x5C, 0xAB, 0x2D, 0xC3, 0xE3, 0x7B, 0x86, 0x06,
+    0xCC, 0x2C, 0x39, 0xD3, 0x5E, 0x7D, 0xBD, 0x09,
+    0x3B, 0x6F, 0xD2, 0x64, 0xA4, 0xCA, 0xD4, 0x0C,
+    0x54, 0x8F, 0xFC, 0xD6, 0xEE, 0x4C, 0x7E, 0xBE,
+    0xBC, 0x03, 0x9F, 0x14, 0xB5, 0x10, 0x3B, 0x9C,
+    0xF8, 0x0F, 0xC5, 0x6B, 0x81, 0xA0, 0xB7, 0x51,
+    0xC2, 0x06, 0xE6, 0x3E, 0x8A, 0xEB, 0x60, 0x2E,
+    0x92, 0xF5, 0x44, 0x03, 0x1A, 0x9E, 0xB3, 0x22,
+    0x42, 0x5A, 0x08, 0xA8, 0x08, 0x34, 0xEB, 0x9E,
+    0x0A, 0x0A, 0x83, 0xC7, 0x45, 0x1C, 0xAF, 0x03,
+    0xA1, 0x17, 0xC2, 0x0E, 0x7C, 0x02, 0xF2, 0x02,
+    0xB2, 0x88, 0x04, 0x35, 0x9F, 0x31, 0x01, 0xE4,
+    0xD0, 0x5D, 0xC5, 0x6C, 0x10, 0xAF, 0x77, 0x85,
+    0xEF, 0xBA, 0x35, 0xF2, 0xAC, 0x17, 0x3D, 0x63,
+    0xFD, 0xC3, 0xAA, 0xD6, 0xF8, 0xE0, 0x0E, 0xE6,
+    0x52, 0xE6, 0xE8, 0x90, 0x74, 0x73, 0x7B, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+
+    0x2C, 0x8A, 0xA3, 0x8E, 0xC3, 0x95, 0x0D, 0xFD,
+    0x64, 0x07, 0xDD, 0xE6, 0x1C, 0x1A, 0xD2, 0xE7,
+    0xF2, 0x27, 0x7D, 0x6E, 0x79, 0x6A, 0x93, 0x80,
+    0x7D, 0x5B, 0x44, 0x53, 0x4C, 0x23, 0x21, 0x40,
+    0x21, 0x4E, 0xD8, 0xEB, 0x5A, 0xB6, 0x0D, 0x7E,
+    0x9E, 0xD3, 0x6E, 0xB3, 0xFF, 0x95, 0x74, 0x77,
+    0xD7, 0x21, 0x6C, 0x9B, 0x20, 0x02, 0x27, 0xA9,
+    0x89, 0xB6, 0x61, 0x9B, 0xC2, 0x6B, 0x87, 0x59,
+    0x7A, 0xAF, 0x19, 0x65, 0x3F, 0x5C, 0x5E, 0x82,
+    0x24, 0x7C, 0x4F, 0x41, 0x9C, 0x80, 0x70, 0x1A,
+    0xC4, 0x26, 0x9B, 0xD3, 0xE4, 0x83, 0xFE, 0xC6,
+    0x4C, 0xDE, 0x1C, 0xE1, 0x0D, 0xA3, 0x68, 0xC7,
+    0xC1, 0x52, 0xB7, 0x25, 0x02, 0x7C, 0x6F, 0xAF,
+    0xBC, 0x49, 0x79, 0x62, 0xCF, 0x83, 0x59, 0xB7,
+    0xCA, 0xD5, 0x64, 0x6E, 0xC7, 0x10, 0xE1, 0x88,
+    0x4E, 0xFF, 0xF9, 0x1B, 0x2B, 0x5C, 0xBF, 0x66,
+    0xD7, 0x8F, 0x76, 0x10, 0xA3, 0x97, 0xBA, 0x63,
+    0x23, 0x0D, 0x26, 0xCE, 0x93, 0xB3, 0xAA, 0x1E,
+    0xFD, 0x52, 0x04, 0x99, 0xC0, 0x73, 0x36, 0x74,
+    0x2C, 0x6E, 0x4E, 0xC8, 0x12, 0x43, 0x64, 0x0E,
+    0xE1, 0xE2, 0xA6, 0x36, 0x38, 0xBC, 0x77, 0xA9,
+    0xB4, 0xD3, 0x50, 0x90, 0x61, 0xC8, 0xC9, 0x75,
+    0xAA, 0x8B, 0xBB, 0x66, 0x01, 0xCE, 0xDA, 0x14,
+    0x35, 0x81, 0x12, 0x06, 0x31, 0xAE, 0x5E, 0x7B,
+    0x53, 0xF6, 0x35, 0x34, 0xD2, 0x3E, 0xA9, 0x5C,
+    0xAB, 0x69, 0x80, 0x55, 0xFB, 0xB9, 0xDD, 0x77,
+    0xC5, 0x51, 0x69, 0x5F, 0xDC, 0x1A, 0x8E, 0xA1,
+    0x30, 0x14, 0x35, 0x10, 0xD3, 0x04, 0xB9, 0x6A,
+    0x3A, 0xF4, 0x33, 0xBB, 0x17, 0x6E, 0x5C, 0x02,
+    0x82, 0x96, 0x5B, 0xD0, 0xFA, 0xEE, 0xB3, 0xDA,
+    0x9C, 0x37, 0x70, 0xFA, 0x0D, 0xFB, 0xAE, 0x97,
+    0x27, 0x86, 0x42, 0x98, 0x03, 0x75, 0x01, 0x4B,
+    0x09, 0x18, 0x32, 0x2D, 0x30, 0xBB, 0x42, 0x42,
+    0xA4, 0x83, 0x6F, 0x1F, 0x69, 0xD9, 0xD8, 0x03,
+    0x7F, 0xC7, 0x34, 0xB4, 0x6B, 0x87, 0xEB, 0xF4,
+    0x77, 0x83, 0xBA, 0xC5, 0xFB, 0x99, 0x1C, 0xDB,
+    0xA6, 0xA2, 0xFF, 0x6A, 0x33, 0x4B, 0x9F, 0xB6,
+    0x55, 0x36, 0x9C, 0x95, 0xBC, 0x6E, 0xDD, 0xA7,
+    0x91, 0xD0, 0xDC, 0x05, 0x6A, 0xD6, 0x27, 0x8B,
+    0x5A, 0x6D, 0x89, 0xFF, 0xC9, 0xD8, 0x5D, 0x03,
+    0xCE, 0x99, 0x28, 0x40, 0xCD, 0x04, 0x28, 0x5C,
+    0x24, 0x9C, 0x35, 0x7A, 0x6B, 0x99, 0xC2, 0x96,
+    0x24, 0x6C, 0xAF, 0x80, 0xFE, 0x17, 0x4C, 0x59,
+    0x7D, 0x96, 0x89, 0x00, 0x23, 0x5B, 0x26, 0x73,
+    0x76, 0xCC, 0xE7, 0xB1, 0x0F, 0x4C, 0xC6, 0x7E,
+    0xEB, 0xA3, 0xF4, 0x67, 0x29, 0x37, 0x4A, 0x77,
+    0x90, 0x5B, 0x78, 0x9F, 0xAF, 0x7A, 0xC8, 0xE0,
+    0x03, 0xAD, 0xE2, 0x73, 0xD1, 0xB2, 0x70, 0x02,
+    0x10, 0x61, 0xC9, 0xCD, 0xB2, 0xB8, 0x36, 0xFF,
+    0x6F, 0x3C, 0x2D, 0x65, 0x50, 0x5A, 0x5C, 0x56,
+    0xE6, 0xAB, 0x9E, 0x02, 0xCF, 0xE8, 0x2C, 0x8A,
+    0x99, 0xC6, 0x0B, 0x77, 0x39, 0x29, 0x5C, 0x68,
+    0xF0, 0xE8, 0x22, 0xAC, 0x88, 0xFB, 0xE2, 0x69,
+    0x74, 0x6B, 0x0D, 0x97, 0xF1, 0x46, 0x14, 0x93,
+    0x77, 0x70, 0x53, 0x24, 0xFC, 0xEA, 0x0B, 0x3B,
+    0x25, 0x53, 0xB2, 0x48, 0xAF, 0x86, 0x34, 0x50,
+    0x9A, 0x96, 0x52, 0xDC, 0x8F, 0x3D, 0x86, 0x62,
+    0xAA, 0xFB, 0x29, 0x31, 0xF0, 0x32, 0x5D, 0xAE,
+    0xD9, 0x4A, 0x36, 0x1E, 0xED, 0xE6, 0x2C, 0xB0,
+    0xB6, 0x06, 0xE1, 0x49, 0x35, 0x3C, 0x66, 0xE3,
+    0x88, 0x51, 0xAC, 0x59, 0x40, 0x50, 0x24, 0xE5,
+    0x76, 0x61, 0x67, 0xF3, 0x25, 0x4F, 0xA8, 0x71,
+    0xCC, 0xE3, 0x62, 0xED, 0xAC, 0x17, 0xFC, 0xB6,
+    0x3C, 0x79, 0xC8, 0x29, 0xB0, 0x10, 0xE1, 0x00,
+    0x61, 0x69, 0x01, 0xF3, 0x1D, 0xD4, 0x90, 0xDD,
+    0xAF, 0x11, 0xD3, 0x6A, 0xD2, 0xBB, 0x18, 0x1F,
+    0x88, 0xE5, 0xCD, 0x87, 0x4C, 0x1B, 0x8B, 0x6F,
+    0x2D, 0x7D, 0xF8, 0xC7, 0xA2, 0x83, 0xCA, 0x04,
+    0xF4, 0x52, 0x9F, 0x76, 0xB8, 0xD5, 0xB7, 0x77,
+    0x0F, 0x2F, 0x51, 0x7A, 0xDA, 0xE4, 0xDE, 0x76,
+    0x4F, 0xDA, 0xE8, 0x9B, 0x8A, 0x74, 0x43, 0x2A,
+    0x98, 0x98, 0x71, 0xDF, 0x36, 0xB6, 0x07, 0xF8,
+    0x75, 0x33, 0x3B, 0xA8, 0x4E, 0x37, 0x29, 0x72,
+    0x68, 0xCD, 0x10, 0x41, 0x86, 0x16, 0xF5, 0xB2,
+    0xA1, 0x45, 0x12, 0x48, 0xF4, 0x7B, 0xA4, 0xBB,
+    0xF1, 0x53, 0x0C, 0x03, 0xCB, 0x9F, 0xAD, 0xAB,
+    0x4C, 0xD2, 0xCF, 0xD6, 0xD0, 0x64, 0xE4, 0x61,
+    0xE5, 0xF3, 0x73, 0xC1, 0x7B, 0x03, 0x01, 0x2F,
+    0xE9, 0x66, 0xCD, 0xDA, 0xA9, 0x66, 0xA4, 0x74,
+    0x8F, 0x1A, 0x0F, 0xB5, 0x22, 0x58, 0x11, 0xB7,
+    0x43, 0x51, 0xE1, 0x0C, 0xBC, 0x3A, 0xE9, 0x72,
+    0x2B, 0x01, 0x3E, 0x54, 0x5B, 0x35, 0xBB, 0x91,
+    0x9B, 0xCE, 0x0E, 0x36, 0x62, 0x3E, 0x21, 0x48,
+    0xDA, 0x9A, 0x18, 0xED, 0x4E, 0x89, 0xDA, 0xC7,
+    0x21, 0xD2, 0xCD, 0x4D, 0x64, 0xC4, 0xF0, 0xF7,
+    0xD8, 0x79, 0xC8, 0x73, 0xE5, 0x07, 0x63, 0x67,
+    0x1F, 0xD4, 0x48, 0x5C, 0xEF, 0xD7, 0x7F, 0x5F,
+    0x14, 0x03, 0x05, 0x05, 0xF6, 0x8B, 0xE8, 0xE3,
+    0xFA, 0xF1, 0x94, 0x7A, 0x10, 0xC1, 0xF4, 0x57,
+    0x5B, 0xFE, 0xFF, 0x87, 0x3D, 0x7B, 0x8D, 0xF5,
+    0x67, 0x07, 0xE9, 0x0A, 0x85, 0x4A, 0x26, 0x6F,
+    0x05, 0x11, 0xC7, 0x44, 0xFE, 0xE3, 0xCE, 0xA9,
+    0x84, 0x43, 0x36, 0x6D, 0xEA, 0xCD, 0x91, 0x13,
+    0x4A, 0xB7, 0x81, 0xDE, 0x2C, 0x12, 0xCE, 0xB4,
+    0x39, 0x99, 0x5C, 0xF3, 0x8F, 0xA6, 0xFB, 0xB5,
+    0x72, 0x2C, 0x89, 0x85, 0x1B, 0x90, 0x3E, 0x25,
+    0xB3, 0x4F, 0x3E, 0x17, 0xA5, 0x1D, 0x86, 0x11,
+    0x85, 0x17, 0xC7, 0x9D, 0x21, 0x69, 0xE4, 0x98,
+    0xAC, 0x98, 0x74, 0xAD, 0x30, 0xB7, 0x57, 0xD9,
+    0x25, 0x2F, 0xFF, 0xEE, 0x6F, 0x7F, 0xB9, 0xB6,
+    0x53, 0x48, 0xB0, 0xFB, 0x06, 0xA4, 0xAD, 0xBA,
+    0x87, 0x43, 0xC2, 0xA4, 0xF3, 0x9A, 0x52, 0x3C,
+    0x43, 0xCB, 0x6C, 0x3E, 0x7F, 0x60, 0xA8, 0x48,
+    0xE6, 0xEE, 0x0C, 0xE2, 0x1C, 0x81, 0x1D, 0xD5,
+    0xA6, 0xB3, 0x92, 0x97, 0x46, 0x20, 0x32, 0x50,
+    0xB1, 0x45, 0x9A, 0x03, 0x65, 0x37, 0xDD, 0xDB,
+    0x64, 0x0B, 0x13, 0x21, 0x7D, 0x20, 0x0C, 0xCE,
+    0xCC, 0x77, 0x99, 0x89, 0x24, 0xF5, 0xCE, 0x31,
+    0xA7, 0x15, 0x8A, 0xE2, 0xB9, 0x19, 0x69, 0x0C,
+    0xB9, 0xC6, 0x1F, 0x7F, 0xEA, 0x2C, 0x3C, 0x58,
+    0x3E, 0x93, 0xF7, 0x6B, 0xDC, 0xB2, 0x19, 0xC1,
+    0x74, 0x29, 0x51, 0x9F, 0x6D, 0x32, 0xBC, 0x71,
+    0x9F, 0xCD, 0xDA, 0xF8, 0x81, 0xA3, 0x81, 0x5B,
+    0x67, 0x08, 0x49, 0x43, 0x87, 0xF8, 0xA9, 0x8A,
+    0x93, 0x27, 0x43, 0xE9, 0x25, 0x3E, 0xCE, 0x4A,
+    0x63, 0xC3, 0xF2, 0xCE, 0x2F, 0xC4, 0x4B, 0xC7,
+    0x07, 0xA5, 0xE3, 0xC1, 0x20, 0x0A, 0x6A, 0x6A,
+    0x67, 0x45, 0x79, 0x74, 0xD9, 0x92, 0xC2, 0xE8,
+    0x34, 0xF2, 0x62, 0x39, 0x7E, 0xBD, 0xC7, 0x7C,
+    0xF9, 0x41, 0x28, 0x23, 0x47, 0xD7, 0x0C, 0x37,
+    0x38, 0x24, 0xA5, 0x86, 0xF9, 0xDB, 0x03, 0x9B,
+    0x51, 0x80, 0x63, 0x66, 0x08, 0x4D, 0xCC, 0x7A,
+    0x4D, 0x9C, 0x2D, 0xC8, 0x2F, 0x21, 0x8B, 0x31,
+    0x99, 0x79, 0x14, 0x52, 0xE9, 0x19, 0xB6, 0x8B,
+    0x0F, 0xEF, 0xBF, 0xC6, 0x29, 0x7F, 0x74, 0x92,
+    0x91, 0x56, 0x0E, 0x41, 0x20, 0x30, 0x14, 0xD8,
+    0xE9, 0xBD, 0xAB, 0x64, 0x38, 0xE7, 0x8B, 0x93,
+    0x2E, 0xB7, 0x53, 0x5E, 0x76, 0x2B, 0x48, 0x30,
+
+    0x51, 0x42, 0x16, 0x6B, 0x8E, 0xB2, 0x63, 0xA5,
+    0x59, 0xE9, 0x25, 0xD7, 0x72, 0x94, 0x02, 0x4C,
+    0x16, 0x29, 0x81, 0x52, 0x40, 0x8A, 0x23, 0x42,
+    0x99, 0x53, 0x08, 0x9C, 0x0F, 0x2C, 0xBA, 0x7B,
+    0x3C, 0x68, 0xB8, 0x4A, 0x3F, 0x5F, 0x1A, 0x71,
+    0x33, 0x73, 0xB6, 0x79, 0x73, 0x41, 0x48, 0xE3,
+    0x85, 0xF2, 0x0A, 0x12, 0x31, 0x17, 0x7A, 0x86,
+    0xF7, 0xDF, 0xAD, 0x86, 0x47, 0xDF, 0x44, 0x0D,
+    0x42, 0x1D, 0xD1, 0x39, 0x29, 0x98, 0x1D, 0x7F,
+    0xE0, 0x27, 0xD2, 0x6E, 0x81, 0x8D, 0x66, 0x2B,
+    0x69, 0xBF, 0x35, 0xEC, 0xE2, 0x0A, 0x32, 0xF3,
+    0x68, 0xD7, 0x93, 0xF2, 0x43, 0x48, 0x7F, 0x53,
+    0x5C, 0x04, 0x8D, 0x7C, 0x94, 0x0B, 0x1B, 0xF5,
+    0x8A, 0x5B, 0xCF, 0xB3, 0x55, 0x60, 0x96, 0x95,
+    0x05, 0xD6, 0xC8, 0x59, 0xB8, 0xFC, 0xD2, 0xC4,
+    0x25, 0xA7, 0x7E, 0xC5, 0x27, 0x27, 0x0F, 0x1A,
+    0xF1, 0x0A, 0xE5, 0x54, 0x11, 0x3E, 0xDD, 0x8E,
+    0xB9, 0x93, 0xA0, 0x51, 0x37, 0x49, 0x12, 0x1B,
+    0x50, 0x8E, 0x58, 0x04, 0x78, 0x28, 0x0F, 0x21,
+    0x0D, 0x7F, 0x52, 0x0E, 0x20, 0x64, 0x5F, 0x23,
+    0x43, 0x25, 0x62, 0x17, 0xC0, 0xA8, 0xC9, 0x20,
+    0x36, 0x5C, 0x39, 0x38, 0x9F, 0x2B, 0xDB, 0xB7,
+    0x6D, 0x1D, 0xC7, 0x5B, 0x20, 0xDA, 0x77, 0x8D,
+    0xD6, 0x13, 0xDB, 0x49, 0x97, 0xC3, 0x21, 0x89,
+    0xFF, 0x7C, 0xFF, 0x7E, 0xAB, 0xF8, 0x30, 0x2E,
+    0x44, 0xB5, 0xC3, 0x00, 0xA0, 0x32, 0xC8, 0xCB,
+    0x14, 0x5D, 0xFC, 0x07, 0xF8, 0x9A, 0x73, 0x78,
+    0x35, 0x75, 0x3C, 0x08, 0xC0, 0xF6, 0xB7, 0x3A,
+    0xB8, 0x2D, 0xF5, 0x5B, 0x39, 0x51, 0x45, 0x02,
+    0xCC, 0xBC, 0xC7, 0x57, 0x19, 0x7D, 0xB8, 0x56,
+    0xC4, 0x2F, 0x19, 0x58, 0xF0, 0xB3, 0x38, 0x9B,
+    0x04, 0xD7, 0x0C, 0xE8, 0x78, 0xC8, 0x4D, 0xBD,
+    0xDB, 0x7E, 0x74, 0xA7, 0x0D, 0xA5, 0x08, 0xFC,
+    0x20, 0x11, 0x12, 0x65, 0x5B, 0x6A, 0xA2, 0x41,
+    0x35, 0x77, 0x0A, 0xDA, 0x95, 0x18, 0x1E, 0x88,
+    0xFF, 0x08, 0xBC, 0xF7, 0x31, 0x91, 0x2E, 0x93,
+    0x5B, 0x5E, 0x5B, 0x97, 0xA3, 0xC4, 0xC6, 0xEB,
+    0xF7, 0xD3, 0xB5, 0x04, 0xC7, 0xE5, 0x54, 0x3A,
+    0x9E, 0x53, 0xBE, 0x19, 0x6D, 0x25, 0x1E, 0x22,
+    0x78, 0x55, 0xC3, 0x7E, 0x83, 0xA4, 0x5B, 0x43,
+    0x26, 0x42, 0x61, 0xD9, 0x4B, 0xE5, 0x3A, 0x5A,
+    0xBD, 0x5C, 0x6A, 0xD0, 0x04, 0x83, 0x10, 0x46,
+    0xC0, 0x7F, 0x25, 0xB4, 0x67, 0xA6, 0x60, 0xC5,
+    0x6D, 0x15, 0x0B, 0x9E, 0x61, 0xBC, 0x31, 0x85,
+    0x63, 0x91, 0x6E, 0xE1, 0xCE, 0xCF, 0x06, 0x91,
+    0x8E, 0xA8, 0x5D, 0xEF, 0x96, 0xE8, 0x8B, 0x73,
+    0xDD, 0xE1, 0xEA, 0x20, 0x3F, 0x51, 0x7A, 0x89,
+    0xD8, 0xB4, 0x2C, 0xCA, 0xF8, 0xD3, 0x8B, 0x04,
+    0x37, 0x4F, 0x58, 0x91, 0x90, 0x5A, 0x7F, 0xFA,
+    0x2F, 0x1E, 0xB7, 0x88, 0x4F, 0xB0, 0xE4, 0x87,
+    0xEB, 0x24, 0x52, 0x03, 0x38, 0x9A, 0x7E, 0x9E,
+    0x84, 0xFD, 0xD9, 0x82, 0x24, 0x86, 0x99, 0x51,
+    0x6C, 0xFF, 0xF8, 0x3F, 0xD2, 0x88, 0xB0, 0x6C,
+    0x04, 0x86, 0xCA, 0xFB, 0x23, 0x62, 0x19, 0xC5,
+    0xE4, 0xE3, 0xCB, 0x3A, 0xA7, 0x3C, 0x3D, 0x8D,
+    0xBD, 0x1B, 0x52, 0xAB, 0x36, 0xAE, 0x34, 0x2B,
+    0x6C, 0x1C, 0xAD, 0x61, 0x1E, 0x6E, 0xB3, 0xDA,
+    0x02, 0xAC, 0x30, 0xAF, 0x20, 0xD2, 0x97, 0xFB,
+    0xE3, 0xF5, 0x1E, 0x3B, 0x44, 0x00, 0x55, 0x29,
+    0x8A, 0xB9, 0x13, 0x18, 0xD2, 0x4C, 0x9F, 0x4E,
+    0xA4, 0x9F, 0x38, 0xD1, 0x17, 0x0B, 0xCF, 0x96,
+    0x16, 0xE2, 0xAE, 0xD0, 0x3D, 0xCA, 0x63, 0x01,
+    0x83, 0x20, 0xE0, 0xAC, 0xF0, 0xFD, 0xD2, 0x50,
+    0x1D, 0x17, 0x98, 0x0F, 0xE1, 0xCA, 0x64, 0xDB,
+    0x75, 0xB1, 0xCD, 0xAD, 0x52, 0x74, 0xC2, 0xDC,
+    0x4D, 0xE5, 0x0E, 0x2C, 0x99, 0x69, 0xF3, 0x9D,
+    0x89, 0x05, 0xB0, 0xFD, 0x89, 0x41, 0xEA, 0x7D,
+    0x61, 0xAE, 0x7B, 0xB5, 0x16, 0x42, 0x2C, 0x76,
+    0x89, 0x3F, 0x96, 0x65, 0x7D, 0x8D, 0x47, 0xCA,
+    0x67, 0xAB, 0xA3, 0xE6, 0x17, 0xFE, 0x85, 0xF2,
+    0x15, 0xA9, 0x72, 0xFA, 0x93, 0xFD, 0x75, 0x41,
+    0xF8, 0xF0, 0x03, 0xE6, 0x63, 0x48, 0x18, 0x93,
+    0xFF, 0x08, 0x0A, 0xD5, 0x58, 0xD4, 0x57, 0x10,
+    0xB4, 0x8C, 0x9C, 0x12, 0x0A, 0x82, 0xEC, 0x29,
+    0x71, 0x0C, 0x6A, 0xAA, 0xBE, 0xAA, 0x47, 0x26,
+    0x74, 0xF9, 0x31, 0x91, 0x03, 0xD8, 0x5C, 0xDF,
+    0x20, 0xBA, 0xC9, 0x13, 0x5A, 0x85, 0x36, 0xAD,
+    0x22, 0x68, 0xEE, 0xDB, 0x6C, 0x48, 0x02, 0xA5,
+    0xE0, 0x08, 0xFF, 0xE4, 0x7C, 0x4C, 0x23, 0x9C,
+    0x6D, 0x73, 0x68, 0xB5, 0x72, 0xF8, 0x62, 0x14,
+    0x22, 0xA0, 0x91, 0x88, 0x97, 0x3E, 0x7A, 0x6F,
+    0x31, 0x96, 0x9C, 0x1C, 0x09, 0xA4, 0x11, 0x23,
+    0x1A, 0x3E, 0x75, 0xB2, 0x92, 0xA5, 0x5F, 0xF3,
+    0xEA, 0x3A, 0x73, 0x45, 0x5A, 0xEC, 0x25, 0xF2,
+    0x1B, 0x08, 0xA6, 0x1F, 0xA6, 0xEC, 0x71, 0x06,
+    0x6F, 0xD2, 0x37, 0x99, 0x39, 0x9B, 0xE8, 0xE0,
+    0xDC, 0x20, 0x22, 0x68, 0xA2, 0xDC, 0x75, 0x0F,
+    0xED, 0x0E, 0xF6, 0xC9, 0x64, 0x99, 0x33, 0x59,
+    0x6F, 0x60, 0xBA, 0x3B, 0xEC, 0x02, 0xA4, 0xA8,
+    0x9E, 0xAD, 0x1F, 0xC5, 0xE4, 0x30, 0x2C, 0x9C,
+    0xE1, 0xCE, 0x85, 0x14, 0xD3, 0x93, 0xAC, 0xE7,
+    0x54, 0x34, 0xFD, 0xA6, 0x58, 0xD5, 0xA5, 0xCE,
+    0x5E, 0xCB, 0x28, 0x21, 0xDF, 0xFB, 0xC5, 0x5D,
+    0x3A, 0xB2, 0x3C, 0x05, 0x82, 0xBF, 0x32, 0x4C,
+    0xAC, 0x80, 0x34, 0xC1, 0xB0, 0x66, 0x61, 0xDC,
+    0x38, 0x8C, 0x06, 0x5F, 0x1B, 0x41, 0x37, 0x31,
+    0x6A, 0x1C, 0x22, 0xCC, 0x8D, 0xE5, 0x36, 0x28,
+    0x72, 0xC8, 0x02, 0x88, 0xE4, 0x9F, 0x83, 0x59,
+    0xAD, 0x48, 0x9D, 0xD4, 0xA5, 0xE5, 0xFF, 0xB4,
+    0x59, 0xA1, 0xFC, 0xB4, 0xC7, 0x33, 0x67, 0x26,
+    0xE1, 0xC6, 0x7B, 0xD5, 0x04, 0xE9, 0xB6, 0x94,
+    0xD2, 0xD6, 0xD2, 0x41, 0x20, 0xA7, 0x75, 0x4A,
+    0x14, 0x76, 0xCD, 0xD0, 0x31, 0x08, 0xB4, 0xCA,
+    0x66, 0x22, 0x2D, 0x80, 0x99, 0x98, 0x71, 0x48,
+    0x1B, 0x2B, 0xE5, 0x9A, 0xE8, 0x84, 0x62, 0x80,
+    0xFA, 0x2D, 0x23, 0xE4, 0xEF, 0x3F, 0x7F, 0xC2,
+    0x78, 0xDB, 0x21, 0xDB, 0x2D, 0xCC, 0x95, 0xA0,
+    0x18, 0x8B, 0xCF, 0xEB, 0x3D, 0xDA, 0x2A, 0x57,
+    0xE5, 0x3E, 0xDE, 0x0E, 0xBF, 0xE0, 0x3C, 0x8C,
+    0x82, 0x98, 0xE8, 0x49, 0xAA, 0xAF, 0x94, 0x28,
+    0x80, 0x0C, 0x48, 0xD7, 0x15, 0x18, 0x73, 0x88,
+    0x19, 0xB8, 0x1E, 0x65, 0x71, 0xF9, 0x0F, 0x39,
+    0x4A, 0x85, 0x51, 0x5F, 0x46, 0x67, 0x6E, 0x07,
+    0x08, 0xB9, 0x00, 0x21, 0xA3, 0xE9, 0x1D, 0xA4,
+    0xE6, 0xF3, 0x68, 0x47, 0x25, 0x72, 0x84, 0x09,
+    0xA1, 0xE1, 0x9A, 0x9D, 0x23, 0x2B, 0x51, 0xA6,
+    0xD3, 0x8D, 0x9B, 0x3D, 0x77, 0x3E, 0xF4, 0x1F,
+    0x89, 0x6A, 0xB8, 0x00, 0x2B, 0xB7, 0xCF, 0x17,
+    0x1B, 0x54, 0x33, 0x31, 0xEF, 0x5F, 0xF8, 0xFB,
+    0xB2, 0xEB, 0x9B, 0xEC, 0xF5, 0xCE, 0xD4, 0x36,
+    0x02, 0xC8, 0x4A, 0xCD, 0x8A, 0x48, 0x99, 0xC4,
+    0x44, 0x42, 0xE3, 0x4E, 0xEB, 0x42, 0x98, 0x3A,
+    0xB8, 0x80, 0x87, 0x51, 0x61, 0x18, 0x2D, 0x2C,
+    0xE5, 0xAC, 0x25, 0xA8, 0x81, 0x7F, 0x1E, 0x25,
+    0xCF, 0x19, 0x6A, 0x2C, 0x78, 0x77, 0xE9, 0xAA,
+    0x24, 0xF7, 0x11, 0x8A, 0x39, 0x0A, 0x44, 0xC4,
+    0xE9, 0x3C, 0xA1, 0x97, 0x3A, 0xFF, 0xCC, 0x0A,
+    0x4C, 0x04, 0x03, 0x99, 0xB4, 0xB6, 0x19, 0x87,
+
+    0x26, 0x7E, 0x8A, 0xA4, 0xF4, 0xDE, 0x1E, 0xE4,
+    0x59, 0x53, 0x60, 0x43, 0x69, 0xB3, 0xD2, 0x8C,
+    0xAC, 0xAB, 0xE7, 0x33, 0x36, 0x11, 0x55, 0x68,
+    0xC5, 0x08, 0xC9, 0x5E, 0x34, 0x64, 0xF4, 0x71,
+    0x54, 0x6F, 0xF4, 0xF6, 0xD8, 0xCD, 0xFC, 0x4A,
+    0x0F, 0xB5, 0x8E, 0x2F, 0x91, 0x9E, 0xF9, 0xDA,
+    0x74, 0x85, 0x94, 0x9B, 0x89, 0x3B, 0xE4, 0xAC,
+    0x11, 0xCC, 0xD3, 0x42, 0xA1, 0xDC, 0xD5, 0x06,
+    0xDB, 0x05, 0xCD, 0xB8, 0x6E, 0xB3, 0x3C, 0x0A,
+    0x04, 0x07, 0x09, 0x48, 0x47, 0x4F, 0x66, 0x14,
+    0x65, 0x30, 0x22, 0x1C, 0x3F, 0xBB, 0x0C, 0xF0,
+    0xC7, 0xB2, 0x8B, 0x15, 0xFF, 0xE6, 0x56, 0x8E,
+    0x2F, 0x0A, 0xB8, 0xA7, 0xE5, 0x8C, 0xDC, 0x58,
+    0x6F, 0xF1, 0x13, 0xBB, 0x8A, 0xA8, 0x2A, 0x5E,
+    0x32, 0x9B, 0x32, 0xE4, 0xA0, 0x8F, 0x22, 0x18,
+    0x82, 0x60, 0xC5, 0xB9, 0x3F, 0x19, 0x27, 0x7C,
+    0x2E, 0x8A, 0xA9, 0x6C, 0x04, 0x7F, 0xA8, 0x0E,
+    0xC5, 0x99, 0xB0, 0x98, 0x2E, 0xE9, 0x29, 0xBE,
+    0x74, 0xA3, 0xAD, 0x4E, 0xF7, 0xDC, 0xC4, 0xEF,
+    0x98, 0x03, 0x59, 0xA6, 0x88, 0x85, 0x99, 0x99,
+    0x9E, 0x51, 0xED, 0x99, 0xBE, 0x78, 0x88, 0x83,
+    0xE7, 0x73, 0x90, 0x7E, 0xF6, 0x11, 0x67, 0xD7,
+    0x10, 0x45, 0x15, 0x61, 0x6D, 0x42, 0x31, 0x99,
+    0x4D, 0x3E, 0xC6, 0x6A, 0x4B, 0x1C, 0x3A, 0x27,
+    0xFF, 0x13, 0x36, 0x7F, 0xB5, 0xE0, 0xC0, 0xF2,
+    0xAC, 0x97, 0x14, 0xDE, 0x03, 0xD8, 0xB3, 0x7D,
+    0xDB, 0xA9, 0x18, 0x1C, 0x4B, 0x8A, 0xD9, 0x65,
+    0x7E, 0xBE, 0x11, 0x19, 0x1B, 0xC2, 0x74, 0xA5,
+    0x19, 0x62, 0xAD, 0x82, 0x5A, 0x3C, 0x40, 0xB1,
+    0x65, 0x15, 0x9E, 0x06, 0xC8, 0xC2, 0x93, 0x1D,
+    0xAC, 0xCC, 0x21, 0xCC, 0x7A, 0x2A, 0x2D, 0xF0,
+    0x22, 0xC2, 0xB8, 0xE9, 0x71, 0x6B, 0x66, 0x79,
+    0xA5, 0xAD, 0x57, 0x37, 0x11, 0x95, 0x1D, 0x65,
+    0xC3, 0x13, 0xAD, 0x83, 0x3E, 0x0A, 0x62, 0xE9,
+    0x87, 0x22, 0x0C, 0xD8, 0xE8, 0xE1, 0x42, 0x90,
+    0x75, 0x0F, 0x23, 0x1A, 0xEB, 0xF5, 0xF2, 0x4B,
+    0xFE, 0x4A, 0xE4, 0xB6, 0xAE, 0x40, 0x16, 0x7C,
+    0x04, 0xA6, 0x23, 0x1B, 0xC9, 0x1D, 0x75, 0x6D,
+    0x1F, 0x81, 0xCC, 0x21, 0xF9, 0x2C, 0x02, 0x55,
+    0xF4, 0xE8, 0xCD, 0x72, 0xCD, 0xF2, 0x9D, 0xAB,
+    0xE1, 0xF6, 0x7E, 0x99, 0xB9, 0x53, 0x06, 0xE3,
+    0xC7, 0x14, 0xF9, 0xCB, 0x16, 0x8E, 0xEE, 0x68,
+    0x2E, 0xF7, 0x82, 0x71, 0xBD, 0x1E, 0x70, 0x73,
+    0x2C, 0x52, 0xA5, 0xAE, 0x23, 0xD2, 0x9E, 0x67,
+    0x4F, 0x7D, 0xD4, 0xC5, 0x05, 0xDE, 0x98, 0xBE,
+    0x71, 0xE6, 0xA4, 0x9F, 0x2B, 0xF8, 0xE7, 0xF5,
+    0xF0, 0xC6, 0xCF, 0xE7, 0xF4, 0x9F, 0x90, 0x93,
+    0x5F, 0x25, 0xBE, 0x54, 0x73, 0xE3, 0x21, 0x9B,
+    0x2A, 0x25, 0x95, 0x9F, 0xF5, 0x8A, 0x39, 0xAB,
+    0x00, 0xD7, 0x14, 0x0A, 0x1E, 0x27, 0x7B, 0x95,
+    0xD9, 0x85, 0x62, 0x4C, 0xE0, 0x22, 0xF6, 0xA0,
+    0xD7, 0xC9, 0x30, 0x75, 0xA5, 0x02, 0x04, 0x33,
+    0x28, 0xC8, 0x31, 0x35, 0x9B, 0xD1, 0xEC, 0x64,
+    0xD4, 0x80, 0x1E, 0xCF, 0xA0, 0xE6, 0x10, 0x49,
+    0x87, 0x98, 0x57, 0x89, 0xC4, 0x5F, 0x54, 0x59,
+    0xB3, 0x16, 0x13, 0x92, 0xB7, 0x9F, 0x82, 0xEC,
+    0x3C, 0xB1, 0xB3, 0x8C, 0x13, 0xBB, 0x8B, 0x1D,
+    0xBA, 0x7F, 0x1B, 0xFE, 0x0A, 0xC9, 0x48, 0xC8,
+    0x9E, 0xC2, 0xE0, 0x60, 0x1B, 0x83, 0x8C, 0xC6,
+    0xCA, 0x8B, 0xA4, 0x6A, 0xEA, 0x35, 0x34, 0xC2,
+    0xCF, 0x60, 0x58, 0x95, 0x1C, 0x2C, 0xB2, 0x73,
+    0x95, 0x2E, 0x9A, 0x8A, 0x94, 0x42, 0x88, 0x89,
+    0xD3, 0x7C, 0x0D, 0x65, 0x7D, 0x30, 0x54, 0x37,
+    0x33, 0xB1, 0x40, 0x72, 0xD9, 0x00, 0xFE, 0xFC,
+    0x57, 0xF8, 0xE4, 0x15, 0x36, 0xBA, 0x58, 0x77,
+    0x6B, 0x20, 0xA9, 0x26, 0xF7, 0xA3, 0xBF, 0x53,
+    0x85, 0x33, 0xD5, 0xF3, 0xA2, 0x9A, 0xCE, 0xB6,
+    0x05, 0x8F, 0x2F, 0xE3, 0xBA, 0xC2, 0x33, 0x86,
+    0x81, 0xC0, 0x84, 0x9B, 0xB3, 0xC6, 0xB3, 0xBF,
+    0x0A, 0x49, 0x04, 0x3E, 0x5F, 0x77, 0xD4, 0x45,
+    0xB8, 0xEA, 0xF2, 0xA3, 0x23, 0x7D, 0x33, 0x56,
+    0x2C, 0xCD, 0x7A, 0xBD, 0xE1, 0xC0, 0xAA, 0xA5,
+    0xB9, 0x36, 0x0D, 0x5C, 0xC8, 0xF1, 0xC7, 0xE6,
+    0xBF, 0x34, 0xB0, 0x46, 0x47, 0xC7, 0xE2, 0x69,
+    0x1E, 0xD8, 0x0A, 0xBB, 0x57, 0x7B, 0x01, 0xF3,
+    0xED, 0x1F, 0x39, 0xFD, 0x27, 0xB0, 0xD0, 0x9E,
+    0x43, 0x06, 0x93, 0x6D, 0x14, 0x39, 0xA9, 0x51,
+    0x26, 0x8B, 0x8A, 0xBB, 0x59, 0xE0, 0xF5, 0xE7,
+    0x41, 0x7C, 0xBA, 0xB7, 0xCF, 0x4C, 0x61, 0xF5,
+    0xAA, 0x4B, 0x8F, 0x07, 0x5C, 0xA9, 0x3E, 0x4F,
+    0xA6, 0xC4, 0x05, 0x6C, 0x48, 0x26, 0x4E, 0xD7,
+    0x71, 0x92, 0xD5, 0x92, 0x40, 0xE1, 0xE7, 0x3D,
+    0x65, 0x98, 0x62, 0x79, 0x57, 0xC3, 0x14, 0x8A,
+    0x05, 0x87, 0x7A, 0xED, 0x44, 0x09, 0x7C, 0x4F,
+    0xC3, 0xE4, 0xCF, 0x36, 0xC1, 0x56, 0x5D, 0x82,
+    0xED, 0x75, 0x7A, 0x18, 0x4B, 0xEC, 0x8C, 0x55,
+    0x50, 0x90, 0x20, 0xCC, 0x16, 0x6D, 0xA4, 0x44,
+    0x26, 0x99, 0x41, 0x39, 0x1F, 0x11, 0x27, 0x8F,
+    0xD5, 0x4F, 0xE7, 0x1A, 0xA6, 0x3B, 0x5E, 0xED,
+    0xF3, 0x1C, 0x2C, 0x54, 0x16, 0x19, 0x46, 0x06,
+    0x32, 0x50, 0xDE, 0x40, 0x0A, 0x7B, 0x78, 0x77,
+    0x02, 0x9A, 0xEF, 0x54, 0x1D, 0x41, 0x23, 0x8A,
+    0xE0, 0x1E, 0xE8, 0x9B, 0x77, 0x1E, 0xFE, 0xD2,
+    0x9E, 0x4D, 0xCA, 0x47, 0xA1, 0x34, 0xF1, 0x44,
+    0x05, 0x2F, 0x88, 0x18, 0x9C, 0xBB, 0x94, 0x0E,
+    0x51, 0xB2, 0xF2, 0x8E, 0x8B, 0xDE, 0xD9, 0xD8,
+    0xD7, 0xA2, 0x7C, 0xC2, 0x72, 0xC7, 0xC3, 0xF0,
+    0xF7, 0xB4, 0x5C, 0x6A, 0x36, 0xA8, 0xF3, 0xD7,
+    0xE3, 0x43, 0x3D, 0x43, 0x2C, 0x0C, 0x41, 0x71,
+    0x33, 0x7F, 0x09, 0xB7, 0x1A, 0x03, 0x29, 0xE6,
+    0x39, 0xED, 0xF5, 0x98, 0x5A, 0x5B, 0x80, 0x80,
+    0x49, 0x40, 0x86, 0xDA, 0x8B, 0x2E, 0x31, 0x85,
+    0x1B, 0x8B, 0xE7, 0xE1, 0x55, 0x85, 0x6C, 0x89,
+    0x92, 0xDC, 0xD0, 0xC2, 0x51, 0x3A, 0x97, 0xFB,
+    0x9D, 0x6C, 0x63, 0xE7, 0xF7, 0x53, 0xDE, 0xC8,
+    0x5B, 0x0C, 0x6A, 0x97, 0xB2, 0xEE, 0xDB, 0xF5,
+    0xE1, 0xE0, 0x9A, 0x3E, 0x36, 0x87, 0xC3, 0x2E,
+    0x22, 0xB9, 0x1B, 0x6D, 0x1D, 0xEB, 0xB6, 0xCA,
+    0xFA, 0x11, 0x0D, 0x07, 0xF1, 0x00, 0xC3, 0xFC,
+    0x19, 0xDB, 0x76, 0xBC, 0x65, 0x75, 0x4B, 0x55,
+    0xD9, 0x47, 0x92, 0x57, 0x1B, 0xB3, 0x0D, 0xBE,
+    0xAE, 0x4C, 0xA1, 0x76, 0xE2, 0x66, 0x2D, 0x12,
+    0x9C, 0x00, 0xA5, 0x9A, 0x91, 0x2C, 0x93, 0x49,
+    0xBC, 0x3D, 0x43, 0x1E, 0x0A, 0x4E, 0x69, 0x9E,
+    0xCA, 0x94, 0x5E, 0xE6, 0xAF, 0xFD, 0xA4, 0x39,
+    0x7F, 0xCA, 0x1B, 0x35, 0x18, 0x29, 0xCE, 0x06,
+    0xA8, 0x4B, 0x7E, 0x44, 0x8E, 0x00, 0x22, 0xA2,
+    0x4E, 0xC4, 0xC4, 0x9F, 0x52, 0xF9, 0x36, 0x51,
+    0x65, 0x31, 0x7D, 0xF7, 0xFB, 0x85, 0x77, 0x7B,
+    0xF1, 0xB5, 0x85, 0xCA, 0x26, 0xF3, 0x20, 0x08,
+    0x7D, 0xEF, 0xDD, 0x28, 0x1F, 0x9B, 0xC0, 0x87,
+    0x84, 0xB7, 0xAA, 0x4D, 0xA5, 0xA6, 0x14, 0x40,
+    0x0A, 0x15, 0xD8, 0x1E, 0xA9, 0xDC, 0x26, 0x11,
+    0x69, 0xA8, 0x22, 0x94, 0xCF, 0x82, 0x34, 0xE2,
+    0x3C, 0xBD, 0x88, 0x24, 0x37, 0xCD, 0x14, 0x72,
+    0x84, 0x68, 0xBC, 0x14, 0x95, 0x5A, 0x13, 0x32,
+    0x2B, 0xCA, 0x78, 0xBC, 0x65, 0xC3, 0xA0, 0x65,
+    0x7B, 0x8C, 0x8C, 0x6D, 0x5E, 0x34, 0x8E, 0x41,
+
+    0x06, 0xDD, 0xDD, 0x43, 0xF0, 0xAF, 0x75, 0x89,
+    0xD9, 0xB9, 0x2A, 0x65, 0xB2, 0x0A, 0x08, 0x25,
+    0x9A, 0x26, 0x48, 0x1B, 0x3F, 0x43, 0x90, 0x60,
+    0x3E, 0x32, 0x9B, 0x5D, 0xAE, 0xFB, 0x84, 0xC6,
+    0xDE, 0x9F, 0x6F, 0x47, 0xD3, 0x1C, 0xC1, 0x4A,
+    0x96, 0x03, 0x91, 0x3B, 0xD7, 0xCE, 0xCC, 0x72,
+    0xEA, 0x1B, 0xC1, 0x97, 0xA9, 0x74, 0x01, 0x24,
+    0x93, 0x4A, 0x82, 0xDA, 0xE2, 0x55, 0x2E, 0x05,
+    0x32, 0x60, 0x75, 0x33, 0x6E, 0xC6, 0xA1, 0x15,
+    0x84, 0x36, 0x4A, 0xF7, 0x4B, 0x99, 0xFE, 0x13,
+    0x19, 0xBE, 0x10, 0x01, 0xD4, 0x07, 0x3F, 0xFE,
+    0x7A, 0x1A, 0x08, 0x41, 0xE1, 0xA7, 0x72, 0x3A,
+    0x83, 0x88, 0xA0, 0x61, 0x3D, 0x08, 0x38, 0x1E,
+    0xFB, 0x9F, 0x9E, 0xBF, 0x5B, 0xD1, 0xF6, 0x9C,
+    0xE4, 0xD1, 0xAD, 0x16, 0x5F, 0x24, 0xD0, 0xB3,
+    0xD9, 0x7B, 0x35, 0xD9, 0x02, 0x54, 0x60, 0x45,
+    0x93, 0x58, 0x81, 0x6F, 0x5C, 0xC9, 0xA1, 0x5B,
+    0x54, 0xEA, 0x37, 0x09, 0x8E, 0x44, 0x58, 0x72,
+    0x81, 0x7A, 0x58, 0x56, 0x6C, 0x58, 0x8B, 0x03,
+    0x88, 0xE9, 0x4F, 0xCC, 0x00, 0x63, 0xBE, 0xBD,
+    0x97, 0x07, 0x68, 0xAC, 0x23, 0x24, 0xE9, 0x08,
+    0xDA, 0xE8, 0x59, 0x8F, 0xC3, 0xFB, 0xD9, 0x48,
+    0x94, 0xE3, 0x62, 0x56, 0x9D, 0x5B, 0x6D, 0x9F,
+    0x47, 0x4A, 0xAB, 0xFC, 0x54, 0x06, 0xC4, 0xA5,
+    0x97, 0xA7, 0x3C, 0xAA, 0x3D, 0x9D, 0x06, 0x57,
+    0x97, 0x35, 0x85, 0xC4, 0x95, 0x9C, 0x70, 0xCD,
+    0xF5, 0x5F, 0xB2, 0x7E, 0xA7, 0x7B, 0xE5, 0x67,
+    0xCE, 0x3D, 0x87, 0x9F, 0xAF, 0x48, 0x88, 0x07,
+    0x8E, 0x04, 0x63, 0xC2, 0xE5, 0xDC, 0x1D, 0x45,
+    0xD1, 0xC1, 0xC2, 0x7E, 0xFE, 0x66, 0x7C, 0x9C,
+    0x3F, 0x26, 0xA3, 0xC2, 0x7F, 0x88, 0xDE, 0x35,
+    0x8F, 0xA1, 0x56, 0xA0, 0xF6, 0xCD, 0x0D, 0xAF,
+    0x89, 0x16, 0xA0, 0xFB, 0xB6, 0xE0, 0x62, 0x77,
+    0x4E, 0x4C, 0xB1, 0xC6, 0x9D, 0xD3, 0x5D, 0xA1,
+    0xE7, 0x5B, 0xDB, 0x1A, 0x49, 0x74, 0x06, 0xAA,
+    0x94, 0xBF, 0x6E, 0x17, 0xD7, 0x49, 0x20, 0x78,
+    0x2C, 0x4C, 0xC4, 0x85, 0xFB, 0x53, 0xF5, 0x3C,
+    0xC2, 0x9E, 0x20, 0x93, 0xC6, 0x1F, 0x25, 0xE8,
+    0x0C, 0x73, 0x15, 0x3F, 0x56, 0xAF, 0xFC, 0x88,
+    0xDB, 0x2D, 0x59, 0x7A, 0x27, 0xEE, 0x78, 0x69,
+    0x5B, 0x11, 0xBC, 0xFC, 0x52, 0x2C, 0x3B, 0xC9,
+    0xDD, 0x09, 0x51, 0x58, 0x33, 0xD5, 0x6F, 0xCE,
+    0x44, 0x12, 0xAF, 0x80, 0xF1, 0xAC, 0xB6, 0xC2,
+    0xC6, 0x4D, 0x82, 0xE1, 0x8F, 0xC7, 0x28, 0x26,
+    0xAA, 0xDB, 0x2C, 0xEB, 0xAE, 0xA6, 0x9A, 0x56,
+    0x96, 0x78, 0xB6, 0x88, 0x41, 0xB9, 0x5A, 0x7B,
+    0x4D, 0x76, 0x5C, 0x7F, 0xD9, 0xBE, 0x85, 0xBF,
+    0xB8, 0xBB, 0xA0, 0xB5, 0x7E, 0x5B, 0x15, 0x89,
+    0x23, 0xA9, 0x79, 0xA8, 0xF5, 0x50, 0x75, 0x82,
+    0xEF, 0xA6, 0x19, 0xFC, 0x5D, 0x30, 0x6D, 0x3B,
+    0x06, 0x34, 0xF1, 0x2A, 0xBA, 0xD2, 0xE5, 0x7F,
+    0xBE, 0xCB, 0xA9, 0x3B, 0x68, 0xC0, 0x2B, 0xD3,
+    0xF9, 0x91, 0x96, 0x05, 0x86, 0xEE, 0xEF, 0xBC,
+    0x19, 0x60, 0x7A, 0x72, 0xF0, 0xA8, 0x93, 0x38,
+    0x69, 0x41, 0x92, 0xFD, 0xD5, 0x22, 0x8B, 0x01,
+    0x30, 0x56, 0xFF, 0xED, 0xC5, 0x9A, 0x97, 0xED,
+    0x76, 0x9F, 0x78, 0x12, 0x7E, 0xD9, 0x82, 0x50,
+    0x33, 0x09, 0x1E, 0x52, 0x75, 0xB0, 0xE6, 0x82,
+    0x55, 0xAF, 0x17, 0x16, 0x74, 0x5D, 0xC7, 0x7E,
+    0xFD, 0xA0, 0xF6, 0x6E, 0x51, 0x4B, 0x45, 0xA4,
+    0x2D, 0x6C, 0x07, 0xF0, 0x0C, 0x79, 0x6F, 0x47,
+    0xEB, 0x18, 0xB7, 0xE2, 0xD3, 0x88, 0x2B, 0x52,
+    0x1B, 0x0F, 0x75, 0x24, 0x1F, 0x4B, 0x1C, 0xBC,
+    0x26, 0x79, 0x69, 0xD0, 0x33, 0x27, 0x19, 0xD5,
+    0x39, 0xF2, 0x96, 0x92, 0xE8, 0xB4, 0xB3, 0x5F,
+    0xAE, 0x50, 0x8A, 0x71, 0x70, 0x90, 0xEB, 0x7D,
+    0x12, 0xF6, 0x0F, 0xF6, 0x7A, 0x2D, 0xEF, 0x9D,
+    0xD3, 0x32, 0x2E, 0x13, 0xE1, 0x3C, 0xBB, 0xCF,
+    0x88, 0x2C, 0x57, 0xEB, 0x05, 0x27, 0x84, 0xE4,
+    0xA1, 0xF6, 0xA6, 0x62, 0xB0, 0x62, 0xC7, 0x1E,
+    0xC1, 0x87, 0x51, 0xBF, 0xA8, 0x66, 0xFD, 0x07,
+    0x6D, 0xF3, 0x6C, 0x53, 0x4E, 0x82, 0x10, 0xFC,
+    0x4E, 0x6A, 0x77, 0x0A, 0xAC, 0xE7, 0x0B, 0xC2,
+    0xF8, 0x79, 0xA8, 0x78, 0x48, 0xC7, 0x06, 0x12,
+    0x90, 0xB1, 0xBA, 0x78, 0x7D, 0x3A, 0x63, 0x66,
+    0xE9, 0x93, 0x33, 0x07, 0xBD, 0x82, 0x77, 0x7F,
+    0x68, 0xFC, 0xB5, 0xA2, 0x2D, 0xF1, 0x45, 0x60,
+    0x64, 0xB2, 0x3C, 0xFA, 0x94, 0xD0, 0x16, 0x36,
+    0xD7, 0x37, 0x4C, 0x22, 0xAD, 0x4B, 0xFF, 0x13,
+    0x55, 0xE4, 0x2A, 0xBD, 0xBF, 0x4E, 0xAD, 0x38,
+    0xB5, 0xF4, 0x17, 0x7C, 0x84, 0xC3, 0xFC, 0x8C,
+    0xD9, 0x37, 0xCC, 0xD5, 0x9D, 0x44, 0xBE, 0xF0,
+    0xFC, 0x1D, 0x10, 0x50, 0xC0, 0x5B, 0x97, 0x94,
+    0xA9, 0x3F, 0x28, 0x0D, 0xE4, 0x09, 0x5F, 0x8B,
+    0xC1, 0x00, 0xF4, 0x55, 0x93, 0x68, 0xAA, 0x91,
+    0x3F, 0x8E, 0xDD, 0xB1, 0xA2, 0x14, 0xE5, 0x35,
+    0xE4, 0x24, 0x81, 0xDC, 0xEC, 0x15, 0x33, 0x90,
+    0xDC, 0xAE, 0x82, 0xF7, 0x32, 0x74, 0x2E, 0x1F,
+    0xD0, 0x09, 0x4E, 0xE6, 0x2A, 0x95, 0xFE, 0xD2,
+    0x75, 0x2B, 0x4A, 0x17, 0xD3, 0x0A, 0x4C, 0x7F,
+    0xD1, 0x9A, 0x6D, 0x49, 0xC6, 0x38, 0xF2, 0x4F,
+    0x89, 0x36, 0xC7, 0x10, 0x5F, 0x87, 0x11, 0xCE,
+    0xC3, 0xEA, 0xB2, 0x45, 0xF8, 0xE6, 0x5C, 0x70,
+    0x90, 0x98, 0x2A, 0xFE, 0x9D, 0x6A, 0x38, 0x2A,
+    0xB1, 0x18, 0x86, 0x8B, 0xCE, 0xA4, 0xCA, 0xC9,
+    0xCF, 0x10, 0x27, 0xC0, 0xC5, 0x8B, 0xDC, 0xA1,
+    0x9B, 0xF2, 0xFC, 0xD7, 0x3A, 0x64, 0x25, 0x56,
+    0xF2, 0x02, 0x80, 0x3A, 0x17, 0x06, 0xA8, 0x93,
+    0xE5, 0xD7, 0x2F, 0xB2, 0x1C, 0xC7, 0x45, 0x43,
+    0xBC, 0xC3, 0x01, 0x9A, 0x4F, 0x73, 0x62, 0xF4,
+    0x51, 0x6F, 0xFA, 0x58, 0xBD, 0x44, 0x14, 0x06,
+    0x83, 0xE6, 0xDB, 0xEF, 0x10, 0x14, 0x11, 0xCA,
+    0x81, 0xF2, 0x96, 0x1C, 0x18, 0xD6, 0x04, 0x24,
+    0x79, 0x2E, 0x25, 0x8A, 0xC8, 0x97, 0x76, 0x47,
+    0xE9, 0xCA, 0xEC, 0xC6, 0x39, 0x53, 0xA3, 0x2D,
+    0x80, 0x24, 0xF7, 0xA2, 0x71, 0x54, 0x2C, 0xF4,
+    0x02, 0x05, 0x6E, 0x2A, 0x01, 0x40, 0x32, 0xC5,
+    0x64, 0xB7, 0xB2, 0xCD, 0xE3, 0x63, 0x15, 0x70,
+    0x0A, 0x35, 0x89, 0xF1, 0x81, 0x34, 0x16, 0x15,
+    0x32, 0x37, 0x8B, 0x0D, 0xCE, 0x23, 0x7B, 0x93,
+    0x41, 0x86, 0x31, 0xC7, 0x61, 0x85, 0x7D, 0xC5,
+    0x3E, 0xC5, 0xF8, 0xAB, 0x1B, 0x30, 0xCC, 0x60,
+    0x84, 0xEB, 0xA9, 0x60, 0xC6, 0x97, 0xB0, 0xF5,
+    0x8A, 0x16, 0x9F, 0x44, 0x7A, 0x55, 0x2B, 0xB3,
+    0x89, 0x96, 0xCF, 0xB2, 0x56, 0x6E, 0x03, 0x49,
+    0x03, 0xFD, 0x97, 0xB2, 0x91, 0x43, 0xAD, 0xE6,
+    0x14, 0x6A, 0x5E, 0x17, 0x64, 0xF0, 0x64, 0x62,
+    0xE7, 0xBC, 0xCE, 0x44, 0xB9, 0x34, 0x90, 0x8F,
+    0xC3, 0xB8, 0x63, 0x3C, 0x7B, 0xC8, 0x97, 0x01,
+    0x25, 0xB9, 0x67, 0x7F, 0xAC, 0x3E, 0x93, 0xDF,
+    0x8A, 0x24, 0xF6, 0x3E, 0x7C, 0xB5, 0x90, 0xA8,
+    0xEB, 0xD9, 0x2E, 0x65, 0x95, 0xA9, 0x6B, 0x2A,
+    0x45, 0x20, 0x23, 0xA9, 0xA6, 0xFD, 0xC9, 0x74,
+    0xE4, 0xDF, 0xC1, 0x8F, 0x6E, 0x26, 0x4C, 0xAC,
+    0x87, 0x77, 0xE2, 0x70, 0x54, 0x79, 0x73, 0xFA,
+    0x09, 0x0E, 0x0D, 0x30, 0x8A, 0x88, 0x79, 0xC3,
+    0xFA, 0x96, 0x0F, 0xCE, 0x05, 0x4E, 0x12, 0x15,
+    0xBB, 0x66, 0x94, 0xC0, 0x53, 0xC9, 0x6A, 0x35,
+};
+
+static const mbedtls_dhm_ffdhe_group ffdhe_groups[] = {
+    { 2048, ffdhe2048_P, ffdhe2048_T },
+    { 3072, ffdhe3072_P, ffdhe3072_T },
+    { 4096, ffdhe4096_P, ffdhe4096_T },
+    { 6144, ffdhe6144_P, ffdhe6144_T },
+    { 8192, ffdhe8192_P, ffdhe8192_T },
+};
+
+/*
+ * Compare the limbs of P with a big-endian prime of the same bit size.
+ * The values are public, so this does not need to be constant-time.
+ */
+static int ffdhe_prime_equals(const mbedtls_mpi *P,
+                              const unsigned char *prime, size_t bytes)
+{
+    size_t i;
+
+    for (i = 0; i < bytes; i++) {
+        unsigned char b = (unsigned char) (P->p[i / ciL] >> ((i % ciL) << 3));
+        if (b != prime[bytes - 1 - i]) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+const mbedtls_dhm_ffdhe_group *mbedtls_dhm_ffdhe_find(const mbedtls_mpi *P,
+                                                      const mbedtls_mpi *G)
+{
+    size_t bits, i;
+
+    if (mbedtls_mpi_cmp_int(G, 2) != 0 || mbedtls_mpi_cmp_int(P, 0) <= 0) {
+        return NULL;
+    }
+
+    bits = mbedtls_mpi_bitlen(P);
+    for (i = 0; i < sizeof(ffdhe_groups) / sizeof(ffdhe_groups[0]); i++) {
+        if (ffdhe_groups[i].bits == bits &&
+            ffdhe_prime_equals(P, ffdhe_groups[i].P, bits / 8)) {
+            return &ffdhe_groups[i];
+        }
+    }
+
+    return NULL;
+}
+
+int mbedtls_dhm_ffdhe_exp_g(mbedtls_mpi *X, const mbedtls_mpi *E,
+                            const mbedtls_dhm_ffdhe_group *grp)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const size_t bytes = grp->bits / 8;
+    const size_t limbs = grp->bits / biL;
+    const size_t d = (grp->bits + DHM_FFDHE_COMB_TEETH - 1) /
+                     DHM_FFDHE_COMB_TEETH;
+    const size_t count = (size_t) 1 << DHM_FFDHE_COMB_TEETH;
+    const size_t pool_limbs = (count + 3) * limbs +
+                              mbedtls_mpi_core_montmul_working_limbs(limbs);
+    mbedtls_mpi_uint *pool, *N, *W, *acc, *sel, *T;
+    mbedtls_mpi_uint mm;
+    size_t i, j, index, low;
+
+    if (mbedtls_mpi_cmp_int(E, 0) < 0 || mbedtls_mpi_bitlen(E) > grp->bits) {
+        return MBEDTLS_ERR_MPI_BAD_INPUT_DATA;
+    }
+
+    pool = mbedtls_calloc(pool_limbs, ciL);
+    if (pool == NULL) {
+        return MBEDTLS_ERR_MPI_ALLOC_FAILED;
+    }
+    N = pool;
+    W = N + limbs;
+    acc = W + count * limbs;
+    sel = acc + limbs;
+    T = sel + limbs;
+
+    MBEDTLS_MPI_CHK(mbedtls_mpi_core_read_be(N, limbs, grp->P, bytes));
+    mm = mbedtls_mpi_core_montmul_init(N);
+
+    /*
+     * W[0] = R mod P = 2^bits - P is 1 in the Montgomery representation,
+     * W[2^i] comes from the group's table and W[v] is the product of the
+     * W[2^i] for all bits i set in v.
+     */
+    (void) mbedtls_mpi_core_sub(W, W, N, limbs);
+    for (i = 0; i < DHM_FFDHE_COMB_TEETH; i++) {
+        MBEDTLS_MPI_CHK(mbedtls_mpi_core_read_be(W + (limbs << i), limbs,
+                                                 grp->T + i * bytes, bytes));
+    }
+    for (index = 3; index < count; index++) {
+        low = index & (~index + 1);
+        if (low != index) {
+            mbedtls_mpi_core_montmul(W + index * limbs,
+                                     W + (index - low) * limbs,
+                                     W + low * limbs, limbs,
+                                     N, limbs, mm, T);
+        }
+    }
+
+    /*
+     * Column j of the comb is made of the bits j, j + d, j + 2d, ... of E.
+     * Every column costs one squaring and one multiplication by a table
+     * entry, which is picked without leaking the secret column value.
+     */
+    memcpy(acc, W, limbs * ciL);
+    for (j = d; j-- > 0;) {
+        mbedtls_mpi_core_montmul(acc, acc, acc, limbs, N, limbs, mm, T);
+
+        index = 0;
+        for (i = 0; i < DHM_FFDHE_COMB_TEETH; i++) {
+            index |= (size_t) mbedtls_mpi_get_bit(E, j + i * d) << i;
+        }
+        mbedtls_mpi_core_ct_uint_table_lookup(sel, W, limbs, count, index);
+        mbedtls_mpi_core_montmul(acc, acc, sel, limbs, N, limbs, mm, T);
+    }
+    mbedtls_mpi_core_from_mont_rep(acc, acc, N, limbs, mm, T);
+
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(X, limbs));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_lset(X, 0));
+    memcpy(X->p, acc, limbs * ciL);
+
+cleanup:
+    mbedtls_zeroize_and_free(pool, pool_limbs * ciL);
+
+    return ret;
+}
+
+#endif /* MBEDTLS_BIGNUM_C && MBEDTLS_DHM_FIXED_BASE_OPTIM == 1 */
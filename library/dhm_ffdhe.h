@@ -0,0 +1,64 @@
+/**
+ * \file dhm_ffdhe.h
+ *
+ * \brief Fixed-base exponentiation in the RFC 7919 finite field groups.
+ *
+ * All RFC 7919 groups use the generator 2, so the ephemeral public key
+ * 2^x mod p can be computed with the fixed-base comb method (HAC 14.117),
+ * using tables that depend only on the group. This needs roughly a third of
+ * the modular multiplications of a generic modular exponentiation.
+ *
+ * This module is used by the DHM module and by the PSA FFDH driver when
+ * #MBEDTLS_DHM_FIXED_BASE_OPTIM is enabled.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#ifndef MBEDTLS_DHM_FFDHE_H
+#define MBEDTLS_DHM_FFDHE_H
+
+#include "common.h"
+
+#include "mbedtls/bignum.h"
+#include "mbedtls/dhm.h"
+
+/** A group with a precomputed comb table. The content is opaque. */
+typedef struct mbedtls_dhm_ffdhe_group mbedtls_dhm_ffdhe_group;
+
+/**
+ * \brief          Look up the precomputed table for a group.
+ *
+ * \param P        The prime modulus of the group.
+ * \param G        The generator of the group.
+ *
+ * \return         The table for computing powers of \p G modulo \p P if
+ *                 (\p P, \p G) is one of the RFC 7919 groups.
+ * \return         \c NULL otherwise.
+ */
+const mbedtls_dhm_ffdhe_group *mbedtls_dhm_ffdhe_find(const mbedtls_mpi *P,
+                                                      const mbedtls_mpi *G);
+
+/**
+ * \brief          Compute X = G^E mod P for a group found by
+ *                 mbedtls_dhm_ffdhe_find().
+ *
+ *                 This function is constant-flow with respect to the value
+ *                 of \p E. It only depends on the size of the group.
+ *
+ * \param X        The destination MPI. It may alias \p E.
+ * \param E        The exponent. It must be non-negative and must not have
+ *                 more bits than the prime of the group.
+ * \param grp      The group, as returned by mbedtls_dhm_ffdhe_find().
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_MPI_BAD_INPUT_DATA if \p E is negative or
+ *                 too large.
+ * \return         #MBEDTLS_ERR_MPI_ALLOC_FAILED on memory allocation
+ *                 failure.
+ */
+int mbedtls_dhm_ffdhe_exp_g(mbedtls_mpi *X, const mbedtls_mpi *E,
+                            const mbedtls_dhm_ffdhe_group *grp);
+
+#endif /* MBEDTLS_DHM_FFDHE_H */
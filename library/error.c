@@ -736,6 +736,8 @@ const char *mbedtls_low_level_strerr(int error_code)
             return( "NET - Polling the net context failed" );
         case -(MBEDTLS_ERR_NET_BAD_INPUT_DATA):
             return( "NET - Input invalid" );
+        case -(MBEDTLS_ERR_NET_KTLS_FAILED):
+            return( "NET - Enabling kernel TLS on the socket failed" );
 #endif /* MBEDTLS_NET_C */
 
 #if defined(MBEDTLS_OID_C)
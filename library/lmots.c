@@ -33,6 +33,19 @@
 
 #include "psa/crypto.h"
 
+/* PSA would use the built-in SHA-256 anyway, so the Winternitz chains can be
+ * hashed together with mbedtls_sha256_batch(), without a PSA operation for
+ * each step. This keeps all the chains on the stack (about 4 KiB), which
+ * only pays off where mbedtls_sha256_batch() has a multi-buffer
+ * implementation: the same conditions as for its AVX2 code in sha256.c. */
+#if defined(MBEDTLS_SHA256_C) && defined(MBEDTLS_PSA_BUILTIN_ALG_SHA_256) && \
+    defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64) && !defined(MBEDTLS_SHA256_ALT) && \
+    !defined(MBEDTLS_SHA256_PROCESS_ALT)
+#include "mbedtls/sha256.h"
+#define LMOTS_CHAIN_BATCH
+#endif
+
 /* Define a local translating function to save code size by not using too many
  * arguments in each translating place. */
 static int local_err_translation(psa_status_t status)
@@ -200,6 +213,16 @@ exit:
     return PSA_TO_MBEDTLS_ERR(status);
 }
 
+#if defined(LMOTS_CHAIN_BATCH)
+/* The hash input of a chain step: I || q || u16str(i) || u8str(j) || tmp */
+#define CHAIN_J_HASH_IDX_OFFSET (MBEDTLS_LMOTS_I_KEY_ID_LEN + \
+                                 MBEDTLS_LMOTS_Q_LEAF_ID_LEN + \
+                                 I_DIGIT_IDX_LEN)
+#define CHAIN_TMP_HASH_OFFSET   (CHAIN_J_HASH_IDX_OFFSET + J_HASH_IDX_LEN)
+#define CHAIN_INPUT_LEN_MAX     (CHAIN_TMP_HASH_OFFSET + \
+                                 MBEDTLS_LMOTS_N_HASH_LEN_MAX)
+#endif /* LMOTS_CHAIN_BATCH */
+
 /* Hash each element of the string of digits (+ checksum), producing a hash
  * output for each element. This is used in several places (by varying the
  * hash_idx_min/max_values) in order to calculate a public key from a private
@@ -229,6 +252,104 @@ exit:
  *                      MBEDTLS_LMOTS_SHA256_N32_W8, this is of size 32 *
  *                      34.
  */
+#if defined(LMOTS_CHAIN_BATCH)
+static int hash_digit_array(const mbedtls_lmots_parameters_t *params,
+                            const unsigned char *x_digit_array,
+                            const unsigned char *hash_idx_min_values,
+                            const unsigned char *hash_idx_max_values,
+                            unsigned char *output)
+{
+    const size_t hash_len = MBEDTLS_LMOTS_N_HASH_LEN(params->type);
+    unsigned char chains[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX][CHAIN_INPUT_LEN_MAX];
+    unsigned char tmp_hash[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX][MBEDTLS_LMOTS_N_HASH_LEN_MAX];
+    const unsigned char *input[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    size_t ilen[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    unsigned char *hash_output[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    unsigned int active[MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT_MAX];
+    unsigned int i_digit_idx;
+    unsigned int j_hash_idx_min;
+    unsigned int j_hash_idx_max;
+    unsigned int step;
+    size_t count, k;
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    for (i_digit_idx = 0;
+         i_digit_idx < MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT(params->type);
+         i_digit_idx++) {
+        memcpy(chains[i_digit_idx], params->I_key_identifier,
+               MBEDTLS_LMOTS_I_KEY_ID_LEN);
+        memcpy(chains[i_digit_idx] + MBEDTLS_LMOTS_I_KEY_ID_LEN,
+               params->q_leaf_identifier, MBEDTLS_LMOTS_Q_LEAF_ID_LEN);
+        mbedtls_lms_unsigned_int_to_network_bytes(i_digit_idx, I_DIGIT_IDX_LEN,
+                                                  chains[i_digit_idx] +
+                                                  MBEDTLS_LMOTS_I_KEY_ID_LEN +
+                                                  MBEDTLS_LMOTS_Q_LEAF_ID_LEN);
+        memcpy(chains[i_digit_idx] + CHAIN_TMP_HASH_OFFSET,
+               &x_digit_array[i_digit_idx * hash_len], hash_len);
+    }
+
+    /* The chains are independent, so advance all of them by one step at a
+     * time, hashing the steps of the chains that are not finished yet as
+     * one batch. */
+    for (step = 0;; step++) {
+        count = 0;
+
+        for (i_digit_idx = 0;
+             i_digit_idx < MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT(params->type);
+             i_digit_idx++) {
+            j_hash_idx_min = hash_idx_min_values != NULL ?
+                             hash_idx_min_values[i_digit_idx] : 0;
+            j_hash_idx_max = hash_idx_max_values != NULL ?
+                             hash_idx_max_values[i_digit_idx] : DIGIT_MAX_VALUE;
+
+            if (j_hash_idx_min + step >= j_hash_idx_max) {
+                continue;
+            }
+
+            mbedtls_lms_unsigned_int_to_network_bytes(j_hash_idx_min + step,
+                                                      J_HASH_IDX_LEN,
+                                                      chains[i_digit_idx] +
+                                                      CHAIN_J_HASH_IDX_OFFSET);
+            active[count] = i_digit_idx;
+            input[count] = chains[i_digit_idx];
+            ilen[count] = CHAIN_TMP_HASH_OFFSET + hash_len;
+            hash_output[count] = tmp_hash[count];
+            count++;
+        }
+
+        if (count == 0) {
+            break;
+        }
+
+        ret = mbedtls_sha256_batch(count, input, ilen, hash_output, 0);
+        if (ret != 0) {
+            goto exit;
+        }
+
+        for (k = 0; k < count; k++) {
+            memcpy(chains[active[k]] + CHAIN_TMP_HASH_OFFSET, tmp_hash[k],
+                   hash_len);
+        }
+    }
+
+    for (i_digit_idx = 0;
+         i_digit_idx < MBEDTLS_LMOTS_P_SIG_DIGIT_COUNT(params->type);
+         i_digit_idx++) {
+        memcpy(&output[i_digit_idx * hash_len],
+               chains[i_digit_idx] + CHAIN_TMP_HASH_OFFSET, hash_len);
+    }
+
+    ret = 0;
+
+exit:
+    mbedtls_platform_zeroize(chains, sizeof(chains));
+    mbedtls_platform_zeroize(tmp_hash, sizeof(tmp_hash));
+
+    return ret;
+}
+
+#else /* LMOTS_CHAIN_BATCH */
+
 static int hash_digit_array(const mbedtls_lmots_parameters_t *params,
                             const unsigned char *x_digit_array,
                             const unsigned char *hash_idx_min_values,
@@ -323,6 +444,8 @@ exit:
     return PSA_TO_MBEDTLS_ERR(status);
 }
 
+#endif /* LMOTS_CHAIN_BATCH */
+
 /* Combine the hashes of the digit array into a public key. This is used in
  * in order to calculate a public key from a private key (RFC8554 Algorithm 1
  * step 4), and to calculate a public key candidate from a signature and message
@@ -34,6 +34,14 @@
 
 #include "mbedtls/platform.h"
 
+#if defined(MBEDTLS_LMS_PRIVATE) && defined(MBEDTLS_SHA256_C) && \
+    defined(MBEDTLS_PSA_BUILTIN_ALG_SHA_256)
+#include "mbedtls/sha256.h"
+/* PSA would use the built-in SHA-256 anyway, so the nodes of each level of
+ * the Merkle tree can be hashed together with mbedtls_sha256_batch(). */
+#define LMS_MERKLE_TREE_BATCH
+#endif
+
 /* Define a local translating function to save code size by not using too many
  * arguments in each translating place. */
 static int local_err_translation(psa_status_t status)
@@ -424,6 +432,78 @@ int mbedtls_lms_verify(const mbedtls_lms_public_t *ctx,
 
 #if defined(MBEDTLS_LMS_PRIVATE)
 
+#if defined(LMS_MERKLE_TREE_BATCH)
+
+/* The number of nodes hashed by each call to mbedtls_sha256_batch() */
+#define MERKLE_TREE_BATCH_COUNT            16
+
+/* The size of the hash input of an internal node, which is the longest */
+#define MERKLE_TREE_NODE_INPUT_MAX         (MBEDTLS_LMOTS_I_KEY_ID_LEN + 4 + \
+                                            D_CONST_LEN + \
+                                            2 * MBEDTLS_LMS_M_NODE_BYTES_MAX)
+
+/* Calculate count nodes of the Merkle tree, with the same values as
+ * create_merkle_leaf_value() and create_merkle_internal_value().
+ *
+ *  ctx                 The LMS private context.
+ *
+ *  tree                The tree, as for calculate_merkle_tree(). The
+ *                      children of the nodes to calculate, if any, must
+ *                      already be in it.
+ *
+ *  r_node_idx          The index of the first node to calculate.
+ *
+ *  count               The number of nodes to calculate, at most
+ *                      MERKLE_TREE_BATCH_COUNT.
+ */
+static int calculate_merkle_nodes(const mbedtls_lms_private_t *ctx,
+                                  unsigned char *tree,
+                                  unsigned int r_node_idx,
+                                  unsigned int count)
+{
+    const size_t node_bytes = MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type);
+    const size_t key_bytes = MBEDTLS_LMOTS_N_HASH_LEN(ctx->params.otstype);
+    unsigned char buf[MERKLE_TREE_BATCH_COUNT][MERKLE_TREE_NODE_INPUT_MAX];
+    const unsigned char *input[MERKLE_TREE_BATCH_COUNT];
+    size_t ilen[MERKLE_TREE_BATCH_COUNT];
+    unsigned char *output[MERKLE_TREE_BATCH_COUNT];
+    unsigned int i, r;
+    unsigned char *p;
+
+    for (i = 0; i < count; i++) {
+        r = r_node_idx + i;
+        p = buf[i];
+
+        memcpy(p, ctx->params.I_key_identifier, MBEDTLS_LMOTS_I_KEY_ID_LEN);
+        p += MBEDTLS_LMOTS_I_KEY_ID_LEN;
+        mbedtls_lms_unsigned_int_to_network_bytes(r, 4, p);
+        p += 4;
+
+        if (r >= MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type)) {
+            memcpy(p, D_LEAF_CONSTANT_BYTES, D_CONST_LEN);
+            p += D_CONST_LEN;
+            memcpy(p, ctx->ots_public_keys[r - MERKLE_TREE_INTERNAL_NODE_AM(
+                                               ctx->params.type)].public_key,
+                   key_bytes);
+            p += key_bytes;
+        } else {
+            /* The children 2r and 2r + 1 are next to each other */
+            memcpy(p, D_INTR_CONSTANT_BYTES, D_CONST_LEN);
+            p += D_CONST_LEN;
+            memcpy(p, &tree[(r * 2) * node_bytes], 2 * node_bytes);
+            p += 2 * node_bytes;
+        }
+
+        input[i] = buf[i];
+        ilen[i] = (size_t) (p - buf[i]);
+        output[i] = &tree[r * node_bytes];
+    }
+
+    return mbedtls_sha256_batch(count, input, ilen, output, 0);
+}
+
+#endif /* LMS_MERKLE_TREE_BATCH */
+
 /* Calculate a full Merkle tree based on a private key. This function
  * implements RFC8554 section 5.3, and is used to generate a public key (as the
  * public key is the root node of the Merkle tree).
@@ -441,9 +521,32 @@ int mbedtls_lms_verify(const mbedtls_lms_public_t *ctx,
 static int calculate_merkle_tree(const mbedtls_lms_private_t *ctx,
                                  unsigned char *tree)
 {
-    unsigned int priv_key_idx;
     unsigned int r_node_idx;
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+#if defined(LMS_MERKLE_TREE_BATCH)
+    unsigned int level_start, count;
+
+    /* The nodes of a level only depend on the level below, so calculate
+     * the tree level by level, starting with the leaf nodes. */
+    for (level_start = MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type);
+         level_start > 0;
+         level_start >>= 1) {
+        for (r_node_idx = level_start;
+             r_node_idx < 2 * level_start;
+             r_node_idx += count) {
+            count = 2 * level_start - r_node_idx;
+            if (count > MERKLE_TREE_BATCH_COUNT) {
+                count = MERKLE_TREE_BATCH_COUNT;
+            }
+
+            ret = calculate_merkle_nodes(ctx, tree, r_node_idx, count);
+            if (ret != 0) {
+                return ret;
+            }
+        }
+    }
+#else
+    unsigned int priv_key_idx;
 
     /* First create the leaf nodes, in ascending order */
     for (priv_key_idx = 0;
@@ -478,61 +581,41 @@ static int calculate_merkle_tree(const mbedtls_lms_private_t *ctx,
             return ret;
         }
     }
+#endif /* LMS_MERKLE_TREE_BATCH */
 
     return 0;
 }
 
-/* Calculate a path from a leaf node of the Merkle tree to the root of the tree,
- * and return the full path. This function implements RFC8554 section 5.4.1, as
- * the Merkle path is the main component of an LMS signature.
+/* Read a path from a leaf node of the Merkle tree to the root of the tree
+ * from the tree kept in the private context. This function implements
+ * RFC8554 section 5.4.1, as the Merkle path is the main component of an LMS
+ * signature.
  *
  *  ctx                 The LMS private context, containing a parameter
- *                      set and private key material consisting of both
- *                      public and private OTS.
+ *                      set and the Merkle tree.
  *
  *  leaf_node_id        Which leaf node to calculate the path from.
  *
  *  path                The output path, which is H hash outputs.
  */
-static int get_merkle_path(mbedtls_lms_private_t *ctx,
-                           unsigned int leaf_node_id,
-                           unsigned char *path)
+static void get_merkle_path(const mbedtls_lms_private_t *ctx,
+                            unsigned int leaf_node_id,
+                            unsigned char *path)
 {
     const size_t node_bytes = MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type);
     unsigned int curr_node_id = leaf_node_id;
     unsigned int adjacent_node_id;
-    unsigned char *tree = NULL;
     unsigned int height;
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-
-    tree = mbedtls_calloc(MERKLE_TREE_NODE_AM(ctx->params.type),
-                          node_bytes);
-    if (tree == NULL) {
-        return MBEDTLS_ERR_LMS_ALLOC_FAILED;
-    }
-
-    ret = calculate_merkle_tree(ctx, tree);
-    if (ret != 0) {
-        goto exit;
-    }
 
     for (height = 0; height < MBEDTLS_LMS_H_TREE_HEIGHT(ctx->params.type);
          height++) {
         adjacent_node_id = curr_node_id ^ 1;
 
         memcpy(&path[height * node_bytes],
-               &tree[adjacent_node_id * node_bytes], node_bytes);
+               &ctx->tree[adjacent_node_id * node_bytes], node_bytes);
 
         curr_node_id >>= 1;
     }
-
-    ret = 0;
-
-exit:
-    mbedtls_zeroize_and_free(tree, node_bytes *
-                             MERKLE_TREE_NODE_AM(ctx->params.type));
-
-    return ret;
 }
 
 void mbedtls_lms_private_init(mbedtls_lms_private_t *ctx)
@@ -559,6 +642,12 @@ void mbedtls_lms_private_free(mbedtls_lms_private_t *ctx)
 
         mbedtls_free(ctx->ots_private_keys);
         mbedtls_free(ctx->ots_public_keys);
+
+        if (ctx->tree != NULL) {
+            mbedtls_zeroize_and_free(ctx->tree,
+                                     MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type) *
+                                     MERKLE_TREE_NODE_AM(ctx->params.type));
+        }
     }
 
     mbedtls_platform_zeroize(ctx, sizeof(*ctx));
@@ -638,6 +727,20 @@ int mbedtls_lms_generate_private_key(mbedtls_lms_private_t *ctx,
         }
     }
 
+    /* The tree only depends on the OTS public keys, so calculate it once
+     * rather than for each signature. */
+    ctx->tree = mbedtls_calloc(MERKLE_TREE_NODE_AM(ctx->params.type),
+                               MBEDTLS_LMS_M_NODE_BYTES(ctx->params.type));
+    if (ctx->tree == NULL) {
+        ret = MBEDTLS_ERR_LMS_ALLOC_FAILED;
+        goto exit;
+    }
+
+    ret = calculate_merkle_tree(ctx, ctx->tree);
+    if (ret != 0) {
+        goto exit;
+    }
+
     ctx->q_next_usable_key = 0;
 
 exit:
@@ -652,8 +755,6 @@ int mbedtls_lms_calculate_public_key(mbedtls_lms_public_t *ctx,
                                      const mbedtls_lms_private_t *priv_ctx)
 {
     const size_t node_bytes = MBEDTLS_LMS_M_NODE_BYTES(priv_ctx->params.type);
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    unsigned char *tree = NULL;
 
     if (!priv_ctx->have_private_key) {
         return MBEDTLS_ERR_LMS_BAD_INPUT_DATA;
@@ -669,32 +770,15 @@ int mbedtls_lms_calculate_public_key(mbedtls_lms_public_t *ctx,
         return MBEDTLS_ERR_LMS_BAD_INPUT_DATA;
     }
 
-    tree = mbedtls_calloc(MERKLE_TREE_NODE_AM(priv_ctx->params.type),
-                          node_bytes);
-    if (tree == NULL) {
-        return MBEDTLS_ERR_LMS_ALLOC_FAILED;
-    }
-
     memcpy(&ctx->params, &priv_ctx->params,
            sizeof(mbedtls_lmots_parameters_t));
 
-    ret = calculate_merkle_tree(priv_ctx, tree);
-    if (ret != 0) {
-        goto exit;
-    }
-
     /* Root node is always at position 1, due to 1-based indexing */
-    memcpy(ctx->T_1_pub_key, &tree[node_bytes], node_bytes);
+    memcpy(ctx->T_1_pub_key, &priv_ctx->tree[node_bytes], node_bytes);
 
     ctx->have_public_key = 1;
 
-    ret = 0;
-
-exit:
-    mbedtls_zeroize_and_free(tree, node_bytes *
-                             MERKLE_TREE_NODE_AM(priv_ctx->params.type));
-
-    return ret;
+    return 0;
 }
 
 
@@ -760,12 +844,9 @@ int mbedtls_lms_sign(mbedtls_lms_private_t *ctx,
                                               MBEDTLS_LMOTS_Q_LEAF_ID_LEN,
                                               sig + SIG_Q_LEAF_ID_OFFSET);
 
-    ret = get_merkle_path(ctx,
-                          MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + q_leaf_identifier,
-                          sig + SIG_PATH_OFFSET(ctx->params.otstype));
-    if (ret != 0) {
-        return ret;
-    }
+    get_merkle_path(ctx,
+                    MERKLE_TREE_INTERNAL_NODE_AM(ctx->params.type) + q_leaf_identifier,
+                    sig + SIG_PATH_OFFSET(ctx->params.otstype));
 
     if (sig_len != NULL) {
         *sig_len = MBEDTLS_LMS_SIG_LEN(ctx->params.type, ctx->params.otstype);
@@ -430,6 +430,7 @@ int mbedtls_md_setup(mbedtls_md_context_t *ctx, const mbedtls_md_info_t *md_info
     ctx->md_ctx = NULL;
 #if defined(MBEDTLS_MD_C)
     ctx->hmac_ctx = NULL;
+    ctx->hmac_key = NULL;
 #else
     if (hmac != 0) {
         return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
@@ -743,6 +744,54 @@ int mbedtls_md(const mbedtls_md_info_t *md_info, const unsigned char *input, siz
     }
 }
 
+int mbedtls_md_batch(const mbedtls_md_info_t *md_info, size_t count,
+                     const unsigned char *const input[], const size_t ilen[],
+                     unsigned char *const output[])
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    int use_legacy_batch = 1;
+    size_t i;
+
+    if (md_info == NULL) {
+        return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
+    }
+
+#if defined(MBEDTLS_MD_SOME_PSA)
+    use_legacy_batch = !md_can_use_psa(md_info);
+#endif
+
+    if (use_legacy_batch) {
+        switch (md_info->type) {
+#if defined(MBEDTLS_SHA224_C)
+            case MBEDTLS_MD_SHA224:
+                return mbedtls_sha256_batch(count, input, ilen, output, 1);
+#endif
+#if defined(MBEDTLS_SHA256_C)
+            case MBEDTLS_MD_SHA256:
+                return mbedtls_sha256_batch(count, input, ilen, output, 0);
+#endif
+#if defined(MBEDTLS_SHA384_C)
+            case MBEDTLS_MD_SHA384:
+                return mbedtls_sha512_batch(count, input, ilen, output, 1);
+#endif
+#if defined(MBEDTLS_SHA512_C)
+            case MBEDTLS_MD_SHA512:
+                return mbedtls_sha512_batch(count, input, ilen, output, 0);
+#endif
+            default:
+                break;
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        if ((ret = mbedtls_md(md_info, input[i], ilen[i], output[i])) != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 unsigned char mbedtls_md_get_size(const mbedtls_md_info_t *md_info)
 {
     if (md_info == NULL) {
@@ -966,6 +1015,25 @@ cleanup:
 }
 #endif /* MBEDTLS_FS_IO */
 
+/*
+ * Replace the hash state of ctx with one from a prepared HMAC key.
+ * A PSA hash operation can only be cloned into an inactive one.
+ */
+static int md_hmac_load_state(mbedtls_md_context_t *ctx,
+                              const mbedtls_md_context_t *src)
+{
+#if defined(MBEDTLS_MD_SOME_PSA)
+    if (ctx->engine == MBEDTLS_MD_ENGINE_PSA) {
+        psa_status_t status = psa_hash_abort(ctx->md_ctx);
+        if (status != PSA_SUCCESS) {
+            return mbedtls_md_error_from_psa(status);
+        }
+    }
+#endif
+
+    return mbedtls_md_clone(ctx, src);
+}
+
 int mbedtls_md_hmac_starts(mbedtls_md_context_t *ctx, const unsigned char *key, size_t keylen)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
@@ -976,6 +1044,8 @@ int mbedtls_md_hmac_starts(mbedtls_md_context_t *ctx, const unsigned char *key,
         return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
     }
 
+    ctx->hmac_key = NULL;
+
     if (keylen > (size_t) ctx->md_info->block_size) {
         if ((ret = mbedtls_md_starts(ctx)) != 0) {
             goto cleanup;
@@ -1038,18 +1108,29 @@ int mbedtls_md_hmac_finish(mbedtls_md_context_t *ctx, unsigned char *output)
     if ((ret = mbedtls_md_finish(ctx, tmp)) != 0) {
         return ret;
     }
-    if ((ret = mbedtls_md_starts(ctx)) != 0) {
-        return ret;
-    }
-    if ((ret = mbedtls_md_update(ctx, opad,
-                                 ctx->md_info->block_size)) != 0) {
-        return ret;
+    if (ctx->hmac_key != NULL) {
+        if ((ret = md_hmac_load_state(ctx, &ctx->hmac_key->outer)) != 0) {
+            goto cleanup;
+        }
+    } else {
+        if ((ret = mbedtls_md_starts(ctx)) != 0) {
+            goto cleanup;
+        }
+        if ((ret = mbedtls_md_update(ctx, opad,
+                                     ctx->md_info->block_size)) != 0) {
+            goto cleanup;
+        }
     }
     if ((ret = mbedtls_md_update(ctx, tmp,
                                  ctx->md_info->size)) != 0) {
-        return ret;
+        goto cleanup;
     }
-    return mbedtls_md_finish(ctx, output);
+    ret = mbedtls_md_finish(ctx, output);
+
+cleanup:
+    mbedtls_platform_zeroize(tmp, sizeof(tmp));
+
+    return ret;
 }
 
 int mbedtls_md_hmac_reset(mbedtls_md_context_t *ctx)
@@ -1061,6 +1142,10 @@ int mbedtls_md_hmac_reset(mbedtls_md_context_t *ctx)
         return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
     }
 
+    if (ctx->hmac_key != NULL) {
+        return md_hmac_load_state(ctx, &ctx->hmac_key->inner);
+    }
+
     ipad = (unsigned char *) ctx->hmac_ctx;
 
     if ((ret = mbedtls_md_starts(ctx)) != 0) {
@@ -1103,6 +1188,127 @@ cleanup:
     return ret;
 }
 
+void mbedtls_md_hmac_key_init(mbedtls_md_hmac_key *key)
+{
+    mbedtls_md_init(&key->inner);
+    mbedtls_md_init(&key->outer);
+}
+
+void mbedtls_md_hmac_key_free(mbedtls_md_hmac_key *key)
+{
+    if (key == NULL) {
+        return;
+    }
+
+    mbedtls_md_free(&key->inner);
+    mbedtls_md_free(&key->outer);
+}
+
+int mbedtls_md_hmac_key_setup(mbedtls_md_hmac_key *key,
+                              const mbedtls_md_info_t *md_info,
+                              const unsigned char *secret, size_t keylen)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_md_context_t ctx;
+
+    if (key == NULL || md_info == NULL) {
+        return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
+    }
+
+    /* Release the states of a key that was already set up */
+    mbedtls_md_hmac_key_free(key);
+    mbedtls_md_hmac_key_init(key);
+
+    /* Let the HMAC code compute the pads, then keep the hash states that
+     * follow them. */
+    mbedtls_md_init(&ctx);
+
+    if ((ret = mbedtls_md_setup(&ctx, md_info, 1)) != 0 ||
+        (ret = mbedtls_md_setup(&key->inner, md_info, 0)) != 0 ||
+        (ret = mbedtls_md_setup(&key->outer, md_info, 0)) != 0) {
+        goto cleanup;
+    }
+
+    if ((ret = mbedtls_md_hmac_starts(&ctx, secret, keylen)) != 0) {
+        goto cleanup;
+    }
+    if ((ret = mbedtls_md_clone(&key->inner, &ctx)) != 0) {
+        goto cleanup;
+    }
+
+    if ((ret = mbedtls_md_starts(&key->outer)) != 0) {
+        goto cleanup;
+    }
+    ret = mbedtls_md_update(&key->outer,
+                            (unsigned char *) ctx.hmac_ctx + md_info->block_size,
+                            md_info->block_size);
+
+cleanup:
+    mbedtls_md_free(&ctx);
+    if (ret != 0) {
+        mbedtls_md_hmac_key_free(key);
+        mbedtls_md_hmac_key_init(key);
+    }
+
+    return ret;
+}
+
+int mbedtls_md_hmac_starts_key(mbedtls_md_context_t *ctx,
+                               const mbedtls_md_hmac_key *key)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if (ctx == NULL || ctx->md_info == NULL || ctx->hmac_ctx == NULL ||
+        key == NULL || key->inner.md_info != ctx->md_info) {
+        return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
+    }
+
+    if ((ret = md_hmac_load_state(ctx, &key->inner)) != 0) {
+        return ret;
+    }
+    ctx->hmac_key = key;
+
+    return 0;
+}
+
+int mbedtls_md_hmac_prepared(const mbedtls_md_hmac_key *key,
+                             const unsigned char *input, size_t ilen,
+                             unsigned char *output)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char tmp[MBEDTLS_MD_MAX_SIZE];
+    mbedtls_md_context_t ctx;
+
+    if (key == NULL || key->inner.md_info == NULL) {
+        return MBEDTLS_ERR_MD_BAD_INPUT_DATA;
+    }
+
+    /* Only a hash context is needed: the pads are in the prepared key */
+    mbedtls_md_init(&ctx);
+
+    if ((ret = mbedtls_md_setup(&ctx, key->inner.md_info, 0)) != 0) {
+        goto cleanup;
+    }
+
+    if ((ret = mbedtls_md_clone(&ctx, &key->inner)) != 0 ||
+        (ret = mbedtls_md_update(&ctx, input, ilen)) != 0 ||
+        (ret = mbedtls_md_finish(&ctx, tmp)) != 0) {
+        goto cleanup;
+    }
+
+    if ((ret = mbedtls_md_clone(&ctx, &key->outer)) != 0 ||
+        (ret = mbedtls_md_update(&ctx, tmp, ctx.md_info->size)) != 0 ||
+        (ret = mbedtls_md_finish(&ctx, output)) != 0) {
+        goto cleanup;
+    }
+
+cleanup:
+    mbedtls_platform_zeroize(tmp, sizeof(tmp));
+    mbedtls_md_free(&ctx);
+
+    return ret;
+}
+
 #endif /* MBEDTLS_MD_C */
 
 #endif /* MBEDTLS_MD_LIGHT */
@@ -29,6 +29,7 @@
 
 #include "mbedtls/net_sockets.h"
 #include "mbedtls/error.h"
+#include "mbedtls/platform_util.h"
 
 #include <string.h>
 
@@ -71,6 +72,21 @@ static int wsa_init_done = 0;
 #include <fcntl.h>
 #include <netdb.h>
 #include <errno.h>
+#include <poll.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+#include <netinet/tcp.h>
+#include <linux/tls.h>
+#if !defined(TCP_ULP)
+#define TCP_ULP 31
+#endif
+#if !defined(SOL_TLS)
+#define SOL_TLS 282
+#endif
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+#endif /* __linux__ */
 
 #define IS_EINTR(ret) ((ret) == EINTR)
 #define SOCKET int
@@ -91,6 +107,7 @@ static int wsa_init_done = 0;
 #include <time.h>
 #endif
 
+#include <limits.h>
 #include <stdint.h>
 
 /*
@@ -119,28 +136,13 @@ static int net_prepare(void)
 
 /*
  * Return 0 if the file descriptor is valid, an error otherwise.
- * If for_select != 0, check whether the file descriptor is within the range
- * allowed for fd_set used for the FD_xxx macros and the select() function.
  */
-static int check_fd(int fd, int for_select)
+static int check_fd(int fd)
 {
     if (fd < 0) {
         return MBEDTLS_ERR_NET_INVALID_CONTEXT;
     }
 
-#if (defined(_WIN32) || defined(_WIN32_WCE)) && !defined(EFIX64) && \
-    !defined(EFI32)
-    (void) for_select;
-#else
-    /* A limitation of select() is that it only works with file descriptors
-     * that are strictly less than FD_SETSIZE. This is a limitation of the
-     * fd_set type. Error out early, because attempting to call FD_SET on a
-     * large file descriptor is a buffer overflow on typical platforms. */
-    if (for_select && fd >= FD_SETSIZE) {
-        return MBEDTLS_ERR_NET_POLL_FAILED;
-    }
-#endif
-
     return 0;
 }
 
@@ -453,44 +455,39 @@ int mbedtls_net_set_nonblock(mbedtls_net_context *ctx)
 int mbedtls_net_poll(mbedtls_net_context *ctx, uint32_t rw, uint32_t timeout)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+#if (defined(_WIN32) || defined(_WIN32_WCE)) && !defined(EFIX64) && \
+    !defined(EFI32)
     struct timeval tv;
 
     fd_set read_fds;
     fd_set write_fds;
+#else
+    struct pollfd pfd;
+#endif
 
     int fd = ctx->fd;
 
-    ret = check_fd(fd, 1);
+    ret = check_fd(fd);
     if (ret != 0) {
         return ret;
     }
 
-#if defined(__has_feature)
-#if __has_feature(memory_sanitizer)
-    /* Ensure that memory sanitizers consider read_fds and write_fds as
-     * initialized even on platforms such as Glibc/x86_64 where FD_ZERO
-     * is implemented in assembly. */
-    memset(&read_fds, 0, sizeof(read_fds));
-    memset(&write_fds, 0, sizeof(write_fds));
-#endif
-#endif
+    if ((rw & ~(uint32_t) (MBEDTLS_NET_POLL_READ | MBEDTLS_NET_POLL_WRITE)) != 0) {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
 
+#if (defined(_WIN32) || defined(_WIN32_WCE)) && !defined(EFIX64) && \
+    !defined(EFI32)
     FD_ZERO(&read_fds);
     if (rw & MBEDTLS_NET_POLL_READ) {
-        rw &= ~MBEDTLS_NET_POLL_READ;
         FD_SET((SOCKET) fd, &read_fds);
     }
 
     FD_ZERO(&write_fds);
     if (rw & MBEDTLS_NET_POLL_WRITE) {
-        rw &= ~MBEDTLS_NET_POLL_WRITE;
         FD_SET((SOCKET) fd, &write_fds);
     }
 
-    if (rw != 0) {
-        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
-    }
-
     tv.tv_sec  = timeout / 1000;
     tv.tv_usec = (timeout % 1000) * 1000;
 
@@ -510,10 +507,312 @@ int mbedtls_net_poll(mbedtls_net_context *ctx, uint32_t rw, uint32_t timeout)
     if (FD_ISSET(fd, &write_fds)) {
         ret |= MBEDTLS_NET_POLL_WRITE;
     }
+#else
+    /* Unlike select(), poll() works with any file descriptor number. */
+    pfd.fd = fd;
+    pfd.events = 0;
+    pfd.revents = 0;
+    if (rw & MBEDTLS_NET_POLL_READ) {
+        pfd.events |= POLLIN;
+    }
+    if (rw & MBEDTLS_NET_POLL_WRITE) {
+        pfd.events |= POLLOUT;
+    }
+
+    do {
+        ret = poll(&pfd, 1, timeout == (uint32_t) -1 ? -1 :
+                   timeout > INT_MAX ? INT_MAX : (int) timeout);
+    } while (ret < 0 && IS_EINTR(errno));
+
+    if (ret < 0) {
+        return MBEDTLS_ERR_NET_POLL_FAILED;
+    }
+
+    /* An invalid descriptor cannot be read or written. Report other errors
+     * and hangups as readiness, so that the next read or write reports the
+     * condition, unless no readiness was requested at all. */
+    if ((pfd.revents & POLLNVAL) != 0 ||
+        ((pfd.revents & POLLERR) != 0 &&
+         (rw & (MBEDTLS_NET_POLL_READ | MBEDTLS_NET_POLL_WRITE)) == 0)) {
+        return MBEDTLS_ERR_NET_POLL_FAILED;
+    }
+
+    ret = 0;
+    if (pfd.revents & (POLLIN | POLLERR | POLLHUP)) {
+        ret |= rw & MBEDTLS_NET_POLL_READ;
+    }
+    if (pfd.revents & (POLLOUT | POLLERR | POLLHUP)) {
+        ret |= rw & MBEDTLS_NET_POLL_WRITE;
+    }
+#endif
 
     return ret;
 }
 
+#if defined(MBEDTLS_NET_POLLER_AVAILABLE)
+
+/* Number of events fetched by each call to epoll_wait(). */
+#define NET_POLLER_MAX_EVENTS 64
+
+/*
+ * Initialize a set of sockets
+ */
+void mbedtls_net_poller_init(mbedtls_net_poller *poller)
+{
+    poller->MBEDTLS_PRIVATE(fd) = -1;
+}
+
+/*
+ * Create the kernel object behind a set of sockets
+ */
+int mbedtls_net_poller_setup(mbedtls_net_poller *poller)
+{
+    int ret = net_prepare();
+    if (ret != 0) {
+        return ret;
+    }
+
+    poller->MBEDTLS_PRIVATE(fd) = epoll_create1(EPOLL_CLOEXEC);
+    if (poller->MBEDTLS_PRIVATE(fd) < 0) {
+        return MBEDTLS_ERR_NET_POLL_FAILED;
+    }
+
+    return 0;
+}
+
+/*
+ * Add a socket to a set
+ */
+int mbedtls_net_poller_add(mbedtls_net_poller *poller,
+                           const mbedtls_net_context *ctx,
+                           uint32_t rw, void *user_data)
+{
+    struct epoll_event ev;
+    int ret = check_fd(ctx->fd);
+    if (ret != 0) {
+        return ret;
+    }
+
+    if (rw == 0 ||
+        (rw & ~(uint32_t) (MBEDTLS_NET_POLL_READ | MBEDTLS_NET_POLL_WRITE)) != 0) {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLET;
+    if (rw & MBEDTLS_NET_POLL_READ) {
+        ev.events |= EPOLLIN | EPOLLRDHUP;
+    }
+    if (rw & MBEDTLS_NET_POLL_WRITE) {
+        ev.events |= EPOLLOUT;
+    }
+    ev.data.ptr = user_data;
+
+    if (epoll_ctl(poller->MBEDTLS_PRIVATE(fd), EPOLL_CTL_ADD, ctx->fd, &ev) != 0) {
+        return MBEDTLS_ERR_NET_POLL_FAILED;
+    }
+
+    return 0;
+}
+
+/*
+ * Remove a socket from a set
+ */
+int mbedtls_net_poller_remove(mbedtls_net_poller *poller,
+                              const mbedtls_net_context *ctx)
+{
+    /* Before Linux 2.6.9, EPOLL_CTL_DEL requires a non-null event. */
+    struct epoll_event ev;
+    int ret = check_fd(ctx->fd);
+    if (ret != 0) {
+        return ret;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    if (epoll_ctl(poller->MBEDTLS_PRIVATE(fd), EPOLL_CTL_DEL, ctx->fd, &ev) != 0) {
+        return MBEDTLS_ERR_NET_POLL_FAILED;
+    }
+
+    return 0;
+}
+
+/*
+ * Wait for events on a set of sockets
+ */
+int mbedtls_net_poller_wait(mbedtls_net_poller *poller,
+                            mbedtls_net_poll_event *events,
+                            size_t max_events, uint32_t timeout)
+{
+    struct epoll_event ev[NET_POLLER_MAX_EVENTS];
+    int ret, i;
+
+    if (max_events == 0) {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+    if (max_events > NET_POLLER_MAX_EVENTS) {
+        max_events = NET_POLLER_MAX_EVENTS;
+    }
+
+    ret = epoll_wait(poller->MBEDTLS_PRIVATE(fd), ev, (int) max_events,
+                     timeout == (uint32_t) -1 ? -1 :
+                     timeout > INT_MAX ? INT_MAX : (int) timeout);
+    if (ret < 0) {
+        return IS_EINTR(errno) ? 0 : MBEDTLS_ERR_NET_POLL_FAILED;
+    }
+
+    /* Report errors and hangups as readiness, so that the next read or
+     * write reports the condition. */
+    for (i = 0; i < ret; i++) {
+        events[i].user_data = ev[i].data.ptr;
+        events[i].rw = 0;
+        if (ev[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP)) {
+            events[i].rw |= MBEDTLS_NET_POLL_READ;
+        }
+        if (ev[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) {
+            events[i].rw |= MBEDTLS_NET_POLL_WRITE;
+        }
+    }
+
+    return ret;
+}
+
+/*
+ * Release a set of sockets
+ */
+void mbedtls_net_poller_free(mbedtls_net_poller *poller)
+{
+    if (poller->MBEDTLS_PRIVATE(fd) == -1) {
+        return;
+    }
+
+    close(poller->MBEDTLS_PRIVATE(fd));
+    poller->MBEDTLS_PRIVATE(fd) = -1;
+}
+
+#endif /* MBEDTLS_NET_POLLER_AVAILABLE */
+
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+#if defined(__linux__)
+/* Point iv, key, salt and rec_seq at the fields of the kernel structure
+ * for the given cipher. The structures only differ by their sizes. */
+#define NET_KTLS_CRYPTO_INFO(member, name)                              \
+    do {                                                                \
+        cipher_type = TLS_CIPHER_ ## name;                              \
+        info_len = sizeof(info.member);                                 \
+        iv = info.member.iv;                                            \
+        iv_size = TLS_CIPHER_ ## name ## _IV_SIZE;                      \
+        key = info.member.key;                                          \
+        key_size = TLS_CIPHER_ ## name ## _KEY_SIZE;                    \
+        salt = info.member.salt;                                        \
+        salt_size = TLS_CIPHER_ ## name ## _SALT_SIZE;                  \
+        rec_seq = info.member.rec_seq;                                  \
+    } while (0)
+#endif /* __linux__ */
+
+/*
+ * Enable kernel TLS for one direction of the connection
+ */
+int mbedtls_net_set_ktls(mbedtls_net_context *ctx, int direction,
+                         const mbedtls_ssl_traffic_keys *keys)
+{
+#if defined(__linux__)
+    int ret;
+    union {
+        struct tls12_crypto_info_aes_gcm_128 gcm128;
+        struct tls12_crypto_info_aes_gcm_256 gcm256;
+        struct tls12_crypto_info_aes_ccm_128 ccm128;
+        struct tls12_crypto_info_chacha20_poly1305 chacha;
+    } info;
+    unsigned char *iv, *key, *salt, *rec_seq;
+    size_t iv_size, key_size, salt_size, info_len;
+    uint16_t cipher_type;
+    int optname;
+
+    if (direction == MBEDTLS_SSL_TRAFFIC_KEYS_TX) {
+        optname = TLS_TX;
+    } else if (direction == MBEDTLS_SSL_TRAFFIC_KEYS_RX) {
+        optname = TLS_RX;
+    } else {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+
+    memset(&info, 0, sizeof(info));
+
+    switch (keys->cipher) {
+        case MBEDTLS_CIPHER_AES_128_GCM:
+            NET_KTLS_CRYPTO_INFO(gcm128, AES_GCM_128);
+            break;
+        case MBEDTLS_CIPHER_AES_256_GCM:
+            NET_KTLS_CRYPTO_INFO(gcm256, AES_GCM_256);
+            break;
+        case MBEDTLS_CIPHER_AES_128_CCM:
+            NET_KTLS_CRYPTO_INFO(ccm128, AES_CCM_128);
+            break;
+        case MBEDTLS_CIPHER_CHACHA20_POLY1305:
+            NET_KTLS_CRYPTO_INFO(chacha, CHACHA20_POLY1305);
+            break;
+        default:
+            return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+
+    if (keys->tls_version == MBEDTLS_SSL_VERSION_TLS1_2) {
+        info.gcm128.info.version = TLS_1_2_VERSION;
+    } else if (keys->tls_version == MBEDTLS_SSL_VERSION_TLS1_3) {
+        info.gcm128.info.version = TLS_1_3_VERSION;
+    } else {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+    info.gcm128.info.cipher_type = cipher_type;
+
+    if (keys->key_len != key_size || keys->tag_len != 16) {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+    memcpy(key, keys->key, key_size);
+    memcpy(rec_seq, keys->rec_seq, sizeof(keys->rec_seq));
+
+    /* The kernel builds the nonce as salt || iv. With a full static IV,
+     * which is the case in TLS 1.3 and for ChaCha20-Poly1305, the static
+     * IV is split between the two. Otherwise, in TLS 1.2, the explicit part
+     * of the nonce is the sequence number. */
+    if (keys->iv_len == salt_size + iv_size) {
+        memcpy(salt, keys->iv, salt_size);
+        memcpy(iv, keys->iv + salt_size, iv_size);
+    } else if (keys->iv_len == salt_size &&
+               iv_size == sizeof(keys->rec_seq)) {
+        memcpy(salt, keys->iv, salt_size);
+        memcpy(iv, keys->rec_seq, iv_size);
+    } else {
+        mbedtls_platform_zeroize(&info, sizeof(info));
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+
+    /* The ULP is already attached if the other direction was set up
+     * first, or when installing new keys. */
+    ret = setsockopt(ctx->fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls"));
+    if (ret != 0 && errno != EEXIST) {
+        mbedtls_platform_zeroize(&info, sizeof(info));
+        return MBEDTLS_ERR_NET_KTLS_FAILED;
+    }
+
+    ret = setsockopt(ctx->fd, SOL_TLS, optname, &info, (socklen_t) info_len);
+    mbedtls_platform_zeroize(&info, sizeof(info));
+    if (ret != 0) {
+        return MBEDTLS_ERR_NET_KTLS_FAILED;
+    }
+
+    return 0;
+#else
+    ((void) ctx);
+    ((void) keys);
+    if (direction != MBEDTLS_SSL_TRAFFIC_KEYS_TX &&
+        direction != MBEDTLS_SSL_TRAFFIC_KEYS_RX) {
+        return MBEDTLS_ERR_NET_BAD_INPUT_DATA;
+    }
+    return MBEDTLS_ERR_NET_KTLS_FAILED;
+#endif /* __linux__ */
+}
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 /*
  * Portable usleep helper
  */
@@ -542,7 +841,7 @@ int mbedtls_net_recv(void *ctx, unsigned char *buf, size_t len)
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     int fd = ((mbedtls_net_context *) ctx)->fd;
 
-    ret = check_fd(fd, 0);
+    ret = check_fd(fd);
     if (ret != 0) {
         return ret;
     }
@@ -582,15 +881,22 @@ int mbedtls_net_recv_timeout(void *ctx, unsigned char *buf,
                              size_t len, uint32_t timeout)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+#if (defined(_WIN32) || defined(_WIN32_WCE)) && !defined(EFIX64) && \
+    !defined(EFI32)
     struct timeval tv;
     fd_set read_fds;
+#else
+    struct pollfd pfd;
+#endif
     int fd = ((mbedtls_net_context *) ctx)->fd;
 
-    ret = check_fd(fd, 1);
+    ret = check_fd(fd);
     if (ret != 0) {
         return ret;
     }
 
+#if (defined(_WIN32) || defined(_WIN32_WCE)) && !defined(EFIX64) && \
+    !defined(EFI32)
     FD_ZERO(&read_fds);
     FD_SET((SOCKET) fd, &read_fds);
 
@@ -598,6 +904,14 @@ int mbedtls_net_recv_timeout(void *ctx, unsigned char *buf,
     tv.tv_usec = (timeout % 1000) * 1000;
 
     ret = select(fd + 1, &read_fds, NULL, NULL, timeout == 0 ? NULL : &tv);
+#else
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    ret = poll(&pfd, 1, timeout == 0 ? -1 :
+               timeout > INT_MAX ? INT_MAX : (int) timeout);
+#endif
 
     /* Zero fds ready means we timed out */
     if (ret == 0) {
@@ -631,7 +945,7 @@ int mbedtls_net_send(void *ctx, const unsigned char *buf, size_t len)
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     int fd = ((mbedtls_net_context *) ctx)->fd;
 
-    ret = check_fd(fd, 0);
+    ret = check_fd(fd);
     if (ret != 0) {
         return ret;
     }
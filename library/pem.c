@@ -247,7 +247,7 @@ int mbedtls_pem_read_buffer(mbedtls_pem_context *ctx, const char *header, const
                             size_t pwdlen, size_t *use_len)
 {
     int ret, enc;
-    size_t len;
+    size_t len, alloc_len;
     unsigned char *buf;
     const unsigned char *s1, *s2, *end;
 #if defined(PEM_RFC1421)
@@ -383,18 +383,17 @@ int mbedtls_pem_read_buffer(mbedtls_pem_context *ctx, const char *header, const
         return MBEDTLS_ERR_PEM_INVALID_DATA;
     }
 
-    ret = mbedtls_base64_decode(NULL, 0, &len, s1, s2 - s1);
+    /* Every 4 characters of base64 give at most 3 bytes, so this is
+     * enough to decode the data in a single pass, without asking
+     * mbedtls_base64_decode() for the exact size first. */
+    alloc_len = (size_t) (s2 - s1) / 4 * 3 + 3;
 
-    if (ret == MBEDTLS_ERR_BASE64_INVALID_CHARACTER) {
-        return MBEDTLS_ERROR_ADD(MBEDTLS_ERR_PEM_INVALID_DATA, ret);
-    }
-
-    if ((buf = mbedtls_calloc(1, len)) == NULL) {
+    if ((buf = mbedtls_calloc(1, alloc_len)) == NULL) {
         return MBEDTLS_ERR_PEM_ALLOC_FAILED;
     }
 
-    if ((ret = mbedtls_base64_decode(buf, len, &len, s1, s2 - s1)) != 0) {
-        mbedtls_zeroize_and_free(buf, len);
+    if ((ret = mbedtls_base64_decode(buf, alloc_len, &len, s1, s2 - s1)) != 0) {
+        mbedtls_zeroize_and_free(buf, alloc_len);
         return MBEDTLS_ERROR_ADD(MBEDTLS_ERR_PEM_INVALID_DATA, ret);
     }
 
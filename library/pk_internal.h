@@ -105,6 +105,36 @@ static inline mbedtls_ecp_group_id mbedtls_pk_get_group_id(const mbedtls_pk_cont
 #endif /* MBEDTLS_ECP_HAVE_CURVE25519 || MBEDTLS_ECP_DP_CURVE448 */
 #endif /* MBEDTLS_PK_HAVE_ECC_KEYS */
 
+#if defined(MBEDTLS_PK_PARSE_C) && defined(MBEDTLS_FS_IO)
+/**
+ * \brief          Load the content of a file like mbedtls_pk_load_file(),
+ *                 but map it into memory instead of reading it if possible
+ *                 (see #MBEDTLS_FS_IO_MMAP).
+ *
+ * \param path     The path of the file.
+ * \param buf      On success, the content of the file, followed by a null
+ *                 byte. It is read-only if the file is mapped.
+ * \param n        On success, the size of the content, including the null
+ *                 byte if the data looks like it is PEM encoded.
+ * \param map_len  On success, the size of the mapping, or \c 0 if \p *buf
+ *                 was allocated with mbedtls_calloc().
+ *
+ * \return         \c 0 if successful, or a specific PK error code.
+ */
+int mbedtls_pk_map_file(const char *path, unsigned char **buf, size_t *n,
+                        size_t *map_len);
+
+/**
+ * \brief          Release the content of a file loaded with
+ *                 mbedtls_pk_map_file().
+ *
+ * \param buf      The content of the file.
+ * \param n        The size returned by mbedtls_pk_map_file().
+ * \param map_len  The size of the mapping returned by mbedtls_pk_map_file().
+ */
+void mbedtls_pk_unmap_file(unsigned char *buf, size_t n, size_t map_len);
+#endif /* MBEDTLS_PK_PARSE_C && MBEDTLS_FS_IO */
+
 #if defined(MBEDTLS_TEST_HOOKS)
 
 MBEDTLS_STATIC_TESTABLE int mbedtls_pk_parse_key_pkcs8_encrypted_der(
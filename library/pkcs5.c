@@ -28,6 +28,15 @@
 #include "mbedtls/oid.h"
 #endif /* MBEDTLS_ASN1_PARSE_C */
 
+#if defined(MBEDTLS_SHA256_C) && !defined(MBEDTLS_SHA256_ALT)
+#include "mbedtls/sha256.h"
+#define PKCS5_PBKDF2_SHA256_DIRECT
+#endif
+#if defined(MBEDTLS_SHA512_C) && !defined(MBEDTLS_SHA512_ALT)
+#include "mbedtls/sha512.h"
+#define PKCS5_PBKDF2_SHA512_DIRECT
+#endif
+
 #include <string.h>
 
 #include "mbedtls/platform.h"
@@ -350,6 +359,243 @@ cleanup:
     return ret;
 }
 
+/*
+ * PBKDF2 directly on the SHA-2 compression functions.
+ *
+ * The HMAC key is the same for every iteration, so the states after the
+ * ipad and opad blocks are computed once. After the first iteration, the
+ * inner and outer hashes both process a single block made of the previous
+ * digest followed by the same padding, since both messages have the length
+ * of one block plus one digest. Each iteration therefore costs two
+ * compressions, where the generic HMAC code needs four, plus the overhead
+ * of the MD layer.
+ */
+#if defined(PKCS5_PBKDF2_SHA256_DIRECT)
+static int pkcs5_pbkdf2_hmac_sha256(int is224,
+                                    const unsigned char *password,
+                                    size_t plen, const unsigned char *salt, size_t slen,
+                                    unsigned int iteration_count,
+                                    uint32_t key_length, unsigned char *output)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_sha256_context inner, outer, ctx;
+    unsigned char pad[64];
+    unsigned char block[64];
+    unsigned char work[32];
+    unsigned char counter[4] = { 0, 0, 0, 1 };
+    size_t md_size = is224 ? 28 : 32;
+    size_t use_len;
+    unsigned int i, j;
+
+    mbedtls_sha256_init(&inner);
+    mbedtls_sha256_init(&outer);
+    mbedtls_sha256_init(&ctx);
+
+    /* Keys longer than a block are hashed first, as in HMAC */
+    memset(pad, 0, sizeof(pad));
+    if (plen > sizeof(pad)) {
+        if ((ret = mbedtls_sha256(password, plen, pad, is224)) != 0) {
+            goto cleanup;
+        }
+    } else if (plen != 0) {
+        memcpy(pad, password, plen);
+    }
+
+    for (j = 0; j < sizeof(pad); j++) {
+        pad[j] ^= 0x36;
+    }
+    if ((ret = mbedtls_sha256_starts(&inner, is224)) != 0 ||
+        (ret = mbedtls_sha256_update(&inner, pad, sizeof(pad))) != 0) {
+        goto cleanup;
+    }
+    for (j = 0; j < sizeof(pad); j++) {
+        pad[j] ^= 0x36 ^ 0x5C;
+    }
+    if ((ret = mbedtls_sha256_starts(&outer, is224)) != 0 ||
+        (ret = mbedtls_sha256_update(&outer, pad, sizeof(pad))) != 0) {
+        goto cleanup;
+    }
+
+    /* Padding of a message of sizeof(pad) + md_size bytes */
+    memset(block, 0, sizeof(block));
+    block[md_size] = 0x80;
+    MBEDTLS_PUT_UINT16_BE((uint16_t) ((sizeof(pad) + md_size) * 8),
+                          block, sizeof(block) - 2);
+
+    while (key_length) {
+        /* U1 = HMAC(password, salt || counter) ends up in work */
+        mbedtls_sha256_clone(&ctx, &inner);
+        if ((ret = mbedtls_sha256_update(&ctx, salt, slen)) != 0 ||
+            (ret = mbedtls_sha256_update(&ctx, counter, 4)) != 0 ||
+            (ret = mbedtls_sha256_finish(&ctx, block)) != 0) {
+            goto cleanup;
+        }
+        mbedtls_sha256_clone(&ctx, &outer);
+        if ((ret = mbedtls_sha256_update(&ctx, block, md_size)) != 0 ||
+            (ret = mbedtls_sha256_finish(&ctx, block)) != 0) {
+            goto cleanup;
+        }
+        memcpy(work, block, md_size);
+
+        for (i = 1; i < iteration_count; i++) {
+            /* U(i+1) = HMAC(password, U(i)) ends up in block */
+            memcpy(ctx.state, inner.state, sizeof(ctx.state));
+            if ((ret = mbedtls_internal_sha256_process(&ctx, block)) != 0) {
+                goto cleanup;
+            }
+            for (j = 0; j < md_size / 4; j++) {
+                MBEDTLS_PUT_UINT32_BE(ctx.state[j], block, 4 * j);
+            }
+
+            memcpy(ctx.state, outer.state, sizeof(ctx.state));
+            if ((ret = mbedtls_internal_sha256_process(&ctx, block)) != 0) {
+                goto cleanup;
+            }
+            for (j = 0; j < md_size / 4; j++) {
+                MBEDTLS_PUT_UINT32_BE(ctx.state[j], block, 4 * j);
+            }
+
+            mbedtls_xor(work, work, block, md_size);
+        }
+
+        use_len = (key_length < md_size) ? key_length : md_size;
+        memcpy(output, work, use_len);
+
+        key_length -= (uint32_t) use_len;
+        output += use_len;
+
+        for (j = 4; j > 0; j--) {
+            if (++counter[j - 1] != 0) {
+                break;
+            }
+        }
+    }
+
+cleanup:
+    mbedtls_sha256_free(&inner);
+    mbedtls_sha256_free(&outer);
+    mbedtls_sha256_free(&ctx);
+    mbedtls_platform_zeroize(pad, sizeof(pad));
+    mbedtls_platform_zeroize(block, sizeof(block));
+    mbedtls_platform_zeroize(work, sizeof(work));
+
+    return ret;
+}
+#endif /* PKCS5_PBKDF2_SHA256_DIRECT */
+
+#if defined(PKCS5_PBKDF2_SHA512_DIRECT)
+static int pkcs5_pbkdf2_hmac_sha512(int is384,
+                                    const unsigned char *password,
+                                    size_t plen, const unsigned char *salt, size_t slen,
+                                    unsigned int iteration_count,
+                                    uint32_t key_length, unsigned char *output)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_sha512_context inner, outer, ctx;
+    unsigned char pad[128];
+    unsigned char block[128];
+    unsigned char work[64];
+    unsigned char counter[4] = { 0, 0, 0, 1 };
+    size_t md_size = is384 ? 48 : 64;
+    size_t use_len;
+    unsigned int i, j;
+
+    mbedtls_sha512_init(&inner);
+    mbedtls_sha512_init(&outer);
+    mbedtls_sha512_init(&ctx);
+
+    /* Keys longer than a block are hashed first, as in HMAC */
+    memset(pad, 0, sizeof(pad));
+    if (plen > sizeof(pad)) {
+        if ((ret = mbedtls_sha512(password, plen, pad, is384)) != 0) {
+            goto cleanup;
+        }
+    } else if (plen != 0) {
+        memcpy(pad, password, plen);
+    }
+
+    for (j = 0; j < sizeof(pad); j++) {
+        pad[j] ^= 0x36;
+    }
+    if ((ret = mbedtls_sha512_starts(&inner, is384)) != 0 ||
+        (ret = mbedtls_sha512_update(&inner, pad, sizeof(pad))) != 0) {
+        goto cleanup;
+    }
+    for (j = 0; j < sizeof(pad); j++) {
+        pad[j] ^= 0x36 ^ 0x5C;
+    }
+    if ((ret = mbedtls_sha512_starts(&outer, is384)) != 0 ||
+        (ret = mbedtls_sha512_update(&outer, pad, sizeof(pad))) != 0) {
+        goto cleanup;
+    }
+
+    /* Padding of a message of sizeof(pad) + md_size bytes */
+    memset(block, 0, sizeof(block));
+    block[md_size] = 0x80;
+    MBEDTLS_PUT_UINT16_BE((uint16_t) ((sizeof(pad) + md_size) * 8),
+                          block, sizeof(block) - 2);
+
+    while (key_length) {
+        /* U1 = HMAC(password, salt || counter) ends up in work */
+        mbedtls_sha512_clone(&ctx, &inner);
+        if ((ret = mbedtls_sha512_update(&ctx, salt, slen)) != 0 ||
+            (ret = mbedtls_sha512_update(&ctx, counter, 4)) != 0 ||
+            (ret = mbedtls_sha512_finish(&ctx, block)) != 0) {
+            goto cleanup;
+        }
+        mbedtls_sha512_clone(&ctx, &outer);
+        if ((ret = mbedtls_sha512_update(&ctx, block, md_size)) != 0 ||
+            (ret = mbedtls_sha512_finish(&ctx, block)) != 0) {
+            goto cleanup;
+        }
+        memcpy(work, block, md_size);
+
+        for (i = 1; i < iteration_count; i++) {
+            /* U(i+1) = HMAC(password, U(i)) ends up in block */
+            memcpy(ctx.state, inner.state, sizeof(ctx.state));
+            if ((ret = mbedtls_internal_sha512_process(&ctx, block)) != 0) {
+                goto cleanup;
+            }
+            for (j = 0; j < md_size / 8; j++) {
+                MBEDTLS_PUT_UINT64_BE(ctx.state[j], block, 8 * j);
+            }
+
+            memcpy(ctx.state, outer.state, sizeof(ctx.state));
+            if ((ret = mbedtls_internal_sha512_process(&ctx, block)) != 0) {
+                goto cleanup;
+            }
+            for (j = 0; j < md_size / 8; j++) {
+                MBEDTLS_PUT_UINT64_BE(ctx.state[j], block, 8 * j);
+            }
+
+            mbedtls_xor(work, work, block, md_size);
+        }
+
+        use_len = (key_length < md_size) ? key_length : md_size;
+        memcpy(output, work, use_len);
+
+        key_length -= (uint32_t) use_len;
+        output += use_len;
+
+        for (j = 4; j > 0; j--) {
+            if (++counter[j - 1] != 0) {
+                break;
+            }
+        }
+    }
+
+cleanup:
+    mbedtls_sha512_free(&inner);
+    mbedtls_sha512_free(&outer);
+    mbedtls_sha512_free(&ctx);
+    mbedtls_platform_zeroize(pad, sizeof(pad));
+    mbedtls_platform_zeroize(block, sizeof(block));
+    mbedtls_platform_zeroize(work, sizeof(work));
+
+    return ret;
+}
+#endif /* PKCS5_PBKDF2_SHA512_DIRECT */
+
 #if !defined(MBEDTLS_DEPRECATED_REMOVED)
 int mbedtls_pkcs5_pbkdf2_hmac(mbedtls_md_context_t *ctx,
                               const unsigned char *password,
@@ -377,6 +623,37 @@ int mbedtls_pkcs5_pbkdf2_hmac_ext(mbedtls_md_type_t md_alg,
         return MBEDTLS_ERR_PKCS5_FEATURE_UNAVAILABLE;
     }
 
+#if UINT_MAX > 0xFFFFFFFF
+    if (iteration_count > 0xFFFFFFFF) {
+        return MBEDTLS_ERR_PKCS5_BAD_INPUT_DATA;
+    }
+#endif
+
+    switch (md_alg) {
+#if defined(PKCS5_PBKDF2_SHA256_DIRECT) && defined(MBEDTLS_SHA224_C)
+        case MBEDTLS_MD_SHA224:
+            return pkcs5_pbkdf2_hmac_sha256(1, password, plen, salt, slen,
+                                            iteration_count, key_length, output);
+#endif
+#if defined(PKCS5_PBKDF2_SHA256_DIRECT)
+        case MBEDTLS_MD_SHA256:
+            return pkcs5_pbkdf2_hmac_sha256(0, password, plen, salt, slen,
+                                            iteration_count, key_length, output);
+#endif
+#if defined(PKCS5_PBKDF2_SHA512_DIRECT) && defined(MBEDTLS_SHA384_C)
+        case MBEDTLS_MD_SHA384:
+            return pkcs5_pbkdf2_hmac_sha512(1, password, plen, salt, slen,
+                                            iteration_count, key_length, output);
+#endif
+#if defined(PKCS5_PBKDF2_SHA512_DIRECT)
+        case MBEDTLS_MD_SHA512:
+            return pkcs5_pbkdf2_hmac_sha512(0, password, plen, salt, slen,
+                                            iteration_count, key_length, output);
+#endif
+        default:
+            break;
+    }
+
     mbedtls_md_init(&md_ctx);
 
     if ((ret = mbedtls_md_setup(&md_ctx, md_info, 1)) != 0) {
@@ -15,6 +15,7 @@
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
 #include "pk_internal.h"
+#include "platform_util_internal.h"
 
 #include <string.h>
 
@@ -108,6 +109,33 @@ int mbedtls_pk_load_file(const char *path, unsigned char **buf, size_t *n)
     return 0;
 }
 
+/*
+ * Map a file into memory if possible, otherwise load it into a heap buffer.
+ */
+int mbedtls_pk_map_file(const char *path, unsigned char **buf, size_t *n,
+                        size_t *map_len)
+{
+    if (mbedtls_platform_map_file(path, buf, n, map_len) != 0) {
+        *map_len = 0;
+        return mbedtls_pk_load_file(path, buf, n);
+    }
+
+    if (strstr((const char *) *buf, "-----BEGIN ") != NULL) {
+        ++*n;
+    }
+
+    return 0;
+}
+
+void mbedtls_pk_unmap_file(unsigned char *buf, size_t n, size_t map_len)
+{
+    if (map_len != 0) {
+        mbedtls_platform_unmap_file(buf, map_len);
+    } else {
+        mbedtls_zeroize_and_free(buf, n);
+    }
+}
+
 /*
  * Load and parse a private key
  */
@@ -116,10 +144,10 @@ int mbedtls_pk_parse_keyfile(mbedtls_pk_context *ctx,
                              int (*f_rng)(void *, unsigned char *, size_t), void *p_rng)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
+    size_t n, map_len;
     unsigned char *buf;
 
-    if ((ret = mbedtls_pk_load_file(path, &buf, &n)) != 0) {
+    if ((ret = mbedtls_pk_map_file(path, &buf, &n, &map_len)) != 0) {
         return ret;
     }
 
@@ -130,7 +158,7 @@ int mbedtls_pk_parse_keyfile(mbedtls_pk_context *ctx,
                                    (const unsigned char *) pwd, strlen(pwd), f_rng, p_rng);
     }
 
-    mbedtls_zeroize_and_free(buf, n);
+    mbedtls_pk_unmap_file(buf, n, map_len);
 
     return ret;
 }
@@ -141,16 +169,16 @@ int mbedtls_pk_parse_keyfile(mbedtls_pk_context *ctx,
 int mbedtls_pk_parse_public_keyfile(mbedtls_pk_context *ctx, const char *path)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
+    size_t n, map_len;
     unsigned char *buf;
 
-    if ((ret = mbedtls_pk_load_file(path, &buf, &n)) != 0) {
+    if ((ret = mbedtls_pk_map_file(path, &buf, &n, &map_len)) != 0) {
         return ret;
     }
 
     ret = mbedtls_pk_parse_public_key(ctx, buf, n);
 
-    mbedtls_zeroize_and_free(buf, n);
+    mbedtls_pk_unmap_file(buf, n, map_len);
 
     return ret;
 }
@@ -25,6 +25,8 @@
 #include "mbedtls/platform_util.h"
 #include "mbedtls/platform.h"
 #include "mbedtls/threading.h"
+#include "mbedtls/error.h"
+#include "platform_util_internal.h"
 
 #include <stddef.h>
 
@@ -238,6 +240,95 @@ extern inline uint64_t mbedtls_get_unaligned_uint64(const void *p);
 
 extern inline void mbedtls_put_unaligned_uint64(void *p, uint64_t x);
 
+#if defined(MBEDTLS_FS_IO)
+
+#if defined(MBEDTLS_FS_IO_MMAP) && !defined(_WIN32) && \
+    (defined(unix) || defined(__unix) || defined(__unix__) || \
+    (defined(__APPLE__) && defined(__MACH__)))
+#include <unistd.h>
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#define PLATFORM_UTIL_USE_MMAP
+#endif
+#endif
+
+#if defined(PLATFORM_UTIL_USE_MMAP)
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if !defined(O_CLOEXEC)
+#define O_CLOEXEC 0
+#endif
+
+int mbedtls_platform_map_file(const char *path, unsigned char **buf,
+                              size_t *len, size_t *map_len)
+{
+    int fd;
+    struct stat st;
+    long page_size;
+    void *p;
+
+    page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0) {
+        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    }
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    }
+
+    /* The bytes of the last page after the end of the file read as zero,
+     * which provides the null byte after the content. There is no such
+     * byte if the file ends on a page boundary. */
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        (uintmax_t) st.st_size >= SIZE_MAX ||
+        (size_t) st.st_size % (size_t) page_size == 0) {
+        close(fd);
+        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    }
+
+    p = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    }
+
+    *buf = p;
+    *len = (size_t) st.st_size;
+    *map_len = (size_t) st.st_size;
+
+    return 0;
+}
+
+void mbedtls_platform_unmap_file(unsigned char *buf, size_t map_len)
+{
+    if (buf != NULL && map_len != 0) {
+        munmap(buf, map_len);
+    }
+}
+#else /* PLATFORM_UTIL_USE_MMAP */
+int mbedtls_platform_map_file(const char *path, unsigned char **buf,
+                              size_t *len, size_t *map_len)
+{
+    (void) path;
+    (void) buf;
+    (void) len;
+    (void) map_len;
+
+    return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+}
+
+void mbedtls_platform_unmap_file(unsigned char *buf, size_t map_len)
+{
+    (void) buf;
+    (void) map_len;
+}
+#endif /* PLATFORM_UTIL_USE_MMAP */
+
+#endif /* MBEDTLS_FS_IO */
+
 #if defined(MBEDTLS_HAVE_TIME) && !defined(MBEDTLS_PLATFORM_MS_TIME_ALT)
 
 #include <time.h>
@@ -0,0 +1,61 @@
+/**
+ * \file platform_util_internal.h
+ *
+ * \brief Internal platform abstraction functions, for use by the library
+ *        only.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#ifndef MBEDTLS_PLATFORM_UTIL_INTERNAL_H
+#define MBEDTLS_PLATFORM_UTIL_INTERNAL_H
+
+#include "common.h"
+
+#include "mbedtls/platform_util.h"
+
+#include <stddef.h>
+
+#if defined(MBEDTLS_FS_IO)
+
+/**
+ * \brief          Map the content of a file into memory, read-only.
+ *
+ *                 The byte after the content of the file is a null byte,
+ *                 as with the buffers filled by mbedtls_pk_load_file(), so
+ *                 the content can be passed to the PEM parsers with a
+ *                 length of \p *len + 1.
+ *
+ *                 This function only succeeds if #MBEDTLS_FS_IO_MMAP is
+ *                 enabled, on POSIX platforms, for regular files that are
+ *                 not empty and whose size is not a multiple of the page
+ *                 size. The caller is expected to read the file with the
+ *                 standard I/O functions when it fails.
+ *
+ * \param path     The path of the file.
+ * \param buf      On success, the address of the content of the file.
+ * \param len      On success, the size of the file in bytes.
+ * \param map_len  On success, the size of the mapping, to be passed to
+ *                 mbedtls_platform_unmap_file(). It is never \c 0.
+ *
+ * \return         \c 0 if successful.
+ * \return         #MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED if the file
+ *                 cannot be mapped, including when it does not exist.
+ */
+int mbedtls_platform_map_file(const char *path, unsigned char **buf,
+                              size_t *len, size_t *map_len);
+
+/**
+ * \brief          Unmap a file mapped by mbedtls_platform_map_file().
+ *
+ * \param buf      The address of the content of the file.
+ * \param map_len  The size of the mapping returned by
+ *                 mbedtls_platform_map_file().
+ */
+void mbedtls_platform_unmap_file(unsigned char *buf, size_t map_len);
+
+#endif /* MBEDTLS_FS_IO */
+
+#endif /* MBEDTLS_PLATFORM_UTIL_INTERNAL_H */
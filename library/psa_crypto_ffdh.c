@@ -14,6 +14,7 @@
 #include "psa_crypto_core.h"
 #include "psa_crypto_ffdh.h"
 #include "psa_crypto_random_impl.h"
+#include "dhm_ffdhe.h"
 #include "mbedtls/platform.h"
 #include "mbedtls/error.h"
 
@@ -152,6 +153,12 @@ psa_status_t mbedtls_psa_ffdh_export_public_key(
     MBEDTLS_MPI_CHK(mbedtls_mpi_read_binary(&X, key_buffer,
                                             key_buffer_size));
 
+#if MBEDTLS_DHM_FIXED_BASE_OPTIM == 1
+    const mbedtls_dhm_ffdhe_group *grp = mbedtls_dhm_ffdhe_find(&P, &G);
+    if (grp != NULL) {
+        MBEDTLS_MPI_CHK(mbedtls_dhm_ffdhe_exp_g(&GX, &X, grp));
+    } else
+#endif
     MBEDTLS_MPI_CHK(mbedtls_mpi_exp_mod(&GX, &G, &X, &P, NULL));
     MBEDTLS_MPI_CHK(mbedtls_mpi_write_binary(&GX, data, key_len));
 
@@ -24,8 +24,10 @@
 static psa_status_t psa_hmac_abort_internal(
     mbedtls_psa_hmac_operation_t *hmac)
 {
-    mbedtls_platform_zeroize(hmac->opad, sizeof(hmac->opad));
-    return psa_hash_abort(&hmac->hash_ctx);
+    psa_status_t status = psa_hash_abort(&hmac->outer_ctx);
+    psa_status_t status2 = psa_hash_abort(&hmac->hash_ctx);
+
+    return status != PSA_SUCCESS ? status : status2;
 }
 
 static psa_status_t psa_hmac_setup_internal(
@@ -35,6 +37,7 @@ static psa_status_t psa_hmac_setup_internal(
     psa_algorithm_t hash_alg)
 {
     uint8_t ipad[PSA_HMAC_MAX_HASH_BLOCK_SIZE];
+    uint8_t opad[PSA_HMAC_MAX_HASH_BLOCK_SIZE];
     size_t i;
     size_t hash_size = PSA_HASH_LENGTH(hash_alg);
     size_t block_size = PSA_HASH_BLOCK_LENGTH(hash_alg);
@@ -46,12 +49,12 @@ static psa_status_t psa_hmac_setup_internal(
      * overflow below. This should never trigger if the hash algorithm
      * is implemented correctly. */
     /* The size checks against the ipad and opad buffers cannot be written
-     * `block_size > sizeof( ipad ) || block_size > sizeof( hmac->opad )`
+     * `block_size > sizeof( ipad ) || block_size > sizeof( opad )`
      * because that triggers -Wlogical-op on GCC 7.3. */
     if (block_size > sizeof(ipad)) {
         return PSA_ERROR_NOT_SUPPORTED;
     }
-    if (block_size > sizeof(hmac->opad)) {
+    if (block_size > sizeof(opad)) {
         return PSA_ERROR_NOT_SUPPORTED;
     }
     if (block_size < hash_size) {
@@ -83,9 +86,9 @@ static psa_status_t psa_hmac_setup_internal(
     /* Copy the key material from ipad to opad, flipping the requisite bits,
      * and filling the rest of opad with the requisite constant. */
     for (i = 0; i < key_length; i++) {
-        hmac->opad[i] = ipad[i] ^ 0x36 ^ 0x5C;
+        opad[i] = ipad[i] ^ 0x36 ^ 0x5C;
     }
-    memset(hmac->opad + key_length, 0x5C, block_size - key_length);
+    memset(opad + key_length, 0x5C, block_size - key_length);
 
     status = psa_hash_setup(&hmac->hash_ctx, hash_alg);
     if (status != PSA_SUCCESS) {
@@ -93,9 +96,22 @@ static psa_status_t psa_hmac_setup_internal(
     }
 
     status = psa_hash_update(&hmac->hash_ctx, ipad, block_size);
+    if (status != PSA_SUCCESS) {
+        goto cleanup;
+    }
+
+    /* Process the opad now rather than keeping it: finishing then only
+     * needs to hash the inner digest. */
+    status = psa_hash_setup(&hmac->outer_ctx, hash_alg);
+    if (status != PSA_SUCCESS) {
+        goto cleanup;
+    }
+
+    status = psa_hash_update(&hmac->outer_ctx, opad, block_size);
 
 cleanup:
     mbedtls_platform_zeroize(ipad, sizeof(ipad));
+    mbedtls_platform_zeroize(opad, sizeof(opad));
 
     return status;
 }
@@ -114,9 +130,7 @@ static psa_status_t psa_hmac_finish_internal(
     size_t mac_size)
 {
     uint8_t tmp[PSA_HASH_MAX_SIZE];
-    psa_algorithm_t hash_alg = hmac->alg;
     size_t hash_size = 0;
-    size_t block_size = PSA_HASH_BLOCK_LENGTH(hash_alg);
     psa_status_t status;
 
     status = psa_hash_finish(&hmac->hash_ctx, tmp, sizeof(tmp), &hash_size);
@@ -125,22 +139,12 @@ static psa_status_t psa_hmac_finish_internal(
     }
     /* From here on, tmp needs to be wiped. */
 
-    status = psa_hash_setup(&hmac->hash_ctx, hash_alg);
-    if (status != PSA_SUCCESS) {
-        goto exit;
-    }
-
-    status = psa_hash_update(&hmac->hash_ctx, hmac->opad, block_size);
+    status = psa_hash_update(&hmac->outer_ctx, tmp, hash_size);
     if (status != PSA_SUCCESS) {
         goto exit;
     }
 
-    status = psa_hash_update(&hmac->hash_ctx, tmp, hash_size);
-    if (status != PSA_SUCCESS) {
-        goto exit;
-    }
-
-    status = psa_hash_finish(&hmac->hash_ctx, tmp, sizeof(tmp), &hash_size);
+    status = psa_hash_finish(&hmac->outer_ctx, tmp, sizeof(tmp), &hash_size);
     if (status != PSA_SUCCESS) {
         goto exit;
     }
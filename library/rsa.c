@@ -448,7 +448,22 @@ int mbedtls_rsa_complete(mbedtls_rsa_context *ctx)
      * Step 3: Basic sanity checks
      */
 
-    return rsa_check_context(ctx, is_priv, 1);
+    if ((ret = rsa_check_context(ctx, is_priv, 1)) != 0) {
+        return ret;
+    }
+
+    /*
+     * Step 4: Precompute R^2 mod N for the public key operation, so that
+     *         keys that are parsed once and used many times, such as trusted
+     *         CA keys, do not pay for it on their first use.
+     */
+
+    if ((ret = mbedtls_mpi_core_get_mont_r2_unsafe(&ctx->RN, &ctx->N)) != 0 ||
+        (ret = mbedtls_mpi_grow(&ctx->RN, ctx->N.n)) != 0) {
+        return MBEDTLS_ERROR_ADD(MBEDTLS_ERR_RSA_BAD_INPUT_DATA, ret);
+    }
+
+    return 0;
 }
 
 int mbedtls_rsa_export_raw(const mbedtls_rsa_context *ctx,
@@ -856,6 +871,58 @@ int mbedtls_rsa_check_pub_priv(const mbedtls_rsa_context *pub,
     return 0;
 }
 
+/*
+ * T = T^65537 mod N, for the most common public exponent.
+ *
+ * The exponent is public, so this is a plain chain of 16 squarings and one
+ * multiplication in the Montgomery domain, without the window table and
+ * the side channel countermeasures of mbedtls_mpi_exp_mod().
+ *
+ * RN holds R^2 mod N, or nothing yet, in which case it is computed here and
+ * kept for the next calls. T must be less than N.
+ */
+static int rsa_public_f4(mbedtls_mpi *T, const mbedtls_mpi *N, mbedtls_mpi *RN)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_mpi_uint mm = mbedtls_mpi_core_montmul_init(N->p);
+    const size_t nlimbs = N->n;
+    const size_t tlimbs = mbedtls_mpi_core_montmul_working_limbs(nlimbs);
+    mbedtls_mpi_uint *A = NULL, *M_T;
+    int i;
+
+    if (RN->p == NULL) {
+        MBEDTLS_MPI_CHK(mbedtls_mpi_core_get_mont_r2_unsafe(RN, N));
+    }
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(RN, nlimbs));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(T, nlimbs));
+
+    A = mbedtls_calloc(nlimbs + tlimbs, ciL);
+    if (A == NULL) {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+    M_T = A + nlimbs;
+
+    /* A = T * R mod N, T = A^(2^16) * R^-(2^16 - 1) mod N */
+    mbedtls_mpi_core_to_mont_rep(A, T->p, N->p, nlimbs, mm, RN->p, M_T);
+    memcpy(T->p, A, nlimbs * ciL);
+    for (i = 0; i < 16; i++) {
+        mbedtls_mpi_core_montmul(T->p, T->p, T->p, nlimbs, N->p, nlimbs, mm,
+                                 M_T);
+    }
+
+    /* T = T * A, then back out of the Montgomery domain */
+    mbedtls_mpi_core_montmul(T->p, T->p, A, nlimbs, N->p, nlimbs, mm, M_T);
+    mbedtls_mpi_core_from_mont_rep(T->p, T->p, N->p, nlimbs, mm, M_T);
+
+    ret = 0;
+
+cleanup:
+    mbedtls_free(A);
+
+    return ret;
+}
+
 /*
  * Do an RSA public key operation
  */
@@ -887,7 +954,12 @@ int mbedtls_rsa_public(mbedtls_rsa_context *ctx,
     }
 
     olen = ctx->len;
-    MBEDTLS_MPI_CHK(mbedtls_mpi_exp_mod(&T, &T, &ctx->E, &ctx->N, &ctx->RN));
+    if (mbedtls_mpi_cmp_int(&ctx->E, 65537) == 0) {
+        MBEDTLS_MPI_CHK(rsa_public_f4(&T, &ctx->N, &ctx->RN));
+    } else {
+        MBEDTLS_MPI_CHK(mbedtls_mpi_exp_mod(&T, &T, &ctx->E, &ctx->N,
+                                            &ctx->RN));
+    }
     MBEDTLS_MPI_CHK(mbedtls_mpi_write_binary(&T, output, olen));
 
 cleanup:
@@ -907,10 +979,13 @@ cleanup:
 }
 
 /*
- * Generate or update blinding values, see section 10 of:
+ * Generate blinding values, see section 10 of:
  *  KOCHER, Paul C. Timing attacks on implementations of Diffie-Hellman, RSA,
  *  DSS, and other systems. In : Advances in Cryptology-CRYPTO'96. Springer
  *  Berlin Heidelberg, 1996. p. 104-113.
+ *
+ * Once generated, the blinding values are updated by squaring, see
+ * mbedtls_rsa_private_batch().
  */
 static int rsa_prepare_blinding(mbedtls_rsa_context *ctx,
                                 int (*f_rng)(void *, unsigned char *, size_t), void *p_rng)
@@ -920,16 +995,6 @@ static int rsa_prepare_blinding(mbedtls_rsa_context *ctx,
 
     mbedtls_mpi_init(&R);
 
-    if (ctx->Vf.p != NULL) {
-        /* We already have blinding values, just update them by squaring */
-        MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&ctx->Vi, &ctx->Vi, &ctx->Vi));
-        MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&ctx->Vi, &ctx->Vi, &ctx->N));
-        MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&ctx->Vf, &ctx->Vf, &ctx->Vf));
-        MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&ctx->Vf, &ctx->Vf, &ctx->N));
-
-        goto cleanup;
-    }
-
     /* Unblinding value: Vf = random number, invertible mod N */
     do {
         if (count++ > 10) {
@@ -970,45 +1035,6 @@ cleanup:
     return ret;
 }
 
-/*
- * Unblind
- * T = T * Vf mod N
- */
-static int rsa_unblind(mbedtls_mpi *T, mbedtls_mpi *Vf, const mbedtls_mpi *N)
-{
-    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    const mbedtls_mpi_uint mm = mbedtls_mpi_core_montmul_init(N->p);
-    const size_t nlimbs = N->n;
-    const size_t tlimbs = mbedtls_mpi_core_montmul_working_limbs(nlimbs);
-    mbedtls_mpi RR, M_T;
-
-    mbedtls_mpi_init(&RR);
-    mbedtls_mpi_init(&M_T);
-
-    MBEDTLS_MPI_CHK(mbedtls_mpi_core_get_mont_r2_unsafe(&RR, N));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&M_T, tlimbs));
-
-    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(T, nlimbs));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(Vf, nlimbs));
-
-    /* T = T * Vf mod N
-     * Reminder: montmul(A, B, N) = A * B * R^-1 mod N
-     * Usually both operands are multiplied by R mod N beforehand (by calling
-     * `to_mont_rep()` on them), yielding a result that's also * R mod N (aka
-     * "in the Montgomery domain"). Here we only multiply one operand by R mod
-     * N, so the result is directly what we want - no need to call
-     * `from_mont_rep()` on it. */
-    mbedtls_mpi_core_to_mont_rep(T->p, T->p, N->p, nlimbs, mm, RR.p, M_T.p);
-    mbedtls_mpi_core_montmul(T->p, T->p, Vf->p, nlimbs, N->p, nlimbs, mm, M_T.p);
-
-cleanup:
-
-    mbedtls_mpi_free(&RR);
-    mbedtls_mpi_free(&M_T);
-
-    return ret;
-}
-
 /*
  * Exponent blinding supposed to prevent side-channel attacks using multiple
  * traces of measurements to recover the RSA key. The more collisions are there,
@@ -1031,13 +1057,24 @@ cleanup:
 #define RSA_EXPONENT_BLINDING 28
 
 /*
- * Do an RSA private key operation
+ * Do one RSA private key operation. The caller holds the context mutex and
+ * provides P1 = P - 1 and Q1 = Q - 1, which only depend on the key and are
+ * therefore shared by all the operations of a batch, and the blinding
+ * values of this operation in Montgomery form: Mi = Vi * R mod N and
+ * Mf = Vf * R mod N. mm and M_T are the Montgomery constant of N and the
+ * working memory for mbedtls_mpi_core_montmul().
  */
-int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
-                        int (*f_rng)(void *, unsigned char *, size_t),
-                        void *p_rng,
-                        const unsigned char *input,
-                        unsigned char *output)
+static int rsa_private_one(mbedtls_rsa_context *ctx,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng,
+                           const mbedtls_mpi *P1,
+                           const mbedtls_mpi *Q1,
+                           const mbedtls_mpi *Mi,
+                           const mbedtls_mpi *Mf,
+                           mbedtls_mpi_uint mm,
+                           mbedtls_mpi_uint *M_T,
+                           const unsigned char *input,
+                           unsigned char *output)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     size_t olen;
@@ -1045,9 +1082,8 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
     /* Temporary holding the result */
     mbedtls_mpi T;
 
-    /* Temporaries holding P-1, Q-1 and the
-     * exponent blinding factor, respectively. */
-    mbedtls_mpi P1, Q1, R;
+    /* Temporary holding the exponent blinding factor. */
+    mbedtls_mpi R;
 
 #if !defined(MBEDTLS_RSA_NO_CRT)
     /* Temporaries holding the results mod p resp. mod q. */
@@ -1065,26 +1101,9 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
      * checked result; should be the same in the end. */
     mbedtls_mpi input_blinded, check_result_blinded;
 
-    if (f_rng == NULL) {
-        return MBEDTLS_ERR_RSA_BAD_INPUT_DATA;
-    }
-
-    if (rsa_check_context(ctx, 1 /* private key checks */,
-                          1 /* blinding on        */) != 0) {
-        return MBEDTLS_ERR_RSA_BAD_INPUT_DATA;
-    }
-
-#if defined(MBEDTLS_THREADING_C)
-    if ((ret = mbedtls_mutex_lock(&ctx->mutex)) != 0) {
-        return ret;
-    }
-#endif
-
     /* MPI Initialization */
     mbedtls_mpi_init(&T);
 
-    mbedtls_mpi_init(&P1);
-    mbedtls_mpi_init(&Q1);
     mbedtls_mpi_init(&R);
 
 #if defined(MBEDTLS_RSA_NO_CRT)
@@ -1111,19 +1130,17 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
 
     /*
      * Blinding
-     * T = T * Vi mod N
+     * T = T * Vi mod N = montmul(T, Vi * R mod N)
      */
-    MBEDTLS_MPI_CHK(rsa_prepare_blinding(ctx, f_rng, p_rng));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&T, &T, &ctx->Vi));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_mod_mpi(&T, &T, &ctx->N));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&T, ctx->N.n));
+    mbedtls_mpi_core_montmul(T.p, T.p, Mi->p, ctx->N.n, ctx->N.p, ctx->N.n,
+                             mm, M_T);
 
     MBEDTLS_MPI_CHK(mbedtls_mpi_copy(&input_blinded, &T));
 
     /*
      * Exponent blinding
      */
-    MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&P1, &ctx->P, 1));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&Q1, &ctx->Q, 1));
 
 #if defined(MBEDTLS_RSA_NO_CRT)
     /*
@@ -1131,7 +1148,7 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
      */
     MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&R, RSA_EXPONENT_BLINDING,
                                             f_rng, p_rng));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&D_blind, &P1, &Q1));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&D_blind, P1, Q1));
     MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&D_blind, &D_blind, &R));
     MBEDTLS_MPI_CHK(mbedtls_mpi_add_mpi(&D_blind, &D_blind, &ctx->D));
 #else
@@ -1140,7 +1157,7 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
      */
     MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&R, RSA_EXPONENT_BLINDING,
                                             f_rng, p_rng));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&DP_blind, &P1, &R));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&DP_blind, P1, &R));
     MBEDTLS_MPI_CHK(mbedtls_mpi_add_mpi(&DP_blind, &DP_blind,
                                         &ctx->DP));
 
@@ -1149,7 +1166,7 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
      */
     MBEDTLS_MPI_CHK(mbedtls_mpi_fill_random(&R, RSA_EXPONENT_BLINDING,
                                             f_rng, p_rng));
-    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&DQ_blind, &Q1, &R));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&DQ_blind, Q1, &R));
     MBEDTLS_MPI_CHK(mbedtls_mpi_add_mpi(&DQ_blind, &DQ_blind,
                                         &ctx->DQ));
 #endif /* MBEDTLS_RSA_NO_CRT */
@@ -1191,22 +1208,16 @@ int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
 
     /*
      * Unblind
-     * T = T * Vf mod N
+     * T = T * Vf mod N = montmul(T, Vf * R mod N)
      */
-    MBEDTLS_MPI_CHK(rsa_unblind(&T, &ctx->Vf, &ctx->N));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&T, ctx->N.n));
+    mbedtls_mpi_core_montmul(T.p, T.p, Mf->p, ctx->N.n, ctx->N.p, ctx->N.n,
+                             mm, M_T);
 
     olen = ctx->len;
     MBEDTLS_MPI_CHK(mbedtls_mpi_write_binary(&T, output, olen));
 
 cleanup:
-#if defined(MBEDTLS_THREADING_C)
-    if (mbedtls_mutex_unlock(&ctx->mutex) != 0) {
-        return MBEDTLS_ERR_THREADING_MUTEX_ERROR;
-    }
-#endif
-
-    mbedtls_mpi_free(&P1);
-    mbedtls_mpi_free(&Q1);
     mbedtls_mpi_free(&R);
 
 #if defined(MBEDTLS_RSA_NO_CRT)
@@ -1225,6 +1236,138 @@ cleanup:
     mbedtls_mpi_free(&check_result_blinded);
     mbedtls_mpi_free(&input_blinded);
 
+    return ret;
+}
+
+/*
+ * Do a batch of RSA private key operations
+ *
+ * Each operation uses the blinding values of the previous one squared, as
+ * successive calls to mbedtls_rsa_private() did. The squaring is done in
+ * Montgomery form, and the blinding values of the context are converted
+ * to and from Montgomery form once per batch instead of being reduced
+ * modulo N after each update. Multiplying by the blinding values in
+ * Montgomery form then needs a single Montgomery multiplication.
+ */
+int mbedtls_rsa_private_batch(mbedtls_rsa_context *ctx,
+                              int (*f_rng)(void *, unsigned char *, size_t),
+                              void *p_rng,
+                              size_t count,
+                              const unsigned char *const input[],
+                              unsigned char *const output[])
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i, nlimbs;
+    mbedtls_mpi_uint mm;
+    int fresh, in_mont = 0;
+
+    /* Temporaries holding P-1 and Q-1, used for exponent blinding. */
+    mbedtls_mpi P1, Q1;
+
+    /* Temporaries holding the blinding values in Montgomery form, and the
+     * working memory of the Montgomery multiplications. */
+    mbedtls_mpi Mi, Mf, M_T;
+
+    if (f_rng == NULL) {
+        return MBEDTLS_ERR_RSA_BAD_INPUT_DATA;
+    }
+
+    if (count != 0 && (input == NULL || output == NULL)) {
+        return MBEDTLS_ERR_RSA_BAD_INPUT_DATA;
+    }
+
+    if (rsa_check_context(ctx, 1 /* private key checks */,
+                          1 /* blinding on        */) != 0) {
+        return MBEDTLS_ERR_RSA_BAD_INPUT_DATA;
+    }
+
+    if (count == 0) {
+        return 0;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    if ((ret = mbedtls_mutex_lock(&ctx->mutex)) != 0) {
+        return ret;
+    }
+#endif
+
+    mbedtls_mpi_init(&P1);
+    mbedtls_mpi_init(&Q1);
+    mbedtls_mpi_init(&Mi);
+    mbedtls_mpi_init(&Mf);
+    mbedtls_mpi_init(&M_T);
+
+    nlimbs = ctx->N.n;
+    mm = mbedtls_mpi_core_montmul_init(ctx->N.p);
+
+    /*
+     * Values that only depend on the key, computed once for the whole batch
+     */
+    MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&P1, &ctx->P, 1));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&Q1, &ctx->Q, 1));
+    /* R^2 mod N is normally precomputed by mbedtls_rsa_complete(). */
+    if (ctx->RN.p == NULL) {
+        MBEDTLS_MPI_CHK(mbedtls_mpi_core_get_mont_r2_unsafe(&ctx->RN, &ctx->N));
+    }
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&ctx->RN, nlimbs));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&M_T,
+                                     mbedtls_mpi_core_montmul_working_limbs(nlimbs)));
+
+    /*
+     * Blinding values: generate them on first use, then convert them to
+     * Montgomery form for the batch
+     */
+    fresh = (ctx->Vf.p == NULL);
+    if (fresh) {
+        MBEDTLS_MPI_CHK(rsa_prepare_blinding(ctx, f_rng, p_rng));
+    }
+
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&ctx->Vi, nlimbs));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&ctx->Vf, nlimbs));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&Mi, nlimbs));
+    MBEDTLS_MPI_CHK(mbedtls_mpi_grow(&Mf, nlimbs));
+    mbedtls_mpi_core_to_mont_rep(Mi.p, ctx->Vi.p, ctx->N.p, nlimbs, mm,
+                                 ctx->RN.p, M_T.p);
+    mbedtls_mpi_core_to_mont_rep(Mf.p, ctx->Vf.p, ctx->N.p, nlimbs, mm,
+                                 ctx->RN.p, M_T.p);
+    in_mont = 1;
+
+    for (i = 0; i < count; i++) {
+        /* Fresh blinding values are used once as they are */
+        if (i != 0 || !fresh) {
+            mbedtls_mpi_core_montmul(Mi.p, Mi.p, Mi.p, nlimbs,
+                                     ctx->N.p, nlimbs, mm, M_T.p);
+            mbedtls_mpi_core_montmul(Mf.p, Mf.p, Mf.p, nlimbs,
+                                     ctx->N.p, nlimbs, mm, M_T.p);
+        }
+
+        MBEDTLS_MPI_CHK(rsa_private_one(ctx, f_rng, p_rng, &P1, &Q1,
+                                        &Mi, &Mf, mm, M_T.p,
+                                        input[i], output[i]));
+    }
+
+cleanup:
+    /* Store the last blinding values used, even on failure, so that they
+     * are never used again. */
+    if (in_mont) {
+        mbedtls_mpi_core_from_mont_rep(ctx->Vi.p, Mi.p, ctx->N.p, nlimbs,
+                                       mm, M_T.p);
+        mbedtls_mpi_core_from_mont_rep(ctx->Vf.p, Mf.p, ctx->N.p, nlimbs,
+                                       mm, M_T.p);
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    if (mbedtls_mutex_unlock(&ctx->mutex) != 0) {
+        return MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+    }
+#endif
+
+    mbedtls_mpi_free(&P1);
+    mbedtls_mpi_free(&Q1);
+    mbedtls_mpi_free(&Mi);
+    mbedtls_mpi_free(&Mf);
+    mbedtls_mpi_free(&M_T);
+
     if (ret != 0 && ret >= -0x007f) {
         return MBEDTLS_ERROR_ADD(MBEDTLS_ERR_RSA_PRIVATE_FAILED, ret);
     }
@@ -1232,6 +1375,18 @@ cleanup:
     return ret;
 }
 
+/*
+ * Do an RSA private key operation
+ */
+int mbedtls_rsa_private(mbedtls_rsa_context *ctx,
+                        int (*f_rng)(void *, unsigned char *, size_t),
+                        void *p_rng,
+                        const unsigned char *input,
+                        unsigned char *output)
+{
+    return mbedtls_rsa_private_batch(ctx, f_rng, p_rng, 1, &input, &output);
+}
+
 #if defined(MBEDTLS_PKCS1_V21)
 /**
  * Generate and apply the MGF1 operation (from PKCS#1 v2.1) to a buffer.
@@ -39,11 +39,25 @@
 #include "mbedtls/sha256.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
+#include "cpu_features.h"
 
 #include <string.h>
 
 #include "mbedtls/platform.h"
 
+/*
+ * Multi-buffer hashing with AVX2 on x86-64: 8 independent messages at once,
+ * one per 32-bit lane. The functions that use AVX2 have a target attribute,
+ * so the library does not need to be built with -mavx2. They are only
+ * called if the CPU and the OS support AVX2.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64) && !defined(MBEDTLS_SHA256_ALT) && \
+    !defined(MBEDTLS_SHA256_PROCESS_ALT)
+#define MBEDTLS_SHA256_BATCH_AVX2
+#include <immintrin.h>
+#endif
+
 #if defined(__aarch64__)
 
 #  if defined(MBEDTLS_SHA256_USE_A64_CRYPTO_IF_PRESENT) || \
@@ -731,6 +745,200 @@ exit:
     return ret;
 }
 
+#if defined(MBEDTLS_SHA256_BATCH_AVX2)
+
+#define SHA256_MB_LANES 8
+
+/* Below this number of messages, hashing them one by one is faster. */
+#define SHA256_MB_MIN_COUNT 3
+
+#define MB_ADD(a, b)    _mm256_add_epi32(a, b)
+#define MB_XOR(a, b)    _mm256_xor_si256(a, b)
+#define MB_AND(a, b)    _mm256_and_si256(a, b)
+#define MB_OR(a, b)     _mm256_or_si256(a, b)
+#define MB_SHR(x, n)    _mm256_srli_epi32(x, n)
+#define MB_ROTR(x, n)   MB_OR(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+#define MB_S0(x) MB_XOR(MB_XOR(MB_ROTR(x, 7), MB_ROTR(x, 18)), MB_SHR(x, 3))
+#define MB_S1(x) MB_XOR(MB_XOR(MB_ROTR(x, 17), MB_ROTR(x, 19)), MB_SHR(x, 10))
+#define MB_S2(x) MB_XOR(MB_XOR(MB_ROTR(x, 2), MB_ROTR(x, 13)), MB_ROTR(x, 22))
+#define MB_S3(x) MB_XOR(MB_XOR(MB_ROTR(x, 6), MB_ROTR(x, 11)), MB_ROTR(x, 25))
+
+#define MB_F0(x, y, z) MB_OR(MB_AND(x, y), MB_AND(z, MB_OR(x, y)))
+#define MB_F1(x, y, z) MB_XOR(z, MB_AND(x, MB_XOR(y, z)))
+
+/*
+ * Process one 64-byte block of each of the 8 messages. Lane l of state[i]
+ * is the i-th state word of the message in lane l.
+ */
+__attribute__((target("avx2")))
+static void sha256_mb_process_avx2(uint32_t state[8][SHA256_MB_LANES],
+                                   const unsigned char *const data[SHA256_MB_LANES])
+{
+    __m256i W[16], A[8], temp1, temp2;
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        A[i] = _mm256_loadu_si256((const __m256i *) state[i]);
+    }
+
+    for (i = 0; i < 64; i++) {
+        if (i < 16) {
+            W[i] = _mm256_setr_epi32(
+                (int) MBEDTLS_GET_UINT32_BE(data[0], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[1], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[2], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[3], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[4], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[5], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[6], 4 * i),
+                (int) MBEDTLS_GET_UINT32_BE(data[7], 4 * i));
+        } else {
+            W[i & 15] = MB_ADD(MB_ADD(MB_S1(W[(i - 2) & 15]), W[(i - 7) & 15]),
+                               MB_ADD(MB_S0(W[(i - 15) & 15]), W[i & 15]));
+        }
+
+        temp1 = MB_ADD(MB_ADD(A[7], MB_S3(A[4])),
+                       MB_ADD(MB_F1(A[4], A[5], A[6]),
+                              MB_ADD(_mm256_set1_epi32((int) K[i]), W[i & 15])));
+        temp2 = MB_ADD(MB_S2(A[0]), MB_F0(A[0], A[1], A[2]));
+
+        A[7] = A[6];
+        A[6] = A[5];
+        A[5] = A[4];
+        A[4] = MB_ADD(A[3], temp1);
+        A[3] = A[2];
+        A[2] = A[1];
+        A[1] = A[0];
+        A[0] = MB_ADD(temp1, temp2);
+    }
+
+    for (i = 0; i < 8; i++) {
+        _mm256_storeu_si256((__m256i *) state[i],
+                            MB_ADD(A[i], _mm256_loadu_si256((const __m256i *) state[i])));
+    }
+}
+
+/*
+ * A message being hashed in one lane: first the complete blocks of the
+ * input, then one or two padded blocks built in tail.
+ */
+typedef struct {
+    size_t job;
+    const unsigned char *input;
+    size_t blocks;
+    unsigned char tail[2 * SHA256_BLOCK_SIZE];
+    size_t tail_blocks;
+} sha256_mb_lane;
+
+static void sha256_mb_lane_start(sha256_mb_lane *lane, size_t job,
+                                 const unsigned char *input, size_t ilen)
+{
+    size_t used = ilen % SHA256_BLOCK_SIZE;
+
+    lane->job = job;
+    lane->input = input;
+    lane->blocks = ilen / SHA256_BLOCK_SIZE;
+    lane->tail_blocks = (used < 56) ? 1 : 2;
+
+    memset(lane->tail, 0, sizeof(lane->tail));
+    if (used != 0) {
+        memcpy(lane->tail, input + ilen - used, used);
+    }
+    lane->tail[used] = 0x80;
+    MBEDTLS_PUT_UINT32_BE((uint32_t) (((uint64_t) ilen) >> 29),
+                          lane->tail, lane->tail_blocks * SHA256_BLOCK_SIZE - 8);
+    MBEDTLS_PUT_UINT32_BE((uint32_t) (ilen << 3),
+                          lane->tail, lane->tail_blocks * SHA256_BLOCK_SIZE - 4);
+}
+
+static int sha256_batch_avx2(size_t count,
+                             const unsigned char *const input[],
+                             const size_t ilen[],
+                             unsigned char *const output[],
+                             int is224)
+{
+    static const unsigned char idle_block[SHA256_BLOCK_SIZE] = { 0 };
+    uint32_t state[8][SHA256_MB_LANES];
+    const unsigned char *data[SHA256_MB_LANES];
+    sha256_mb_lane lanes[SHA256_MB_LANES];
+    mbedtls_sha256_context ctx;
+    size_t next = 0, active = 0;
+    unsigned int i, l;
+
+    /* Take the initial state from a context rather than repeating it */
+    mbedtls_sha256_init(&ctx);
+    (void) mbedtls_sha256_starts(&ctx, is224);
+
+    for (l = 0; l < SHA256_MB_LANES; l++) {
+        if (next < count) {
+            sha256_mb_lane_start(&lanes[l], next, input[next], ilen[next]);
+            next++;
+            active++;
+        } else {
+            lanes[l].job = count;
+        }
+        for (i = 0; i < 8; i++) {
+            state[i][l] = ctx.state[i];
+        }
+    }
+
+    while (active > 0) {
+        for (l = 0; l < SHA256_MB_LANES; l++) {
+            if (lanes[l].job == count) {
+                data[l] = idle_block;
+            } else if (lanes[l].blocks > 0) {
+                data[l] = lanes[l].input;
+            } else {
+                data[l] = lanes[l].tail;
+            }
+        }
+
+        sha256_mb_process_avx2(state, data);
+
+        for (l = 0; l < SHA256_MB_LANES; l++) {
+            sha256_mb_lane *lane = &lanes[l];
+
+            if (lane->job == count) {
+                continue;
+            }
+            if (lane->blocks > 0) {
+                lane->input += SHA256_BLOCK_SIZE;
+                lane->blocks--;
+                continue;
+            }
+            if (--lane->tail_blocks > 0) {
+                memmove(lane->tail, lane->tail + SHA256_BLOCK_SIZE,
+                        SHA256_BLOCK_SIZE);
+                continue;
+            }
+
+            /* The message in this lane is complete */
+            for (i = 0; i < (is224 ? 7u : 8u); i++) {
+                MBEDTLS_PUT_UINT32_BE(state[i][l], output[lane->job], 4 * i);
+            }
+
+            if (next < count) {
+                sha256_mb_lane_start(lane, next, input[next], ilen[next]);
+                next++;
+            } else {
+                lane->job = count;
+                active--;
+            }
+            for (i = 0; i < 8; i++) {
+                state[i][l] = ctx.state[i];
+            }
+        }
+    }
+
+    mbedtls_sha256_free(&ctx);
+    mbedtls_platform_zeroize(state, sizeof(state));
+    mbedtls_platform_zeroize(lanes, sizeof(lanes));
+
+    return 0;
+}
+#endif /* MBEDTLS_SHA256_BATCH_AVX2 */
+
 #endif /* !MBEDTLS_SHA256_ALT */
 
 /*
@@ -778,6 +986,47 @@ exit:
     return ret;
 }
 
+/*
+ * output[i] = SHA-256( input[i] ) for i in 0..count-1
+ */
+int mbedtls_sha256_batch(size_t count,
+                         const unsigned char *const input[],
+                         const size_t ilen[],
+                         unsigned char *const output[],
+                         int is224)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+#if defined(MBEDTLS_SHA224_C) && defined(MBEDTLS_SHA256_C)
+    if (is224 != 0 && is224 != 1) {
+        return MBEDTLS_ERR_SHA256_BAD_INPUT_DATA;
+    }
+#elif defined(MBEDTLS_SHA256_C)
+    if (is224 != 0) {
+        return MBEDTLS_ERR_SHA256_BAD_INPUT_DATA;
+    }
+#else /* defined MBEDTLS_SHA224_C only */
+    if (is224 == 0) {
+        return MBEDTLS_ERR_SHA256_BAD_INPUT_DATA;
+    }
+#endif
+
+#if defined(MBEDTLS_SHA256_BATCH_AVX2)
+    if (count >= SHA256_MB_MIN_COUNT && mbedtls_cpu_has_avx2()) {
+        return sha256_batch_avx2(count, input, ilen, output, is224);
+    }
+#endif
+
+    for (i = 0; i < count; i++) {
+        if ((ret = mbedtls_sha256(input[i], ilen[i], output[i], is224)) != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 /*
  * FIPS-180-2 test vectors
@@ -17,6 +17,7 @@
 #include "mbedtls/sha3.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
+#include "cpu_features.h"
 
 #include <string.h>
 
@@ -24,7 +25,29 @@
 #include "mbedtls/platform.h"
 #endif /* MBEDTLS_SELF_TEST */
 
+/*
+ * Four-way parallel permutation for mbedtls_sha3_x4().
+ *
+ * With AVX2 on x86-64, each 256-bit register holds the same lane of four
+ * states. The function that uses AVX2 has a target attribute, so the
+ * library does not need to be built with -mavx2, and it is only called if
+ * the CPU and the OS support AVX2.
+ *
+ * With the Armv8.2 SHA3 extension, two states are processed at a time in
+ * 128-bit registers. This is only enabled if the compiler targets the
+ * extension, e.g. with -march=armv8.2-a+sha3.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64)
+#define MBEDTLS_SHA3_X4_AVX2
+#include <immintrin.h>
+#elif defined(MBEDTLS_ARCH_IS_ARM64) && defined(__ARM_FEATURE_SHA3)
+#define MBEDTLS_SHA3_X4_A64
+#include <arm_neon.h>
+#endif
+
 #define XOR_BYTE 0x6
+#define XOR_BYTE_SHAKE 0x1F
 
 typedef struct mbedtls_sha3_family_functions {
     mbedtls_sha3_id id;
@@ -37,11 +60,13 @@ mbedtls_sha3_family_functions;
 /*
  * List of supported SHA-3 families
  */
-static mbedtls_sha3_family_functions sha3_families[] = {
+static const mbedtls_sha3_family_functions sha3_families[] = {
     { MBEDTLS_SHA3_224,      1152, 224 },
     { MBEDTLS_SHA3_256,      1088, 256 },
     { MBEDTLS_SHA3_384,       832, 384 },
     { MBEDTLS_SHA3_512,       576, 512 },
+    { MBEDTLS_SHA3_SHAKE128, 1344,   0 },
+    { MBEDTLS_SHA3_SHAKE256, 1088,   0 },
     { MBEDTLS_SHA3_NONE, 0, 0 }
 };
 
@@ -54,107 +79,117 @@ static const uint64_t rc[24] = {
     0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
 };
 
-static const uint8_t rho[24] = {
-    1, 62, 28, 27, 36, 44,  6, 55, 20,
-    3, 10, 43, 25, 39, 41, 45, 15,
-    21,  8, 18,  2, 61, 56, 14
-};
-
-static const uint8_t pi[24] = {
-    10,  7, 11, 17, 18, 3,  5, 16,  8, 21, 24, 4,
-    15, 23, 19, 13, 12, 2, 20, 14, 22,  9,  6, 1,
-};
-
 #define ROT64(x, y) (((x) << (y)) | ((x) >> (64U - (y))))
 #define ABSORB(ctx, idx, v) do { ctx->state[(idx) >> 3] ^= ((uint64_t) (v)) << (((idx) & 0x7) << 3); \
 } while (0)
 #define SQUEEZE(ctx, idx) ((uint8_t) (ctx->state[(idx) >> 3] >> (((idx) & 0x7) << 3)))
-#define SWAP(x, y) do { uint64_t tmp = (x); (x) = (y); (y) = tmp; } while (0)
+
+/*
+ * One round of Keccak-f[1600] without iota, fully unrolled, with theta,
+ * rho and pi merged so that each lane of the state A is read and written
+ * once per round. B, C and D are temporaries.
+ *
+ * The round is written in terms of the operations below, so that it can
+ * be instantiated for 64-bit integers and for vectors of lanes of
+ * independent states. They map to single instructions with the Armv8.2
+ * SHA3 extension.
+ *
+ *  K_XOR(a, b)         a ^ b
+ *  K_XOR3(a, b, c)     a ^ b ^ c               (EOR3)
+ *  K_RAX1(a, b)        a ^ ROT64(b, 1)         (RAX1)
+ *  K_XAR(a, b, n)      ROT64(a ^ b, n)         (XAR)
+ *  K_BCAX(a, b, c)     a ^ (b & ~c)            (BCAX)
+ */
+#define KECCAK_ROUND(A, B, C, D)                            \
+    C[0] = K_XOR3(K_XOR3(A[0], A[5], A[10]), A[15], A[20]); \
+    C[1] = K_XOR3(K_XOR3(A[1], A[6], A[11]), A[16], A[21]); \
+    C[2] = K_XOR3(K_XOR3(A[2], A[7], A[12]), A[17], A[22]); \
+    C[3] = K_XOR3(K_XOR3(A[3], A[8], A[13]), A[18], A[23]); \
+    C[4] = K_XOR3(K_XOR3(A[4], A[9], A[14]), A[19], A[24]); \
+    D[0] = K_RAX1(C[4], C[1]);                              \
+    D[1] = K_RAX1(C[0], C[2]);                              \
+    D[2] = K_RAX1(C[1], C[3]);                              \
+    D[3] = K_RAX1(C[2], C[4]);                              \
+    D[4] = K_RAX1(C[3], C[0]);                              \
+    B[0] = K_XOR(A[0], D[0]);                               \
+    B[10] = K_XAR(A[1], D[1], 1);                           \
+    B[20] = K_XAR(A[2], D[2], 62);                          \
+    B[5] = K_XAR(A[3], D[3], 28);                           \
+    B[15] = K_XAR(A[4], D[4], 27);                          \
+    B[16] = K_XAR(A[5], D[0], 36);                          \
+    B[1] = K_XAR(A[6], D[1], 44);                           \
+    B[11] = K_XAR(A[7], D[2], 6);                           \
+    B[21] = K_XAR(A[8], D[3], 55);                          \
+    B[6] = K_XAR(A[9], D[4], 20);                           \
+    B[7] = K_XAR(A[10], D[0], 3);                           \
+    B[17] = K_XAR(A[11], D[1], 10);                         \
+    B[2] = K_XAR(A[12], D[2], 43);                          \
+    B[12] = K_XAR(A[13], D[3], 25);                         \
+    B[22] = K_XAR(A[14], D[4], 39);                         \
+    B[23] = K_XAR(A[15], D[0], 41);                         \
+    B[8] = K_XAR(A[16], D[1], 45);                          \
+    B[18] = K_XAR(A[17], D[2], 15);                         \
+    B[3] = K_XAR(A[18], D[3], 21);                          \
+    B[13] = K_XAR(A[19], D[4], 8);                          \
+    B[14] = K_XAR(A[20], D[0], 18);                         \
+    B[24] = K_XAR(A[21], D[1], 2);                          \
+    B[9] = K_XAR(A[22], D[2], 61);                          \
+    B[19] = K_XAR(A[23], D[3], 56);                         \
+    B[4] = K_XAR(A[24], D[4], 14);                          \
+    A[0] = K_BCAX(B[0], B[2], B[1]);                        \
+    A[1] = K_BCAX(B[1], B[3], B[2]);                        \
+    A[2] = K_BCAX(B[2], B[4], B[3]);                        \
+    A[3] = K_BCAX(B[3], B[0], B[4]);                        \
+    A[4] = K_BCAX(B[4], B[1], B[0]);                        \
+    A[5] = K_BCAX(B[5], B[7], B[6]);                        \
+    A[6] = K_BCAX(B[6], B[8], B[7]);                        \
+    A[7] = K_BCAX(B[7], B[9], B[8]);                        \
+    A[8] = K_BCAX(B[8], B[5], B[9]);                        \
+    A[9] = K_BCAX(B[9], B[6], B[5]);                        \
+    A[10] = K_BCAX(B[10], B[12], B[11]);                    \
+    A[11] = K_BCAX(B[11], B[13], B[12]);                    \
+    A[12] = K_BCAX(B[12], B[14], B[13]);                    \
+    A[13] = K_BCAX(B[13], B[10], B[14]);                    \
+    A[14] = K_BCAX(B[14], B[11], B[10]);                    \
+    A[15] = K_BCAX(B[15], B[17], B[16]);                    \
+    A[16] = K_BCAX(B[16], B[18], B[17]);                    \
+    A[17] = K_BCAX(B[17], B[19], B[18]);                    \
+    A[18] = K_BCAX(B[18], B[15], B[19]);                    \
+    A[19] = K_BCAX(B[19], B[16], B[15]);                    \
+    A[20] = K_BCAX(B[20], B[22], B[21]);                    \
+    A[21] = K_BCAX(B[21], B[23], B[22]);                    \
+    A[22] = K_BCAX(B[22], B[24], B[23]);                    \
+    A[23] = K_BCAX(B[23], B[20], B[24]);                    \
+    A[24] = K_BCAX(B[24], B[21], B[20]);
+
+#define K_XOR(a, b)         ((a) ^ (b))
+#define K_XOR3(a, b, c)     ((a) ^ (b) ^ (c))
+#define K_RAX1(a, b)        ((a) ^ ROT64((b), 1))
+#define K_XAR(a, b, n)      ROT64(((a) ^ (b)), n)
+#define K_BCAX(a, b, c)     ((a) ^ ((b) & ~(c)))
 
 /* The permutation function.  */
 static void keccak_f1600(mbedtls_sha3_context *ctx)
 {
-    uint64_t lane[5];
-    uint64_t *s = ctx->state;
-    int i;
-
-    for (int round = 0; round < 24; round++) {
-        uint64_t t;
-
-        /* Theta */
-        lane[0] = s[0] ^ s[5] ^ s[10] ^ s[15] ^ s[20];
-        lane[1] = s[1] ^ s[6] ^ s[11] ^ s[16] ^ s[21];
-        lane[2] = s[2] ^ s[7] ^ s[12] ^ s[17] ^ s[22];
-        lane[3] = s[3] ^ s[8] ^ s[13] ^ s[18] ^ s[23];
-        lane[4] = s[4] ^ s[9] ^ s[14] ^ s[19] ^ s[24];
-
-        t = lane[4] ^ ROT64(lane[1], 1);
-        s[0] ^= t; s[5] ^= t; s[10] ^= t; s[15] ^= t; s[20] ^= t;
-
-        t = lane[0] ^ ROT64(lane[2], 1);
-        s[1] ^= t; s[6] ^= t; s[11] ^= t; s[16] ^= t; s[21] ^= t;
-
-        t = lane[1] ^ ROT64(lane[3], 1);
-        s[2] ^= t; s[7] ^= t; s[12] ^= t; s[17] ^= t; s[22] ^= t;
+    uint64_t A[25], B[25], C[5], D[5];
+    int round;
 
-        t = lane[2] ^ ROT64(lane[4], 1);
-        s[3] ^= t; s[8] ^= t; s[13] ^= t; s[18] ^= t; s[23] ^= t;
+    memcpy(A, ctx->state, sizeof(A));
 
-        t = lane[3] ^ ROT64(lane[0], 1);
-        s[4] ^= t; s[9] ^= t; s[14] ^= t; s[19] ^= t; s[24] ^= t;
-
-        /* Rho */
-        for (i = 1; i < 25; i++) {
-            s[i] = ROT64(s[i], rho[i-1]);
-        }
-
-        /* Pi */
-        t = s[1];
-        for (i = 0; i < 24; i++) {
-            SWAP(s[pi[i]], t);
-        }
-
-        /* Chi */
-        lane[0] = s[0]; lane[1] = s[1]; lane[2] = s[2]; lane[3] = s[3]; lane[4] = s[4];
-        s[0] ^= (~lane[1]) & lane[2];
-        s[1] ^= (~lane[2]) & lane[3];
-        s[2] ^= (~lane[3]) & lane[4];
-        s[3] ^= (~lane[4]) & lane[0];
-        s[4] ^= (~lane[0]) & lane[1];
-
-        lane[0] = s[5]; lane[1] = s[6]; lane[2] = s[7]; lane[3] = s[8]; lane[4] = s[9];
-        s[5] ^= (~lane[1]) & lane[2];
-        s[6] ^= (~lane[2]) & lane[3];
-        s[7] ^= (~lane[3]) & lane[4];
-        s[8] ^= (~lane[4]) & lane[0];
-        s[9] ^= (~lane[0]) & lane[1];
-
-        lane[0] = s[10]; lane[1] = s[11]; lane[2] = s[12]; lane[3] = s[13]; lane[4] = s[14];
-        s[10] ^= (~lane[1]) & lane[2];
-        s[11] ^= (~lane[2]) & lane[3];
-        s[12] ^= (~lane[3]) & lane[4];
-        s[13] ^= (~lane[4]) & lane[0];
-        s[14] ^= (~lane[0]) & lane[1];
-
-        lane[0] = s[15]; lane[1] = s[16]; lane[2] = s[17]; lane[3] = s[18]; lane[4] = s[19];
-        s[15] ^= (~lane[1]) & lane[2];
-        s[16] ^= (~lane[2]) & lane[3];
-        s[17] ^= (~lane[3]) & lane[4];
-        s[18] ^= (~lane[4]) & lane[0];
-        s[19] ^= (~lane[0]) & lane[1];
-
-        lane[0] = s[20]; lane[1] = s[21]; lane[2] = s[22]; lane[3] = s[23]; lane[4] = s[24];
-        s[20] ^= (~lane[1]) & lane[2];
-        s[21] ^= (~lane[2]) & lane[3];
-        s[22] ^= (~lane[3]) & lane[4];
-        s[23] ^= (~lane[4]) & lane[0];
-        s[24] ^= (~lane[0]) & lane[1];
-
-        /* Iota */
-        s[0] ^= rc[round];
+    for (round = 0; round < 24; round++) {
+        KECCAK_ROUND(A, B, C, D);
+        A[0] ^= rc[round];
     }
+
+    memcpy(ctx->state, A, sizeof(A));
 }
 
+#undef K_XOR
+#undef K_XOR3
+#undef K_RAX1
+#undef K_XAR
+#undef K_BCAX
+
 void mbedtls_sha3_init(mbedtls_sha3_context *ctx)
 {
     memset(ctx, 0, sizeof(mbedtls_sha3_context));
@@ -178,17 +213,24 @@ void mbedtls_sha3_clone(mbedtls_sha3_context *dst,
 /*
  * SHA-3 context setup
  */
-int mbedtls_sha3_starts(mbedtls_sha3_context *ctx, mbedtls_sha3_id id)
+static const mbedtls_sha3_family_functions *sha3_family(mbedtls_sha3_id id)
 {
-    mbedtls_sha3_family_functions *p = NULL;
+    const mbedtls_sha3_family_functions *p;
 
     for (p = sha3_families; p->id != MBEDTLS_SHA3_NONE; p++) {
         if (p->id == id) {
-            break;
+            return p;
         }
     }
 
-    if (p->id == MBEDTLS_SHA3_NONE) {
+    return NULL;
+}
+
+int mbedtls_sha3_starts(mbedtls_sha3_context *ctx, mbedtls_sha3_id id)
+{
+    const mbedtls_sha3_family_functions *p = sha3_family(id);
+
+    if (p == NULL) {
         return MBEDTLS_ERR_SHA3_BAD_INPUT_DATA;
     }
 
@@ -197,6 +239,7 @@ int mbedtls_sha3_starts(mbedtls_sha3_context *ctx, mbedtls_sha3_id id)
 
     memset(ctx->state, 0, sizeof(ctx->state));
     ctx->index = 0;
+    ctx->squeezing = 0;
 
     return 0;
 }
@@ -208,42 +251,87 @@ int mbedtls_sha3_update(mbedtls_sha3_context *ctx,
                         const uint8_t *input,
                         size_t ilen)
 {
-    if (ilen >= 8) {
-        // 8-byte align index
-        int align_bytes = 8 - (ctx->index % 8);
-        if (align_bytes) {
-            for (; align_bytes > 0; align_bytes--) {
-                ABSORB(ctx, ctx->index, *input++);
-                ilen--;
-                ctx->index++;
-            }
-            if ((ctx->index = ctx->index % ctx->max_block_size) == 0) {
-                keccak_f1600(ctx);
-            }
+    if (ctx->squeezing) {
+        return MBEDTLS_ERR_SHA3_BAD_INPUT_DATA;
+    }
+
+    /* Complete a partial lane. The block size is a multiple of 8, so the
+     * block cannot end in the middle of a lane. */
+    while (ilen > 0 && (ctx->index & 0x7) != 0) {
+        ABSORB(ctx, ctx->index, *input++);
+        ilen--;
+        if ((ctx->index = ctx->index + 1) == ctx->max_block_size) {
+            keccak_f1600(ctx);
+            ctx->index = 0;
         }
+    }
 
-        // process input in 8-byte chunks
-        while (ilen >= 8) {
-            ABSORB(ctx, ctx->index, MBEDTLS_GET_UINT64_LE(input, 0));
-            input += 8;
-            ilen -= 8;
-            if ((ctx->index = (ctx->index + 8) % ctx->max_block_size) == 0) {
-                keccak_f1600(ctx);
-            }
+    /* Process input in 8-byte lanes */
+    while (ilen >= 8) {
+        ctx->state[ctx->index >> 3] ^= MBEDTLS_GET_UINT64_LE(input, 0);
+        input += 8;
+        ilen -= 8;
+        if ((ctx->index = ctx->index + 8) == ctx->max_block_size) {
+            keccak_f1600(ctx);
+            ctx->index = 0;
         }
     }
 
-    // handle remaining bytes
+    /* Handle remaining bytes, which do not fill a lane */
     while (ilen-- > 0) {
         ABSORB(ctx, ctx->index, *input++);
-        if ((ctx->index = (ctx->index + 1) % ctx->max_block_size) == 0) {
-            keccak_f1600(ctx);
-        }
+        ctx->index++;
     }
 
     return 0;
 }
 
+/*
+ * Pad the input and switch to the squeezing phase. After this, index is
+ * the number of bytes of the current block that were already output.
+ */
+static void sha3_pad(mbedtls_sha3_context *ctx)
+{
+    ABSORB(ctx, ctx->index, ctx->olen > 0 ? XOR_BYTE : XOR_BYTE_SHAKE);
+    ABSORB(ctx, ctx->max_block_size - 1, 0x80);
+    keccak_f1600(ctx);
+    ctx->index = 0;
+    ctx->squeezing = 1;
+}
+
+static void sha3_squeeze(mbedtls_sha3_context *ctx,
+                         uint8_t *output, size_t olen)
+{
+    size_t n;
+
+    while (olen > 0) {
+        if (ctx->index == ctx->max_block_size) {
+            keccak_f1600(ctx);
+            ctx->index = 0;
+        }
+
+        n = ctx->max_block_size - ctx->index;
+        if (n > olen) {
+            n = olen;
+        }
+        olen -= n;
+
+        for (; n > 0 && (ctx->index & 0x7) != 0; n--) {
+            *output++ = SQUEEZE(ctx, ctx->index);
+            ctx->index++;
+        }
+        for (; n >= 8; n -= 8) {
+            MBEDTLS_PUT_UINT64_LE(ctx->state[ctx->index >> 3], output, 0);
+            output += 8;
+            ctx->index += 8;
+        }
+        for (; n > 0; n--) {
+            *output++ = SQUEEZE(ctx, ctx->index);
+            ctx->index++;
+        }
+    }
+}
+
 int mbedtls_sha3_finish(mbedtls_sha3_context *ctx,
                         uint8_t *output, size_t olen)
 {
@@ -258,18 +346,10 @@ int mbedtls_sha3_finish(mbedtls_sha3_context *ctx,
         olen = ctx->olen;
     }
 
-    ABSORB(ctx, ctx->index, XOR_BYTE);
-    ABSORB(ctx, ctx->max_block_size - 1, 0x80);
-    keccak_f1600(ctx);
-    ctx->index = 0;
-
-    while (olen-- > 0) {
-        *output++ = SQUEEZE(ctx, ctx->index);
-
-        if ((ctx->index = (ctx->index + 1) % ctx->max_block_size) == 0) {
-            keccak_f1600(ctx);
-        }
+    if (!ctx->squeezing) {
+        sha3_pad(ctx);
     }
+    sha3_squeeze(ctx, output, olen);
 
     ret = 0;
 
@@ -278,6 +358,22 @@ exit:
     return ret;
 }
 
+int mbedtls_sha3_squeeze(mbedtls_sha3_context *ctx,
+                         uint8_t *output, size_t olen)
+{
+    /* Only SHAKE has a variable output length */
+    if (ctx->olen > 0 || ctx->max_block_size == 0) {
+        return MBEDTLS_ERR_SHA3_BAD_INPUT_DATA;
+    }
+
+    if (!ctx->squeezing) {
+        sha3_pad(ctx);
+    }
+    sha3_squeeze(ctx, output, olen);
+
+    return 0;
+}
+
 /*
  * output = SHA-3( input buffer )
  */
@@ -308,6 +404,184 @@ exit:
     return ret;
 }
 
+#if defined(MBEDTLS_SHA3_X4_AVX2) || defined(MBEDTLS_SHA3_X4_A64)
+
+#if defined(MBEDTLS_SHA3_X4_AVX2)
+
+static int sha3_x4_has_simd(void)
+{
+    return mbedtls_cpu_has_avx2();
+}
+
+#define X4_ROL(x, n)        _mm256_or_si256(_mm256_slli_epi64(x, n), \
+                                            _mm256_srli_epi64(x, 64 - (n)))
+
+#define K_XOR(a, b)         _mm256_xor_si256(a, b)
+#define K_XOR3(a, b, c)     K_XOR(K_XOR(a, b), c)
+#define K_RAX1(a, b)        K_XOR(a, X4_ROL(b, 1))
+#define K_XAR(a, b, n)      X4_ROL(K_XOR(a, b), n)
+#define K_BCAX(a, b, c)     K_XOR(a, _mm256_andnot_si256(c, b))
+
+/* Lane i of state j is state[i][j]. */
+__attribute__((target("avx2")))
+static void keccak_f1600_x4(uint64_t state[25][4])
+{
+    __m256i A[25], B[25], C[5], D[5];
+    int i, round;
+
+    for (i = 0; i < 25; i++) {
+        A[i] = _mm256_loadu_si256((const __m256i *) state[i]);
+    }
+
+    for (round = 0; round < 24; round++) {
+        KECCAK_ROUND(A, B, C, D);
+        A[0] = K_XOR(A[0], _mm256_set1_epi64x((long long) rc[round]));
+    }
+
+    for (i = 0; i < 25; i++) {
+        _mm256_storeu_si256((__m256i *) state[i], A[i]);
+    }
+}
+
+#undef X4_ROL
+
+#else /* MBEDTLS_SHA3_X4_A64 */
+
+static int sha3_x4_has_simd(void)
+{
+    return 1;
+}
+
+#define K_XOR(a, b)         veorq_u64(a, b)
+#define K_XOR3(a, b, c)     veor3q_u64(a, b, c)
+#define K_RAX1(a, b)        vrax1q_u64(a, b)
+#define K_XAR(a, b, n)      vxarq_u64(a, b, 64 - (n))
+#define K_BCAX(a, b, c)     vbcaxq_u64(a, b, c)
+
+/* Lane i of state j is state[i][j]. */
+static void keccak_f1600_x4(uint64_t state[25][4])
+{
+    uint64x2_t A[25], B[25], C[5], D[5];
+    int i, j, round;
+
+    for (j = 0; j < 4; j += 2) {
+        for (i = 0; i < 25; i++) {
+            A[i] = vld1q_u64(&state[i][j]);
+        }
+
+        for (round = 0; round < 24; round++) {
+            KECCAK_ROUND(A, B, C, D);
+            A[0] = K_XOR(A[0], vdupq_n_u64(rc[round]));
+        }
+
+        for (i = 0; i < 25; i++) {
+            vst1q_u64(&state[i][j], A[i]);
+        }
+    }
+}
+
+#endif /* MBEDTLS_SHA3_X4_A64 */
+
+#undef K_XOR
+#undef K_XOR3
+#undef K_RAX1
+#undef K_XAR
+#undef K_BCAX
+
+/*
+ * The same as mbedtls_sha3() on four inputs, with the family already
+ * looked up and olen already checked.
+ */
+static void sha3_x4(const mbedtls_sha3_family_functions *p,
+                    const uint8_t *const input[4], size_t ilen,
+                    uint8_t *const output[4], size_t olen)
+{
+    uint64_t state[25][4];
+    uint8_t block[1344 / 8];
+    const size_t r = p->r / 8;
+    size_t off, n, i;
+    int j;
+
+    memset(state, 0, sizeof(state));
+
+    /* Absorb the whole blocks */
+    for (off = 0; ilen - off >= r; off += r) {
+        for (j = 0; j < 4; j++) {
+            for (i = 0; i < r / 8; i++) {
+                state[i][j] ^= MBEDTLS_GET_UINT64_LE(input[j], off + 8 * i);
+            }
+        }
+        keccak_f1600_x4(state);
+    }
+
+    /* Pad and absorb the last, partial block */
+    for (j = 0; j < 4; j++) {
+        memset(block, 0, r);
+        memcpy(block, input[j] + off, ilen - off);
+        block[ilen - off] ^= p->olen > 0 ? XOR_BYTE : XOR_BYTE_SHAKE;
+        block[r - 1] ^= 0x80;
+        for (i = 0; i < r / 8; i++) {
+            state[i][j] ^= MBEDTLS_GET_UINT64_LE(block, 8 * i);
+        }
+    }
+    keccak_f1600_x4(state);
+
+    /* Squeeze */
+    for (off = 0; off < olen; off += n) {
+        if (off > 0) {
+            keccak_f1600_x4(state);
+        }
+        n = olen - off < r ? olen - off : r;
+        for (j = 0; j < 4; j++) {
+            for (i = 0; i < (n + 7) / 8; i++) {
+                MBEDTLS_PUT_UINT64_LE(state[i][j], block, 8 * i);
+            }
+            memcpy(output[j] + off, block, n);
+        }
+    }
+
+    mbedtls_platform_zeroize(state, sizeof(state));
+    mbedtls_platform_zeroize(block, sizeof(block));
+}
+
+#endif /* MBEDTLS_SHA3_X4_AVX2 || MBEDTLS_SHA3_X4_A64 */
+
+int mbedtls_sha3_x4(mbedtls_sha3_id id,
+                    const uint8_t *const input[4], size_t ilen,
+                    uint8_t *const output[4], size_t olen)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_sha3_family_functions *p = sha3_family(id);
+    int j;
+
+    if (p == NULL) {
+        return MBEDTLS_ERR_SHA3_BAD_INPUT_DATA;
+    }
+
+    /* Catch SHA-3 families, with fixed output length */
+    if (p->olen > 0) {
+        if (p->olen / 8 > olen) {
+            return MBEDTLS_ERR_SHA3_BAD_INPUT_DATA;
+        }
+        olen = p->olen / 8;
+    }
+
+#if defined(MBEDTLS_SHA3_X4_AVX2) || defined(MBEDTLS_SHA3_X4_A64)
+    if (sha3_x4_has_simd()) {
+        sha3_x4(p, input, ilen, output, olen);
+        return 0;
+    }
+#endif
+
+    for (j = 0; j < 4; j++) {
+        if ((ret = mbedtls_sha3(id, input[j], ilen, output[j], olen)) != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 /**************** Self-tests ****************/
 
 #if defined(MBEDTLS_SELF_TEST)
@@ -33,6 +33,7 @@
 #include "mbedtls/sha512.h"
 #include "mbedtls/platform_util.h"
 #include "mbedtls/error.h"
+#include "cpu_features.h"
 
 #if defined(_MSC_VER) || defined(__WATCOMC__)
   #define UL64(x) x##ui64
@@ -44,6 +45,19 @@
 
 #include "mbedtls/platform.h"
 
+/*
+ * Multi-buffer hashing with AVX2 on x86-64: 4 independent messages at once,
+ * one per 64-bit lane. The functions that use AVX2 have a target attribute,
+ * so the library does not need to be built with -mavx2. They are only
+ * called if the CPU and the OS support AVX2.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    defined(MBEDTLS_ARCH_IS_X64) && !defined(MBEDTLS_SHA512_ALT) && \
+    !defined(MBEDTLS_SHA512_PROCESS_ALT)
+#define MBEDTLS_SHA512_BATCH_AVX2
+#include <immintrin.h>
+#endif
+
 #if defined(__aarch64__)
 #  if defined(MBEDTLS_SHA512_USE_A64_CRYPTO_IF_PRESENT) || \
     defined(MBEDTLS_SHA512_USE_A64_CRYPTO_ONLY)
@@ -878,6 +892,197 @@ exit:
     return ret;
 }
 
+#if defined(MBEDTLS_SHA512_BATCH_AVX2)
+
+#define SHA512_MB_LANES 4
+
+/* Below this number of messages, hashing them one by one is faster. */
+#define SHA512_MB_MIN_COUNT 3
+
+#define MB_ADD(a, b)    _mm256_add_epi64(a, b)
+#define MB_XOR(a, b)    _mm256_xor_si256(a, b)
+#define MB_AND(a, b)    _mm256_and_si256(a, b)
+#define MB_OR(a, b)     _mm256_or_si256(a, b)
+#define MB_SHR(x, n)    _mm256_srli_epi64(x, n)
+#define MB_ROTR(x, n)   MB_OR(_mm256_srli_epi64(x, n), _mm256_slli_epi64(x, 64 - (n)))
+
+#define MB_S0(x) MB_XOR(MB_XOR(MB_ROTR(x, 1), MB_ROTR(x, 8)), MB_SHR(x, 7))
+#define MB_S1(x) MB_XOR(MB_XOR(MB_ROTR(x, 19), MB_ROTR(x, 61)), MB_SHR(x, 6))
+#define MB_S2(x) MB_XOR(MB_XOR(MB_ROTR(x, 28), MB_ROTR(x, 34)), MB_ROTR(x, 39))
+#define MB_S3(x) MB_XOR(MB_XOR(MB_ROTR(x, 14), MB_ROTR(x, 18)), MB_ROTR(x, 41))
+
+#define MB_F0(x, y, z) MB_OR(MB_AND(x, y), MB_AND(z, MB_OR(x, y)))
+#define MB_F1(x, y, z) MB_XOR(z, MB_AND(x, MB_XOR(y, z)))
+
+/*
+ * Process one 128-byte block of each of the 4 messages. Lane l of state[i]
+ * is the i-th state word of the message in lane l.
+ */
+__attribute__((target("avx2")))
+static void sha512_mb_process_avx2(uint64_t state[8][SHA512_MB_LANES],
+                                   const unsigned char *const data[SHA512_MB_LANES])
+{
+    __m256i W[16], A[8], temp1, temp2;
+    unsigned int i;
+
+    for (i = 0; i < 8; i++) {
+        A[i] = _mm256_loadu_si256((const __m256i *) state[i]);
+    }
+
+    for (i = 0; i < 80; i++) {
+        if (i < 16) {
+            W[i] = _mm256_setr_epi64x(
+                (long long) MBEDTLS_GET_UINT64_BE(data[0], 8 * i),
+                (long long) MBEDTLS_GET_UINT64_BE(data[1], 8 * i),
+                (long long) MBEDTLS_GET_UINT64_BE(data[2], 8 * i),
+                (long long) MBEDTLS_GET_UINT64_BE(data[3], 8 * i));
+        } else {
+            W[i & 15] = MB_ADD(MB_ADD(MB_S1(W[(i - 2) & 15]), W[(i - 7) & 15]),
+                               MB_ADD(MB_S0(W[(i - 15) & 15]), W[i & 15]));
+        }
+
+        temp1 = MB_ADD(MB_ADD(A[7], MB_S3(A[4])),
+                       MB_ADD(MB_F1(A[4], A[5], A[6]),
+                              MB_ADD(_mm256_set1_epi64x((long long) K[i]),
+                                     W[i & 15])));
+        temp2 = MB_ADD(MB_S2(A[0]), MB_F0(A[0], A[1], A[2]));
+
+        A[7] = A[6];
+        A[6] = A[5];
+        A[5] = A[4];
+        A[4] = MB_ADD(A[3], temp1);
+        A[3] = A[2];
+        A[2] = A[1];
+        A[1] = A[0];
+        A[0] = MB_ADD(temp1, temp2);
+    }
+
+    for (i = 0; i < 8; i++) {
+        _mm256_storeu_si256((__m256i *) state[i],
+                            MB_ADD(A[i], _mm256_loadu_si256((const __m256i *) state[i])));
+    }
+}
+
+/*
+ * A message being hashed in one lane: first the complete blocks of the
+ * input, then one or two padded blocks built in tail.
+ */
+typedef struct {
+    size_t job;
+    const unsigned char *input;
+    size_t blocks;
+    unsigned char tail[2 * SHA512_BLOCK_SIZE];
+    size_t tail_blocks;
+} sha512_mb_lane;
+
+static void sha512_mb_lane_start(sha512_mb_lane *lane, size_t job,
+                                 const unsigned char *input, size_t ilen)
+{
+    size_t used = ilen % SHA512_BLOCK_SIZE;
+
+    lane->job = job;
+    lane->input = input;
+    lane->blocks = ilen / SHA512_BLOCK_SIZE;
+    lane->tail_blocks = (used < 112) ? 1 : 2;
+
+    memset(lane->tail, 0, sizeof(lane->tail));
+    if (used != 0) {
+        memcpy(lane->tail, input + ilen - used, used);
+    }
+    lane->tail[used] = 0x80;
+    MBEDTLS_PUT_UINT64_BE((uint64_t) ilen >> 61,
+                          lane->tail, lane->tail_blocks * SHA512_BLOCK_SIZE - 16);
+    MBEDTLS_PUT_UINT64_BE((uint64_t) ilen << 3,
+                          lane->tail, lane->tail_blocks * SHA512_BLOCK_SIZE - 8);
+}
+
+static int sha512_batch_avx2(size_t count,
+                             const unsigned char *const input[],
+                             const size_t ilen[],
+                             unsigned char *const output[],
+                             int is384)
+{
+    static const unsigned char idle_block[SHA512_BLOCK_SIZE] = { 0 };
+    uint64_t state[8][SHA512_MB_LANES];
+    const unsigned char *data[SHA512_MB_LANES];
+    sha512_mb_lane lanes[SHA512_MB_LANES];
+    mbedtls_sha512_context ctx;
+    size_t next = 0, active = 0;
+    unsigned int i, l;
+
+    /* Take the initial state from a context rather than repeating it */
+    mbedtls_sha512_init(&ctx);
+    (void) mbedtls_sha512_starts(&ctx, is384);
+
+    for (l = 0; l < SHA512_MB_LANES; l++) {
+        if (next < count) {
+            sha512_mb_lane_start(&lanes[l], next, input[next], ilen[next]);
+            next++;
+            active++;
+        } else {
+            lanes[l].job = count;
+        }
+        for (i = 0; i < 8; i++) {
+            state[i][l] = ctx.state[i];
+        }
+    }
+
+    while (active > 0) {
+        for (l = 0; l < SHA512_MB_LANES; l++) {
+            if (lanes[l].job == count) {
+                data[l] = idle_block;
+            } else if (lanes[l].blocks > 0) {
+                data[l] = lanes[l].input;
+            } else {
+                data[l] = lanes[l].tail;
+            }
+        }
+
+        sha512_mb_process_avx2(state, data);
+
+        for (l = 0; l < SHA512_MB_LANES; l++) {
+            sha512_mb_lane *lane = &lanes[l];
+
+            if (lane->job == count) {
+                continue;
+            }
+            if (lane->blocks > 0) {
+                lane->input += SHA512_BLOCK_SIZE;
+                lane->blocks--;
+                continue;
+            }
+            if (--lane->tail_blocks > 0) {
+                memmove(lane->tail, lane->tail + SHA512_BLOCK_SIZE,
+                        SHA512_BLOCK_SIZE);
+                continue;
+            }
+
+            /* The message in this lane is complete */
+            for (i = 0; i < (is384 ? 6u : 8u); i++) {
+                MBEDTLS_PUT_UINT64_BE(state[i][l], output[lane->job], 8 * i);
+            }
+
+            if (next < count) {
+                sha512_mb_lane_start(lane, next, input[next], ilen[next]);
+                next++;
+            } else {
+                lane->job = count;
+                active--;
+            }
+            for (i = 0; i < 8; i++) {
+                state[i][l] = ctx.state[i];
+            }
+        }
+    }
+
+    mbedtls_sha512_free(&ctx);
+    mbedtls_platform_zeroize(state, sizeof(state));
+    mbedtls_platform_zeroize(lanes, sizeof(lanes));
+
+    return 0;
+}
+#endif /* MBEDTLS_SHA512_BATCH_AVX2 */
+
 #endif /* !MBEDTLS_SHA512_ALT */
 
 /*
@@ -925,6 +1130,47 @@ exit:
     return ret;
 }
 
+/*
+ * output[i] = SHA-512( input[i] ) for i in 0..count-1
+ */
+int mbedtls_sha512_batch(size_t count,
+                         const unsigned char *const input[],
+                         const size_t ilen[],
+                         unsigned char *const output[],
+                         int is384)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t i;
+
+#if defined(MBEDTLS_SHA384_C) && defined(MBEDTLS_SHA512_C)
+    if (is384 != 0 && is384 != 1) {
+        return MBEDTLS_ERR_SHA512_BAD_INPUT_DATA;
+    }
+#elif defined(MBEDTLS_SHA512_C)
+    if (is384 != 0) {
+        return MBEDTLS_ERR_SHA512_BAD_INPUT_DATA;
+    }
+#else /* defined MBEDTLS_SHA384_C only */
+    if (is384 == 0) {
+        return MBEDTLS_ERR_SHA512_BAD_INPUT_DATA;
+    }
+#endif
+
+#if defined(MBEDTLS_SHA512_BATCH_AVX2)
+    if (count >= SHA512_MB_MIN_COUNT && mbedtls_cpu_has_avx2()) {
+        return sha512_batch_avx2(count, input, ilen, output, is384);
+    }
+#endif
+
+    for (i = 0; i < count; i++) {
+        if ((ret = mbedtls_sha512(input[i], ilen[i], output[i], is384)) != 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 
 /*
@@ -672,6 +672,10 @@ struct mbedtls_ssl_handshake_params {
 
 #if defined(MBEDTLS_SSL_ASYNC_PRIVATE)
     uint8_t async_in_progress; /*!< an asynchronous operation is in progress */
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    uint16_t async_sig_alg;    /*!< signature algorithm of the pending
+                                    TLS 1.3 CertificateVerify signature */
+#endif
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
 
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
@@ -1138,6 +1142,16 @@ struct mbedtls_ssl_transform {
                             MBEDTLS_CLIENT_HELLO_RANDOM_LEN];
     /*!< ServerHello.random+ClientHello.random */
 #endif /* MBEDTLS_SSL_CONTEXT_SERIALIZATION */
+
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+    /* Copies of the raw keys for mbedtls_ssl_export_traffic_keys(),
+     * see ssl_tls12_populate_transform() and
+     * mbedtls_ssl_tls13_populate_transform() */
+    mbedtls_cipher_type_t cipher_type;  /*!<  cipher of the keys      */
+    size_t keylen;                      /*!<  key length              */
+    unsigned char key_enc[MBEDTLS_SSL_MAX_KEY_LENGTH]; /*!< key (encryption) */
+    unsigned char key_dec[MBEDTLS_SSL_MAX_KEY_LENGTH]; /*!< key (decryption) */
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
 };
 
 /*
@@ -1306,6 +1320,32 @@ static inline void mbedtls_ssl_handshake_set_state(mbedtls_ssl_context *ssl,
     ssl->state = (int) state;
 }
 
+/*
+ * Handshake profiling events, see mbedtls_ssl_conf_handshake_profile().
+ * MBEDTLS_SSL_PROFILE_BEGIN/END compile to nothing unless
+ * MBEDTLS_SSL_HANDSHAKE_PROFILING is enabled.
+ */
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+static inline void mbedtls_ssl_profile_event(mbedtls_ssl_context *ssl,
+                                             mbedtls_ssl_profile_phase phase,
+                                             int state, int end)
+{
+    if (ssl->conf->f_profile != NULL) {
+        ssl->conf->f_profile(ssl->conf->p_profile, ssl, phase, state, end);
+    }
+}
+
+#define MBEDTLS_SSL_PROFILE_BEGIN(ssl, phase)                              \
+    mbedtls_ssl_profile_event((ssl), MBEDTLS_SSL_PROFILE_ ## phase,       \
+                              (ssl)->state, 0)
+#define MBEDTLS_SSL_PROFILE_END(ssl, phase)                                \
+    mbedtls_ssl_profile_event((ssl), MBEDTLS_SSL_PROFILE_ ## phase,       \
+                              (ssl)->state, 1)
+#else
+#define MBEDTLS_SSL_PROFILE_BEGIN(ssl, phase) do { } while (0)
+#define MBEDTLS_SSL_PROFILE_END(ssl, phase)   do { } while (0)
+#endif /* MBEDTLS_SSL_HANDSHAKE_PROFILING */
+
 MBEDTLS_CHECK_RETURN_CRITICAL
 int mbedtls_ssl_send_fatal_handshake_failure(mbedtls_ssl_context *ssl);
 
@@ -1772,6 +1812,28 @@ int mbedtls_ssl_session_reset_int(mbedtls_ssl_context *ssl, int partial);
 void mbedtls_ssl_session_reset_msg_layer(mbedtls_ssl_context *ssl,
                                          int partial);
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+MBEDTLS_CHECK_RETURN_CRITICAL
+int mbedtls_ssl_acquire_buffers(mbedtls_ssl_context *ssl);
+#endif
+
+/*
+ * Allocate the I/O buffers again if they were released by
+ * mbedtls_ssl_release_buffers(). The context must be set up.
+ */
+MBEDTLS_CHECK_RETURN_CRITICAL
+static inline int mbedtls_ssl_check_buffers(mbedtls_ssl_context *ssl)
+{
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    if (ssl->in_buf == NULL) {
+        return mbedtls_ssl_acquire_buffers(ssl);
+    }
+#else
+    ((void) ssl);
+#endif
+    return 0;
+}
+
 /*
  * Send pending alert
  */
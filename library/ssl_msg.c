@@ -2244,12 +2244,14 @@ int mbedtls_ssl_fetch_input(mbedtls_ssl_context *ssl, size_t nb_want)
 
             MBEDTLS_SSL_DEBUG_MSG(3, ("f_recv_timeout: %lu ms", (unsigned long) timeout));
 
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, RECV);
             if (ssl->f_recv_timeout != NULL) {
                 ret = ssl->f_recv_timeout(ssl->p_bio, ssl->in_hdr, len,
                                           timeout);
             } else {
                 ret = ssl->f_recv(ssl->p_bio, ssl->in_hdr, len);
             }
+            MBEDTLS_SSL_PROFILE_END(ssl, RECV);
 
             MBEDTLS_SSL_DEBUG_RET(2, "ssl->f_recv(_timeout)", ret);
 
@@ -2307,6 +2309,7 @@ int mbedtls_ssl_fetch_input(mbedtls_ssl_context *ssl, size_t nb_want)
             if (mbedtls_ssl_check_timer(ssl) != 0) {
                 ret = MBEDTLS_ERR_SSL_TIMEOUT;
             } else {
+                MBEDTLS_SSL_PROFILE_BEGIN(ssl, RECV);
                 if (ssl->f_recv_timeout != NULL) {
                     ret = ssl->f_recv_timeout(ssl->p_bio,
                                               ssl->in_hdr + ssl->in_left, len,
@@ -2315,6 +2318,7 @@ int mbedtls_ssl_fetch_input(mbedtls_ssl_context *ssl, size_t nb_want)
                     ret = ssl->f_recv(ssl->p_bio,
                                       ssl->in_hdr + ssl->in_left, len);
                 }
+                MBEDTLS_SSL_PROFILE_END(ssl, RECV);
             }
 
             MBEDTLS_SSL_DEBUG_MSG(2, ("in_left: %" MBEDTLS_PRINTF_SIZET
@@ -2374,7 +2378,9 @@ int mbedtls_ssl_flush_output(mbedtls_ssl_context *ssl)
                                   mbedtls_ssl_out_hdr_len(ssl) + ssl->out_msglen, ssl->out_left));
 
         buf = ssl->out_hdr - ssl->out_left;
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, SEND);
         ret = ssl->f_send(ssl->p_bio, buf, ssl->out_left);
+        MBEDTLS_SSL_PROFILE_END(ssl, SEND);
 
         MBEDTLS_SSL_DEBUG_RET(2, "ssl->f_send", ret);
 
@@ -5096,6 +5102,10 @@ int mbedtls_ssl_send_alert_message(mbedtls_ssl_context *ssl,
         return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
     }
 
+    if ((ret = mbedtls_ssl_check_buffers(ssl)) != 0) {
+        return ret;
+    }
+
     if (ssl->out_left != 0) {
         return mbedtls_ssl_flush_output(ssl);
     }
@@ -5673,6 +5683,10 @@ int mbedtls_ssl_read(mbedtls_ssl_context *ssl, unsigned char *buf, size_t len)
         return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
     }
 
+    if ((ret = mbedtls_ssl_check_buffers(ssl)) != 0) {
+        return ret;
+    }
+
     MBEDTLS_SSL_DEBUG_MSG(2, ("=> read"));
 
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
@@ -5939,6 +5953,10 @@ int mbedtls_ssl_write(mbedtls_ssl_context *ssl, const unsigned char *buf, size_t
         return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
     }
 
+    if ((ret = mbedtls_ssl_check_buffers(ssl)) != 0) {
+        return ret;
+    }
+
 #if defined(MBEDTLS_SSL_RENEGOTIATION)
     if ((ret = ssl_check_ctr_renegotiate(ssl)) != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "ssl_check_ctr_renegotiate", ret);
@@ -1360,6 +1360,133 @@ static int ssl_conf_check(const mbedtls_ssl_context *ssl)
     return 0;
 }
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+/* All the buffers of a pool have this size, which fits both directions. */
+#define SSL_POOL_BUFFER_LEN                                  \
+    (MBEDTLS_SSL_IN_BUFFER_LEN > MBEDTLS_SSL_OUT_BUFFER_LEN ? \
+     MBEDTLS_SSL_IN_BUFFER_LEN : MBEDTLS_SSL_OUT_BUFFER_LEN)
+
+void mbedtls_ssl_buffer_pool_init(mbedtls_ssl_buffer_pool *pool)
+{
+    memset(pool, 0, sizeof(mbedtls_ssl_buffer_pool));
+    pool->max_free = MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX;
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init(&pool->mutex);
+#endif
+}
+
+void mbedtls_ssl_buffer_pool_set_max_free(mbedtls_ssl_buffer_pool *pool,
+                                          size_t max_free)
+{
+    pool->max_free = max_free;
+}
+
+void mbedtls_ssl_buffer_pool_free(mbedtls_ssl_buffer_pool *pool)
+{
+    unsigned char *buf;
+
+    if (pool == NULL) {
+        return;
+    }
+
+    /* The free buffers are chained through their first bytes */
+    while ((buf = pool->head) != NULL) {
+        memcpy(&pool->head, buf, sizeof(pool->head));
+        mbedtls_free(buf);
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free(&pool->mutex);
+#endif
+    mbedtls_platform_zeroize(pool, sizeof(mbedtls_ssl_buffer_pool));
+}
+
+/*
+ * Get a zeroized buffer of SSL_POOL_BUFFER_LEN bytes from the pool,
+ * or allocate one if the pool is empty.
+ */
+static unsigned char *ssl_buffer_pool_get(mbedtls_ssl_buffer_pool *pool)
+{
+    unsigned char *buf = NULL;
+
+#if defined(MBEDTLS_THREADING_C)
+    if (mbedtls_mutex_lock(&pool->mutex) != 0) {
+        return NULL;
+    }
+#endif
+
+    if (pool->head != NULL) {
+        buf = pool->head;
+        memcpy(&pool->head, buf, sizeof(pool->head));
+        pool->count--;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    if (mbedtls_mutex_unlock(&pool->mutex) != 0) {
+        mbedtls_free(buf);
+        return NULL;
+    }
+#endif
+
+    if (buf == NULL) {
+        return mbedtls_calloc(1, SSL_POOL_BUFFER_LEN);
+    }
+
+    mbedtls_platform_zeroize(buf, sizeof(pool->head));
+    return buf;
+}
+
+/*
+ * Give a buffer of SSL_POOL_BUFFER_LEN bytes back to the pool,
+ * or free it if the pool is full.
+ */
+static void ssl_buffer_pool_put(mbedtls_ssl_buffer_pool *pool,
+                                unsigned char *buf)
+{
+    mbedtls_platform_zeroize(buf, SSL_POOL_BUFFER_LEN);
+
+#if defined(MBEDTLS_THREADING_C)
+    if (mbedtls_mutex_lock(&pool->mutex) != 0) {
+        mbedtls_free(buf);
+        return;
+    }
+#endif
+
+    if (pool->count < pool->max_free) {
+        memcpy(buf, &pool->head, sizeof(pool->head));
+        pool->head = buf;
+        pool->count++;
+        buf = NULL;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock(&pool->mutex);
+#endif
+
+    mbedtls_free(buf);
+}
+
+static unsigned char *ssl_buffer_get(const mbedtls_ssl_config *conf,
+                                     size_t len)
+{
+    if (conf->buffer_pool != NULL && len == SSL_POOL_BUFFER_LEN) {
+        return ssl_buffer_pool_get(conf->buffer_pool);
+    }
+    return mbedtls_calloc(1, len);
+}
+
+static void ssl_buffer_put(const mbedtls_ssl_config *conf,
+                           unsigned char *buf, size_t len)
+{
+    if (conf != NULL && conf->buffer_pool != NULL &&
+        len == SSL_POOL_BUFFER_LEN) {
+        ssl_buffer_pool_put(conf->buffer_pool, buf);
+        return;
+    }
+    mbedtls_zeroize_and_free(buf, len);
+}
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 /*
  * Setup an SSL context
  */
@@ -1388,7 +1515,11 @@ int mbedtls_ssl_setup(mbedtls_ssl_context *ssl,
 #if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
     ssl->in_buf_len = in_buf_len;
 #endif
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    ssl->in_buf = ssl_buffer_get(conf, in_buf_len);
+#else
     ssl->in_buf = mbedtls_calloc(1, in_buf_len);
+#endif
     if (ssl->in_buf == NULL) {
         MBEDTLS_SSL_DEBUG_MSG(1, ("alloc(%" MBEDTLS_PRINTF_SIZET " bytes) failed", in_buf_len));
         ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -1398,7 +1529,11 @@ int mbedtls_ssl_setup(mbedtls_ssl_context *ssl,
 #if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
     ssl->out_buf_len = out_buf_len;
 #endif
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    ssl->out_buf = ssl_buffer_get(conf, out_buf_len);
+#else
     ssl->out_buf = mbedtls_calloc(1, out_buf_len);
+#endif
     if (ssl->out_buf == NULL) {
         MBEDTLS_SSL_DEBUG_MSG(1, ("alloc(%" MBEDTLS_PRINTF_SIZET " bytes) failed", out_buf_len));
         ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
@@ -1445,6 +1580,124 @@ error:
     return ret;
 }
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+int mbedtls_ssl_release_buffers(mbedtls_ssl_context *ssl)
+{
+#if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
+    size_t in_buf_len;
+    size_t out_buf_len;
+#else
+    size_t in_buf_len = MBEDTLS_SSL_IN_BUFFER_LEN;
+    size_t out_buf_len = MBEDTLS_SSL_OUT_BUFFER_LEN;
+#endif
+
+    if (ssl == NULL || ssl->conf == NULL) {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    if (ssl->in_buf == NULL) {
+        return 0;
+    }
+
+#if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
+    in_buf_len = ssl->in_buf_len;
+    out_buf_len = ssl->out_buf_len;
+#endif
+
+    /* With DTLS, the input buffer may hold further records of a datagram */
+    if (ssl->conf->transport != MBEDTLS_SSL_TRANSPORT_STREAM) {
+        return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+    }
+
+    if (mbedtls_ssl_is_handshake_over(ssl) == 0) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("Handshake isn't completed"));
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    if (mbedtls_ssl_check_pending(ssl) != 0 || ssl->in_left != 0) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("There is pending incoming data"));
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    if (ssl->out_left != 0) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("There is pending outgoing data"));
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    MBEDTLS_SSL_DEBUG_MSG(2, ("=> release buffers"));
+
+    /* With TLS, the incoming sequence number lives in the input buffer,
+     * see mbedtls_ssl_update_in_pointers(). Keep it in the context, where
+     * ssl->in_ctr keeps pointing until the buffers are back. */
+    memcpy(ssl->in_ctr_saved, ssl->in_ctr, MBEDTLS_SSL_SEQUENCE_NUMBER_LEN);
+
+    ssl_buffer_put(ssl->conf, ssl->in_buf, in_buf_len);
+    ssl_buffer_put(ssl->conf, ssl->out_buf, out_buf_len);
+    ssl->in_buf = NULL;
+    ssl->out_buf = NULL;
+
+    ssl->in_hdr = NULL;
+    ssl->in_ctr = ssl->in_ctr_saved;
+    ssl->in_len = NULL;
+    ssl->in_iv = NULL;
+    ssl->in_msg = NULL;
+
+    ssl->out_hdr = NULL;
+    ssl->out_ctr = NULL;
+    ssl->out_len = NULL;
+    ssl->out_iv = NULL;
+    ssl->out_msg = NULL;
+#if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
+    ssl->in_cid = NULL;
+    ssl->out_cid = NULL;
+#endif
+
+    MBEDTLS_SSL_DEBUG_MSG(2, ("<= release buffers"));
+
+    return 0;
+}
+
+int mbedtls_ssl_acquire_buffers(mbedtls_ssl_context *ssl)
+{
+#if defined(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH)
+    size_t in_buf_len = ssl->in_buf_len;
+    size_t out_buf_len = ssl->out_buf_len;
+#else
+    size_t in_buf_len = MBEDTLS_SSL_IN_BUFFER_LEN;
+    size_t out_buf_len = MBEDTLS_SSL_OUT_BUFFER_LEN;
+#endif
+    unsigned char *in_buf, *out_buf;
+
+    if (ssl->conf == NULL) {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    in_buf = ssl_buffer_get(ssl->conf, in_buf_len);
+    if (in_buf == NULL) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("alloc(%" MBEDTLS_PRINTF_SIZET " bytes) failed", in_buf_len));
+        return MBEDTLS_ERR_SSL_ALLOC_FAILED;
+    }
+
+    out_buf = ssl_buffer_get(ssl->conf, out_buf_len);
+    if (out_buf == NULL) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("alloc(%" MBEDTLS_PRINTF_SIZET " bytes) failed", out_buf_len));
+        ssl_buffer_put(ssl->conf, in_buf, in_buf_len);
+        return MBEDTLS_ERR_SSL_ALLOC_FAILED;
+    }
+
+    MBEDTLS_SSL_DEBUG_MSG(2, ("=> acquire buffers"));
+
+    ssl->in_buf = in_buf;
+    ssl->out_buf = out_buf;
+
+    mbedtls_ssl_reset_in_out_pointers(ssl);
+    mbedtls_ssl_update_out_pointers(ssl, ssl->transform_out);
+    memcpy(ssl->in_ctr, ssl->in_ctr_saved, MBEDTLS_SSL_SEQUENCE_NUMBER_LEN);
+
+    MBEDTLS_SSL_DEBUG_MSG(2, ("<= acquire buffers"));
+
+    return 0;
+}
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 /*
  * Reset an initialized and used SSL context for re-use while retaining
  * all application-set variables, function pointers and data.
@@ -1538,6 +1791,10 @@ int mbedtls_ssl_session_reset_int(mbedtls_ssl_context *ssl, int partial)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
+    if ((ret = mbedtls_ssl_check_buffers(ssl)) != 0) {
+        return ret;
+    }
+
     ssl->state = MBEDTLS_SSL_HELLO_REQUEST;
 
     mbedtls_ssl_session_reset_msg_layer(ssl, partial);
@@ -1618,6 +1875,14 @@ void mbedtls_ssl_conf_dtls_badmac_limit(mbedtls_ssl_config *conf, unsigned limit
     conf->badmac_limit = limit;
 }
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+void mbedtls_ssl_conf_buffer_pool(mbedtls_ssl_config *conf,
+                                  mbedtls_ssl_buffer_pool *pool)
+{
+    conf->buffer_pool = pool;
+}
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 #if defined(MBEDTLS_SSL_PROTO_DTLS)
 
 void mbedtls_ssl_set_datagram_packing(mbedtls_ssl_context *ssl,
@@ -1665,6 +1930,16 @@ void mbedtls_ssl_conf_dbg(mbedtls_ssl_config *conf,
     conf->p_dbg      = p_dbg;
 }
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+void mbedtls_ssl_conf_handshake_profile(mbedtls_ssl_config *conf,
+                                        mbedtls_ssl_profile_t *f_profile,
+                                        void *p_profile)
+{
+    conf->f_profile = f_profile;
+    conf->p_profile = p_profile;
+}
+#endif /* MBEDTLS_SSL_HANDSHAKE_PROFILING */
+
 void mbedtls_ssl_set_bio(mbedtls_ssl_context *ssl,
                          void *p_bio,
                          mbedtls_ssl_send_t *f_send,
@@ -3222,6 +3497,14 @@ void mbedtls_ssl_conf_async_private_cb(
     conf->p_async_config_data = async_config_data;
 }
 
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+void mbedtls_ssl_conf_async_private_tls13(mbedtls_ssl_config *conf,
+                                          int enable)
+{
+    conf->async_private_tls13 = (uint8_t) enable;
+}
+#endif /* MBEDTLS_SSL_PROTO_TLS1_3 */
+
 void *mbedtls_ssl_conf_get_async_config_data(const mbedtls_ssl_config *conf)
 {
     return conf->p_async_config_data;
@@ -3811,6 +4094,9 @@ static int ssl_prepare_handshake_step(mbedtls_ssl_context *ssl)
 int mbedtls_ssl_handshake_step(mbedtls_ssl_context *ssl)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+    int profile_state;
+#endif
 
     if (ssl            == NULL                       ||
         ssl->conf      == NULL                       ||
@@ -3819,9 +4105,16 @@ int mbedtls_ssl_handshake_step(mbedtls_ssl_context *ssl)
         return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
     }
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+    /* Report the state the step started in, not the one it moved to. */
+    profile_state = ssl->state;
+    mbedtls_ssl_profile_event(ssl, MBEDTLS_SSL_PROFILE_HANDSHAKE_STEP,
+                              profile_state, 0);
+#endif
+
     ret = ssl_prepare_handshake_step(ssl);
     if (ret != 0) {
-        return ret;
+        goto cleanup;
     }
 
     ret = mbedtls_ssl_handle_pending_alert(ssl);
@@ -3891,6 +4184,10 @@ int mbedtls_ssl_handshake_step(mbedtls_ssl_context *ssl)
     }
 
 cleanup:
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+    mbedtls_ssl_profile_event(ssl, MBEDTLS_SSL_PROFILE_HANDSHAKE_STEP,
+                              profile_state, 1);
+#endif
     return ret;
 }
 
@@ -4011,11 +4308,17 @@ int mbedtls_ssl_start_renegotiation(mbedtls_ssl_context *ssl)
 int mbedtls_ssl_renegotiate(mbedtls_ssl_context *ssl)
 {
     int ret = MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+    int buf_ret;
 
     if (ssl == NULL || ssl->conf == NULL) {
         return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
     }
 
+    /* Keep ret as is: it is the result when no endpoint code is built. */
+    if ((buf_ret = mbedtls_ssl_check_buffers(ssl)) != 0) {
+        return buf_ret;
+    }
+
 #if defined(MBEDTLS_SSL_SRV_C)
     /* On server, just send the request */
     if (ssl->conf->endpoint == MBEDTLS_SSL_IS_SERVER) {
@@ -4817,6 +5120,66 @@ int mbedtls_ssl_context_load(mbedtls_ssl_context *context,
 }
 #endif /* MBEDTLS_SSL_CONTEXT_SERIALIZATION */
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+/*
+ * Export the record protection state of one direction of a connection
+ */
+int mbedtls_ssl_export_traffic_keys(const mbedtls_ssl_context *ssl,
+                                    int direction,
+                                    mbedtls_ssl_traffic_keys *keys)
+{
+    const mbedtls_ssl_transform *transform;
+    const unsigned char *ctr;
+
+    if (ssl->state < MBEDTLS_SSL_HANDSHAKE_OVER) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("Handshake isn't completed"));
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    if (direction == MBEDTLS_SSL_TRAFFIC_KEYS_TX) {
+        if (ssl->out_left != 0) {
+            MBEDTLS_SSL_DEBUG_MSG(1, ("There is pending outgoing data"));
+            return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+        }
+        transform = ssl->transform_out;
+        ctr = ssl->cur_out_ctr;
+    } else if (direction == MBEDTLS_SSL_TRAFFIC_KEYS_RX) {
+        if (mbedtls_ssl_check_pending(ssl) != 0 || ssl->in_left != 0) {
+            MBEDTLS_SSL_DEBUG_MSG(1, ("There is pending incoming data"));
+            return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+        }
+        transform = ssl->transform_in;
+        ctr = ssl->in_ctr;
+    } else {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    if (transform == NULL) {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    /* The record layer of TLS only, with an AEAD */
+    if (ssl->conf->transport != MBEDTLS_SSL_TRANSPORT_STREAM ||
+        mbedtls_ssl_transform_uses_aead(transform) != 1) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("Only TLS with AEAD ciphersuites supported"));
+        return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+    }
+
+    keys->tls_version = transform->tls_version;
+    keys->cipher = transform->cipher_type;
+    keys->key_len = transform->keylen;
+    memcpy(keys->key, direction == MBEDTLS_SSL_TRAFFIC_KEYS_TX ?
+           transform->key_enc : transform->key_dec, transform->keylen);
+    keys->iv_len = transform->fixed_ivlen;
+    memcpy(keys->iv, direction == MBEDTLS_SSL_TRAFFIC_KEYS_TX ?
+           transform->iv_enc : transform->iv_dec, transform->fixed_ivlen);
+    keys->tag_len = transform->taglen;
+    memcpy(keys->rec_seq, ctr, sizeof(keys->rec_seq));
+
+    return 0;
+}
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 /*
  * Free an SSL context
  */
@@ -4835,7 +5198,11 @@ void mbedtls_ssl_free(mbedtls_ssl_context *ssl)
         size_t out_buf_len = MBEDTLS_SSL_OUT_BUFFER_LEN;
 #endif
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+        ssl_buffer_put(ssl->conf, ssl->out_buf, out_buf_len);
+#else
         mbedtls_zeroize_and_free(ssl->out_buf, out_buf_len);
+#endif
         ssl->out_buf = NULL;
     }
 
@@ -4846,7 +5213,11 @@ void mbedtls_ssl_free(mbedtls_ssl_context *ssl)
         size_t in_buf_len = MBEDTLS_SSL_IN_BUFFER_LEN;
 #endif
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+        ssl_buffer_put(ssl->conf, ssl->in_buf, in_buf_len);
+#else
         mbedtls_zeroize_and_free(ssl->in_buf, in_buf_len);
+#endif
         ssl->in_buf = NULL;
     }
 
@@ -6776,9 +7147,12 @@ int mbedtls_ssl_psk_derive_premaster(mbedtls_ssl_context *ssl, mbedtls_key_excha
         size_t len;
 
         /* Write length only when we know the actual value */
-        if ((ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
-                                           p + 2, end - (p + 2), &len,
-                                           ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
+                                      p + 2, end - (p + 2), &len,
+                                      ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_calc_secret", ret);
             return ret;
         }
@@ -6793,9 +7167,12 @@ int mbedtls_ssl_psk_derive_premaster(mbedtls_ssl_context *ssl, mbedtls_key_excha
         int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
         size_t zlen;
 
-        if ((ret = mbedtls_ecdh_calc_secret(&ssl->handshake->ecdh_ctx, &zlen,
-                                            p + 2, end - (p + 2),
-                                            ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_ecdh_calc_secret(&ssl->handshake->ecdh_ctx, &zlen,
+                                       p + 2, end - (p + 2),
+                                       ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ecdh_calc_secret", ret);
             return ret;
         }
@@ -7288,6 +7665,7 @@ static int ssl_parse_certificate_verify(mbedtls_ssl_context *ssl,
         have_ca_chain = 1;
 
         MBEDTLS_SSL_DEBUG_MSG(3, ("use CA callback for X.509 CRT verification"));
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, VERIFY_CHAIN);
         ret = mbedtls_x509_crt_verify_with_ca_cb(
             chain,
             ssl->conf->f_ca_cb,
@@ -7296,6 +7674,7 @@ static int ssl_parse_certificate_verify(mbedtls_ssl_context *ssl,
             ssl->hostname,
             &ssl->session_negotiate->verify_result,
             f_vrfy, p_vrfy);
+        MBEDTLS_SSL_PROFILE_END(ssl, VERIFY_CHAIN);
     } else
 #endif /* MBEDTLS_X509_TRUSTED_CERTIFICATE_CALLBACK */
     {
@@ -7317,6 +7696,7 @@ static int ssl_parse_certificate_verify(mbedtls_ssl_context *ssl,
             have_ca_chain = 1;
         }
 
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, VERIFY_CHAIN);
         ret = mbedtls_x509_crt_verify_restartable(
             chain,
             ca_chain, ca_crl,
@@ -7324,6 +7704,7 @@ static int ssl_parse_certificate_verify(mbedtls_ssl_context *ssl,
             ssl->hostname,
             &ssl->session_negotiate->verify_result,
             f_vrfy, p_vrfy, rs_ctx);
+        MBEDTLS_SSL_PROFILE_END(ssl, VERIFY_CHAIN);
     }
 
     if (ret != 0) {
@@ -8427,6 +8808,18 @@ static int ssl_tls12_populate_transform(mbedtls_ssl_transform *transform,
         goto end;
     }
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+    if (keylen > sizeof(transform->key_enc)) {
+        MBEDTLS_SSL_DEBUG_MSG(1, ("should never happen"));
+        ret = MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+        goto end;
+    }
+    transform->cipher_type = (mbedtls_cipher_type_t) ciphersuite_info->cipher;
+    transform->keylen = keylen;
+    memcpy(transform->key_enc, key1, keylen);
+    memcpy(transform->key_dec, key2, keylen);
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
     if (ssl != NULL && ssl->f_export_keys != NULL) {
         ssl->f_export_keys(ssl->p_export_keys,
                            MBEDTLS_SSL_KEY_EXPORT_TLS12_MASTER_SECRET,
@@ -1608,7 +1608,10 @@ static int ssl_parse_server_hello(mbedtls_ssl_context *ssl)
      * case of DTLS includes the server CID extracted from the CID extension.
      */
     if (ssl->handshake->resume) {
-        if ((ret = mbedtls_ssl_derive_keys(ssl)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
+        ret = mbedtls_ssl_derive_keys(ssl);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ssl_derive_keys", ret);
             mbedtls_ssl_send_alert_message(
                 ssl,
@@ -2406,6 +2409,7 @@ start_processing:
         }
 #endif
 
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, VERIFY_SIGNATURE);
 #if defined(MBEDTLS_X509_RSASSA_PSS_SUPPORT)
         if (pk_alg == MBEDTLS_PK_RSASSA_PSS) {
             mbedtls_pk_rsassa_pss_options rsassa_pss_options;
@@ -2424,6 +2428,7 @@ start_processing:
 #endif /* MBEDTLS_X509_RSASSA_PSS_SUPPORT */
         ret = mbedtls_pk_verify_restartable(peer_pk,
                                             md_alg, hash, hashlen, p, sig_len, rs_ctx);
+        MBEDTLS_SSL_PROFILE_END(ssl, VERIFY_SIGNATURE);
 
         if (ret != 0) {
             int send_alert_msg = 1;
@@ -2726,10 +2731,12 @@ static int ssl_write_client_key_exchange(mbedtls_ssl_context *ssl)
         MBEDTLS_PUT_UINT16_BE(content_len, ssl->out_msg, 4);
         header_len = 6;
 
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         ret = mbedtls_dhm_make_public(&ssl->handshake->dhm_ctx,
                                       (int) mbedtls_dhm_get_len(&ssl->handshake->dhm_ctx),
                                       &ssl->out_msg[header_len], content_len,
                                       ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
         if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_make_public", ret);
             return ret;
@@ -2738,11 +2745,14 @@ static int ssl_write_client_key_exchange(mbedtls_ssl_context *ssl)
         MBEDTLS_SSL_DEBUG_MPI(3, "DHM: X ", &ssl->handshake->dhm_ctx.X);
         MBEDTLS_SSL_DEBUG_MPI(3, "DHM: GX", &ssl->handshake->dhm_ctx.GX);
 
-        if ((ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
-                                           ssl->handshake->premaster,
-                                           MBEDTLS_PREMASTER_SIZE,
-                                           &ssl->handshake->pmslen,
-                                           ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
+                                      ssl->handshake->premaster,
+                                      MBEDTLS_PREMASTER_SIZE,
+                                      &ssl->handshake->pmslen,
+                                      ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_calc_secret", ret);
             return ret;
         }
@@ -2787,8 +2797,10 @@ static int ssl_write_client_key_exchange(mbedtls_ssl_context *ssl)
         psa_set_key_bits(&key_attributes, handshake->xxdh_psa_bits);
 
         /* Generate ECDH private key. */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_generate_key(&key_attributes,
                                   &handshake->xxdh_psa_privkey);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
         if (status != PSA_SUCCESS) {
             return MBEDTLS_ERR_SSL_HW_ACCEL_FAILED;
         }
@@ -2816,6 +2828,7 @@ static int ssl_write_client_key_exchange(mbedtls_ssl_context *ssl)
         /* The ECDH secret is the premaster secret used for key derivation. */
 
         /* Compute ECDH shared secret. */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_raw_key_agreement(PSA_ALG_ECDH,
                                        handshake->xxdh_psa_privkey,
                                        handshake->xxdh_psa_peerkey,
@@ -2823,6 +2836,7 @@ static int ssl_write_client_key_exchange(mbedtls_ssl_context *ssl)
                                        ssl->handshake->premaster,
                                        sizeof(ssl->handshake->premaster),
                                        &ssl->handshake->pmslen);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
 
         destruction_status = psa_destroy_key(handshake->xxdh_psa_privkey);
         handshake->xxdh_psa_privkey = MBEDTLS_SVC_KEY_ID_INIT;
@@ -2846,10 +2860,12 @@ static int ssl_write_client_key_exchange(mbedtls_ssl_context *ssl)
         }
 #endif
 
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         ret = mbedtls_ecdh_make_public(&ssl->handshake->ecdh_ctx,
                                        &content_len,
                                        &ssl->out_msg[header_len], 1000,
                                        ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
         if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ecdh_make_public", ret);
 #if defined(MBEDTLS_SSL_ECP_RESTARTABLE_ENABLED)
@@ -2874,11 +2890,14 @@ ecdh_calc_secret:
             content_len = ssl->handshake->ecrs_n;
         }
 #endif
-        if ((ret = mbedtls_ecdh_calc_secret(&ssl->handshake->ecdh_ctx,
-                                            &ssl->handshake->pmslen,
-                                            ssl->handshake->premaster,
-                                            MBEDTLS_MPI_MAX_SIZE,
-                                            ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_ecdh_calc_secret(&ssl->handshake->ecdh_ctx,
+                                       &ssl->handshake->pmslen,
+                                       ssl->handshake->premaster,
+                                       MBEDTLS_MPI_MAX_SIZE,
+                                       ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ecdh_calc_secret", ret);
 #if defined(MBEDTLS_SSL_ECP_RESTARTABLE_ENABLED)
             if (ret == MBEDTLS_ERR_ECP_IN_PROGRESS) {
@@ -2959,8 +2978,10 @@ ecdh_calc_secret:
         psa_set_key_bits(&key_attributes, handshake->xxdh_psa_bits);
 
         /* Generate ECDH private key. */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_generate_key(&key_attributes,
                                   &handshake->xxdh_psa_privkey);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
         if (status != PSA_SUCCESS) {
             return PSA_TO_MBEDTLS_ERR(status);
         }
@@ -2999,6 +3020,7 @@ ecdh_calc_secret:
         size_t zlen = 0;
 
         /* Perform ECDH computation after the uint16 reserved for the length */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_raw_key_agreement(PSA_ALG_ECDH,
                                        handshake->xxdh_psa_privkey,
                                        handshake->xxdh_psa_peerkey,
@@ -3006,6 +3028,7 @@ ecdh_calc_secret:
                                        pms + zlen_size,
                                        pms_end - (pms + zlen_size),
                                        &zlen);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
 
         destruction_status = psa_destroy_key(handshake->xxdh_psa_privkey);
         handshake->xxdh_psa_privkey = MBEDTLS_SVC_KEY_ID_INIT;
@@ -3081,10 +3104,12 @@ ecdh_calc_secret:
             ssl->out_msg[header_len++] = MBEDTLS_BYTE_1(content_len);
             ssl->out_msg[header_len++] = MBEDTLS_BYTE_0(content_len);
 
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
             ret = mbedtls_dhm_make_public(&ssl->handshake->dhm_ctx,
                                           (int) mbedtls_dhm_get_len(&ssl->handshake->dhm_ctx),
                                           &ssl->out_msg[header_len], content_len,
                                           ssl->conf->f_rng, ssl->conf->p_rng);
+            MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
             if (ret != 0) {
                 MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_make_public", ret);
                 return ret;
@@ -3096,9 +3121,12 @@ ecdh_calc_secret:
             size_t pms_len;
 
             /* Write length only when we know the actual value */
-            if ((ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
-                                               pms + 2, pms_end - (pms + 2), &pms_len,
-                                               ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+            ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
+                                          pms + 2, pms_end - (pms + 2), &pms_len,
+                                          ssl->conf->f_rng, ssl->conf->p_rng);
+            MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+            if (ret != 0) {
                 MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_calc_secret", ret);
                 return ret;
             }
@@ -3115,11 +3143,13 @@ ecdh_calc_secret:
             /*
              * ClientECDiffieHellmanPublic public;
              */
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
             ret = mbedtls_ecdh_make_public(&ssl->handshake->ecdh_ctx,
                                            &content_len,
                                            &ssl->out_msg[header_len],
                                            MBEDTLS_SSL_OUT_CONTENT_LEN - header_len,
                                            ssl->conf->f_rng, ssl->conf->p_rng);
+            MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
             if (ret != 0) {
                 MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ecdh_make_public", ret);
                 return ret;
@@ -3224,7 +3254,10 @@ static int ssl_write_certificate_verify(mbedtls_ssl_context *ssl)
 
     MBEDTLS_SSL_DEBUG_MSG(2, ("=> write certificate verify"));
 
-    if ((ret = mbedtls_ssl_derive_keys(ssl)) != 0) {
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
+    ret = mbedtls_ssl_derive_keys(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
+    if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ssl_derive_keys", ret);
         return ret;
     }
@@ -3266,7 +3299,10 @@ static int ssl_write_certificate_verify(mbedtls_ssl_context *ssl)
     }
 #endif
 
-    if ((ret = mbedtls_ssl_derive_keys(ssl)) != 0) {
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
+    ret = mbedtls_ssl_derive_keys(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
+    if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ssl_derive_keys", ret);
         return ret;
     }
@@ -3341,12 +3377,15 @@ sign:
     }
 #endif
 
-    if ((ret = mbedtls_pk_sign_restartable(mbedtls_ssl_own_key(ssl),
-                                           md_alg, hash_start, hashlen,
-                                           ssl->out_msg + 6 + offset,
-                                           out_buf_len - 6 - offset,
-                                           &n,
-                                           ssl->conf->f_rng, ssl->conf->p_rng, rs_ctx)) != 0) {
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, SIGN);
+    ret = mbedtls_pk_sign_restartable(mbedtls_ssl_own_key(ssl),
+                                      md_alg, hash_start, hashlen,
+                                      ssl->out_msg + 6 + offset,
+                                      out_buf_len - 6 - offset,
+                                      &n,
+                                      ssl->conf->f_rng, ssl->conf->p_rng, rs_ctx);
+    MBEDTLS_SSL_PROFILE_END(ssl, SIGN);
+    if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_pk_sign", ret);
 #if defined(MBEDTLS_SSL_ECP_RESTARTABLE_ENABLED)
         if (ret == MBEDTLS_ERR_ECP_IN_PROGRESS) {
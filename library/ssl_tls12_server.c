@@ -2284,7 +2284,10 @@ static int ssl_write_server_hello(mbedtls_ssl_context *ssl)
         n = ssl->session_negotiate->id_len;
         ssl->state = MBEDTLS_SSL_SERVER_CHANGE_CIPHER_SPEC;
 
-        if ((ret = mbedtls_ssl_derive_keys(ssl)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
+        ret = mbedtls_ssl_derive_keys(ssl);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ssl_derive_keys", ret);
             return ret;
         }
@@ -2898,11 +2901,14 @@ static int ssl_prepare_server_key_exchange(mbedtls_ssl_context *ssl,
             return ret;
         }
 
-        if ((ret = mbedtls_dhm_make_params(
-                 &ssl->handshake->dhm_ctx,
-                 (int) mbedtls_dhm_get_len(&ssl->handshake->dhm_ctx),
-                 ssl->out_msg + ssl->out_msglen, &len,
-                 ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_dhm_make_params(
+            &ssl->handshake->dhm_ctx,
+            (int) mbedtls_dhm_get_len(&ssl->handshake->dhm_ctx),
+            ssl->out_msg + ssl->out_msglen, &len,
+            ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_make_params", ret);
             return ret;
         }
@@ -3003,8 +3009,10 @@ curve_matching_done:
         p += 2;
 
         /* Generate ECDH private key. */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_generate_key(&key_attributes,
                                   &handshake->xxdh_psa_privkey);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
         if (status != PSA_SUCCESS) {
             ret = PSA_TO_MBEDTLS_ERR(status);
             MBEDTLS_SSL_DEBUG_RET(1, "psa_generate_key", ret);
@@ -3052,11 +3060,14 @@ curve_matching_done:
             return ret;
         }
 
-        if ((ret = mbedtls_ecdh_make_params(
-                 &ssl->handshake->ecdh_ctx, &len,
-                 ssl->out_msg + ssl->out_msglen,
-                 MBEDTLS_SSL_OUT_CONTENT_LEN - ssl->out_msglen,
-                 ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_ecdh_make_params(
+            &ssl->handshake->ecdh_ctx, &len,
+            ssl->out_msg + ssl->out_msglen,
+            MBEDTLS_SSL_OUT_CONTENT_LEN - ssl->out_msglen,
+            ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ecdh_make_params", ret);
             return ret;
         }
@@ -3160,9 +3171,11 @@ curve_matching_done:
 
 #if defined(MBEDTLS_SSL_ASYNC_PRIVATE)
         if (ssl->conf->f_async_sign_start != NULL) {
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, SIGN);
             ret = ssl->conf->f_async_sign_start(ssl,
                                                 mbedtls_ssl_own_cert(ssl),
                                                 md_alg, hash, hashlen);
+            MBEDTLS_SSL_PROFILE_END(ssl, SIGN);
             switch (ret) {
                 case MBEDTLS_ERR_SSL_HW_ACCEL_FALLTHROUGH:
                     /* act as if f_async_sign was null */
@@ -3190,13 +3203,16 @@ curve_matching_done:
          * after the call to ssl_prepare_server_key_exchange.
          * ssl_write_server_key_exchange also takes care of incrementing
          * ssl->out_msglen. */
-        if ((ret = mbedtls_pk_sign(mbedtls_ssl_own_key(ssl),
-                                   md_alg, hash, hashlen,
-                                   ssl->out_msg + ssl->out_msglen + 2,
-                                   out_buf_len - ssl->out_msglen - 2,
-                                   signature_len,
-                                   ssl->conf->f_rng,
-                                   ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, SIGN);
+        ret = mbedtls_pk_sign(mbedtls_ssl_own_key(ssl),
+                              md_alg, hash, hashlen,
+                              ssl->out_msg + ssl->out_msglen + 2,
+                              out_buf_len - ssl->out_msglen - 2,
+                              signature_len,
+                              ssl->conf->f_rng,
+                              ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, SIGN);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_pk_sign", ret);
             return ret;
         }
@@ -3680,11 +3696,14 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
             return MBEDTLS_ERR_SSL_DECODE_ERROR;
         }
 
-        if ((ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
-                                           ssl->handshake->premaster,
-                                           MBEDTLS_PREMASTER_SIZE,
-                                           &ssl->handshake->pmslen,
-                                           ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
+                                      ssl->handshake->premaster,
+                                      MBEDTLS_PREMASTER_SIZE,
+                                      &ssl->handshake->pmslen,
+                                      ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_calc_secret", ret);
             return MBEDTLS_ERR_SSL_DECODE_ERROR;
         }
@@ -3736,11 +3755,13 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
         handshake->xxdh_psa_peerkey_len = data_len;
 
         /* Compute ECDH shared secret. */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_raw_key_agreement(
             PSA_ALG_ECDH, handshake->xxdh_psa_privkey,
             handshake->xxdh_psa_peerkey, handshake->xxdh_psa_peerkey_len,
             handshake->premaster, sizeof(handshake->premaster),
             &handshake->pmslen);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
         if (status != PSA_SUCCESS) {
             ret = PSA_TO_MBEDTLS_ERR(status);
             MBEDTLS_SSL_DEBUG_RET(1, "psa_raw_key_agreement", ret);
@@ -3771,11 +3792,14 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
         MBEDTLS_SSL_DEBUG_ECDH(3, &ssl->handshake->ecdh_ctx,
                                MBEDTLS_DEBUG_ECDH_QP);
 
-        if ((ret = mbedtls_ecdh_calc_secret(&ssl->handshake->ecdh_ctx,
-                                            &ssl->handshake->pmslen,
-                                            ssl->handshake->premaster,
-                                            MBEDTLS_MPI_MAX_SIZE,
-                                            ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_ecdh_calc_secret(&ssl->handshake->ecdh_ctx,
+                                       &ssl->handshake->pmslen,
+                                       ssl->handshake->premaster,
+                                       MBEDTLS_MPI_MAX_SIZE,
+                                       ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ecdh_calc_secret", ret);
             return MBEDTLS_ERR_SSL_DECODE_ERROR;
         }
@@ -3865,9 +3889,12 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
         size_t pms_len;
 
         /* Write length only when we know the actual value */
-        if ((ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
-                                           pms + 2, pms_end - (pms + 2), &pms_len,
-                                           ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
+        ret = mbedtls_dhm_calc_secret(&ssl->handshake->dhm_ctx,
+                                      pms + 2, pms_end - (pms + 2), &pms_len,
+                                      ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_dhm_calc_secret", ret);
             return ret;
         }
@@ -3948,6 +3975,7 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
         size_t zlen = 0;
 
         /* Compute ECDH shared secret. */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
         status = psa_raw_key_agreement(PSA_ALG_ECDH,
                                        handshake->xxdh_psa_privkey,
                                        handshake->xxdh_psa_peerkey,
@@ -3955,6 +3983,7 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
                                        psm + zlen_size,
                                        psm_end - (psm + zlen_size),
                                        &zlen);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
 
         destruction_status = psa_destroy_key(handshake->xxdh_psa_privkey);
         handshake->xxdh_psa_privkey = MBEDTLS_SVC_KEY_ID_INIT;
@@ -4036,7 +4065,10 @@ static int ssl_parse_client_key_exchange(mbedtls_ssl_context *ssl)
         return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
     }
 
-    if ((ret = mbedtls_ssl_derive_keys(ssl)) != 0) {
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
+    ret = mbedtls_ssl_derive_keys(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
+    if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_ssl_derive_keys", ret);
         return ret;
     }
@@ -4207,9 +4239,12 @@ static int ssl_parse_certificate_verify(mbedtls_ssl_context *ssl)
         }
     }
 
-    if ((ret = mbedtls_pk_verify(peer_pk,
-                                 md_alg, hash_start, hashlen,
-                                 ssl->in_msg + i, sig_len)) != 0) {
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, VERIFY_SIGNATURE);
+    ret = mbedtls_pk_verify(peer_pk,
+                            md_alg, hash_start, hashlen,
+                            ssl->in_msg + i, sig_len);
+    MBEDTLS_SSL_PROFILE_END(ssl, VERIFY_SIGNATURE);
+    if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_pk_verify", ret);
         return ret;
     }
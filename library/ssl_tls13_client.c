@@ -1284,7 +1284,9 @@ int mbedtls_ssl_tls13_finalize_client_hello(mbedtls_ssl_context *ssl)
         /* Start the TLS 1.3 key schedule:
          *     Set the PSK and derive early secret.
          */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
         ret = mbedtls_ssl_tls13_key_schedule_stage_early(ssl);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
         if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(
                 1, "mbedtls_ssl_tls13_key_schedule_stage_early", ret);
@@ -1292,7 +1294,9 @@ int mbedtls_ssl_tls13_finalize_client_hello(mbedtls_ssl_context *ssl)
         }
 
         /* Derive early data key material */
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
         ret = mbedtls_ssl_tls13_compute_early_transform(ssl);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
         if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(
                 1, "mbedtls_ssl_tls13_compute_early_transform", ret);
@@ -1951,7 +1955,9 @@ static int ssl_tls13_postprocess_server_hello(mbedtls_ssl_context *ssl)
         MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL)
 #endif
     {
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
         ret = mbedtls_ssl_tls13_key_schedule_stage_early(ssl);
+        MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
         if (ret != 0) {
             MBEDTLS_SSL_DEBUG_RET(
                 1, "mbedtls_ssl_tls13_key_schedule_stage_early", ret);
@@ -1959,7 +1965,9 @@ static int ssl_tls13_postprocess_server_hello(mbedtls_ssl_context *ssl)
         }
     }
 
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_compute_handshake_transform(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1,
                               "mbedtls_ssl_tls13_compute_handshake_transform",
@@ -2527,7 +2535,9 @@ static int ssl_tls13_process_server_finished(mbedtls_ssl_context *ssl)
         return ret;
     }
 
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_compute_application_transform(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_PEND_FATAL_ALERT(
             MBEDTLS_SSL_ALERT_MSG_HANDSHAKE_FAILURE,
@@ -2622,7 +2632,9 @@ static int ssl_tls13_write_client_finished(mbedtls_ssl_context *ssl)
         return ret;
     }
 
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_compute_resumption_master_secret(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(
             1, "mbedtls_ssl_tls13_compute_resumption_master_secret ", ret);
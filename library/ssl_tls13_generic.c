@@ -312,10 +312,13 @@ static int ssl_tls13_parse_certificate_verify(mbedtls_ssl_context *ssl,
     }
 #endif /* MBEDTLS_X509_RSASSA_PSS_SUPPORT */
 
-    if ((ret = mbedtls_pk_verify_ext(sig_alg, options,
-                                     &ssl->session_negotiate->peer_cert->pk,
-                                     md_alg, verify_hash, verify_hash_len,
-                                     p, signature_len)) == 0) {
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, VERIFY_SIGNATURE);
+    ret = mbedtls_pk_verify_ext(sig_alg, options,
+                                &ssl->session_negotiate->peer_cert->pk,
+                                md_alg, verify_hash, verify_hash_len,
+                                p, signature_len);
+    MBEDTLS_SSL_PROFILE_END(ssl, VERIFY_SIGNATURE);
+    if (ret == 0) {
         return 0;
     }
     MBEDTLS_SSL_DEBUG_RET(1, "mbedtls_pk_verify_ext", ret);
@@ -697,6 +700,7 @@ static int ssl_tls13_validate_certificate(mbedtls_ssl_context *ssl)
     /*
      * Main check: verify certificate
      */
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, VERIFY_CHAIN);
     ret = mbedtls_x509_crt_verify_with_profile(
         ssl->session_negotiate->peer_cert,
         ca_chain, ca_crl,
@@ -704,6 +708,7 @@ static int ssl_tls13_validate_certificate(mbedtls_ssl_context *ssl)
         ssl->hostname,
         &verify_result,
         ssl->conf->f_vrfy, ssl->conf->p_vrfy);
+    MBEDTLS_SSL_PROFILE_END(ssl, VERIFY_CHAIN);
 
     if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1, "x509_verify_cert", ret);
@@ -996,6 +1001,45 @@ int mbedtls_ssl_tls13_check_sig_alg_cert_key_match(uint16_t sig_alg,
     return 0;
 }
 
+#if defined(MBEDTLS_SSL_ASYNC_PRIVATE) && defined(MBEDTLS_SSL_SRV_C)
+/*
+ * Get the result of an asynchronous CertificateVerify signature started with
+ * f_async_sign_start and write the signature algorithm, the signature length
+ * and the signature at buf.
+ */
+MBEDTLS_CHECK_RETURN_CRITICAL
+static int ssl_tls13_resume_certificate_verify(mbedtls_ssl_context *ssl,
+                                               unsigned char *buf,
+                                               unsigned char *end,
+                                               size_t *out_len)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    size_t signature_len = 0;
+
+    ret = ssl->conf->f_async_resume(ssl, buf + 4, &signature_len,
+                                    (size_t) (end - (buf + 4)));
+    if (ret != MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS) {
+        ssl->handshake->async_in_progress = 0;
+        mbedtls_ssl_set_async_operation_data(ssl, NULL);
+    }
+    MBEDTLS_SSL_DEBUG_RET(2, "ssl_tls13_resume_certificate_verify", ret);
+    if (ret != 0) {
+        return ret;
+    }
+
+    MBEDTLS_SSL_DEBUG_MSG(2, ("CertificateVerify signature with %s",
+                              mbedtls_ssl_sig_alg_to_str(
+                                  ssl->handshake->async_sig_alg)));
+
+    MBEDTLS_PUT_UINT16_BE(ssl->handshake->async_sig_alg, buf, 0);
+    MBEDTLS_PUT_UINT16_BE(signature_len, buf, 2);
+
+    *out_len = 4 + signature_len;
+
+    return 0;
+}
+#endif /* MBEDTLS_SSL_ASYNC_PRIVATE && MBEDTLS_SSL_SRV_C */
+
 MBEDTLS_CHECK_RETURN_CRITICAL
 static int ssl_tls13_write_certificate_verify_body(mbedtls_ssl_context *ssl,
                                                    unsigned char *buf,
@@ -1016,7 +1060,32 @@ static int ssl_tls13_write_certificate_verify_body(mbedtls_ssl_context *ssl,
 
     *out_len = 0;
 
+#if defined(MBEDTLS_SSL_ASYNC_PRIVATE) && defined(MBEDTLS_SSL_SRV_C)
+    /* If there is an ongoing signature operation, the message is already
+     * prepared up to the signature: resume signing. */
+    if (ssl->handshake->async_in_progress != 0) {
+        MBEDTLS_SSL_DEBUG_MSG(2, ("resuming signature operation"));
+        MBEDTLS_SSL_CHK_BUF_PTR(p, end, 4);
+        return ssl_tls13_resume_certificate_verify(ssl, p, end, out_len);
+    }
+#endif /* MBEDTLS_SSL_ASYNC_PRIVATE && MBEDTLS_SSL_SRV_C */
+
     own_key = mbedtls_ssl_own_key(ssl);
+#if defined(MBEDTLS_SSL_ASYNC_PRIVATE) && defined(MBEDTLS_SSL_SRV_C)
+    /* The private key may only be available through the asynchronous
+     * callbacks: the public key in the certificate tells which signature
+     * algorithms can be used. */
+    if (own_key == NULL && ssl->conf->endpoint == MBEDTLS_SSL_IS_SERVER &&
+        mbedtls_ssl_own_cert(ssl) != NULL) {
+        if (ssl->conf->async_private_tls13 !=
+            MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_ENABLED ||
+            ssl->conf->f_async_sign_start == NULL) {
+            MBEDTLS_SSL_DEBUG_MSG(1, ("got no private key"));
+            return MBEDTLS_ERR_SSL_PRIVATE_KEY_REQUIRED;
+        }
+        own_key = &mbedtls_ssl_own_cert(ssl)->pk;
+    }
+#endif /* MBEDTLS_SSL_ASYNC_PRIVATE && MBEDTLS_SSL_SRV_C */
     if (own_key == NULL) {
         MBEDTLS_SSL_DEBUG_MSG(1, ("should never happen"));
         return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
@@ -1086,10 +1155,48 @@ static int ssl_tls13_write_certificate_verify_body(mbedtls_ssl_context *ssl,
 
         MBEDTLS_SSL_DEBUG_BUF(3, "verify hash", verify_hash, verify_hash_len);
 
-        if ((ret = mbedtls_pk_sign_ext(pk_type, own_key,
-                                       md_alg, verify_hash, verify_hash_len,
-                                       p + 4, (size_t) (end - (p + 4)), &signature_len,
-                                       ssl->conf->f_rng, ssl->conf->p_rng)) != 0) {
+#if defined(MBEDTLS_SSL_ASYNC_PRIVATE) && defined(MBEDTLS_SSL_SRV_C)
+        if (ssl->conf->endpoint == MBEDTLS_SSL_IS_SERVER &&
+            ssl->conf->async_private_tls13 ==
+            MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_ENABLED &&
+            ssl->conf->f_async_sign_start != NULL) {
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, SIGN);
+            ret = ssl->conf->f_async_sign_start(ssl,
+                                                mbedtls_ssl_own_cert(ssl),
+                                                md_alg, verify_hash,
+                                                verify_hash_len);
+            MBEDTLS_SSL_PROFILE_END(ssl, SIGN);
+            switch (ret) {
+                case MBEDTLS_ERR_SSL_HW_ACCEL_FALLTHROUGH:
+                    /* act as if f_async_sign was null */
+                    if (mbedtls_ssl_own_key(ssl) == NULL) {
+                        MBEDTLS_SSL_DEBUG_MSG(1, ("got no private key"));
+                        return MBEDTLS_ERR_SSL_PRIVATE_KEY_REQUIRED;
+                    }
+                    break;
+                case 0:
+                    ssl->handshake->async_in_progress = 1;
+                    ssl->handshake->async_sig_alg = *sig_alg;
+                    return ssl_tls13_resume_certificate_verify(ssl, p, end,
+                                                               out_len);
+                case MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS:
+                    ssl->handshake->async_in_progress = 1;
+                    ssl->handshake->async_sig_alg = *sig_alg;
+                    return MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS;
+                default:
+                    MBEDTLS_SSL_DEBUG_RET(1, "f_async_sign_start", ret);
+                    return ret;
+            }
+        }
+#endif /* MBEDTLS_SSL_ASYNC_PRIVATE && MBEDTLS_SSL_SRV_C */
+
+        MBEDTLS_SSL_PROFILE_BEGIN(ssl, SIGN);
+        ret = mbedtls_pk_sign_ext(pk_type, own_key,
+                                  md_alg, verify_hash, verify_hash_len,
+                                  p + 4, (size_t) (end - (p + 4)), &signature_len,
+                                  ssl->conf->f_rng, ssl->conf->p_rng);
+        MBEDTLS_SSL_PROFILE_END(ssl, SIGN);
+        if (ret != 0) {
             MBEDTLS_SSL_DEBUG_MSG(2, ("CertificateVerify signature failed with %s",
                                       mbedtls_ssl_sig_alg_to_str(*sig_alg)));
             MBEDTLS_SSL_DEBUG_RET(2, "mbedtls_pk_sign_ext", ret);
@@ -1599,8 +1706,10 @@ int mbedtls_ssl_tls13_generate_and_write_xxdh_key_exchange(
     psa_set_key_bits(&key_attributes, handshake->xxdh_psa_bits);
 
     /* Generate ECDH/FFDH private key. */
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
     status = psa_generate_key(&key_attributes,
                               &handshake->xxdh_psa_privkey);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
     if (status != PSA_SUCCESS) {
         ret = PSA_TO_MBEDTLS_ERR(status);
         MBEDTLS_SSL_DEBUG_RET(1, "psa_generate_key", ret);
@@ -1017,6 +1017,16 @@ int mbedtls_ssl_tls13_populate_transform(
     memcpy(transform->iv_enc, iv_enc, traffic_keys->iv_len);
     memcpy(transform->iv_dec, iv_dec, traffic_keys->iv_len);
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+    if (traffic_keys->key_len > sizeof(transform->key_enc)) {
+        return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    }
+    transform->cipher_type = (mbedtls_cipher_type_t) ciphersuite_info->cipher;
+    transform->keylen = traffic_keys->key_len;
+    memcpy(transform->key_enc, key_enc, traffic_keys->key_len);
+    memcpy(transform->key_dec, key_dec, traffic_keys->key_len);
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 #if !defined(MBEDTLS_USE_PSA_CRYPTO)
     if ((ret = mbedtls_cipher_setkey(&transform->cipher_ctx_enc,
                                      key_enc, mbedtls_cipher_info_get_key_bitlen(cipher_info),
@@ -1515,10 +1525,12 @@ static int ssl_tls13_key_schedule_stage_handshake(mbedtls_ssl_context *ssl)
                 return MBEDTLS_ERR_SSL_ALLOC_FAILED;
             }
 
+            MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_EXCHANGE);
             status = psa_raw_key_agreement(
                 alg, handshake->xxdh_psa_privkey,
                 handshake->xxdh_psa_peerkey, handshake->xxdh_psa_peerkey_len,
                 shared_secret, shared_secret_len, &shared_secret_len);
+            MBEDTLS_SSL_PROFILE_END(ssl, KEY_EXCHANGE);
             if (status != PSA_SUCCESS) {
                 ret = PSA_TO_MBEDTLS_ERR(status);
                 MBEDTLS_SSL_DEBUG_RET(1, "psa_raw_key_agreement", ret);
@@ -1894,4 +1906,90 @@ int mbedtls_ssl_tls13_export_handshake_psk(mbedtls_ssl_context *ssl,
 }
 #endif /* MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_SOME_PSK_ENABLED */
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+/*
+ * Key update, see RFC 8446 section 7.2:
+ *
+ *   application_traffic_secret_N+1 =
+ *       HKDF-Expand-Label(application_traffic_secret_N,
+ *                         "traffic upd", "", Hash.length)
+ */
+int mbedtls_ssl_tls13_next_traffic_keys(mbedtls_ssl_context *ssl,
+                                        int direction,
+                                        mbedtls_ssl_traffic_keys *keys)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    const mbedtls_ssl_ciphersuite_t *ciphersuite_info;
+    unsigned char *secret;
+    unsigned char next_secret[MBEDTLS_TLS1_3_MD_MAX_SIZE];
+    psa_algorithm_t hash_alg;
+    size_t hash_len;
+    size_t key_len, iv_len;
+    int is_client_secret;
+
+    if (mbedtls_ssl_is_handshake_over(ssl) == 0 || ssl->session == NULL ||
+        ssl->tls_version != MBEDTLS_SSL_VERSION_TLS1_3) {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    if (direction == MBEDTLS_SSL_TRAFFIC_KEYS_TX) {
+        is_client_secret = ssl->conf->endpoint == MBEDTLS_SSL_IS_CLIENT;
+    } else if (direction == MBEDTLS_SSL_TRAFFIC_KEYS_RX) {
+        is_client_secret = ssl->conf->endpoint == MBEDTLS_SSL_IS_SERVER;
+    } else {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    secret = is_client_secret ?
+             ssl->session->app_secrets.client_application_traffic_secret_N :
+             ssl->session->app_secrets.server_application_traffic_secret_N;
+
+    ciphersuite_info = mbedtls_ssl_ciphersuite_from_id(ssl->session->ciphersuite);
+    if (ciphersuite_info == NULL) {
+        return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    }
+
+    ret = ssl_tls13_get_cipher_key_info(ciphersuite_info, &key_len, &iv_len);
+    if (ret != 0) {
+        return ret;
+    }
+    if (key_len > sizeof(keys->key) || iv_len > sizeof(keys->iv)) {
+        return MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    }
+
+    hash_alg = mbedtls_md_psa_alg_from_type(ciphersuite_info->mac);
+    hash_len = PSA_HASH_LENGTH(hash_alg);
+
+    ret = mbedtls_ssl_tls13_hkdf_expand_label(
+        hash_alg, secret, hash_len,
+        MBEDTLS_SSL_TLS1_3_LBL_WITH_LEN(traffic_upd),
+        NULL, 0,
+        next_secret, hash_len);
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    ret = ssl_tls13_make_traffic_key(hash_alg, next_secret, hash_len,
+                                     keys->key, key_len,
+                                     keys->iv, iv_len);
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    memcpy(secret, next_secret, hash_len);
+
+    keys->tls_version = MBEDTLS_SSL_VERSION_TLS1_3;
+    keys->cipher = (mbedtls_cipher_type_t) ciphersuite_info->cipher;
+    keys->key_len = key_len;
+    keys->iv_len = iv_len;
+    keys->tag_len =
+        (ciphersuite_info->flags & MBEDTLS_CIPHERSUITE_SHORT_TAG) ? 8 : 16;
+    memset(keys->rec_seq, 0, sizeof(keys->rec_seq));
+
+cleanup:
+    mbedtls_platform_zeroize(next_secret, sizeof(next_secret));
+    return ret;
+}
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 #endif /* MBEDTLS_SSL_PROTO_TLS1_3 */
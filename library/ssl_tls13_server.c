@@ -117,7 +117,7 @@ static int ssl_tls13_offered_psks_check_identity_match_ticket(
 
     /* Ticket parser is not configured, Skip */
     if (ssl->conf->f_ticket_parse == NULL || identity_len == 0) {
-        return 0;
+        return SSL_TLS1_3_OFFERED_PSK_NOT_MATCH;
     }
 
     /* We create a copy of the encrypted ticket since the ticket parsing
@@ -1755,7 +1755,9 @@ static int ssl_tls13_postprocess_client_hello(mbedtls_ssl_context *ssl)
     ssl->handshake->sni_name_len = 0;
 #endif /* MBEDTLS_SSL_SERVER_NAME_INDICATION */
 
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_key_schedule_stage_early(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1,
                               "mbedtls_ssl_tls1_3_key_schedule_stage_early", ret);
@@ -2219,7 +2221,9 @@ MBEDTLS_CHECK_RETURN_CRITICAL
 static int ssl_tls13_finalize_server_hello(mbedtls_ssl_context *ssl)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_compute_handshake_transform(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(1,
                               "mbedtls_ssl_tls13_compute_handshake_transform",
@@ -2631,7 +2635,9 @@ static int ssl_tls13_write_server_finished(mbedtls_ssl_context *ssl)
         return ret;
     }
 
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_compute_application_transform(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_PEND_FATAL_ALERT(
             MBEDTLS_SSL_ALERT_MSG_HANDSHAKE_FAILURE,
@@ -2666,7 +2672,9 @@ static int ssl_tls13_process_client_finished(mbedtls_ssl_context *ssl)
         return ret;
     }
 
+    MBEDTLS_SSL_PROFILE_BEGIN(ssl, KEY_SCHEDULE);
     ret = mbedtls_ssl_tls13_compute_resumption_master_secret(ssl);
+    MBEDTLS_SSL_PROFILE_END(ssl, KEY_SCHEDULE);
     if (ret != 0) {
         MBEDTLS_SSL_DEBUG_RET(
             1, "mbedtls_ssl_tls13_compute_resumption_master_secret", ret);
@@ -23,6 +23,8 @@
 #include "mbedtls/error.h"
 #include "mbedtls/oid.h"
 #include "mbedtls/platform_util.h"
+#include "pk_internal.h"
+#include "platform_util_internal.h"
 
 #include <string.h>
 
@@ -30,6 +32,11 @@
 #include "mbedtls/pem.h"
 #endif
 
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+#include "psa/crypto.h"
+#include "md_psa.h"
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
 #include "mbedtls/platform.h"
 
 #if defined(MBEDTLS_HAVE_TIME)
@@ -208,6 +215,27 @@ static int x509_get_crl_entry_ext(unsigned char **p,
     return 0;
 }
 
+/*
+ * X.509 CRL Entry, from the content of its SEQUENCE
+ */
+static int x509_get_entry_content(unsigned char **p,
+                                  const unsigned char *end,
+                                  mbedtls_x509_crl_entry *entry)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if ((ret = mbedtls_x509_get_serial(p, end, &entry->serial)) != 0) {
+        return ret;
+    }
+
+    if ((ret = mbedtls_x509_get_time(p, end,
+                                     &entry->revocation_date)) != 0) {
+        return ret;
+    }
+
+    return x509_get_crl_entry_ext(p, end, &entry->entry_ext);
+}
+
 /*
  * X.509 CRL Entries
  */
@@ -248,17 +276,7 @@ static int x509_get_entries(unsigned char **p,
         cur_entry->raw.len = len2;
         end2 = *p + len2;
 
-        if ((ret = mbedtls_x509_get_serial(p, end2, &cur_entry->serial)) != 0) {
-            return ret;
-        }
-
-        if ((ret = mbedtls_x509_get_time(p, end2,
-                                         &cur_entry->revocation_date)) != 0) {
-            return ret;
-        }
-
-        if ((ret = x509_get_crl_entry_ext(p, end2,
-                                          &cur_entry->entry_ext)) != 0) {
+        if ((ret = x509_get_entry_content(p, end2, cur_entry)) != 0) {
             return ret;
         }
 
@@ -277,10 +295,31 @@ static int x509_get_entries(unsigned char **p,
 }
 
 /*
- * Parse one  CRLs in DER format and append it to the chained list
+ * Release a buffer that was handed over to x509_crl_parse_der_internal().
  */
-int mbedtls_x509_crl_parse_der(mbedtls_x509_crl *chain,
-                               const unsigned char *buf, size_t buflen)
+static void x509_crl_free_raw(unsigned char *buf, size_t buflen,
+                              size_t map_len)
+{
+#if defined(MBEDTLS_FS_IO)
+    if (map_len != 0) {
+        mbedtls_platform_unmap_file(buf, map_len);
+        return;
+    }
+#else
+    (void) map_len;
+#endif
+    mbedtls_zeroize_and_free(buf, buflen);
+}
+
+/*
+ * Parse one  CRLs in DER format and append it to the chained list.
+ * If make_copy is 0, the CRL takes ownership of buf, even if parsing fails.
+ * buf must then have been allocated with mbedtls_calloc() if map_len is 0,
+ * or be a file mapping of map_len bytes otherwise.
+ */
+static int x509_crl_parse_der_internal(mbedtls_x509_crl *chain,
+                                       unsigned char *buf, size_t buflen,
+                                       int make_copy, size_t map_len)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
     size_t len;
@@ -292,6 +331,9 @@ int mbedtls_x509_crl_parse_der(mbedtls_x509_crl *chain,
      * Check for valid input
      */
     if (crl == NULL || buf == NULL) {
+        if (!make_copy) {
+            x509_crl_free_raw(buf, buflen, map_len);
+        }
         return MBEDTLS_ERR_X509_BAD_INPUT_DATA;
     }
 
@@ -311,6 +353,9 @@ int mbedtls_x509_crl_parse_der(mbedtls_x509_crl *chain,
 
         if (crl->next == NULL) {
             mbedtls_x509_crl_free(crl);
+            if (!make_copy) {
+                x509_crl_free_raw(buf, buflen, map_len);
+            }
             return MBEDTLS_ERR_X509_ALLOC_FAILED;
         }
 
@@ -318,19 +363,27 @@ int mbedtls_x509_crl_parse_der(mbedtls_x509_crl *chain,
         crl = crl->next;
     }
 
-    /*
-     * Copy raw DER-encoded CRL
-     */
     if (buflen == 0) {
+        if (!make_copy) {
+            x509_crl_free_raw(buf, buflen, map_len);
+        }
         return MBEDTLS_ERR_X509_INVALID_FORMAT;
     }
 
-    p = mbedtls_calloc(1, buflen);
-    if (p == NULL) {
-        return MBEDTLS_ERR_X509_ALLOC_FAILED;
-    }
+    /*
+     * Copy raw DER-encoded CRL, unless the caller hands it over
+     */
+    if (make_copy) {
+        p = mbedtls_calloc(1, buflen);
+        if (p == NULL) {
+            return MBEDTLS_ERR_X509_ALLOC_FAILED;
+        }
 
-    memcpy(p, buf, buflen);
+        memcpy(p, buf, buflen);
+    } else {
+        p = buf;
+        crl->raw_map_len = map_len;
+    }
 
     crl->raw.p = p;
     crl->raw.len = buflen;
@@ -498,6 +551,12 @@ int mbedtls_x509_crl_parse_der(mbedtls_x509_crl *chain,
     return 0;
 }
 
+int mbedtls_x509_crl_parse_der(mbedtls_x509_crl *chain,
+                               const unsigned char *buf, size_t buflen)
+{
+    return x509_crl_parse_der_internal(chain, (unsigned char *) buf, buflen, 1, 0);
+}
+
 /*
  * Parse one or more CRLs and add them to the chained list
  */
@@ -536,8 +595,11 @@ int mbedtls_x509_crl_parse(mbedtls_x509_crl *chain, const unsigned char *buf, si
             buflen -= use_len;
             buf += use_len;
 
-            if ((ret = mbedtls_x509_crl_parse_der(chain,
-                                                  pem.buf, pem.buflen)) != 0) {
+            /* Hand the decoded CRL over instead of copying it */
+            ret = x509_crl_parse_der_internal(chain, pem.buf, pem.buflen, 0, 0);
+            pem.buf = NULL;
+            pem.buflen = 0;
+            if (ret != 0) {
                 mbedtls_pem_free(&pem);
                 return ret;
             }
@@ -566,16 +628,465 @@ int mbedtls_x509_crl_parse(mbedtls_x509_crl *chain, const unsigned char *buf, si
 int mbedtls_x509_crl_parse_file(mbedtls_x509_crl *chain, const char *path)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
+    size_t n, map_len;
     unsigned char *buf;
 
-    if ((ret = mbedtls_pk_load_file(path, &buf, &n)) != 0) {
+    if ((ret = mbedtls_pk_map_file(path, &buf, &n, &map_len)) != 0) {
         return ret;
     }
 
+    /* mbedtls_pk_map_file() counts the null terminator of PEM data.
+     * Hand DER data over instead of copying it, or parse it in place if
+     * the file is mapped. */
+    if (n > 0 && buf[n - 1] != '\0') {
+        return x509_crl_parse_der_internal(chain, buf, n, 0, map_len);
+    }
+
     ret = mbedtls_x509_crl_parse(chain, buf, n);
 
-    mbedtls_zeroize_and_free(buf, n);
+    mbedtls_pk_unmap_file(buf, n, map_len);
+
+    return ret;
+}
+#endif /* MBEDTLS_FS_IO */
+
+/*
+ * Size of the window of mbedtls_x509_crl_parse_stream(): the largest
+ * element of a CRL other than the list of entries, and the largest entry.
+ */
+#define X509_CRL_STREAM_WINDOW 4096
+
+/*
+ * State of mbedtls_x509_crl_parse_stream(). The bytes consumed from the
+ * stream are kept in buf while keep is set, and hashed while hashing is set.
+ */
+typedef struct {
+    unsigned char *buf;
+    size_t len;
+    size_t size;
+    int keep;
+    int hashing;
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    psa_hash_operation_t op;
+#else
+    mbedtls_md_context_t md;
+#endif
+    mbedtls_x509_crl_entry_cb_t *f_entry;
+    void *p_entry;
+} x509_crl_stream_state;
+
+static int x509_crl_stream_tap(void *p_tap,
+                               const unsigned char *buf, size_t len)
+{
+    x509_crl_stream_state *st = p_tap;
+
+    if (st->keep && len > 0) {
+        if (len > st->size - st->len) {
+            size_t size = st->size * 2 > st->len + len ?
+                          st->size * 2 : st->len + len;
+            unsigned char *p = mbedtls_calloc(1, size);
+
+            if (p == NULL) {
+                return MBEDTLS_ERR_X509_ALLOC_FAILED;
+            }
+            if (st->buf != NULL) {
+                memcpy(p, st->buf, st->len);
+                mbedtls_zeroize_and_free(st->buf, st->size);
+            }
+            st->buf = p;
+            st->size = size;
+        }
+
+        memcpy(st->buf + st->len, buf, len);
+        st->len += len;
+    }
+
+    if (st->hashing) {
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+        if (psa_hash_update(&st->op, buf, len) != PSA_SUCCESS) {
+            return MBEDTLS_ERR_X509_FATAL_ERROR;
+        }
+#else
+        return mbedtls_md_update(&st->md, buf, len);
+#endif
+    }
+
+    return 0;
+}
+
+/*
+ * Start hashing the TBSCertList, including the part of it already kept.
+ */
+static int x509_crl_stream_hash_start(x509_crl_stream_state *st,
+                                      mbedtls_md_type_t md_alg)
+{
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    if (psa_hash_setup(&st->op,
+                       mbedtls_md_psa_alg_from_type(md_alg)) != PSA_SUCCESS) {
+        return MBEDTLS_ERR_X509_UNKNOWN_SIG_ALG;
+    }
+    if (psa_hash_update(&st->op, st->buf, st->len) != PSA_SUCCESS) {
+        return MBEDTLS_ERR_X509_FATAL_ERROR;
+    }
+#else
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if (mbedtls_md_setup(&st->md, mbedtls_md_info_from_type(md_alg), 0) != 0) {
+        return MBEDTLS_ERR_X509_UNKNOWN_SIG_ALG;
+    }
+    if ((ret = mbedtls_md_starts(&st->md)) != 0 ||
+        (ret = mbedtls_md_update(&st->md, st->buf, st->len)) != 0) {
+        return ret;
+    }
+#endif
+    st->hashing = 1;
+
+    return 0;
+}
+
+static int x509_crl_stream_entry(void *ctx, int tag,
+                                 unsigned char *start, size_t len)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    x509_crl_stream_state *st = ctx;
+    mbedtls_x509_crl_entry entry;
+    unsigned char *p = start;
+
+    memset(&entry, 0, sizeof(entry));
+    entry.raw.tag = tag;
+    entry.raw.p = start;
+    entry.raw.len = len;
+
+    if ((ret = x509_get_entry_content(&p, start + len, &entry)) != 0) {
+        return ret;
+    }
+
+    if (st->f_entry != NULL) {
+        return st->f_entry(st->p_entry, &entry);
+    }
+
+    return 0;
+}
+
+/*
+ * Write the header of a constructed SEQUENCE and return its length.
+ */
+static size_t x509_crl_put_seq_header(unsigned char *p, size_t len)
+{
+    size_t n = 0, i;
+
+    *p++ = MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE;
+
+    if (len < 0x80) {
+        *p = (unsigned char) len;
+        return 2;
+    }
+
+    for (i = len; i != 0; i >>= 8) {
+        n++;
+    }
+
+    *p++ = (unsigned char) (0x80 | n);
+    for (i = n; i > 0; i--) {
+        p[i - 1] = (unsigned char) len;
+        len >>= 8;
+    }
+
+    return 2 + n;
+}
+
+/*
+ * Parse a CRL from a stream, without keeping its entries
+ */
+int mbedtls_x509_crl_parse_stream(mbedtls_x509_crl *chain,
+                                  mbedtls_asn1_stream_read_t *f_read,
+                                  void *p_read,
+                                  mbedtls_x509_crl_entry_cb_t *f_entry,
+                                  void *p_entry)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_asn1_stream s;
+    x509_crl_stream_state st;
+    size_t len, crl_end, tbs_end, tbs_header_len, sig_start;
+    unsigned char *p, *end, *der;
+    unsigned char crl_header[6], tbs_header[6];
+    size_t crl_header_len, tbs_header_len_new, der_len;
+    int tag, entries_allowed = 1;
+    mbedtls_x509_buf sig_oid, sig_params;
+    mbedtls_md_type_t md_alg;
+    mbedtls_pk_type_t pk_alg;
+    void *sig_opts = NULL;
+    unsigned char hash[MBEDTLS_MD_MAX_SIZE];
+    unsigned char *tbs_hash = NULL;
+    size_t hash_len = 0;
+    mbedtls_x509_crl *crl;
+
+    if (chain == NULL || f_read == NULL) {
+        return MBEDTLS_ERR_X509_BAD_INPUT_DATA;
+    }
+
+    memset(&st, 0, sizeof(st));
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    st.op = psa_hash_operation_init();
+#else
+    mbedtls_md_init(&st.md);
+#endif
+    st.f_entry = f_entry;
+    st.p_entry = p_entry;
+
+    if ((ret = mbedtls_asn1_stream_setup(&s, f_read, p_read,
+                                         X509_CRL_STREAM_WINDOW)) != 0) {
+        return ret;
+    }
+    mbedtls_asn1_stream_set_tap(&s, x509_crl_stream_tap, &st);
+
+    /*
+     * CertificateList  ::=  SEQUENCE  {
+     *      tbsCertList          TBSCertList,
+     *      signatureAlgorithm   AlgorithmIdentifier,
+     *      signatureValue       BIT STRING  }
+     *
+     * The headers of CertificateList and TBSCertList are rewritten once the
+     * entries are removed. Everything else is kept, except the entries.
+     */
+    if ((ret = mbedtls_asn1_stream_get_tag(&s, &len,
+                                           MBEDTLS_ASN1_CONSTRUCTED |
+                                           MBEDTLS_ASN1_SEQUENCE)) != 0) {
+        ret = MBEDTLS_ERR_X509_INVALID_FORMAT;
+        goto cleanup;
+    }
+    crl_end = mbedtls_asn1_stream_offset(&s) + len;
+
+    st.keep = 1;
+    if ((ret = mbedtls_asn1_stream_get_tag(&s, &len,
+                                           MBEDTLS_ASN1_CONSTRUCTED |
+                                           MBEDTLS_ASN1_SEQUENCE)) != 0) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT, ret);
+        goto cleanup;
+    }
+    tbs_header_len = st.len;
+    tbs_end = mbedtls_asn1_stream_offset(&s) + len;
+    if (tbs_end > crl_end) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT,
+                                MBEDTLS_ERR_ASN1_OUT_OF_DATA);
+        goto cleanup;
+    }
+
+    /*
+     * Version  ::=  INTEGER  OPTIONAL {  v1(0), v2(1)  }
+     *
+     * signature            AlgorithmIdentifier
+     *
+     * The rest of the TBSCertList is hashed as it goes by, with the hash
+     * algorithm of the signature.
+     */
+    if ((ret = mbedtls_asn1_stream_peek_tag(&s, &tag)) != 0 ||
+        (tag == MBEDTLS_ASN1_INTEGER &&
+         (ret = mbedtls_asn1_stream_get_element(&s, &p, &len)) != 0) ||
+        (ret = mbedtls_asn1_stream_get_element(&s, &p, &len)) != 0) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT, ret);
+        goto cleanup;
+    }
+
+    end = p + len;
+    if ((ret = mbedtls_x509_get_alg(&p, end, &sig_oid, &sig_params)) != 0) {
+        goto cleanup;
+    }
+    if (mbedtls_x509_get_sig_alg(&sig_oid, &sig_params,
+                                 &md_alg, &pk_alg, &sig_opts) != 0) {
+        ret = MBEDTLS_ERR_X509_UNKNOWN_SIG_ALG;
+        goto cleanup;
+    }
+    if ((ret = x509_crl_stream_hash_start(&st, md_alg)) != 0) {
+        goto cleanup;
+    }
+
+    /*
+     * issuer               Name
+     * thisUpdate           Time
+     * nextUpdate           Time OPTIONAL
+     */
+    if ((ret = mbedtls_asn1_stream_get_element(&s, &p, &len)) != 0 ||
+        (ret = mbedtls_asn1_stream_get_element(&s, &p, &len)) != 0) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT, ret);
+        goto cleanup;
+    }
+
+    if (mbedtls_asn1_stream_offset(&s) < tbs_end &&
+        ((ret = mbedtls_asn1_stream_peek_tag(&s, &tag)) != 0 ||
+         ((tag == MBEDTLS_ASN1_UTC_TIME ||
+           tag == MBEDTLS_ASN1_GENERALIZED_TIME) &&
+          (ret = mbedtls_asn1_stream_get_element(&s, &p, &len)) != 0))) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT, ret);
+        goto cleanup;
+    }
+
+    /*
+     * revokedCertificates    SEQUENCE OF SEQUENCE   {
+     *      userCertificate        CertificateSerialNumber,
+     *      revocationDate         Time,
+     *      crlEntryExtensions     Extensions OPTIONAL
+     *                                   -- if present, MUST be v2
+     *                        } OPTIONAL
+     *
+     * crlExtensions          EXPLICIT Extensions OPTIONAL
+     *                              -- if present, MUST be v2
+     *
+     * Anything else is kept, and rejected when the rebuilt CRL is parsed.
+     */
+    while (mbedtls_asn1_stream_offset(&s) < tbs_end) {
+        if ((ret = mbedtls_asn1_stream_peek_tag(&s, &tag)) != 0) {
+            ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT, ret);
+            goto cleanup;
+        }
+
+        if (entries_allowed &&
+            tag == (MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE)) {
+            st.keep = 0;
+            ret = mbedtls_asn1_stream_traverse_sequence_of(
+                &s, 0xff, MBEDTLS_ASN1_CONSTRUCTED | MBEDTLS_ASN1_SEQUENCE,
+                0, 0, x509_crl_stream_entry, &st);
+            st.keep = 1;
+        } else {
+            ret = mbedtls_asn1_stream_get_element(&s, &p, &len);
+        }
+        entries_allowed = 0;
+
+        if (ret != 0) {
+            goto cleanup;
+        }
+    }
+
+    if (mbedtls_asn1_stream_offset(&s) != tbs_end) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT,
+                                MBEDTLS_ERR_ASN1_LENGTH_MISMATCH);
+        goto cleanup;
+    }
+
+    st.hashing = 0;
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    if (psa_hash_finish(&st.op, hash, sizeof(hash),
+                        &hash_len) != PSA_SUCCESS) {
+        ret = MBEDTLS_ERR_X509_FATAL_ERROR;
+        goto cleanup;
+    }
+#else
+    hash_len = mbedtls_md_get_size(mbedtls_md_info_from_ctx(&st.md));
+    if ((ret = mbedtls_md_finish(&st.md, hash)) != 0) {
+        goto cleanup;
+    }
+#endif
+
+    /*
+     *  signatureAlgorithm   AlgorithmIdentifier,
+     *  signatureValue       BIT STRING
+     */
+    sig_start = st.len;
+    while (mbedtls_asn1_stream_offset(&s) < crl_end) {
+        if ((ret = mbedtls_asn1_stream_get_element(&s, &p, &len)) != 0) {
+            ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT, ret);
+            goto cleanup;
+        }
+    }
+
+    if (mbedtls_asn1_stream_offset(&s) != crl_end) {
+        ret = MBEDTLS_ERROR_ADD(MBEDTLS_ERR_X509_INVALID_FORMAT,
+                                MBEDTLS_ERR_ASN1_LENGTH_MISMATCH);
+        goto cleanup;
+    }
+
+    /*
+     * Rebuild the CRL without its entries and parse it as usual. It is
+     * small, since the entries were the only part of unbounded size.
+     */
+    len = sig_start - tbs_header_len;
+    tbs_header_len_new = x509_crl_put_seq_header(tbs_header, len);
+    len = tbs_header_len_new + st.len - tbs_header_len;
+    crl_header_len = x509_crl_put_seq_header(crl_header, len);
+    der_len = crl_header_len + len;
+
+    tbs_hash = mbedtls_calloc(1, hash_len);
+    if (tbs_hash == NULL) {
+        ret = MBEDTLS_ERR_X509_ALLOC_FAILED;
+        goto cleanup;
+    }
+    memcpy(tbs_hash, hash, hash_len);
+
+    der = mbedtls_calloc(1, der_len);
+    if (der == NULL) {
+        ret = MBEDTLS_ERR_X509_ALLOC_FAILED;
+        goto cleanup;
+    }
+    p = der;
+    memcpy(p, crl_header, crl_header_len);
+    p += crl_header_len;
+    memcpy(p, tbs_header, tbs_header_len_new);
+    p += tbs_header_len_new;
+    memcpy(p, st.buf + tbs_header_len, st.len - tbs_header_len);
+
+    ret = x509_crl_parse_der_internal(chain, der, der_len, 0, 0);
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    for (crl = chain; crl->next != NULL; crl = crl->next) {
+        ;
+    }
+    crl->tbs_hash = tbs_hash;
+    crl->tbs_hash_len = hash_len;
+    tbs_hash = NULL;
+
+cleanup:
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    psa_hash_abort(&st.op);
+#else
+    mbedtls_md_free(&st.md);
+#endif
+#if defined(MBEDTLS_X509_RSASSA_PSS_SUPPORT)
+    mbedtls_free(sig_opts);
+#endif
+    if (st.buf != NULL) {
+        mbedtls_zeroize_and_free(st.buf, st.size);
+    }
+    mbedtls_asn1_stream_free(&s);
+    mbedtls_free(tbs_hash);
+    mbedtls_platform_zeroize(hash, sizeof(hash));
+
+    return ret;
+}
+
+#if defined(MBEDTLS_FS_IO)
+static int x509_crl_stream_fread(void *p_read, unsigned char *buf, size_t len)
+{
+    FILE *f = p_read;
+    size_t n = fread(buf, 1, len, f);
+
+    if (n == 0 && ferror(f)) {
+        return MBEDTLS_ERR_X509_FILE_IO_ERROR;
+    }
+
+    return (int) n;
+}
+
+/*
+ * Load a CRL with mbedtls_x509_crl_parse_stream()
+ */
+int mbedtls_x509_crl_parse_file_stream(mbedtls_x509_crl *chain,
+                                       const char *path,
+                                       mbedtls_x509_crl_entry_cb_t *f_entry,
+                                       void *p_entry)
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    FILE *f;
+
+    if ((f = fopen(path, "rb")) == NULL) {
+        return MBEDTLS_ERR_X509_FILE_IO_ERROR;
+    }
+
+    ret = mbedtls_x509_crl_parse_stream(chain, x509_crl_stream_fread, f,
+                                        f_entry, p_entry);
+
+    fclose(f);
 
     return ret;
 }
@@ -696,9 +1207,12 @@ void mbedtls_x509_crl_free(mbedtls_x509_crl *crl)
         }
 
         if (crl_cur->raw.p != NULL) {
-            mbedtls_zeroize_and_free(crl_cur->raw.p, crl_cur->raw.len);
+            x509_crl_free_raw(crl_cur->raw.p, crl_cur->raw.len,
+                              crl_cur->raw_map_len);
         }
 
+        mbedtls_free(crl_cur->tbs_hash);
+
         crl_prv = crl_cur;
         crl_cur = crl_cur->next;
 
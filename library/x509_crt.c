@@ -38,6 +38,7 @@
 #include "md_psa.h"
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
 #include "pk_internal.h"
+#include "platform_util_internal.h"
 
 #include "mbedtls/platform.h"
 
@@ -1505,16 +1506,37 @@ int mbedtls_x509_crt_parse(mbedtls_x509_crt *chain,
 int mbedtls_x509_crt_parse_file(mbedtls_x509_crt *chain, const char *path)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
+    size_t n, map_len;
     unsigned char *buf;
+    mbedtls_x509_crt *crt;
 
-    if ((ret = mbedtls_pk_load_file(path, &buf, &n)) != 0) {
+    if ((ret = mbedtls_pk_map_file(path, &buf, &n, &map_len)) != 0) {
         return ret;
     }
 
+    /* mbedtls_pk_map_file() counts the null terminator of PEM data.
+     * Parse a mapped DER certificate in place: it keeps the mapping
+     * until it is freed. */
+    if (map_len != 0 && buf[n - 1] != '\0') {
+        ret = mbedtls_x509_crt_parse_der_internal(chain, buf, n, 0,
+                                                  NULL, NULL);
+        if (ret != 0) {
+            mbedtls_platform_unmap_file(buf, map_len);
+            return ret;
+        }
+
+        crt = chain;
+        while (crt->next != NULL) {
+            crt = crt->next;
+        }
+        crt->raw_map_len = map_len;
+
+        return 0;
+    }
+
     ret = mbedtls_x509_crt_parse(chain, buf, n);
 
-    mbedtls_zeroize_and_free(buf, n);
+    mbedtls_pk_unmap_file(buf, n, map_len);
 
     return ret;
 }
@@ -1988,6 +2010,12 @@ int mbedtls_x509_crt_is_revoked(const mbedtls_x509_crt *crt, const mbedtls_x509_
 {
     const mbedtls_x509_crl_entry *cur = &crl->entry;
 
+    /* The entries of a streamed CRL are not kept: an empty list does not
+     * mean that nothing is revoked, so fail closed. */
+    if (crl->tbs_hash_len != 0) {
+        return 1;
+    }
+
     while (cur != NULL && cur->serial.len != 0) {
         if (crt->serial.len == cur->serial.len &&
             memcmp(crt->serial.p, cur->serial.p, crt->serial.len) == 0) {
@@ -2001,16 +2029,16 @@ int mbedtls_x509_crt_is_revoked(const mbedtls_x509_crt *crt, const mbedtls_x509_
 }
 
 /*
- * Check that the given certificate is not revoked according to the CRL.
- * Skip validation if no CRL for the given CA is present.
+ * Check that a CRL is correctly signed by the given CA and is current.
+ * Return 0 if the signature is good, -1 if the CRL cannot be trusted.
  */
-static int x509_crt_verifycrl(mbedtls_x509_crt *crt, mbedtls_x509_crt *ca,
-                              mbedtls_x509_crl *crl_list,
-                              const mbedtls_x509_crt_profile *profile,
-                              const mbedtls_x509_time *now)
+static int x509_crl_check(const mbedtls_x509_crl *crl, mbedtls_x509_crt *ca,
+                          const mbedtls_x509_crt_profile *profile,
+                          const mbedtls_x509_time *now,
+                          int *flags)
 {
-    int flags = 0;
-    unsigned char hash[MBEDTLS_MD_MAX_SIZE];
+    unsigned char computed_hash[MBEDTLS_MD_MAX_SIZE];
+    const unsigned char *hash = computed_hash;
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     psa_algorithm_t psa_algorithm;
 #else
@@ -2018,87 +2046,120 @@ static int x509_crt_verifycrl(mbedtls_x509_crt *crt, mbedtls_x509_crt *ca,
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
     size_t hash_length;
 
-    if (ca == NULL) {
-        return flags;
+    /*
+     * Check if the CA is configured to sign CRLs
+     */
+    if (mbedtls_x509_crt_check_key_usage(ca,
+                                         MBEDTLS_X509_KU_CRL_SIGN) != 0) {
+        *flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+        return -1;
     }
 
-    while (crl_list != NULL) {
-        if (crl_list->version == 0 ||
-            x509_name_cmp(&crl_list->issuer, &ca->subject) != 0) {
-            crl_list = crl_list->next;
-            continue;
-        }
-
-        /*
-         * Check if the CA is configured to sign CRLs
-         */
-        if (mbedtls_x509_crt_check_key_usage(ca,
-                                             MBEDTLS_X509_KU_CRL_SIGN) != 0) {
-            flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
-            break;
-        }
-
-        /*
-         * Check if CRL is correctly signed by the trusted CA
-         */
-        if (x509_profile_check_md_alg(profile, crl_list->sig_md) != 0) {
-            flags |= MBEDTLS_X509_BADCRL_BAD_MD;
-        }
+    /*
+     * Check if CRL is correctly signed by the trusted CA
+     */
+    if (x509_profile_check_md_alg(profile, crl->sig_md) != 0) {
+        *flags |= MBEDTLS_X509_BADCRL_BAD_MD;
+    }
 
-        if (x509_profile_check_pk_alg(profile, crl_list->sig_pk) != 0) {
-            flags |= MBEDTLS_X509_BADCRL_BAD_PK;
-        }
+    if (x509_profile_check_pk_alg(profile, crl->sig_pk) != 0) {
+        *flags |= MBEDTLS_X509_BADCRL_BAD_PK;
+    }
 
+    if (crl->tbs_hash_len != 0) {
+        /* The body was hashed while the CRL was streamed */
+        hash = crl->tbs_hash;
+        hash_length = crl->tbs_hash_len;
+    } else {
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
-        psa_algorithm = mbedtls_md_psa_alg_from_type(crl_list->sig_md);
+        psa_algorithm = mbedtls_md_psa_alg_from_type(crl->sig_md);
         if (psa_hash_compute(psa_algorithm,
-                             crl_list->tbs.p,
-                             crl_list->tbs.len,
-                             hash,
-                             sizeof(hash),
+                             crl->tbs.p,
+                             crl->tbs.len,
+                             computed_hash,
+                             sizeof(computed_hash),
                              &hash_length) != PSA_SUCCESS) {
             /* Note: this can't happen except after an internal error */
-            flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
-            break;
+            *flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+            return -1;
         }
 #else
-        md_info = mbedtls_md_info_from_type(crl_list->sig_md);
+        md_info = mbedtls_md_info_from_type(crl->sig_md);
         hash_length = mbedtls_md_get_size(md_info);
         if (mbedtls_md(md_info,
-                       crl_list->tbs.p,
-                       crl_list->tbs.len,
-                       hash) != 0) {
+                       crl->tbs.p,
+                       crl->tbs.len,
+                       computed_hash) != 0) {
             /* Note: this can't happen except after an internal error */
-            flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
-            break;
+            *flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+            return -1;
         }
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
+    }
+
+    if (x509_profile_check_key(profile, &ca->pk) != 0) {
+        *flags |= MBEDTLS_X509_BADCERT_BAD_KEY;
+    }
+
+    if (mbedtls_pk_verify_ext(crl->sig_pk, crl->sig_opts, &ca->pk,
+                              crl->sig_md, hash, hash_length,
+                              crl->sig.p, crl->sig.len) != 0) {
+        *flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+        return -1;
+    }
 
-        if (x509_profile_check_key(profile, &ca->pk) != 0) {
-            flags |= MBEDTLS_X509_BADCERT_BAD_KEY;
+#if defined(MBEDTLS_HAVE_TIME_DATE)
+    /*
+     * Check for validity of CRL (Do not drop out)
+     */
+    if (mbedtls_x509_time_cmp(&crl->next_update, now) < 0) {
+        *flags |= MBEDTLS_X509_BADCRL_EXPIRED;
+    }
+
+    if (mbedtls_x509_time_cmp(&crl->this_update, now) > 0) {
+        *flags |= MBEDTLS_X509_BADCRL_FUTURE;
+    }
+#else
+    ((void) now);
+#endif
+
+    return 0;
+}
+
+/*
+ * Check that the given certificate is not revoked according to the CRL.
+ * Skip validation if no CRL for the given CA is present.
+ */
+static int x509_crt_verifycrl(mbedtls_x509_crt *crt, mbedtls_x509_crt *ca,
+                              mbedtls_x509_crl *crl_list,
+                              const mbedtls_x509_crt_profile *profile,
+                              const mbedtls_x509_time *now)
+{
+    int flags = 0;
+
+    if (ca == NULL) {
+        return flags;
+    }
+
+    while (crl_list != NULL) {
+        if (crl_list->version == 0 ||
+            x509_name_cmp(&crl_list->issuer, &ca->subject) != 0) {
+            crl_list = crl_list->next;
+            continue;
         }
 
-        if (mbedtls_pk_verify_ext(crl_list->sig_pk, crl_list->sig_opts, &ca->pk,
-                                  crl_list->sig_md, hash, hash_length,
-                                  crl_list->sig.p, crl_list->sig.len) != 0) {
-            flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+        if (x509_crl_check(crl_list, ca, profile, now, &flags) != 0) {
             break;
         }
 
-#if defined(MBEDTLS_HAVE_TIME_DATE)
         /*
-         * Check for validity of CRL (Do not drop out)
+         * The entries of a streamed CRL are not kept, so the revocation
+         * status cannot be checked against it
          */
-        if (mbedtls_x509_time_cmp(&crl_list->next_update, now) < 0) {
-            flags |= MBEDTLS_X509_BADCRL_EXPIRED;
-        }
-
-        if (mbedtls_x509_time_cmp(&crl_list->this_update, now) > 0) {
-            flags |= MBEDTLS_X509_BADCRL_FUTURE;
+        if (crl_list->tbs_hash_len != 0) {
+            flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+            break;
         }
-#else
-        ((void) now);
-#endif
 
         /*
          * Check if certificate is revoked
@@ -2113,6 +2174,45 @@ static int x509_crt_verifycrl(mbedtls_x509_crt *crt, mbedtls_x509_crt *ca,
 
     return flags;
 }
+
+/*
+ * Check that a CRL is signed by one of the trusted CAs
+ */
+int mbedtls_x509_crl_verify(const mbedtls_x509_crl *crl,
+                            mbedtls_x509_crt *trust_ca,
+                            const mbedtls_x509_crt_profile *profile,
+                            uint32_t *flags)
+{
+    int crl_flags = 0;
+    mbedtls_x509_time now;
+
+    if (crl == NULL || profile == NULL || flags == NULL) {
+        return MBEDTLS_ERR_X509_BAD_INPUT_DATA;
+    }
+
+    memset(&now, 0, sizeof(now));
+#if defined(MBEDTLS_HAVE_TIME_DATE)
+    if (mbedtls_x509_time_gmtime(mbedtls_time(NULL), &now) != 0) {
+        return MBEDTLS_ERR_X509_FATAL_ERROR;
+    }
+#endif
+
+    while (trust_ca != NULL &&
+           (trust_ca->version == 0 ||
+            x509_name_cmp(&crl->issuer, &trust_ca->subject) != 0)) {
+        trust_ca = trust_ca->next;
+    }
+
+    if (crl->version == 0 || trust_ca == NULL) {
+        crl_flags |= MBEDTLS_X509_BADCRL_NOT_TRUSTED;
+    } else {
+        (void) x509_crl_check(crl, trust_ca, profile, &now, &crl_flags);
+    }
+
+    *flags = (uint32_t) crl_flags;
+
+    return crl_flags != 0 ? MBEDTLS_ERR_X509_CERT_VERIFY_FAILED : 0;
+}
 #endif /* MBEDTLS_X509_CRL_PARSE_C */
 
 /*
@@ -3245,6 +3345,11 @@ void mbedtls_x509_crt_free(mbedtls_x509_crt *crt)
         if (cert_cur->raw.p != NULL && cert_cur->own_buffer) {
             mbedtls_zeroize_and_free(cert_cur->raw.p, cert_cur->raw.len);
         }
+#if defined(MBEDTLS_FS_IO)
+        if (cert_cur->raw_map_len != 0) {
+            mbedtls_platform_unmap_file(cert_cur->raw.p, cert_cur->raw_map_len);
+        }
+#endif
 
         cert_prv = cert_cur;
         cert_cur = cert_cur->next;
@@ -23,6 +23,7 @@
 #include "mbedtls/error.h"
 #include "mbedtls/oid.h"
 #include "mbedtls/platform_util.h"
+#include "pk_internal.h"
 
 #include <string.h>
 
@@ -439,16 +440,16 @@ int mbedtls_x509_csr_parse(mbedtls_x509_csr *csr, const unsigned char *buf, size
 int mbedtls_x509_csr_parse_file(mbedtls_x509_csr *csr, const char *path)
 {
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
-    size_t n;
+    size_t n, map_len;
     unsigned char *buf;
 
-    if ((ret = mbedtls_pk_load_file(path, &buf, &n)) != 0) {
+    if ((ret = mbedtls_pk_map_file(path, &buf, &n, &map_len)) != 0) {
         return ret;
     }
 
     ret = mbedtls_x509_csr_parse(csr, buf, n);
 
-    mbedtls_zeroize_and_free(buf, n);
+    mbedtls_pk_unmap_file(buf, n, map_len);
 
     return ret;
 }
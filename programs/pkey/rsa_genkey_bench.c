@@ -0,0 +1,483 @@
+/*
+ *  RSA key generation benchmark
+ *
+ *  Generates RSA keys of several sizes and reports keys per minute. With
+ *  threads=N, the primes of each key are searched for by N threads in
+ *  parallel, each with its own random candidate stream, and the search
+ *  stops as soon as two primes are found.
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#include "mbedtls/build_info.h"
+
+#include "mbedtls/platform.h"
+
+#if !defined(MBEDTLS_BIGNUM_C) || !defined(MBEDTLS_ENTROPY_C) ||   \
+    !defined(MBEDTLS_RSA_C) || !defined(MBEDTLS_GENPRIME) ||      \
+    !defined(MBEDTLS_CTR_DRBG_C)
+int main(void)
+{
+    mbedtls_printf("MBEDTLS_BIGNUM_C and/or MBEDTLS_ENTROPY_C and/or "
+                   "MBEDTLS_RSA_C and/or MBEDTLS_GENPRIME and/or "
+                   "MBEDTLS_CTR_DRBG_C not defined.\n");
+    mbedtls_exit(0);
+}
+#else
+
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/bignum.h"
+#include "mbedtls/rsa.h"
+#include "mbedtls/error.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#if defined(MBEDTLS_THREADING_C) && defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+#include <pthread.h>
+#define BENCH_HAVE_THREADS
+#endif
+
+#define DFL_SIZES               "2048,3072,4096"
+#define DFL_KEYS                4
+#define DFL_THREADS             1
+#define DFL_EXPONENT            65537
+
+#define BENCH_MAX_SIZES         8
+#define BENCH_MAX_THREADS       64
+
+#if defined(BENCH_HAVE_THREADS)
+#define USAGE_THREADS                                                       \
+    "    threads=%%d          threads searching for the primes of a key\n"  \
+    "                        default: 1 (use mbedtls_rsa_gen_key()),\n"     \
+    "                        maximum: 64\n"
+#else
+#define USAGE_THREADS ""
+#endif
+
+#define USAGE                                                               \
+    "\n usage: rsa_genkey_bench param=<>...\n"                              \
+    "\n acceptable parameters:\n"                                           \
+    "    sizes=a,b,c         key sizes in bits\n"                           \
+    "                        default: " DFL_SIZES "\n"                      \
+    "    keys=%%d             keys generated per size\n"                    \
+    "                        default: 4\n"                                  \
+    USAGE_THREADS                                                           \
+    "    exponent=%%d         public exponent\n"                            \
+    "                        default: 65537\n"                              \
+    "\n"
+
+static struct options {
+    unsigned int sizes[BENCH_MAX_SIZES];
+    int size_count;
+    int keys;
+    int threads;
+    int exponent;
+} opt;
+
+static uint64_t bench_time_us(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t) now.QuadPart * 1000000u / (uint64_t) freq.QuadPart;
+#else
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (uint64_t) tv.tv_sec * 1000000u + (uint64_t) tv.tv_usec;
+#endif
+}
+
+static mbedtls_entropy_context entropy;
+
+#if defined(BENCH_HAVE_THREADS)
+/*
+ * Parallel prime search
+ *
+ * Each worker calls mbedtls_mpi_gen_prime() in a loop with its own DRBG.
+ * The library polls the RNG for every new candidate and every
+ * Miller-Rabin round, so the RNG callback doubles as the cancellation
+ * point: once two primes are found, it fails and the other workers return
+ * from mbedtls_mpi_gen_prime() promptly.
+ */
+#define BENCH_SEARCH_CANCELLED  MBEDTLS_ERR_ERROR_GENERIC_ERROR
+
+typedef struct {
+    mbedtls_threading_mutex_t mutex;
+    unsigned int nbits;
+    int flags;
+    int found;
+    int ret;
+    mbedtls_mpi primes[2];
+} bench_search;
+
+typedef struct {
+    bench_search *search;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_mpi prime;
+} bench_worker;
+
+static int bench_search_done(bench_search *search)
+{
+    int done;
+
+    if (mbedtls_mutex_lock(&search->mutex) != 0) {
+        return 1;
+    }
+    done = search->found == 2 || search->ret != 0;
+    mbedtls_mutex_unlock(&search->mutex);
+
+    return done;
+}
+
+static int bench_search_random(void *p_worker, unsigned char *output,
+                               size_t len)
+{
+    bench_worker *worker = p_worker;
+
+    if (bench_search_done(worker->search)) {
+        return BENCH_SEARCH_CANCELLED;
+    }
+
+    return mbedtls_ctr_drbg_random(&worker->drbg, output, len);
+}
+
+static void *bench_search_run(void *p_worker)
+{
+    bench_worker *worker = p_worker;
+    bench_search *search = worker->search;
+    int ret;
+
+    while (1) {
+        ret = mbedtls_mpi_gen_prime(&worker->prime, search->nbits,
+                                    search->flags, bench_search_random,
+                                    worker);
+        if (ret == BENCH_SEARCH_CANCELLED) {
+            break;
+        }
+
+        if (mbedtls_mutex_lock(&search->mutex) != 0) {
+            break;
+        }
+        if (ret != 0 && search->ret == 0) {
+            search->ret = ret;
+        } else if (ret == 0 && search->found < 2) {
+            ret = mbedtls_mpi_copy(&search->primes[search->found],
+                                   &worker->prime);
+            if (ret == 0) {
+                search->found++;
+            } else {
+                search->ret = ret;
+            }
+        }
+        mbedtls_mutex_unlock(&search->mutex);
+
+        if (ret != 0) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Search for two primes of nbits bits with opt.threads threads.
+ */
+static int bench_find_primes(bench_worker *workers, bench_search *search,
+                             unsigned int nbits, int flags)
+{
+    static pthread_t threads[BENCH_MAX_THREADS];
+    int t;
+
+    search->nbits = nbits;
+    search->flags = flags;
+    search->found = 0;
+    search->ret = 0;
+
+    for (t = 0; t < opt.threads; t++) {
+        if (pthread_create(&threads[t], NULL, bench_search_run,
+                           &workers[t]) != 0) {
+            threads[t] = pthread_self();
+        }
+    }
+    for (t = 0; t < opt.threads; t++) {
+        if (!pthread_equal(threads[t], pthread_self())) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+
+    if (search->ret != 0) {
+        return search->ret;
+    }
+
+    return search->found == 2 ? 0 : MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+}
+
+/*
+ * Generate an RSA key from primes found in parallel, applying the same
+ * criteria as mbedtls_rsa_gen_key() to the pair of primes.
+ */
+static int bench_gen_key_parallel(mbedtls_rsa_context *rsa,
+                                  bench_worker *workers, bench_search *search,
+                                  unsigned int nbits, int exponent)
+{
+    int ret;
+    int flags = nbits > 1024 ? MBEDTLS_MPI_GEN_PRIME_FLAG_LOW_ERR : 0;
+    mbedtls_mpi *P = &search->primes[0], *Q = &search->primes[1];
+    mbedtls_mpi E, H, G, D;
+
+    mbedtls_mpi_init(&E); mbedtls_mpi_init(&H);
+    mbedtls_mpi_init(&G); mbedtls_mpi_init(&D);
+
+    MBEDTLS_MPI_CHK(mbedtls_mpi_lset(&E, exponent));
+
+    do {
+        MBEDTLS_MPI_CHK(bench_find_primes(workers, search, nbits >> 1, flags));
+
+        /* |P - Q| > 2^(nbits / 2 - 100) */
+        MBEDTLS_MPI_CHK(mbedtls_mpi_sub_mpi(&H, P, Q));
+        if (mbedtls_mpi_bitlen(&H) <= ((nbits >= 200) ? ((nbits >> 1) - 99) : 0)) {
+            continue;
+        }
+        if (mbedtls_mpi_cmp_mpi(P, Q) < 0) {
+            mbedtls_mpi_swap(P, Q);
+        }
+
+        /* GCD(E, (P - 1) * (Q - 1)) == 1 */
+        MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&G, P, 1));
+        MBEDTLS_MPI_CHK(mbedtls_mpi_sub_int(&H, Q, 1));
+        MBEDTLS_MPI_CHK(mbedtls_mpi_mul_mpi(&H, &H, &G));
+        MBEDTLS_MPI_CHK(mbedtls_mpi_gcd(&G, &E, &H));
+        if (mbedtls_mpi_cmp_int(&G, 1) != 0) {
+            continue;
+        }
+
+        mbedtls_rsa_free(rsa);
+        mbedtls_rsa_init(rsa);
+        MBEDTLS_MPI_CHK(mbedtls_rsa_import(rsa, NULL, P, Q, NULL, &E));
+        MBEDTLS_MPI_CHK(mbedtls_rsa_complete(rsa));
+
+        /* D = E^-1 mod LCM(P - 1, Q - 1) > 2^(nbits / 2) */
+        MBEDTLS_MPI_CHK(mbedtls_rsa_export(rsa, NULL, NULL, NULL, &D, NULL));
+        if (mbedtls_mpi_bitlen(&D) <= ((nbits + 1) / 2)) {
+            continue;
+        }
+
+        break;
+    } while (1);
+
+    ret = mbedtls_rsa_check_privkey(rsa);
+
+cleanup:
+    mbedtls_mpi_free(&E); mbedtls_mpi_free(&H);
+    mbedtls_mpi_free(&G); mbedtls_mpi_free(&D);
+
+    return ret;
+}
+#endif /* BENCH_HAVE_THREADS */
+
+static int bench_run(unsigned int nbits, mbedtls_ctr_drbg_context *drbg)
+{
+    int ret = 0;
+    int i;
+    uint64_t start, elapsed_us;
+    mbedtls_rsa_context rsa;
+#if defined(BENCH_HAVE_THREADS)
+    static bench_worker workers[BENCH_MAX_THREADS];
+    static bench_search search;
+    char pers[32];
+    int t;
+#endif
+
+    mbedtls_rsa_init(&rsa);
+
+#if defined(BENCH_HAVE_THREADS)
+    mbedtls_mutex_init(&search.mutex);
+    mbedtls_mpi_init(&search.primes[0]);
+    mbedtls_mpi_init(&search.primes[1]);
+    for (t = 0; t < opt.threads; t++) {
+        workers[t].search = &search;
+        mbedtls_ctr_drbg_init(&workers[t].drbg);
+        mbedtls_mpi_init(&workers[t].prime);
+    }
+    /* With a single thread, mbedtls_rsa_gen_key() uses the main DRBG. */
+    for (t = 0; t < opt.threads && opt.threads > 1; t++) {
+        mbedtls_snprintf(pers, sizeof(pers), "rsa_genkey_bench %d", t);
+        ret = mbedtls_ctr_drbg_seed(&workers[t].drbg, mbedtls_entropy_func,
+                                    &entropy, (const unsigned char *) pers,
+                                    strlen(pers));
+        if (ret != 0) {
+            goto exit;
+        }
+    }
+#endif
+
+    mbedtls_printf("  RSA-%-5u: ", nbits);
+    fflush(stdout);
+
+    start = bench_time_us();
+
+    for (i = 0; i < opt.keys; i++) {
+#if defined(BENCH_HAVE_THREADS)
+        if (opt.threads > 1) {
+            ret = bench_gen_key_parallel(&rsa, workers, &search, nbits,
+                                         opt.exponent);
+        } else
+#endif
+        {
+            mbedtls_rsa_free(&rsa);
+            mbedtls_rsa_init(&rsa);
+            ret = mbedtls_rsa_gen_key(&rsa, mbedtls_ctr_drbg_random, drbg,
+                                      nbits, opt.exponent);
+        }
+        if (ret != 0) {
+            goto exit;
+        }
+        if (mbedtls_rsa_get_len(&rsa) * 8 != nbits) {
+            ret = MBEDTLS_ERR_RSA_KEY_GEN_FAILED;
+            goto exit;
+        }
+    }
+
+    elapsed_us = bench_time_us() - start;
+
+    mbedtls_printf("%4d keys in %8.2f s, %8.2f keys/min, %8.0f ms/key\n",
+                   opt.keys, (double) elapsed_us / 1e6,
+                   elapsed_us == 0 ? 0.0 :
+                   (double) opt.keys * 60e6 / (double) elapsed_us,
+                   (double) elapsed_us / 1e3 / opt.keys);
+
+exit:
+    if (ret != 0) {
+        mbedtls_printf("failed, returned -0x%04x\n", (unsigned int) -ret);
+    }
+
+    mbedtls_rsa_free(&rsa);
+#if defined(BENCH_HAVE_THREADS)
+    for (t = 0; t < opt.threads; t++) {
+        mbedtls_ctr_drbg_free(&workers[t].drbg);
+        mbedtls_mpi_free(&workers[t].prime);
+    }
+    mbedtls_mpi_free(&search.primes[0]);
+    mbedtls_mpi_free(&search.primes[1]);
+    mbedtls_mutex_free(&search.mutex);
+#endif
+
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0, i;
+    int exit_code = MBEDTLS_EXIT_FAILURE;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    const char *pers = "rsa_genkey_bench";
+    char *p, *q;
+    char sizes[64];
+
+    mbedtls_entropy_init(&entropy);
+    mbedtls_ctr_drbg_init(&ctr_drbg);
+
+    strcpy(sizes, DFL_SIZES);
+    opt.keys = DFL_KEYS;
+    opt.threads = DFL_THREADS;
+    opt.exponent = DFL_EXPONENT;
+
+    for (i = 1; i < argc; i++) {
+        p = argv[i];
+        if ((q = strchr(p, '=')) == NULL) {
+            goto usage;
+        }
+        *q++ = '\0';
+
+        if (strcmp(p, "sizes") == 0) {
+            if (strlen(q) >= sizeof(sizes)) {
+                goto usage;
+            }
+            strcpy(sizes, q);
+        } else if (strcmp(p, "keys") == 0) {
+            opt.keys = atoi(q);
+            if (opt.keys < 1) {
+                goto usage;
+            }
+#if defined(BENCH_HAVE_THREADS)
+        } else if (strcmp(p, "threads") == 0) {
+            opt.threads = atoi(q);
+            if (opt.threads < 1 || opt.threads > BENCH_MAX_THREADS) {
+                goto usage;
+            }
+#endif
+        } else if (strcmp(p, "exponent") == 0) {
+            opt.exponent = atoi(q);
+            if (opt.exponent < 3) {
+                goto usage;
+            }
+        } else {
+            goto usage;
+        }
+    }
+
+    /* Parse the list of key sizes */
+    opt.size_count = 0;
+    for (p = sizes; *p != '\0'; p = q) {
+        if (opt.size_count == BENCH_MAX_SIZES) {
+            goto usage;
+        }
+        opt.sizes[opt.size_count] = (unsigned int) strtoul(p, &q, 10);
+        if (q == p || opt.sizes[opt.size_count] == 0 ||
+            (*q != '\0' && *q != ',')) {
+            goto usage;
+        }
+        opt.size_count++;
+        if (*q == ',') {
+            q++;
+        }
+    }
+    if (opt.size_count == 0) {
+        goto usage;
+    }
+
+    if ((ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy,
+                                     (const unsigned char *) pers,
+                                     strlen(pers))) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_ctr_drbg_seed returned %d\n", ret);
+        goto exit;
+    }
+
+    mbedtls_printf("\n  RSA key generation, exponent %d, %d thread%s\n\n",
+                   opt.exponent, opt.threads, opt.threads > 1 ? "s" : "");
+
+    for (i = 0; i < opt.size_count; i++) {
+        if ((ret = bench_run(opt.sizes[i], &ctr_drbg)) != 0) {
+            goto exit;
+        }
+    }
+
+    mbedtls_printf("\n");
+    exit_code = MBEDTLS_EXIT_SUCCESS;
+    goto exit;
+
+usage:
+    mbedtls_printf(USAGE);
+
+exit:
+    mbedtls_ctr_drbg_free(&ctr_drbg);
+    mbedtls_entropy_free(&entropy);
+
+    mbedtls_exit(exit_code);
+}
+#endif /* MBEDTLS_BIGNUM_C && MBEDTLS_ENTROPY_C && MBEDTLS_RSA_C &&
+          MBEDTLS_GENPRIME && MBEDTLS_CTR_DRBG_C */
@@ -0,0 +1,716 @@
+/*
+ *  SSL server demonstration program using an event loop for handling
+ *  multiple clients and a pool of threads for the private key operations.
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#include "mbedtls/build_info.h"
+
+#include "mbedtls/platform.h"
+
+#if !defined(MBEDTLS_BIGNUM_C)  || !defined(MBEDTLS_ENTROPY_C) ||         \
+    !defined(MBEDTLS_SSL_TLS_C) || !defined(MBEDTLS_SSL_SRV_C) ||         \
+    !defined(MBEDTLS_NET_C) || !defined(MBEDTLS_SSL_ASYNC_PRIVATE) ||     \
+    !defined(MBEDTLS_CTR_DRBG_C) || !defined(MBEDTLS_X509_CRT_PARSE_C) || \
+    !defined(MBEDTLS_THREADING_C) || !defined(MBEDTLS_THREADING_PTHREAD) || \
+    !defined(MBEDTLS_PEM_PARSE_C)
+int main(void)
+{
+    mbedtls_printf("MBEDTLS_BIGNUM_C and/or MBEDTLS_ENTROPY_C "
+                   "and/or MBEDTLS_SSL_TLS_C and/or MBEDTLS_SSL_SRV_C and/or "
+                   "MBEDTLS_NET_C and/or MBEDTLS_SSL_ASYNC_PRIVATE and/or "
+                   "MBEDTLS_CTR_DRBG_C and/or MBEDTLS_X509_CRT_PARSE_C and/or "
+                   "MBEDTLS_THREADING_C and/or MBEDTLS_THREADING_PTHREAD "
+                   "and/or MBEDTLS_PEM_PARSE_C not defined.\n");
+    mbedtls_exit(0);
+}
+#else
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/x509.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/error.h"
+#include "mbedtls/platform_util.h"
+#include "test/certs.h"
+
+#define HTTP_RESPONSE \
+    "HTTP/1.0 200 OK\r\nContent-Type: text/html\r\n\r\n" \
+    "<h2>Mbed TLS Test Server</h2>\r\n" \
+    "<p>Successful connection using: %s</p>\r\n"
+
+#define MAX_NUM_CONNECTIONS 16
+#define NUM_WORKERS 4
+
+/*
+ * Private key operations.
+ *
+ * The handshake of each connection runs in the main thread. When it needs
+ * a signature or a decryption with the private key, the start callback
+ * queues a job and the handshake returns MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS.
+ * A worker thread performs the operation, then writes to a pipe to wake up
+ * the event loop, which resumes the handshake of the connections that are
+ * waiting for a job.
+ */
+
+typedef enum {
+    JOB_QUEUED,
+    JOB_RUNNING,
+    JOB_DONE,
+} job_state_t;
+
+typedef struct async_job {
+    struct async_job *next;
+    job_state_t state;
+    int cancelled;              /* the connection no longer needs the result */
+    int is_sign;                /* signature if nonzero, else decryption */
+    int use_pss;                /* RSASSA-PSS signature (TLS 1.3) */
+    mbedtls_md_type_t md_alg;
+    unsigned char input[MBEDTLS_MPI_MAX_SIZE];
+    size_t input_len;
+    unsigned char output[MBEDTLS_PK_SIGNATURE_MAX_SIZE];
+    size_t output_len;
+    int ret;
+} async_job_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;        /* signalled when a job is queued */
+    async_job_t *head;
+    async_job_t *tail;
+    int stop;
+    mbedtls_pk_context *pk;     /* the private key, only used by the workers */
+    mbedtls_entropy_context *entropy;
+    int wake_fd[2];             /* pipe written to when a job is done */
+} worker_pool_t;
+
+static worker_pool_t pool;
+
+static void *worker_main(void *data)
+{
+    int ret;
+    async_job_t *job;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    const char pers[] = "ssl_async_server worker";
+
+    ((void) data);
+
+    /* Each worker has its own DRBG, seeded from the shared entropy
+     * context, which is thread-safe when MBEDTLS_THREADING_C is enabled. */
+    mbedtls_ctr_drbg_init(&ctr_drbg);
+    ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, pool.entropy,
+                                (const unsigned char *) pers, strlen(pers));
+
+    pthread_mutex_lock(&pool.mutex);
+    while (1) {
+        while (pool.head == NULL && !pool.stop) {
+            pthread_cond_wait(&pool.cond, &pool.mutex);
+        }
+        if (pool.stop) {
+            break;
+        }
+
+        job = pool.head;
+        pool.head = job->next;
+        if (pool.head == NULL) {
+            pool.tail = NULL;
+        }
+        job->state = JOB_RUNNING;
+        pthread_mutex_unlock(&pool.mutex);
+
+        if (ret != 0) {
+            job->ret = ret;
+        } else if (!job->is_sign) {
+            job->ret = mbedtls_pk_decrypt(pool.pk, job->input, job->input_len,
+                                          job->output, &job->output_len,
+                                          sizeof(job->output),
+                                          mbedtls_ctr_drbg_random, &ctr_drbg);
+        }
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+        else if (job->use_pss) {
+            job->ret = mbedtls_pk_sign_ext(MBEDTLS_PK_RSASSA_PSS, pool.pk,
+                                           job->md_alg,
+                                           job->input, job->input_len,
+                                           job->output, sizeof(job->output),
+                                           &job->output_len,
+                                           mbedtls_ctr_drbg_random, &ctr_drbg);
+        }
+#endif /* MBEDTLS_SSL_PROTO_TLS1_3 */
+        else {
+            job->ret = mbedtls_pk_sign(pool.pk, job->md_alg,
+                                       job->input, job->input_len,
+                                       job->output, sizeof(job->output),
+                                       &job->output_len,
+                                       mbedtls_ctr_drbg_random, &ctr_drbg);
+        }
+
+        pthread_mutex_lock(&pool.mutex);
+        if (job->cancelled) {
+            mbedtls_platform_zeroize(job, sizeof(*job));
+            mbedtls_free(job);
+        } else {
+            job->state = JOB_DONE;
+            if (write(pool.wake_fd[1], "", 1) != 1) {
+                /* The pipe is full: the event loop has a wakeup pending. */
+            }
+        }
+    }
+    pthread_mutex_unlock(&pool.mutex);
+
+    mbedtls_ctr_drbg_free(&ctr_drbg);
+
+    return NULL;
+}
+
+static int queue_job(mbedtls_ssl_context *ssl, int is_sign,
+                     mbedtls_md_type_t md_alg,
+                     const unsigned char *input, size_t input_len)
+{
+    async_job_t *job;
+
+    if (input_len > sizeof(job->input)) {
+        return MBEDTLS_ERR_PK_BAD_INPUT_DATA;
+    }
+
+    job = mbedtls_calloc(1, sizeof(*job));
+    if (job == NULL) {
+        return MBEDTLS_ERR_PK_ALLOC_FAILED;
+    }
+
+    job->is_sign = is_sign;
+    job->md_alg = md_alg;
+    memcpy(job->input, input, input_len);
+    job->input_len = input_len;
+    job->state = JOB_QUEUED;
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    /* TLS 1.3 uses RSASSA-PSS for all RSA signatures. */
+    job->use_pss = is_sign &&
+                   mbedtls_ssl_get_version_number(ssl) == MBEDTLS_SSL_VERSION_TLS1_3 &&
+                   mbedtls_pk_can_do(pool.pk, MBEDTLS_PK_RSA);
+#endif
+
+    pthread_mutex_lock(&pool.mutex);
+    if (pool.tail != NULL) {
+        pool.tail->next = job;
+    } else {
+        pool.head = job;
+    }
+    pool.tail = job;
+    pthread_cond_signal(&pool.cond);
+    pthread_mutex_unlock(&pool.mutex);
+
+    mbedtls_ssl_set_async_operation_data(ssl, job);
+
+    return MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS;
+}
+
+static int async_sign_start(mbedtls_ssl_context *ssl,
+                            mbedtls_x509_crt *cert,
+                            mbedtls_md_type_t md_alg,
+                            const unsigned char *hash,
+                            size_t hash_len)
+{
+    ((void) cert);
+    return queue_job(ssl, 1, md_alg, hash, hash_len);
+}
+
+static int async_decrypt_start(mbedtls_ssl_context *ssl,
+                               mbedtls_x509_crt *cert,
+                               const unsigned char *input,
+                               size_t input_len)
+{
+    ((void) cert);
+    return queue_job(ssl, 0, MBEDTLS_MD_NONE, input, input_len);
+}
+
+static int async_resume(mbedtls_ssl_context *ssl,
+                        unsigned char *output,
+                        size_t *output_len,
+                        size_t output_size)
+{
+    int ret;
+    async_job_t *job = mbedtls_ssl_get_async_operation_data(ssl);
+
+    pthread_mutex_lock(&pool.mutex);
+    if (job->state != JOB_DONE) {
+        pthread_mutex_unlock(&pool.mutex);
+        return MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS;
+    }
+    pthread_mutex_unlock(&pool.mutex);
+
+    ret = job->ret;
+    if (ret == 0) {
+        if (job->output_len > output_size) {
+            ret = MBEDTLS_ERR_PK_BUFFER_TOO_SMALL;
+        } else {
+            memcpy(output, job->output, job->output_len);
+            *output_len = job->output_len;
+        }
+    }
+
+    mbedtls_platform_zeroize(job, sizeof(*job));
+    mbedtls_free(job);
+
+    return ret;
+}
+
+static void async_cancel(mbedtls_ssl_context *ssl)
+{
+    async_job_t *job = mbedtls_ssl_get_async_operation_data(ssl);
+    async_job_t **p, *prev = NULL;
+
+    pthread_mutex_lock(&pool.mutex);
+    if (job->state == JOB_RUNNING) {
+        /* The worker frees the job when it is done with it. */
+        job->cancelled = 1;
+        job = NULL;
+    } else if (job->state == JOB_QUEUED) {
+        for (p = &pool.head; *p != job; p = &(*p)->next) {
+            prev = *p;
+        }
+        *p = job->next;
+        if (pool.tail == job) {
+            pool.tail = prev;
+        }
+    }
+    pthread_mutex_unlock(&pool.mutex);
+
+    if (job != NULL) {
+        mbedtls_platform_zeroize(job, sizeof(*job));
+        mbedtls_free(job);
+    }
+}
+
+/*
+ * Connections.
+ */
+
+typedef enum {
+    CONN_FREE = 0,
+    CONN_HANDSHAKE,
+    CONN_READ,
+    CONN_WRITE,
+    CONN_CLOSE,
+} conn_state_t;
+
+typedef struct {
+    conn_state_t state;
+    mbedtls_net_context fd;
+    mbedtls_ssl_context ssl;
+    short events;               /* poll() events to wait for, 0 while
+                                 * waiting for a private key operation */
+    unsigned char buf[1024];
+    size_t len;
+    size_t written;
+} connection_t;
+
+static connection_t conns[MAX_NUM_CONNECTIONS];
+
+static void conn_close(connection_t *conn)
+{
+    /* This calls the cancel callback if a private key operation is
+     * in progress. */
+    mbedtls_ssl_free(&conn->ssl);
+    mbedtls_net_free(&conn->fd);
+    conn->state = CONN_FREE;
+}
+
+/*
+ * Make as much progress as possible on a connection, until it needs to wait
+ * for the network or for a private key operation.
+ */
+static void conn_step(connection_t *conn)
+{
+    int ret = 0;
+    int id = (int) (conn - conns);
+
+    while (ret == 0) {
+        switch (conn->state) {
+            case CONN_HANDSHAKE:
+                ret = mbedtls_ssl_handshake(&conn->ssl);
+                if (ret == 0) {
+                    mbedtls_printf("  [ #%d ]  Handshake done: %s\n", id,
+                                   mbedtls_ssl_get_ciphersuite(&conn->ssl));
+                    conn->state = CONN_READ;
+                }
+                break;
+
+            case CONN_READ:
+                ret = mbedtls_ssl_read(&conn->ssl, conn->buf,
+                                       sizeof(conn->buf) - 1);
+                if (ret > 0) {
+                    mbedtls_printf("  [ #%d ]  %d bytes read\n", id, ret);
+                    conn->len = mbedtls_snprintf((char *) conn->buf,
+                                                 sizeof(conn->buf), HTTP_RESPONSE,
+                                                 mbedtls_ssl_get_ciphersuite(&conn->ssl));
+                    conn->written = 0;
+                    conn->state = CONN_WRITE;
+                    ret = 0;
+                } else if (ret == 0 || ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+                    mbedtls_printf("  [ #%d ]  connection was closed gracefully\n",
+                                   id);
+                    conn_close(conn);
+                    return;
+                }
+                break;
+
+            case CONN_WRITE:
+                ret = mbedtls_ssl_write(&conn->ssl, conn->buf + conn->written,
+                                        conn->len - conn->written);
+                if (ret > 0) {
+                    conn->written += ret;
+                    if (conn->written == conn->len) {
+                        mbedtls_printf("  [ #%d ]  %d bytes written\n", id,
+                                       (int) conn->len);
+                        conn->state = CONN_CLOSE;
+                    }
+                    ret = 0;
+                }
+                break;
+
+            case CONN_CLOSE:
+                ret = mbedtls_ssl_close_notify(&conn->ssl);
+                if (ret == 0) {
+                    mbedtls_printf("  [ #%d ]  Connection closed\n", id);
+                    conn_close(conn);
+                    return;
+                }
+                break;
+
+            default:
+                return;
+        }
+    }
+
+    switch (ret) {
+        case MBEDTLS_ERR_SSL_WANT_READ:
+            conn->events = POLLIN;
+            break;
+
+        case MBEDTLS_ERR_SSL_WANT_WRITE:
+            conn->events = POLLOUT;
+            break;
+
+        case MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS:
+            conn->events = 0;
+            break;
+
+        default:
+            mbedtls_printf("  [ #%d ]  failed: -0x%04x\n", id,
+                           (unsigned int) -ret);
+            conn_close(conn);
+            break;
+    }
+}
+
+static void accept_connections(mbedtls_net_context *listen_fd,
+                               const mbedtls_ssl_config *conf)
+{
+    int ret, i;
+    mbedtls_net_context client_fd;
+
+    while (1) {
+        mbedtls_net_init(&client_fd);
+        ret = mbedtls_net_accept(listen_fd, &client_fd, NULL, 0, NULL);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ) {
+            return;
+        }
+        if (ret != 0) {
+            mbedtls_printf("  [ main ]  failed: mbedtls_net_accept returned -0x%04x\n",
+                           (unsigned int) -ret);
+            return;
+        }
+
+        for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+            if (conns[i].state == CONN_FREE) {
+                break;
+            }
+        }
+        if (i == MAX_NUM_CONNECTIONS) {
+            mbedtls_printf("  [ main ]  Too many connections\n");
+            mbedtls_net_free(&client_fd);
+            continue;
+        }
+
+        mbedtls_ssl_init(&conns[i].ssl);
+        conns[i].fd = client_fd;
+        if ((ret = mbedtls_net_set_nonblock(&conns[i].fd)) != 0 ||
+            (ret = mbedtls_ssl_setup(&conns[i].ssl, conf)) != 0) {
+            mbedtls_printf("  [ main ]  failed: setting up a connection returned -0x%04x\n",
+                           (unsigned int) -ret);
+            mbedtls_ssl_free(&conns[i].ssl);
+            mbedtls_net_free(&conns[i].fd);
+            continue;
+        }
+        mbedtls_ssl_set_bio(&conns[i].ssl, &conns[i].fd,
+                            mbedtls_net_send, mbedtls_net_recv, NULL);
+
+        mbedtls_printf("  [ #%d ]  New connection\n", i);
+        conns[i].state = CONN_HANDSHAKE;
+        conn_step(&conns[i]);
+    }
+}
+
+int main(void)
+{
+    int ret, i, n;
+    mbedtls_net_context listen_fd;
+    const char pers[] = "ssl_async_server";
+    pthread_t workers[NUM_WORKERS];
+    int num_workers = 0;
+    struct pollfd fds[MAX_NUM_CONNECTIONS + 2];
+    unsigned char drain[64];
+
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    mbedtls_ssl_config conf;
+    mbedtls_x509_crt srvcert;
+    mbedtls_pk_context pkey;
+
+    mbedtls_x509_crt_init(&srvcert);
+    mbedtls_pk_init(&pkey);
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_ctr_drbg_init(&ctr_drbg);
+    mbedtls_entropy_init(&entropy);
+    mbedtls_net_init(&listen_fd);
+    memset(conns, 0, sizeof(conns));
+
+    memset(&pool, 0, sizeof(pool));
+    pool.wake_fd[0] = pool.wake_fd[1] = -1;
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.cond, NULL);
+    pool.pk = &pkey;
+    pool.entropy = &entropy;
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    psa_status_t status = psa_crypto_init();
+    if (status != PSA_SUCCESS) {
+        mbedtls_fprintf(stderr, "Failed to initialize PSA Crypto implementation: %d\n",
+                        (int) status);
+        ret = MBEDTLS_ERR_SSL_HW_ACCEL_FAILED;
+        goto exit;
+    }
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    /*
+     * 1a. Seed the random number generator
+     */
+    mbedtls_printf("  . Seeding the random number generator...");
+
+    if ((ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy,
+                                     (const unsigned char *) pers,
+                                     strlen(pers))) != 0) {
+        mbedtls_printf(" failed: mbedtls_ctr_drbg_seed returned -0x%04x\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 1b. Load the certificate and the private key
+     */
+    mbedtls_printf("  . Loading the server cert. and key...");
+    fflush(stdout);
+
+    /*
+     * This demonstration program uses embedded test certificates.
+     * Instead, you may want to use mbedtls_x509_crt_parse_file() to read the
+     * server certificate, as well as mbedtls_pk_parse_keyfile(). In a real
+     * application, the private key would typically stay in a separate
+     * process or in a hardware security module.
+     */
+    ret = mbedtls_x509_crt_parse(&srvcert, (const unsigned char *) mbedtls_test_srv_crt,
+                                 mbedtls_test_srv_crt_len);
+    if (ret != 0) {
+        mbedtls_printf(" failed\n  !  mbedtls_x509_crt_parse returned %d\n\n", ret);
+        goto exit;
+    }
+
+    ret = mbedtls_pk_parse_key(&pkey, (const unsigned char *) mbedtls_test_srv_key,
+                               mbedtls_test_srv_key_len, NULL, 0,
+                               mbedtls_ctr_drbg_random, &ctr_drbg);
+    if (ret != 0) {
+        mbedtls_printf(" failed\n  !  mbedtls_pk_parse_key returned %d\n\n", ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 1c. Start the worker threads
+     */
+    mbedtls_printf("  . Starting %d worker threads...", NUM_WORKERS);
+
+    if (pipe(pool.wake_fd) != 0) {
+        mbedtls_printf(" failed\n  ! pipe() failed\n\n");
+        ret = 1;
+        goto exit;
+    }
+
+    for (num_workers = 0; num_workers < NUM_WORKERS; num_workers++) {
+        if ((ret = pthread_create(&workers[num_workers], NULL, worker_main,
+                                  NULL)) != 0) {
+            mbedtls_printf(" failed\n  ! pthread_create returned %d\n\n", ret);
+            goto exit;
+        }
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 1d. Prepare SSL configuration
+     */
+    mbedtls_printf("  . Setting up the SSL data....");
+
+    if ((ret = mbedtls_ssl_config_defaults(&conf,
+                                           MBEDTLS_SSL_IS_SERVER,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0) {
+        mbedtls_printf(" failed: mbedtls_ssl_config_defaults returned -0x%04x\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
+
+    /* The private key is only available to the worker threads. */
+    if ((ret = mbedtls_ssl_conf_own_cert(&conf, &srvcert, NULL)) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_ssl_conf_own_cert returned %d\n\n", ret);
+        goto exit;
+    }
+
+    mbedtls_ssl_conf_async_private_cb(&conf, async_sign_start,
+                                      async_decrypt_start, async_resume,
+                                      async_cancel, NULL);
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    /* The workers sign with RSASSA-PSS in TLS 1.3. */
+    mbedtls_ssl_conf_async_private_tls13(&conf,
+                                         MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_ENABLED);
+#endif
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 2. Setup the listening TCP socket
+     */
+    mbedtls_printf("  . Bind on https://localhost:4433/ ...");
+    fflush(stdout);
+
+    if ((ret = mbedtls_net_bind(&listen_fd, NULL, "4433", MBEDTLS_NET_PROTO_TCP)) != 0 ||
+        (ret = mbedtls_net_set_nonblock(&listen_fd)) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_net_bind returned %d\n\n", ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 3. Event loop
+     */
+    mbedtls_printf("  [ main ]  Waiting for remote connections\n");
+
+    while (1) {
+        fds[0].fd = listen_fd.fd;
+        fds[0].events = POLLIN;
+        fds[1].fd = pool.wake_fd[0];
+        fds[1].events = POLLIN;
+        for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+            /* poll() ignores negative descriptors. */
+            fds[i + 2].fd = (conns[i].state != CONN_FREE && conns[i].events != 0) ?
+                            conns[i].fd.fd : -1;
+            fds[i + 2].events = conns[i].events;
+        }
+
+        n = poll(fds, MAX_NUM_CONNECTIONS + 2, -1);
+        if (n < 0) {
+            mbedtls_printf("  [ main ]  failed: poll() failed\n");
+            ret = 1;
+            goto exit;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            /* Some private key operations are done: resume all the
+             * handshakes that are waiting for one. The others get
+             * MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS again. */
+            if (read(pool.wake_fd[0], drain, sizeof(drain)) <= 0) {
+                ret = 1;
+                goto exit;
+            }
+            for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+                if (conns[i].state != CONN_FREE && conns[i].events == 0) {
+                    conn_step(&conns[i]);
+                }
+            }
+        }
+
+        for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+            if (fds[i + 2].fd >= 0 && fds[i + 2].revents != 0 &&
+                conns[i].state != CONN_FREE) {
+                conn_step(&conns[i]);
+            }
+        }
+
+        if (fds[0].revents & POLLIN) {
+            accept_connections(&listen_fd, &conf);
+        }
+    }
+
+exit:
+
+#ifdef MBEDTLS_ERROR_C
+    if (ret != 0) {
+        char error_buf[100];
+        mbedtls_strerror(ret, error_buf, 100);
+        mbedtls_printf("Last error was: -0x%04x - %s\n\n", (unsigned int) -ret, error_buf);
+    }
+#endif
+
+    for (i = 0; i < MAX_NUM_CONNECTIONS; i++) {
+        if (conns[i].state != CONN_FREE) {
+            conn_close(&conns[i]);
+        }
+    }
+
+    pthread_mutex_lock(&pool.mutex);
+    pool.stop = 1;
+    pthread_cond_broadcast(&pool.cond);
+    pthread_mutex_unlock(&pool.mutex);
+    for (i = 0; i < num_workers; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    pthread_cond_destroy(&pool.cond);
+    pthread_mutex_destroy(&pool.mutex);
+    if (pool.wake_fd[0] >= 0) {
+        close(pool.wake_fd[0]);
+        close(pool.wake_fd[1]);
+    }
+
+    mbedtls_net_free(&listen_fd);
+    mbedtls_x509_crt_free(&srvcert);
+    mbedtls_pk_free(&pkey);
+    mbedtls_ssl_config_free(&conf);
+    mbedtls_ctr_drbg_free(&ctr_drbg);
+    mbedtls_entropy_free(&entropy);
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    mbedtls_psa_crypto_free();
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    mbedtls_exit(ret);
+}
+
+#endif /* MBEDTLS_BIGNUM_C && MBEDTLS_ENTROPY_C &&
+          MBEDTLS_SSL_TLS_C && MBEDTLS_SSL_SRV_C && MBEDTLS_NET_C &&
+          MBEDTLS_SSL_ASYNC_PRIVATE && MBEDTLS_CTR_DRBG_C &&
+          MBEDTLS_X509_CRT_PARSE_C && MBEDTLS_THREADING_C &&
+          MBEDTLS_THREADING_PTHREAD && MBEDTLS_PEM_PARSE_C */
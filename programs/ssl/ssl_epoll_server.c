@@ -0,0 +1,511 @@
+/*
+ *  SSL server demonstration program handling many concurrent clients in a
+ *  single thread, with non-blocking sockets and an edge-triggered event loop.
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#include "mbedtls/build_info.h"
+
+#include "mbedtls/platform.h"
+
+#if !defined(MBEDTLS_BIGNUM_C)  || !defined(MBEDTLS_ENTROPY_C) ||         \
+    !defined(MBEDTLS_SSL_TLS_C) || !defined(MBEDTLS_SSL_SRV_C) ||         \
+    !defined(MBEDTLS_NET_C) || !defined(MBEDTLS_CTR_DRBG_C) ||            \
+    !defined(MBEDTLS_X509_CRT_PARSE_C) || !defined(MBEDTLS_PEM_PARSE_C) || \
+    !defined(__linux__)
+int main(void)
+{
+    mbedtls_printf("MBEDTLS_BIGNUM_C and/or MBEDTLS_ENTROPY_C "
+                   "and/or MBEDTLS_SSL_TLS_C and/or MBEDTLS_SSL_SRV_C and/or "
+                   "MBEDTLS_NET_C and/or MBEDTLS_CTR_DRBG_C and/or "
+                   "MBEDTLS_X509_CRT_PARSE_C and/or MBEDTLS_PEM_PARSE_C "
+                   "not defined, or not running on Linux.\n");
+    mbedtls_exit(0);
+}
+#else
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <time.h>
+
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/x509.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/error.h"
+#include "test/certs.h"
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+#include "mbedtls/ssl_cache.h"
+#endif
+
+#define HTTP_RESPONSE \
+    "HTTP/1.0 200 OK\r\nContent-Type: text/html\r\n\r\n" \
+    "<h2>Mbed TLS Test Server</h2>\r\n" \
+    "<p>Successful connection using: %s</p>\r\n"
+
+/*
+ * Each connection needs one file descriptor and an SSL context with its
+ * record buffers, about 2 * MBEDTLS_SSL_IN_CONTENT_LEN bytes with the
+ * default configuration. To test with many connections, consider smaller
+ * buffers or MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH.
+ *
+ * With TLS 1.3 or MBEDTLS_USE_PSA_CRYPTO, each connection also holds a few
+ * PSA keys: MBEDTLS_PSA_KEY_SLOT_COUNT must be raised accordingly,
+ * otherwise handshakes fail with MBEDTLS_ERR_SSL_ALLOC_FAILED beyond a few
+ * concurrent connections.
+ */
+#define DFL_SERVER_PORT         "4433"
+#define DFL_MAX_CONNECTIONS     20000
+
+#define USAGE \
+    "\n usage: ssl_epoll_server param=<>...\n"              \
+    "\n acceptable parameters:\n"                           \
+    "    server_port=%%s        default: 4433\n"             \
+    "    max_connections=%%d    default: 20000\n"            \
+    "\n"
+
+#define MAX_EVENTS 64
+
+/*
+ * Options
+ */
+struct options {
+    const char *server_port;    /* port on which the server listens */
+    int max_connections;        /* maximum number of concurrent connections */
+} opt;
+
+typedef enum {
+    CONN_HANDSHAKE,
+    CONN_READ,
+    CONN_WRITE,
+    CONN_CLOSE,
+    CONN_DEAD,
+} conn_state_t;
+
+typedef struct connection {
+    conn_state_t state;
+    mbedtls_net_context fd;
+    mbedtls_ssl_context ssl;
+    struct connection *next_dead;
+    unsigned char buf[512];
+    size_t len;
+    size_t written;
+} connection_t;
+
+/*
+ * Statistics, printed every second when they change.
+ */
+static long active_connections;
+static unsigned long total_handshakes;
+static unsigned long total_failures;
+
+/* Connections that were closed while processing a batch of events. They
+ * are freed after the batch, since later events in the same batch may
+ * refer to them. */
+static connection_t *dead_connections;
+
+static void conn_close(connection_t *conn)
+{
+    mbedtls_ssl_free(&conn->ssl);
+    /* Closing the socket also removes it from the poller. */
+    mbedtls_net_free(&conn->fd);
+    conn->state = CONN_DEAD;
+    conn->next_dead = dead_connections;
+    dead_connections = conn;
+    active_connections--;
+}
+
+static void free_dead_connections(void)
+{
+    connection_t *conn;
+
+    while ((conn = dead_connections) != NULL) {
+        dead_connections = conn->next_dead;
+        mbedtls_free(conn);
+    }
+}
+
+/*
+ * Make as much progress as possible on a connection. With an edge-triggered
+ * poller, this must go on until an operation returns
+ * MBEDTLS_ERR_SSL_WANT_READ or MBEDTLS_ERR_SSL_WANT_WRITE, otherwise no
+ * new event may be reported for the connection.
+ */
+static void conn_step(connection_t *conn)
+{
+    int ret = 0;
+
+    while (ret == 0) {
+        switch (conn->state) {
+            case CONN_HANDSHAKE:
+                ret = mbedtls_ssl_handshake(&conn->ssl);
+                if (ret == 0) {
+                    total_handshakes++;
+                    conn->state = CONN_READ;
+                }
+                break;
+
+            case CONN_READ:
+                ret = mbedtls_ssl_read(&conn->ssl, conn->buf, sizeof(conn->buf));
+                if (ret > 0) {
+                    /* Assume that the request fits in one record. */
+                    conn->len = mbedtls_snprintf((char *) conn->buf,
+                                                 sizeof(conn->buf), HTTP_RESPONSE,
+                                                 mbedtls_ssl_get_ciphersuite(&conn->ssl));
+                    conn->written = 0;
+                    conn->state = CONN_WRITE;
+                    ret = 0;
+                } else if (ret == 0 || ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+                    conn_close(conn);
+                    return;
+                }
+                break;
+
+            case CONN_WRITE:
+                ret = mbedtls_ssl_write(&conn->ssl, conn->buf + conn->written,
+                                        conn->len - conn->written);
+                if (ret > 0) {
+                    conn->written += ret;
+                    if (conn->written == conn->len) {
+                        conn->state = CONN_CLOSE;
+                    }
+                    ret = 0;
+                }
+                break;
+
+            case CONN_CLOSE:
+                ret = mbedtls_ssl_close_notify(&conn->ssl);
+                if (ret == 0) {
+                    conn_close(conn);
+                    return;
+                }
+                break;
+
+            default:
+                return;
+        }
+    }
+
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+        total_failures++;
+        conn_close(conn);
+    }
+}
+
+static void accept_connections(mbedtls_net_context *listen_fd,
+                               mbedtls_net_poller *poller,
+                               const mbedtls_ssl_config *conf)
+{
+    int ret;
+    mbedtls_net_context client_fd;
+    connection_t *conn;
+
+    /* The listening socket is edge-triggered too: accept until there
+     * are no more pending connections. */
+    while (1) {
+        mbedtls_net_init(&client_fd);
+        ret = mbedtls_net_accept(listen_fd, &client_fd, NULL, 0, NULL);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ) {
+            return;
+        }
+        if (ret != 0) {
+            /* For example, too many open files. Pending connections are
+             * accepted at the next event on the listening socket. */
+            mbedtls_printf("  ! mbedtls_net_accept returned -0x%04x\n",
+                           (unsigned int) -ret);
+            return;
+        }
+
+        if (active_connections >= opt.max_connections ||
+            (conn = mbedtls_calloc(1, sizeof(*conn))) == NULL) {
+            total_failures++;
+            mbedtls_net_free(&client_fd);
+            continue;
+        }
+
+        mbedtls_ssl_init(&conn->ssl);
+        conn->fd = client_fd;
+        conn->state = CONN_HANDSHAKE;
+        active_connections++;
+
+        if ((ret = mbedtls_net_set_nonblock(&conn->fd)) != 0 ||
+            (ret = mbedtls_ssl_setup(&conn->ssl, conf)) != 0 ||
+            (ret = mbedtls_net_poller_add(poller, &conn->fd,
+                                          MBEDTLS_NET_POLL_READ |
+                                          MBEDTLS_NET_POLL_WRITE,
+                                          conn)) != 0) {
+            total_failures++;
+            conn_close(conn);
+            continue;
+        }
+        mbedtls_ssl_set_bio(&conn->ssl, &conn->fd,
+                            mbedtls_net_send, mbedtls_net_recv, NULL);
+
+        /* The client has usually sent its ClientHello already. */
+        conn_step(conn);
+    }
+}
+
+/*
+ * Allow as many open files as possible: each connection uses one.
+ */
+static void raise_open_files_limit(void)
+{
+    struct rlimit rlim_nofile;
+
+    if (getrlimit(RLIMIT_NOFILE, &rlim_nofile) != 0) {
+        return;
+    }
+    if (rlim_nofile.rlim_cur < rlim_nofile.rlim_max) {
+        rlim_nofile.rlim_cur = rlim_nofile.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rlim_nofile);
+        getrlimit(RLIMIT_NOFILE, &rlim_nofile);
+    }
+    mbedtls_printf("  . Open files limit: %lu\n",
+                   (unsigned long) rlim_nofile.rlim_cur);
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 1, i, n;
+    char *p, *q;
+    mbedtls_net_context listen_fd;
+    mbedtls_net_poller poller;
+    mbedtls_net_poll_event events[MAX_EVENTS];
+    const char pers[] = "ssl_epoll_server";
+    time_t last_report = 0, now;
+    long last_active = -1;
+    unsigned long last_handshakes = 0;
+
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context ctr_drbg;
+    mbedtls_ssl_config conf;
+    mbedtls_x509_crt srvcert;
+    mbedtls_pk_context pkey;
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_context cache;
+#endif
+
+    mbedtls_net_init(&listen_fd);
+    mbedtls_net_poller_init(&poller);
+    mbedtls_x509_crt_init(&srvcert);
+    mbedtls_pk_init(&pkey);
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_ctr_drbg_init(&ctr_drbg);
+    mbedtls_entropy_init(&entropy);
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_init(&cache);
+#endif
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    psa_status_t status = psa_crypto_init();
+    if (status != PSA_SUCCESS) {
+        mbedtls_fprintf(stderr, "Failed to initialize PSA Crypto implementation: %d\n",
+                        (int) status);
+        ret = MBEDTLS_ERR_SSL_HW_ACCEL_FAILED;
+        goto exit;
+    }
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    opt.server_port         = DFL_SERVER_PORT;
+    opt.max_connections     = DFL_MAX_CONNECTIONS;
+
+    for (i = 1; i < argc; i++) {
+        p = argv[i];
+        if ((q = strchr(p, '=')) == NULL) {
+            goto usage;
+        }
+        *q++ = '\0';
+
+        if (strcmp(p, "server_port") == 0) {
+            opt.server_port = q;
+        } else if (strcmp(p, "max_connections") == 0) {
+            opt.max_connections = atoi(q);
+            if (opt.max_connections <= 0) {
+                goto usage;
+            }
+        } else {
+usage:
+            mbedtls_printf(USAGE);
+            goto exit;
+        }
+    }
+
+    raise_open_files_limit();
+
+    /*
+     * 1a. Seed the random number generator
+     */
+    mbedtls_printf("  . Seeding the random number generator...");
+
+    if ((ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy,
+                                     (const unsigned char *) pers,
+                                     strlen(pers))) != 0) {
+        mbedtls_printf(" failed: mbedtls_ctr_drbg_seed returned -0x%04x\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 1b. Load the certificate and the private key
+     */
+    mbedtls_printf("  . Loading the server cert. and key...");
+    fflush(stdout);
+
+    /*
+     * This demonstration program uses embedded test certificates.
+     * Instead, you may want to use mbedtls_x509_crt_parse_file() to read the
+     * server certificate, as well as mbedtls_pk_parse_keyfile().
+     */
+    ret = mbedtls_x509_crt_parse(&srvcert, (const unsigned char *) mbedtls_test_srv_crt,
+                                 mbedtls_test_srv_crt_len);
+    if (ret != 0) {
+        mbedtls_printf(" failed\n  !  mbedtls_x509_crt_parse returned %d\n\n", ret);
+        goto exit;
+    }
+
+    ret = mbedtls_pk_parse_key(&pkey, (const unsigned char *) mbedtls_test_srv_key,
+                               mbedtls_test_srv_key_len, NULL, 0,
+                               mbedtls_ctr_drbg_random, &ctr_drbg);
+    if (ret != 0) {
+        mbedtls_printf(" failed\n  !  mbedtls_pk_parse_key returned %d\n\n", ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 1c. Prepare SSL configuration
+     */
+    mbedtls_printf("  . Setting up the SSL data....");
+
+    if ((ret = mbedtls_ssl_config_defaults(&conf,
+                                           MBEDTLS_SSL_IS_SERVER,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0) {
+        mbedtls_printf(" failed: mbedtls_ssl_config_defaults returned -0x%04x\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_set_max_entries(&cache, opt.max_connections);
+    mbedtls_ssl_conf_session_cache(&conf, &cache,
+                                   mbedtls_ssl_cache_get,
+                                   mbedtls_ssl_cache_set);
+#endif
+
+    if ((ret = mbedtls_ssl_conf_own_cert(&conf, &srvcert, &pkey)) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_ssl_conf_own_cert returned %d\n\n", ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 2. Setup the listening TCP socket and the poller
+     */
+    mbedtls_printf("  . Bind on https://localhost:%s/ ...", opt.server_port);
+    fflush(stdout);
+
+    if ((ret = mbedtls_net_bind(&listen_fd, NULL, opt.server_port,
+                                MBEDTLS_NET_PROTO_TCP)) != 0 ||
+        (ret = mbedtls_net_set_nonblock(&listen_fd)) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_net_bind returned %d\n\n", ret);
+        goto exit;
+    }
+
+    /* mbedtls_net_bind() uses a small backlog, which drops connections when
+     * many clients connect at once. On Linux, calling listen() again
+     * updates the backlog. */
+    listen(listen_fd.fd, SOMAXCONN);
+
+    if ((ret = mbedtls_net_poller_setup(&poller)) != 0 ||
+        (ret = mbedtls_net_poller_add(&poller, &listen_fd,
+                                      MBEDTLS_NET_POLL_READ, NULL)) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_net_poller_setup returned %d\n\n", ret);
+        goto exit;
+    }
+
+    mbedtls_printf(" ok\n");
+
+    /*
+     * 3. Event loop
+     */
+    mbedtls_printf("  . Waiting for remote connections\n");
+
+    while (1) {
+        n = mbedtls_net_poller_wait(&poller, events, MAX_EVENTS, 1000);
+        if (n < 0) {
+            ret = n;
+            mbedtls_printf("  ! mbedtls_net_poller_wait returned -0x%04x\n",
+                           (unsigned int) -ret);
+            goto exit;
+        }
+
+        for (i = 0; i < n; i++) {
+            connection_t *conn = events[i].user_data;
+
+            if (conn == NULL) {
+                accept_connections(&listen_fd, &poller, &conf);
+            } else if (conn->state != CONN_DEAD) {
+                conn_step(conn);
+            }
+        }
+
+        free_dead_connections();
+
+        now = time(NULL);
+        if (now != last_report &&
+            (active_connections != last_active ||
+             total_handshakes != last_handshakes)) {
+            mbedtls_printf("  . active: %ld, handshakes: %lu, failures: %lu\n",
+                           active_connections, total_handshakes, total_failures);
+            last_report = now;
+            last_active = active_connections;
+            last_handshakes = total_handshakes;
+        }
+    }
+
+exit:
+
+#ifdef MBEDTLS_ERROR_C
+    if (ret != 0) {
+        char error_buf[100];
+        mbedtls_strerror(ret, error_buf, 100);
+        mbedtls_printf("Last error was: -0x%04x - %s\n\n", (unsigned int) -ret, error_buf);
+    }
+#endif
+
+    mbedtls_net_poller_free(&poller);
+    mbedtls_net_free(&listen_fd);
+    mbedtls_x509_crt_free(&srvcert);
+    mbedtls_pk_free(&pkey);
+    mbedtls_ssl_config_free(&conf);
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_free(&cache);
+#endif
+    mbedtls_ctr_drbg_free(&ctr_drbg);
+    mbedtls_entropy_free(&entropy);
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    mbedtls_psa_crypto_free();
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    mbedtls_exit(ret);
+}
+
+#endif /* MBEDTLS_BIGNUM_C && MBEDTLS_ENTROPY_C &&
+          MBEDTLS_SSL_TLS_C && MBEDTLS_SSL_SRV_C && MBEDTLS_NET_C &&
+          MBEDTLS_CTR_DRBG_C && MBEDTLS_X509_CRT_PARSE_C &&
+          MBEDTLS_PEM_PARSE_C && __linux__ */
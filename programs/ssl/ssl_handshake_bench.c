@@ -0,0 +1,1057 @@
+/*
+ *  TLS handshake and session resumption benchmark
+ *
+ *  Runs TLS clients and servers in the same process, connected by in-memory
+ *  transports, and measures the cost of full and resumed handshakes.
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#define MBEDTLS_ALLOW_PRIVATE_ACCESS
+
+#include "ssl_test_lib.h"
+
+#if defined(MBEDTLS_SSL_TEST_IMPOSSIBLE)
+int main(void)
+{
+    mbedtls_printf(MBEDTLS_SSL_TEST_IMPOSSIBLE);
+    mbedtls_exit(0);
+}
+#elif !defined(MBEDTLS_SSL_SRV_C) || !defined(MBEDTLS_SSL_CLI_C) || \
+    !defined(MBEDTLS_X509_CRT_PARSE_C) || !defined(MBEDTLS_PEM_PARSE_C) || \
+    !defined(MBEDTLS_HAVE_TIME)
+int main(void)
+{
+    mbedtls_printf("MBEDTLS_SSL_SRV_C and/or MBEDTLS_SSL_CLI_C and/or "
+                   "MBEDTLS_X509_CRT_PARSE_C and/or MBEDTLS_PEM_PARSE_C and/or "
+                   "MBEDTLS_HAVE_TIME not defined.\n");
+    mbedtls_exit(0);
+}
+#else
+
+#include <test/ssl_helpers.h>
+
+#include <time.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+#include "mbedtls/ssl_cache.h"
+#endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include "mbedtls/ssl_ticket.h"
+#endif
+
+#if defined(MBEDTLS_THREADING_C) && defined(MBEDTLS_THREADING_PTHREAD)
+#include <pthread.h>
+#define BENCH_HAVE_THREADS
+#endif
+
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+#define BENCH_HAVE_PROFILE
+#endif
+
+#define DFL_MODE                "all"
+#define DFL_VERSION             "all"
+#define DFL_KEY_TYPE            "ec"
+#define DFL_FORCE_CIPHER        0
+#define DFL_GROUPS              NULL
+#define DFL_HANDSHAKES          100
+#define DFL_THREADS             1
+#define DFL_DEBUG_LEVEL         0
+#define DFL_PROFILE             0
+#define DFL_TLS1_3_PSK_KEX      MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK_EPHEMERAL
+
+#define BENCH_RING_SIZE         (1u << 15)
+#define BENCH_MAX_THREADS       64
+#define BENCH_MAX_STEPS         1000
+#define BENCH_PROFILE_STATES    64
+
+#if defined(MBEDTLS_THREADING_C) && defined(MBEDTLS_THREADING_PTHREAD)
+#define USAGE_THREADS                                                       \
+    "    threads=%%d          number of concurrent client/server pairs\n"   \
+    "                        default: 1, maximum: 64\n"
+#else
+#define USAGE_THREADS ""
+#endif
+
+#if defined(BENCH_HAVE_PROFILE)
+#define USAGE_PROFILE                                                       \
+    "    profile=%%d          1: break the handshake cost down by phase\n"  \
+    "                        and by handshake state\n"                     \
+    "                        default: 0 (disabled)\n"
+#else
+#define USAGE_PROFILE ""
+#endif
+
+#define USAGE                                                               \
+    "\n usage: ssl_handshake_bench param=<>...\n"                           \
+    "\n acceptable parameters:\n"                                           \
+    "    mode=%%s             full, cache, ticket, psk or all\n"            \
+    "                        default: " DFL_MODE "\n"                       \
+    "    version=%%s          tls12, tls13 or all\n"                        \
+    "                        default: " DFL_VERSION "\n"                    \
+    "    key_type=%%s         server key: rsa or ec\n"                      \
+    "                        default: " DFL_KEY_TYPE "\n"                   \
+    "    force_ciphersuite=<name>    default: all enabled\n"                \
+    "    groups=a,b,c,d      default: library default\n"                   \
+    "    tls13_psk_kex=%%s    psk or psk_ephemeral (psk mode only)\n"      \
+    "                        default: psk_ephemeral\n"                      \
+    "    handshakes=%%d       measured handshakes per mode and thread\n"    \
+    "                        default: 100\n"                                \
+    USAGE_THREADS                                                           \
+    USAGE_PROFILE                                                           \
+    "    debug_level=%%d      default: 0 (disabled)\n"                      \
+    "\n"
+
+enum {
+    BENCH_MODE_FULL = 0,
+    BENCH_MODE_CACHE,
+    BENCH_MODE_TICKET,
+    BENCH_MODE_PSK,
+    BENCH_MODE_COUNT
+};
+
+static const char *const bench_mode_names[BENCH_MODE_COUNT] = {
+    "full", "cache", "ticket", "psk"
+};
+
+/*
+ * global options
+ */
+struct options {
+    const char *mode;           /* handshake modes to measure               */
+    const char *version;        /* protocol versions to measure             */
+    const char *key_type;       /* type of the server key                   */
+    int force_ciphersuite[2];   /* protocol/ciphersuite to use, or all      */
+    char *groups;               /* list of supported groups                 */
+    int tls13_psk_kex;          /* TLS 1.3 key exchange mode in psk mode    */
+    int handshakes;             /* measured handshakes per thread           */
+    int threads;                /* number of concurrent connection pairs    */
+    int profile;                /* report time spent per handshake phase    */
+    int debug_level;            /* level of debugging                       */
+} opt;
+
+/*
+ * Wall-clock time in microseconds, for latency measurements.
+ */
+static uint64_t bench_time_us(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t) now.QuadPart * 1000000u / (uint64_t) freq.QuadPart;
+#else
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (uint64_t) tv.tv_sec * 1000000u + (uint64_t) tv.tv_usec;
+#endif
+}
+
+/*
+ * Server-side session lookup wrappers, so that we can report how many
+ * handshakes were actually resumed rather than silently measuring full
+ * handshakes.
+ */
+typedef struct {
+    void *p_ctx;
+    unsigned long hits;
+#if defined(BENCH_HAVE_THREADS)
+    mbedtls_threading_mutex_t mutex;
+#endif
+} bench_resume_counter;
+
+static void bench_count_hit(bench_resume_counter *counter)
+{
+#if defined(BENCH_HAVE_THREADS)
+    mbedtls_mutex_lock(&counter->mutex);
+#endif
+    counter->hits++;
+#if defined(BENCH_HAVE_THREADS)
+    mbedtls_mutex_unlock(&counter->mutex);
+#endif
+}
+
+#if defined(MBEDTLS_SSL_CACHE_C)
+static int bench_cache_get(void *data, unsigned char const *session_id,
+                           size_t session_id_len, mbedtls_ssl_session *session)
+{
+    bench_resume_counter *counter = data;
+    int ret = mbedtls_ssl_cache_get(counter->p_ctx, session_id,
+                                    session_id_len, session);
+    if (ret == 0) {
+        bench_count_hit(counter);
+    }
+    return ret;
+}
+
+static int bench_cache_set(void *data, unsigned char const *session_id,
+                           size_t session_id_len,
+                           const mbedtls_ssl_session *session)
+{
+    bench_resume_counter *counter = data;
+    return mbedtls_ssl_cache_set(counter->p_ctx, session_id,
+                                 session_id_len, session);
+}
+#endif /* MBEDTLS_SSL_CACHE_C */
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+static int bench_ticket_write(void *p_ticket, const mbedtls_ssl_session *session,
+                              unsigned char *start, const unsigned char *end,
+                              size_t *tlen, uint32_t *lifetime)
+{
+    bench_resume_counter *counter = p_ticket;
+    return mbedtls_ssl_ticket_write(counter->p_ctx, session,
+                                    start, end, tlen, lifetime);
+}
+
+static int bench_ticket_parse(void *p_ticket, mbedtls_ssl_session *session,
+                              unsigned char *buf, size_t len)
+{
+    bench_resume_counter *counter = p_ticket;
+    int ret = mbedtls_ssl_ticket_parse(counter->p_ctx, session, buf, len);
+    if (ret == 0) {
+        bench_count_hit(counter);
+    }
+    return ret;
+}
+#endif /* MBEDTLS_SSL_SESSION_TICKETS && MBEDTLS_SSL_TICKET_C */
+
+#if defined(BENCH_HAVE_PROFILE)
+/*
+ * Clock for the handshake profile: the cycle counter where we know how to
+ * read it, microseconds otherwise.
+ */
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    (defined(__amd64__) || defined(__x86_64__))
+#define BENCH_PROFILE_UNIT      "kcycles"
+#define BENCH_PROFILE_SCALE     1000.0
+static uint64_t bench_profile_clock(void)
+{
+    uint32_t lo, hi;
+    __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t) hi << 32) | lo;
+}
+#else
+#define BENCH_PROFILE_UNIT      "us"
+#define BENCH_PROFILE_SCALE     1.0
+#define bench_profile_clock     bench_time_us
+#endif
+
+/*
+ * Time spent by one endpoint in each profiling phase and in each
+ * handshake state, accumulated over the measured handshakes.
+ */
+typedef struct {
+    int active;
+    uint64_t start[MBEDTLS_SSL_PROFILE_PHASE_COUNT];
+    uint64_t phase_total[MBEDTLS_SSL_PROFILE_PHASE_COUNT];
+    uint64_t state_total[BENCH_PROFILE_STATES];
+} bench_profile;
+
+static const char *const bench_phase_names[MBEDTLS_SSL_PROFILE_PHASE_COUNT] = {
+    "handshake steps", "key exchange", "sign", "verify signature",
+    "verify chain", "key schedule", "send", "recv"
+};
+
+/*
+ * Profiling callback. Connections are set up with their bench_profile as
+ * user data, so that the same configuration can be shared by all threads.
+ */
+static void bench_profile_event(void *p_profile, mbedtls_ssl_context *ssl,
+                                mbedtls_ssl_profile_phase phase,
+                                int state, int end)
+{
+    bench_profile *profile = mbedtls_ssl_get_user_data_p(ssl);
+    uint64_t now = bench_profile_clock();
+    uint64_t elapsed;
+
+    (void) p_profile;
+
+    if (profile == NULL || !profile->active) {
+        return;
+    }
+    if (!end) {
+        profile->start[phase] = now;
+        return;
+    }
+
+    elapsed = now - profile->start[phase];
+    profile->phase_total[phase] += elapsed;
+    if (phase == MBEDTLS_SSL_PROFILE_HANDSHAKE_STEP &&
+        state >= 0 && state < BENCH_PROFILE_STATES) {
+        profile->state_total[state] += elapsed;
+    }
+}
+#endif /* BENCH_HAVE_PROFILE */
+
+/*
+ * State shared by all threads while measuring one configuration.
+ */
+typedef struct {
+    int mode;
+    mbedtls_ssl_protocol_version version;
+    mbedtls_ssl_config srv_conf;
+    mbedtls_ssl_config cli_conf;
+    bench_resume_counter resumed;
+} bench_config;
+
+/*
+ * Per-thread results.
+ */
+typedef struct {
+    const bench_config *config;
+    uint32_t *latencies_us;
+    int done;
+    int ret;
+    char ciphersuite[64];
+#if defined(BENCH_HAVE_PROFILE)
+    bench_profile profile[2];   /* client, server */
+#endif
+} bench_worker;
+
+static rng_context_t rng;
+static mbedtls_x509_crt cacert;
+static mbedtls_x509_crt srvcert;
+static mbedtls_pk_context pkey;
+#if defined(MBEDTLS_SSL_CACHE_C)
+static mbedtls_ssl_cache_context cache;
+#endif
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+static mbedtls_ssl_ticket_context ticket_ctx;
+#endif
+static uint16_t group_list[GROUP_LIST_SIZE];
+static int tls12_psk_ciphersuites[64];
+
+static const unsigned char bench_psk[32] = {
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20
+};
+static const char bench_psk_identity[] = "Client_identity";
+
+/*
+ * Obtain a session from a completed connection. In TLS 1.3 the server
+ * sends tickets after the handshake, so let it flush them and let the client
+ * process them first.
+ */
+static int bench_save_session(mbedtls_ssl_context *cli,
+                              mbedtls_ssl_context *srv,
+                              mbedtls_ssl_session *session)
+{
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3) && defined(MBEDTLS_SSL_SESSION_TICKETS)
+    if (mbedtls_ssl_get_version_number(cli) == MBEDTLS_SSL_VERSION_TLS1_3) {
+        unsigned char buf[16];
+        int ret;
+        int steps;
+
+        for (steps = 0; steps < BENCH_MAX_STEPS; steps++) {
+            ret = mbedtls_ssl_write(srv, buf, 0);
+            if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ &&
+                ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+                return ret;
+            }
+
+            ret = mbedtls_ssl_read(cli, buf, sizeof(buf));
+            if (ret == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET) {
+                break;
+            }
+            if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ &&
+                ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+                return ret;
+            }
+        }
+        if (steps == BENCH_MAX_STEPS) {
+            return MBEDTLS_ERR_SSL_TIMEOUT;
+        }
+    }
+#else
+    (void) srv;
+#endif
+
+    return mbedtls_ssl_get_session(cli, session);
+}
+
+/* Drop what the previous handshake left unread, such as a TLS 1.3
+ * NewSessionTicket that the client did not process. */
+static void bench_discard_input(mbedtls_test_mock_socket *socket)
+{
+    (void) mbedtls_test_ssl_buffer_get(socket->input, NULL,
+                                       socket->input->content_length);
+}
+
+static void *bench_worker_run(void *data)
+{
+    bench_worker *worker = data;
+    const bench_config *config = worker->config;
+    mbedtls_ssl_context cli, srv;
+    mbedtls_ssl_session session;
+    mbedtls_test_mock_socket cli_sock, srv_sock;
+    int resume = config->mode == BENCH_MODE_CACHE ||
+                 config->mode == BENCH_MODE_TICKET;
+    int i;
+    int ret;
+
+    mbedtls_ssl_init(&cli);
+    mbedtls_ssl_init(&srv);
+    mbedtls_ssl_session_init(&session);
+    mbedtls_test_mock_socket_init(&cli_sock);
+    mbedtls_test_mock_socket_init(&srv_sock);
+
+    if ((ret = mbedtls_test_mock_socket_connect(&cli_sock, &srv_sock,
+                                                BENCH_RING_SIZE)) != 0) {
+        goto exit;
+    }
+
+    if ((ret = mbedtls_ssl_setup(&cli, &config->cli_conf)) != 0 ||
+        (ret = mbedtls_ssl_setup(&srv, &config->srv_conf)) != 0) {
+        goto exit;
+    }
+    if ((ret = mbedtls_ssl_set_hostname(&cli, "localhost")) != 0) {
+        goto exit;
+    }
+    mbedtls_ssl_set_bio(&cli, &cli_sock, mbedtls_test_mock_tcp_send_nb,
+                        mbedtls_test_mock_tcp_recv_nb, NULL);
+    mbedtls_ssl_set_bio(&srv, &srv_sock, mbedtls_test_mock_tcp_send_nb,
+                        mbedtls_test_mock_tcp_recv_nb, NULL);
+#if defined(BENCH_HAVE_PROFILE)
+    mbedtls_ssl_set_user_data_p(&cli, &worker->profile[0]);
+    mbedtls_ssl_set_user_data_p(&srv, &worker->profile[1]);
+#endif
+
+    /* Iteration -1 is an unmeasured warm-up handshake. In resumption modes
+     * it also establishes the session that the measured handshakes resume. */
+    for (i = -1; i < opt.handshakes; i++) {
+        uint64_t start;
+
+        if ((ret = mbedtls_ssl_session_reset(&cli)) != 0 ||
+            (ret = mbedtls_ssl_session_reset(&srv)) != 0) {
+            goto exit;
+        }
+        bench_discard_input(&cli_sock);
+        bench_discard_input(&srv_sock);
+
+        if (resume && i >= 0 &&
+            (ret = mbedtls_ssl_set_session(&cli, &session)) != 0) {
+            goto exit;
+        }
+
+#if defined(BENCH_HAVE_PROFILE)
+        worker->profile[0].active = worker->profile[1].active = i >= 0;
+#endif
+        start = bench_time_us();
+        ret = loopback_handshake(&cli, &srv);
+#if defined(BENCH_HAVE_PROFILE)
+        worker->profile[0].active = worker->profile[1].active = 0;
+#endif
+        if (ret != 0) {
+            goto exit;
+        }
+        if (i >= 0) {
+            worker->latencies_us[i] = (uint32_t) (bench_time_us() - start);
+        } else {
+            mbedtls_snprintf(worker->ciphersuite, sizeof(worker->ciphersuite),
+                             "%s", mbedtls_ssl_get_ciphersuite(&cli));
+            if (resume &&
+                (ret = bench_save_session(&cli, &srv, &session)) != 0) {
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    worker->ret = ret;
+    worker->done = 1;
+    mbedtls_ssl_session_free(&session);
+    mbedtls_ssl_free(&cli);
+    mbedtls_ssl_free(&srv);
+    mbedtls_test_mock_socket_close(&cli_sock);
+    mbedtls_test_mock_socket_close(&srv_sock);
+    return NULL;
+}
+
+static int bench_setup_config(bench_config *config)
+{
+    int ret;
+
+    mbedtls_ssl_config_init(&config->srv_conf);
+    mbedtls_ssl_config_init(&config->cli_conf);
+
+    if ((ret = mbedtls_ssl_config_defaults(&config->srv_conf,
+                                           MBEDTLS_SSL_IS_SERVER,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0 ||
+        (ret = mbedtls_ssl_config_defaults(&config->cli_conf,
+                                           MBEDTLS_SSL_IS_CLIENT,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0) {
+        return ret;
+    }
+
+    mbedtls_ssl_conf_rng(&config->srv_conf, rng_get, &rng);
+    mbedtls_ssl_conf_rng(&config->cli_conf, rng_get, &rng);
+    mbedtls_ssl_conf_dbg(&config->srv_conf, my_debug, stdout);
+    mbedtls_ssl_conf_dbg(&config->cli_conf, my_debug, stdout);
+#if defined(BENCH_HAVE_PROFILE)
+    if (opt.profile) {
+        mbedtls_ssl_conf_handshake_profile(&config->srv_conf,
+                                           bench_profile_event, NULL);
+        mbedtls_ssl_conf_handshake_profile(&config->cli_conf,
+                                           bench_profile_event, NULL);
+    }
+#endif
+
+    mbedtls_ssl_conf_min_tls_version(&config->srv_conf, config->version);
+    mbedtls_ssl_conf_max_tls_version(&config->srv_conf, config->version);
+    mbedtls_ssl_conf_min_tls_version(&config->cli_conf, config->version);
+    mbedtls_ssl_conf_max_tls_version(&config->cli_conf, config->version);
+
+    mbedtls_ssl_conf_ca_chain(&config->cli_conf, &cacert, NULL);
+    mbedtls_ssl_conf_authmode(&config->cli_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    if ((ret = mbedtls_ssl_conf_own_cert(&config->srv_conf,
+                                         &srvcert, &pkey)) != 0) {
+        return ret;
+    }
+
+    if (opt.force_ciphersuite[0] != DFL_FORCE_CIPHER) {
+        mbedtls_ssl_conf_ciphersuites(&config->srv_conf, opt.force_ciphersuite);
+        mbedtls_ssl_conf_ciphersuites(&config->cli_conf, opt.force_ciphersuite);
+    }
+    if (opt.groups != NULL) {
+        mbedtls_ssl_conf_groups(&config->srv_conf, group_list);
+        mbedtls_ssl_conf_groups(&config->cli_conf, group_list);
+    }
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&config->cli_conf,
+                                     config->mode == BENCH_MODE_TICKET ?
+                                     MBEDTLS_SSL_SESSION_TICKETS_ENABLED :
+                                     MBEDTLS_SSL_SESSION_TICKETS_DISABLED);
+#endif
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3) && defined(MBEDTLS_SSL_SESSION_TICKETS) && \
+    defined(MBEDTLS_SSL_SRV_C)
+    mbedtls_ssl_conf_new_session_tickets(&config->srv_conf,
+                                         config->mode == BENCH_MODE_TICKET ?
+                                         1 : 0);
+#endif
+
+    switch (config->mode) {
+        case BENCH_MODE_FULL:
+            break;
+
+        case BENCH_MODE_CACHE:
+#if defined(MBEDTLS_SSL_CACHE_C)
+            config->resumed.p_ctx = &cache;
+            mbedtls_ssl_conf_session_cache(&config->srv_conf, &config->resumed,
+                                           bench_cache_get, bench_cache_set);
+            break;
+#else
+            return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+
+        case BENCH_MODE_TICKET:
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+            config->resumed.p_ctx = &ticket_ctx;
+            mbedtls_ssl_conf_session_tickets_cb(&config->srv_conf,
+                                                bench_ticket_write,
+                                                bench_ticket_parse,
+                                                &config->resumed);
+            break;
+#else
+            return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+
+        case BENCH_MODE_PSK:
+#if defined(MBEDTLS_SSL_HANDSHAKE_WITH_PSK_ENABLED)
+            if ((ret = mbedtls_ssl_conf_psk(&config->srv_conf,
+                                            bench_psk, sizeof(bench_psk),
+                                            (const unsigned char *) bench_psk_identity,
+                                            strlen(bench_psk_identity))) != 0 ||
+                (ret = mbedtls_ssl_conf_psk(&config->cli_conf,
+                                            bench_psk, sizeof(bench_psk),
+                                            (const unsigned char *) bench_psk_identity,
+                                            strlen(bench_psk_identity))) != 0) {
+                return ret;
+            }
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+            if (config->version == MBEDTLS_SSL_VERSION_TLS1_3) {
+                mbedtls_ssl_conf_tls13_key_exchange_modes(&config->srv_conf,
+                                                          opt.tls13_psk_kex);
+                mbedtls_ssl_conf_tls13_key_exchange_modes(&config->cli_conf,
+                                                          opt.tls13_psk_kex);
+            }
+#endif
+            if (config->version == MBEDTLS_SSL_VERSION_TLS1_2 &&
+                opt.force_ciphersuite[0] == DFL_FORCE_CIPHER) {
+                if (tls12_psk_ciphersuites[0] == 0) {
+                    return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+                }
+                mbedtls_ssl_conf_ciphersuites(&config->srv_conf,
+                                              tls12_psk_ciphersuites);
+                mbedtls_ssl_conf_ciphersuites(&config->cli_conf,
+                                              tls12_psk_ciphersuites);
+            }
+            break;
+#else
+            return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+
+        default:
+            return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+
+    return 0;
+}
+
+static int bench_compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *) a;
+    uint32_t y = *(const uint32_t *) b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t bench_percentile(const uint32_t *sorted, size_t count,
+                                 unsigned percent)
+{
+    size_t idx = (count * percent + 99) / 100;
+    return sorted[idx == 0 ? 0 : idx - 1];
+}
+
+#if defined(BENCH_HAVE_PROFILE)
+/*
+ * Print the profile summed over all workers, per handshake.
+ * Phases other than "handshake steps" are included in the steps, the
+ * TLS 1.3 key schedule includes the ECDHE shared secret computation, and
+ * send/recv also include the transport. Steps are listed by state number
+ * (see mbedtls_ssl_states).
+ */
+static void bench_print_profile(const bench_worker *workers, size_t count)
+{
+    uint64_t total[2];
+    int phase, state, t, side;
+
+    mbedtls_printf("  %-14s  %-20s %10s %10s\n", "",
+                   BENCH_PROFILE_UNIT "/handshake", "client", "server");
+    for (phase = 0; phase < MBEDTLS_SSL_PROFILE_PHASE_COUNT; phase++) {
+        for (side = 0; side < 2; side++) {
+            total[side] = 0;
+            for (t = 0; t < opt.threads; t++) {
+                total[side] += workers[t].profile[side].phase_total[phase];
+            }
+        }
+        mbedtls_printf("  %-14s  %-20s %10.1f %10.1f\n", "",
+                       bench_phase_names[phase],
+                       (double) total[0] / BENCH_PROFILE_SCALE / (double) count,
+                       (double) total[1] / BENCH_PROFILE_SCALE / (double) count);
+    }
+    for (state = 0; state < BENCH_PROFILE_STATES; state++) {
+        for (side = 0; side < 2; side++) {
+            total[side] = 0;
+            for (t = 0; t < opt.threads; t++) {
+                total[side] += workers[t].profile[side].state_total[state];
+            }
+        }
+        if (total[0] == 0 && total[1] == 0) {
+            continue;
+        }
+        mbedtls_printf("  %-14s  state %-14d %10.1f %10.1f\n", "", state,
+                       (double) total[0] / BENCH_PROFILE_SCALE / (double) count,
+                       (double) total[1] / BENCH_PROFILE_SCALE / (double) count);
+    }
+}
+#endif /* BENCH_HAVE_PROFILE */
+
+static int bench_run(int mode, mbedtls_ssl_protocol_version version)
+{
+    static bench_worker workers[BENCH_MAX_THREADS];
+#if defined(BENCH_HAVE_THREADS)
+    static pthread_t threads[BENCH_MAX_THREADS];
+#endif
+    bench_config config;
+    uint32_t *latencies = NULL;
+    size_t count = (size_t) opt.handshakes * (size_t) opt.threads;
+    uint64_t wall_start, wall_us;
+    clock_t cpu_start, cpu_ticks;
+    const char *version_name =
+        version == MBEDTLS_SSL_VERSION_TLS1_3 ? "TLS1.3" : "TLS1.2";
+    char title[80];
+    int t;
+    int ret;
+
+    memset(&config, 0, sizeof(config));
+    config.mode = mode;
+    config.version = version;
+#if defined(BENCH_HAVE_THREADS)
+    mbedtls_mutex_init(&config.resumed.mutex);
+#endif
+
+    mbedtls_snprintf(title, sizeof(title), "%s %s", version_name,
+                     bench_mode_names[mode]);
+    mbedtls_printf("  %-14s: ", title);
+    fflush(stdout);
+
+    ret = bench_setup_config(&config);
+    if (ret == MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE ||
+        (mode == BENCH_MODE_CACHE && version == MBEDTLS_SSL_VERSION_TLS1_3)) {
+        /* Session-ID based resumption does not exist in TLS 1.3. */
+        mbedtls_printf("not available in this configuration\n");
+        ret = 0;
+        goto exit;
+    }
+    if (ret != 0) {
+        goto exit;
+    }
+
+    latencies = mbedtls_calloc(count, sizeof(uint32_t));
+    if (latencies == NULL) {
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto exit;
+    }
+
+    for (t = 0; t < opt.threads; t++) {
+        memset(&workers[t], 0, sizeof(workers[t]));
+        workers[t].config = &config;
+        workers[t].latencies_us = latencies + (size_t) t * opt.handshakes;
+    }
+
+    wall_start = bench_time_us();
+    cpu_start = clock();
+
+#if defined(BENCH_HAVE_THREADS)
+    for (t = 0; t < opt.threads; t++) {
+        if (pthread_create(&threads[t], NULL, bench_worker_run,
+                           &workers[t]) != 0) {
+            workers[t].ret = MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+            workers[t].done = 1;
+            threads[t] = pthread_self();
+        }
+    }
+    for (t = 0; t < opt.threads; t++) {
+        if (!pthread_equal(threads[t], pthread_self())) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+#else
+    bench_worker_run(&workers[0]);
+#endif
+
+    cpu_ticks = clock() - cpu_start;
+    wall_us = bench_time_us() - wall_start;
+
+    for (t = 0; t < opt.threads; t++) {
+        if (workers[t].ret != 0) {
+            ret = workers[t].ret;
+            goto exit;
+        }
+    }
+
+    qsort(latencies, count, sizeof(uint32_t), bench_compare_u32);
+
+    mbedtls_printf("%9.1f hs/s, %7.0f us CPU/hs, "
+                   "latency us p50 %6u p90 %6u p99 %6u max %6u",
+                   wall_us == 0 ? 0.0 : (double) count * 1e6 / (double) wall_us,
+                   (double) cpu_ticks * 1e6 / CLOCKS_PER_SEC / (double) count,
+                   (unsigned) bench_percentile(latencies, count, 50),
+                   (unsigned) bench_percentile(latencies, count, 90),
+                   (unsigned) bench_percentile(latencies, count, 99),
+                   (unsigned) latencies[count - 1]);
+    if (mode == BENCH_MODE_CACHE || mode == BENCH_MODE_TICKET) {
+        mbedtls_printf(", %lu%% resumed",
+                       config.resumed.hits * 100 / (unsigned long) count);
+    }
+    mbedtls_printf("\n  %-14s  %s\n", "", workers[0].ciphersuite);
+#if defined(BENCH_HAVE_PROFILE)
+    if (opt.profile) {
+        bench_print_profile(workers, count);
+    }
+#endif
+
+exit:
+    if (ret != 0) {
+        char error_buf[100];
+        mbedtls_strerror(ret, error_buf, sizeof(error_buf));
+        mbedtls_printf("failed\n  ! -0x%04x - %s\n", (unsigned int) -ret,
+                       error_buf);
+    }
+#if defined(BENCH_HAVE_THREADS)
+    mbedtls_mutex_free(&config.resumed.mutex);
+#endif
+    mbedtls_ssl_config_free(&config.srv_conf);
+    mbedtls_ssl_config_free(&config.cli_conf);
+    mbedtls_free(latencies);
+    return ret;
+}
+
+static int bench_parse_mode(const char *name, int *modes)
+{
+    int i;
+
+    if (strcmp(name, "all") == 0) {
+        for (i = 0; i < BENCH_MODE_COUNT; i++) {
+            modes[i] = 1;
+        }
+        return 0;
+    }
+    for (i = 0; i < BENCH_MODE_COUNT; i++) {
+        if (strcmp(name, bench_mode_names[i]) == 0) {
+            modes[i] = 1;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0, i;
+    int exit_code = MBEDTLS_EXIT_FAILURE;
+    int modes[BENCH_MODE_COUNT] = { 0 };
+    int mode;
+    const int *list;
+    size_t psk_count = 0;
+    char *p, *q;
+    const char *srv_crt, *srv_key;
+    size_t srv_crt_len, srv_key_len;
+#if defined(MBEDTLS_USE_PSA_CRYPTO) || defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    psa_status_t status;
+#endif
+
+    rng_init(&rng);
+    mbedtls_x509_crt_init(&cacert);
+    mbedtls_x509_crt_init(&srvcert);
+    mbedtls_pk_init(&pkey);
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_init(&cache);
+#endif
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_init(&ticket_ctx);
+#endif
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO) || defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    status = psa_crypto_init();
+    if (status != PSA_SUCCESS) {
+        mbedtls_fprintf(stderr, "Failed to initialize PSA Crypto implementation: %d\n",
+                        (int) status);
+        goto exit;
+    }
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+    mbedtls_test_enable_insecure_external_rng();
+#endif
+
+    opt.mode                = DFL_MODE;
+    opt.version             = DFL_VERSION;
+    opt.key_type            = DFL_KEY_TYPE;
+    opt.force_ciphersuite[0] = DFL_FORCE_CIPHER;
+    opt.groups              = DFL_GROUPS;
+    opt.tls13_psk_kex       = DFL_TLS1_3_PSK_KEX;
+    opt.handshakes          = DFL_HANDSHAKES;
+    opt.threads             = DFL_THREADS;
+    opt.profile             = DFL_PROFILE;
+    opt.debug_level         = DFL_DEBUG_LEVEL;
+
+    for (i = 1; i < argc; i++) {
+        p = argv[i];
+        if ((q = strchr(p, '=')) == NULL) {
+            goto usage;
+        }
+        *q++ = '\0';
+
+        if (strcmp(p, "mode") == 0) {
+            opt.mode = q;
+        } else if (strcmp(p, "version") == 0) {
+            if (strcmp(q, "tls12") != 0 && strcmp(q, "tls13") != 0 &&
+                strcmp(q, "all") != 0) {
+                goto usage;
+            }
+            opt.version = q;
+        } else if (strcmp(p, "key_type") == 0) {
+            if (strcmp(q, "rsa") != 0 && strcmp(q, "ec") != 0) {
+                goto usage;
+            }
+            opt.key_type = q;
+        } else if (strcmp(p, "force_ciphersuite") == 0) {
+            opt.force_ciphersuite[0] = mbedtls_ssl_get_ciphersuite_id(q);
+            if (opt.force_ciphersuite[0] == 0) {
+                ret = 2;
+                goto usage;
+            }
+            opt.force_ciphersuite[1] = 0;
+        } else if (strcmp(p, "groups") == 0) {
+            opt.groups = q;
+        } else if (strcmp(p, "tls13_psk_kex") == 0) {
+            if (strcmp(q, "psk") == 0) {
+                opt.tls13_psk_kex = MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK;
+            } else if (strcmp(q, "psk_ephemeral") == 0) {
+                opt.tls13_psk_kex =
+                    MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK_EPHEMERAL;
+            } else {
+                goto usage;
+            }
+        } else if (strcmp(p, "handshakes") == 0) {
+            opt.handshakes = atoi(q);
+            if (opt.handshakes < 1) {
+                goto usage;
+            }
+        }
+#if defined(BENCH_HAVE_THREADS)
+        else if (strcmp(p, "threads") == 0) {
+            opt.threads = atoi(q);
+            if (opt.threads < 1 || opt.threads > BENCH_MAX_THREADS) {
+                goto usage;
+            }
+        }
+#endif
+#if defined(BENCH_HAVE_PROFILE)
+        else if (strcmp(p, "profile") == 0) {
+            opt.profile = atoi(q);
+            if (opt.profile < 0 || opt.profile > 1) {
+                goto usage;
+            }
+        }
+#endif
+        else if (strcmp(p, "debug_level") == 0) {
+            opt.debug_level = atoi(q);
+            if (opt.debug_level < 0 || opt.debug_level > 65535) {
+                goto usage;
+            }
+        } else {
+            goto usage;
+        }
+    }
+
+    if (bench_parse_mode(opt.mode, modes) != 0) {
+        goto usage;
+    }
+    if (opt.groups != NULL &&
+        parse_groups(opt.groups, group_list, GROUP_LIST_SIZE) != 0) {
+        goto exit;
+    }
+
+#if defined(MBEDTLS_DEBUG_C)
+    mbedtls_debug_set_threshold(opt.debug_level);
+#endif
+
+    if ((ret = rng_seed(&rng, 0, "ssl_handshake_bench")) != 0) {
+        goto exit;
+    }
+
+    /*
+     * Load the certificates and the server key
+     */
+    if (strcmp(opt.key_type, "rsa") == 0) {
+        srv_crt = mbedtls_test_srv_crt_rsa;
+        srv_crt_len = mbedtls_test_srv_crt_rsa_len;
+        srv_key = mbedtls_test_srv_key_rsa;
+        srv_key_len = mbedtls_test_srv_key_rsa_len;
+    } else {
+        srv_crt = mbedtls_test_srv_crt_ec;
+        srv_crt_len = mbedtls_test_srv_crt_ec_len;
+        srv_key = mbedtls_test_srv_key_ec;
+        srv_key_len = mbedtls_test_srv_key_ec_len;
+    }
+
+    if ((ret = mbedtls_x509_crt_parse(&cacert,
+                                      (const unsigned char *) mbedtls_test_cas_pem,
+                                      mbedtls_test_cas_pem_len)) != 0 ||
+        (ret = mbedtls_x509_crt_parse(&srvcert, (const unsigned char *) srv_crt,
+                                      srv_crt_len)) != 0 ||
+        (ret = mbedtls_pk_parse_key(&pkey, (const unsigned char *) srv_key,
+                                    srv_key_len, NULL, 0, rng_get, &rng)) != 0) {
+        mbedtls_printf(" failed\n  !  loading test credentials returned -0x%x\n\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    if ((ret = mbedtls_ssl_ticket_setup(&ticket_ctx, rng_get, &rng,
+                                        MBEDTLS_CIPHER_AES_256_GCM,
+                                        86400)) != 0) {
+        mbedtls_printf(" failed\n  ! mbedtls_ssl_ticket_setup returned -0x%x\n\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+#endif
+
+    /* TLS 1.2 PSK mode: restrict the offer to PSK-based ciphersuites */
+    for (list = mbedtls_ssl_list_ciphersuites(); *list != 0; list++) {
+        const mbedtls_ssl_ciphersuite_t *info =
+            mbedtls_ssl_ciphersuite_from_id(*list);
+        if (info != NULL && mbedtls_ssl_ciphersuite_uses_psk(info) &&
+            psk_count < sizeof(tls12_psk_ciphersuites) /
+            sizeof(tls12_psk_ciphersuites[0]) - 1) {
+            tls12_psk_ciphersuites[psk_count++] = *list;
+        }
+    }
+    tls12_psk_ciphersuites[psk_count] = 0;
+
+    mbedtls_printf("\n  Handshakes per mode: %d x %d thread(s), server key: %s\n\n",
+                   opt.handshakes, opt.threads, opt.key_type);
+
+    for (mode = 0; mode < BENCH_MODE_COUNT; mode++) {
+        if (!modes[mode]) {
+            continue;
+        }
+#if defined(MBEDTLS_SSL_PROTO_TLS1_2)
+        if (strcmp(opt.version, "tls13") != 0 &&
+            (ret = bench_run(mode, MBEDTLS_SSL_VERSION_TLS1_2)) != 0) {
+            goto exit;
+        }
+#endif
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+        if (strcmp(opt.version, "tls12") != 0 &&
+            (ret = bench_run(mode, MBEDTLS_SSL_VERSION_TLS1_3)) != 0) {
+            goto exit;
+        }
+#endif
+    }
+
+    mbedtls_printf("\n");
+    exit_code = MBEDTLS_EXIT_SUCCESS;
+    goto exit;
+
+usage:
+    if (ret == 0) {
+        ret = 1;
+    }
+
+    mbedtls_printf(USAGE);
+
+    list = mbedtls_ssl_list_ciphersuites();
+    while (*list) {
+        mbedtls_printf(" %-42s", mbedtls_ssl_get_ciphersuite_name(*list));
+        list++;
+        if (!*list) {
+            break;
+        }
+        mbedtls_printf(" %s\n", mbedtls_ssl_get_ciphersuite_name(*list));
+        list++;
+    }
+    mbedtls_printf("\n");
+
+exit:
+    mbedtls_x509_crt_free(&cacert);
+    mbedtls_x509_crt_free(&srvcert);
+    mbedtls_pk_free(&pkey);
+#if defined(MBEDTLS_SSL_CACHE_C)
+    mbedtls_ssl_cache_free(&cache);
+#endif
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_TICKET_C)
+    mbedtls_ssl_ticket_free(&ticket_ctx);
+#endif
+    rng_free(&rng);
+
+    mbedtls_exit(exit_code);
+}
+#endif /* !MBEDTLS_SSL_TEST_IMPOSSIBLE && MBEDTLS_SSL_SRV_C && MBEDTLS_SSL_CLI_C &&
+          MBEDTLS_X509_CRT_PARSE_C && MBEDTLS_PEM_PARSE_C && MBEDTLS_HAVE_TIME */
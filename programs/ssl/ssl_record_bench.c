@@ -0,0 +1,508 @@
+/*
+ *  TLS record layer throughput benchmark
+ *
+ *  Establishes a TLS connection between a client and a server in the same
+ *  process, connected by an in-memory transport, then measures the cost of
+ *  mbedtls_ssl_write() on the client and mbedtls_ssl_read() on the server
+ *  for each ciphersuite, record size and protocol version.
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+ */
+
+#define MBEDTLS_ALLOW_PRIVATE_ACCESS
+
+#include "ssl_test_lib.h"
+
+#if defined(MBEDTLS_SSL_TEST_IMPOSSIBLE)
+int main(void)
+{
+    mbedtls_printf(MBEDTLS_SSL_TEST_IMPOSSIBLE);
+    mbedtls_exit(0);
+}
+#elif !defined(MBEDTLS_SSL_SRV_C) || !defined(MBEDTLS_SSL_CLI_C) || \
+    !defined(MBEDTLS_X509_CRT_PARSE_C) || !defined(MBEDTLS_PEM_PARSE_C) || \
+    !defined(MBEDTLS_HAVE_TIME)
+int main(void)
+{
+    mbedtls_printf("MBEDTLS_SSL_SRV_C and/or MBEDTLS_SSL_CLI_C and/or "
+                   "MBEDTLS_X509_CRT_PARSE_C and/or MBEDTLS_PEM_PARSE_C and/or "
+                   "MBEDTLS_HAVE_TIME not defined.\n");
+    mbedtls_exit(0);
+}
+#else
+
+#include <test/ssl_helpers.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#define DFL_VERSION             "all"
+#define DFL_CIPHERSUITES        NULL
+#define DFL_RECORD_SIZES        "16,256,1024,4096,16384"
+#define DFL_BYTES               (4 * 1024 * 1024)
+#define DFL_DEBUG_LEVEL         0
+
+#define BENCH_MAX_CIPHERSUITES  256
+#define BENCH_MAX_RECORD_SIZES  16
+#define BENCH_RING_SIZE         (2 * (MBEDTLS_SSL_OUT_CONTENT_LEN + 1024))
+
+#define USAGE                                                               \
+    "\n usage: ssl_record_bench param=<>...\n"                              \
+    "\n acceptable parameters:\n"                                           \
+    "    version=%%s          tls12, tls13 or all\n"                        \
+    "                        default: " DFL_VERSION "\n"                    \
+    "    ciphersuites=a,b,c  default: all enabled ciphersuites with\n"      \
+    "                        ECDHE-ECDSA key exchange, and all TLS 1.3\n"   \
+    "                        ciphersuites\n"                                \
+    "    record_sizes=a,b,c  plaintext bytes per record\n"                  \
+    "                        default: " DFL_RECORD_SIZES "\n"               \
+    "    bytes=%%d            application data to transfer per measurement\n" \
+    "                        default: 4194304\n"                            \
+    "    debug_level=%%d      default: 0 (disabled)\n"                      \
+    "\n"
+
+/*
+ * global options
+ */
+struct options {
+    const char *version;        /* protocol versions to measure             */
+    char *ciphersuites;         /* ciphersuites to measure, or default list */
+    char *record_sizes;         /* record payload sizes to measure          */
+    size_t bytes;               /* application data per measurement         */
+    int debug_level;            /* level of debugging                       */
+} opt;
+
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) && \
+    (defined(__amd64__) || defined(__x86_64__))
+#define BENCH_HAVE_CYCLES
+static uint64_t bench_cycles(void)
+{
+    uint32_t lo, hi;
+    __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t) hi << 32) | lo;
+}
+#else
+static uint64_t bench_cycles(void)
+{
+    return 0;
+}
+#endif
+
+static uint64_t bench_time_us(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t) now.QuadPart * 1000000u / (uint64_t) freq.QuadPart;
+#else
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (uint64_t) tv.tv_sec * 1000000u + (uint64_t) tv.tv_usec;
+#endif
+}
+
+static rng_context_t rng;
+static mbedtls_x509_crt cacert;
+static mbedtls_x509_crt srvcert;
+static mbedtls_pk_context pkey;
+static unsigned char *payload;
+static unsigned char *received;
+
+typedef struct {
+    uint64_t write_cycles;
+    uint64_t read_cycles;
+    uint64_t elapsed_us;
+} bench_result;
+
+/*
+ * Transfer opt.bytes from the client to the server, record_size bytes per
+ * mbedtls_ssl_write() call. The ring buffer can hold at least one full
+ * record, so that every write can complete before the matching read.
+ */
+static int bench_transfer(mbedtls_ssl_context *cli, mbedtls_ssl_context *srv,
+                          size_t record_size, bench_result *result)
+{
+    size_t sent = 0, got = 0;
+    uint64_t start_us = bench_time_us();
+    uint64_t t0;
+    int ret;
+
+    memset(result, 0, sizeof(*result));
+
+    while (got < opt.bytes) {
+        size_t chunk = opt.bytes - sent;
+        if (chunk > record_size) {
+            chunk = record_size;
+        }
+
+        if (chunk > 0) {
+            t0 = bench_cycles();
+            ret = mbedtls_ssl_write(cli, payload, chunk);
+            result->write_cycles += bench_cycles() - t0;
+            if (ret > 0) {
+                sent += (size_t) ret;
+            } else if (ret != MBEDTLS_ERR_SSL_WANT_WRITE &&
+                       ret != MBEDTLS_ERR_SSL_WANT_READ) {
+                return ret;
+            }
+        }
+
+        do {
+            t0 = bench_cycles();
+            ret = mbedtls_ssl_read(srv, received, record_size);
+            result->read_cycles += bench_cycles() - t0;
+            if (ret > 0) {
+                got += (size_t) ret;
+            } else if (ret != MBEDTLS_ERR_SSL_WANT_READ &&
+                       ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+                return ret == 0 ? MBEDTLS_ERR_SSL_CONN_EOF : ret;
+            }
+        } while (ret > 0 && got < sent);
+    }
+
+    result->elapsed_us = bench_time_us() - start_us;
+    return 0;
+}
+
+static int bench_run(int ciphersuite, mbedtls_ssl_protocol_version version,
+                     const size_t *record_sizes, size_t record_size_count)
+{
+    mbedtls_ssl_config srv_conf, cli_conf;
+    mbedtls_ssl_context cli, srv;
+    mbedtls_test_mock_socket cli_sock, srv_sock;
+    int ciphersuites[2] = { ciphersuite, 0 };
+    bench_result result;
+    size_t i;
+    int ret;
+
+    mbedtls_ssl_config_init(&srv_conf);
+    mbedtls_ssl_config_init(&cli_conf);
+    mbedtls_ssl_init(&cli);
+    mbedtls_ssl_init(&srv);
+    mbedtls_test_mock_socket_init(&cli_sock);
+    mbedtls_test_mock_socket_init(&srv_sock);
+
+    mbedtls_printf("  %s %s\n",
+                   version == MBEDTLS_SSL_VERSION_TLS1_3 ? "TLS1.3" : "TLS1.2",
+                   mbedtls_ssl_get_ciphersuite_name(ciphersuite));
+
+    if ((ret = mbedtls_ssl_config_defaults(&srv_conf, MBEDTLS_SSL_IS_SERVER,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0 ||
+        (ret = mbedtls_ssl_config_defaults(&cli_conf, MBEDTLS_SSL_IS_CLIENT,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0) {
+        goto exit;
+    }
+
+    mbedtls_ssl_conf_rng(&srv_conf, rng_get, &rng);
+    mbedtls_ssl_conf_rng(&cli_conf, rng_get, &rng);
+    mbedtls_ssl_conf_dbg(&srv_conf, my_debug, stdout);
+    mbedtls_ssl_conf_dbg(&cli_conf, my_debug, stdout);
+    mbedtls_ssl_conf_min_tls_version(&srv_conf, version);
+    mbedtls_ssl_conf_max_tls_version(&srv_conf, version);
+    mbedtls_ssl_conf_min_tls_version(&cli_conf, version);
+    mbedtls_ssl_conf_max_tls_version(&cli_conf, version);
+    mbedtls_ssl_conf_ciphersuites(&srv_conf, ciphersuites);
+    mbedtls_ssl_conf_ciphersuites(&cli_conf, ciphersuites);
+    mbedtls_ssl_conf_ca_chain(&cli_conf, &cacert, NULL);
+    mbedtls_ssl_conf_authmode(&cli_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    if ((ret = mbedtls_ssl_conf_own_cert(&srv_conf, &srvcert, &pkey)) != 0) {
+        goto exit;
+    }
+
+    if ((ret = mbedtls_test_mock_socket_connect(&cli_sock, &srv_sock,
+                                                BENCH_RING_SIZE)) != 0) {
+        goto exit;
+    }
+
+    if ((ret = mbedtls_ssl_setup(&cli, &cli_conf)) != 0 ||
+        (ret = mbedtls_ssl_setup(&srv, &srv_conf)) != 0 ||
+        (ret = mbedtls_ssl_set_hostname(&cli, "localhost")) != 0) {
+        goto exit;
+    }
+    mbedtls_ssl_set_bio(&cli, &cli_sock, mbedtls_test_mock_tcp_send_nb,
+                        mbedtls_test_mock_tcp_recv_nb, NULL);
+    mbedtls_ssl_set_bio(&srv, &srv_sock, mbedtls_test_mock_tcp_send_nb,
+                        mbedtls_test_mock_tcp_recv_nb, NULL);
+
+    if ((ret = loopback_handshake(&cli, &srv)) != 0) {
+        goto exit;
+    }
+
+    for (i = 0; i < record_size_count; i++) {
+        /* Warm up the caches and the branch predictors before measuring. */
+        size_t bytes = opt.bytes;
+        opt.bytes = record_sizes[i] * 16;
+        ret = bench_transfer(&cli, &srv, record_sizes[i], &result);
+        opt.bytes = bytes;
+        if (ret != 0) {
+            goto exit;
+        }
+
+        if ((ret = bench_transfer(&cli, &srv, record_sizes[i], &result)) != 0) {
+            goto exit;
+        }
+
+        mbedtls_printf("    %5u-byte records : %9.2f MB/s",
+                       (unsigned) record_sizes[i],
+                       result.elapsed_us == 0 ? 0.0 :
+                       (double) opt.bytes / (double) result.elapsed_us);
+#if defined(BENCH_HAVE_CYCLES)
+        mbedtls_printf(",  write %7.2f cycles/byte,  read %7.2f cycles/byte",
+                       (double) result.write_cycles / (double) opt.bytes,
+                       (double) result.read_cycles / (double) opt.bytes);
+#endif
+        mbedtls_printf("\n");
+    }
+
+exit:
+    if (ret != 0) {
+        mbedtls_printf("    failed: -0x%04x\n", (unsigned int) -ret);
+    }
+    mbedtls_ssl_free(&cli);
+    mbedtls_ssl_free(&srv);
+    mbedtls_ssl_config_free(&srv_conf);
+    mbedtls_ssl_config_free(&cli_conf);
+    mbedtls_test_mock_socket_close(&cli_sock);
+    mbedtls_test_mock_socket_close(&srv_sock);
+    return ret;
+}
+
+/*
+ * Default list: every TLS 1.3 ciphersuite, and every TLS 1.2 ciphersuite
+ * with ECDHE-ECDSA key exchange. The latter covers all the record
+ * protection mechanisms without measuring the same cipher several times.
+ */
+static int bench_default_ciphersuite(const mbedtls_ssl_ciphersuite_t *info)
+{
+    if (info->min_tls_version == MBEDTLS_SSL_VERSION_TLS1_3) {
+        return 1;
+    }
+    return info->key_exchange == MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA;
+}
+
+int main(int argc, char *argv[])
+{
+    int ret = 0, i;
+    int exit_code = MBEDTLS_EXIT_FAILURE;
+    int ciphersuites[BENCH_MAX_CIPHERSUITES];
+    size_t ciphersuite_count = 0;
+    size_t record_sizes[BENCH_MAX_RECORD_SIZES];
+    size_t record_size_count = 0;
+    size_t max_record_size = 0;
+    size_t n;
+    const int *list;
+    char *p, *q;
+#if defined(MBEDTLS_USE_PSA_CRYPTO) || defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    psa_status_t status;
+#endif
+
+    rng_init(&rng);
+    mbedtls_x509_crt_init(&cacert);
+    mbedtls_x509_crt_init(&srvcert);
+    mbedtls_pk_init(&pkey);
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO) || defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    status = psa_crypto_init();
+    if (status != PSA_SUCCESS) {
+        mbedtls_fprintf(stderr, "Failed to initialize PSA Crypto implementation: %d\n",
+                        (int) status);
+        goto exit;
+    }
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_EXTERNAL_RNG)
+    mbedtls_test_enable_insecure_external_rng();
+#endif
+
+    opt.version             = DFL_VERSION;
+    opt.ciphersuites        = DFL_CIPHERSUITES;
+    opt.record_sizes        = NULL;
+    opt.bytes               = DFL_BYTES;
+    opt.debug_level         = DFL_DEBUG_LEVEL;
+
+    for (i = 1; i < argc; i++) {
+        p = argv[i];
+        if ((q = strchr(p, '=')) == NULL) {
+            goto usage;
+        }
+        *q++ = '\0';
+
+        if (strcmp(p, "version") == 0) {
+            if (strcmp(q, "tls12") != 0 && strcmp(q, "tls13") != 0 &&
+                strcmp(q, "all") != 0) {
+                goto usage;
+            }
+            opt.version = q;
+        } else if (strcmp(p, "ciphersuites") == 0) {
+            opt.ciphersuites = q;
+        } else if (strcmp(p, "record_sizes") == 0) {
+            opt.record_sizes = q;
+        } else if (strcmp(p, "bytes") == 0) {
+            if (atoi(q) < 1) {
+                goto usage;
+            }
+            opt.bytes = (size_t) atoi(q);
+        } else if (strcmp(p, "debug_level") == 0) {
+            opt.debug_level = atoi(q);
+            if (opt.debug_level < 0 || opt.debug_level > 65535) {
+                goto usage;
+            }
+        } else {
+            goto usage;
+        }
+    }
+
+    /*
+     * Parse the lists
+     */
+    if (opt.ciphersuites != NULL) {
+        for (p = strtok(opt.ciphersuites, ","); p != NULL;
+             p = strtok(NULL, ",")) {
+            int id = mbedtls_ssl_get_ciphersuite_id(p);
+            if (id == 0) {
+                mbedtls_printf("unknown ciphersuite %s\n", p);
+                ret = 2;
+                goto usage;
+            }
+            if (ciphersuite_count < BENCH_MAX_CIPHERSUITES) {
+                ciphersuites[ciphersuite_count++] = id;
+            }
+        }
+    } else {
+        for (list = mbedtls_ssl_list_ciphersuites(); *list != 0; list++) {
+            const mbedtls_ssl_ciphersuite_t *info =
+                mbedtls_ssl_ciphersuite_from_id(*list);
+            if (info != NULL && bench_default_ciphersuite(info) &&
+                ciphersuite_count < BENCH_MAX_CIPHERSUITES) {
+                ciphersuites[ciphersuite_count++] = *list;
+            }
+        }
+    }
+
+    {
+        char default_sizes[] = DFL_RECORD_SIZES;
+        for (p = strtok(opt.record_sizes != NULL ? opt.record_sizes :
+                        default_sizes, ",");
+             p != NULL && record_size_count < BENCH_MAX_RECORD_SIZES;
+             p = strtok(NULL, ",")) {
+            int size = atoi(p);
+            if (size < 1 || size > MBEDTLS_SSL_OUT_CONTENT_LEN) {
+                mbedtls_printf("record size %s out of range (1-%d)\n",
+                               p, MBEDTLS_SSL_OUT_CONTENT_LEN);
+                goto usage;
+            }
+            record_sizes[record_size_count++] = (size_t) size;
+            if ((size_t) size > max_record_size) {
+                max_record_size = (size_t) size;
+            }
+        }
+    }
+
+#if defined(MBEDTLS_DEBUG_C)
+    mbedtls_debug_set_threshold(opt.debug_level);
+#endif
+
+    if ((ret = rng_seed(&rng, 0, "ssl_record_bench")) != 0) {
+        goto exit;
+    }
+
+    payload = mbedtls_calloc(1, max_record_size);
+    received = mbedtls_calloc(1, max_record_size);
+    if (payload == NULL || received == NULL) {
+        ret = MBEDTLS_ERR_SSL_ALLOC_FAILED;
+        goto exit;
+    }
+    memset(payload, 0x2A, max_record_size);
+
+    if ((ret = mbedtls_x509_crt_parse(&cacert,
+                                      (const unsigned char *) mbedtls_test_cas_pem,
+                                      mbedtls_test_cas_pem_len)) != 0 ||
+        (ret = mbedtls_x509_crt_parse(&srvcert,
+                                      (const unsigned char *) mbedtls_test_srv_crt_ec,
+                                      mbedtls_test_srv_crt_ec_len)) != 0 ||
+        (ret = mbedtls_pk_parse_key(&pkey,
+                                    (const unsigned char *) mbedtls_test_srv_key_ec,
+                                    mbedtls_test_srv_key_ec_len, NULL, 0,
+                                    rng_get, &rng)) != 0) {
+        mbedtls_printf(" failed\n  !  loading test credentials returned -0x%x\n\n",
+                       (unsigned int) -ret);
+        goto exit;
+    }
+
+    mbedtls_printf("\n  Bytes per measurement: %u\n\n", (unsigned) opt.bytes);
+
+    for (n = 0; n < ciphersuite_count; n++) {
+        const mbedtls_ssl_ciphersuite_t *info =
+            mbedtls_ssl_ciphersuite_from_id(ciphersuites[n]);
+        mbedtls_ssl_protocol_version version;
+
+        if (info == NULL) {
+            continue;
+        }
+
+        for (version = info->min_tls_version;
+             version <= info->max_tls_version;
+             version++) {
+            if ((version == MBEDTLS_SSL_VERSION_TLS1_2 &&
+                 strcmp(opt.version, "tls13") == 0) ||
+                (version == MBEDTLS_SSL_VERSION_TLS1_3 &&
+                 strcmp(opt.version, "tls12") == 0) ||
+                (version != MBEDTLS_SSL_VERSION_TLS1_2 &&
+                 version != MBEDTLS_SSL_VERSION_TLS1_3)) {
+                continue;
+            }
+
+            /* Failures are reported per ciphersuite; keep going so that one
+             * unusable ciphersuite does not hide the others. */
+            if (bench_run(ciphersuites[n], version, record_sizes,
+                          record_size_count) != 0) {
+                ret = 1;
+            }
+        }
+    }
+
+    mbedtls_printf("\n");
+    if (ret == 0) {
+        exit_code = MBEDTLS_EXIT_SUCCESS;
+    }
+    goto exit;
+
+usage:
+    if (ret == 0) {
+        ret = 1;
+    }
+
+    mbedtls_printf(USAGE);
+
+    list = mbedtls_ssl_list_ciphersuites();
+    while (*list) {
+        mbedtls_printf(" %-42s", mbedtls_ssl_get_ciphersuite_name(*list));
+        list++;
+        if (!*list) {
+            break;
+        }
+        mbedtls_printf(" %s\n", mbedtls_ssl_get_ciphersuite_name(*list));
+        list++;
+    }
+    mbedtls_printf("\n");
+
+exit:
+    mbedtls_free(payload);
+    mbedtls_free(received);
+    mbedtls_x509_crt_free(&cacert);
+    mbedtls_x509_crt_free(&srvcert);
+    mbedtls_pk_free(&pkey);
+    rng_free(&rng);
+
+    mbedtls_exit(exit_code);
+}
+#endif /* !MBEDTLS_SSL_TEST_IMPOSSIBLE && MBEDTLS_SSL_SRV_C && MBEDTLS_SSL_CLI_C &&
+          MBEDTLS_X509_CRT_PARSE_C && MBEDTLS_PEM_PARSE_C && MBEDTLS_HAVE_TIME */
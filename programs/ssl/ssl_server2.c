@@ -84,6 +84,7 @@ int main(void)
 #define DFL_ASYNC_PRIVATE_DELAY1 (-1)
 #define DFL_ASYNC_PRIVATE_DELAY2 (-1)
 #define DFL_ASYNC_PRIVATE_ERROR  (0)
+#define DFL_ASYNC_PRIVATE_TLS13  (0)
 #define DFL_PSK                 ""
 #define DFL_PSK_OPAQUE          0
 #define DFL_PSK_LIST_OPAQUE     0
@@ -216,7 +217,9 @@ int main(void)
     "    async_private_delay2=%%d  Asynchronous delay for key_file2 and sni\n" \
     "                              default: -1 (not asynchronous)\n" \
     "    async_private_error=%%d   Async callback error injection (default=0=none,\n" \
-    "                              1=start, 2=cancel, 3=resume, negative=first time only)"
+    "                              1=start, 2=cancel, 3=resume, negative=first time only)\n" \
+    "    async_private_tls13=%%d   Use the async sign callback in TLS 1.3\n" \
+    "                              default: 0 (disabled)"
 #else
 #define USAGE_SSL_ASYNC ""
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
@@ -620,6 +623,7 @@ struct options {
     int async_private_delay1;   /* number of times f_async_resume needs to be called for key 1, or -1 for no async */
     int async_private_delay2;   /* number of times f_async_resume needs to be called for key 2, or -1 for no async */
     int async_private_error;    /* inject error in async private callback */
+    int async_private_tls13;    /* use the async sign callback in TLS 1.3   */
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     int psk_opaque;
     int psk_list_opaque;
@@ -1257,6 +1261,18 @@ static int ssl_async_resume(mbedtls_ssl_context *ssl,
                                      config_data->f_rng, config_data->p_rng);
             break;
         case ASYNC_OP_SIGN:
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+            /* TLS 1.3 uses RSASSA-PSS for all RSA signatures. */
+            if (mbedtls_ssl_get_version_number(ssl) == MBEDTLS_SSL_VERSION_TLS1_3 &&
+                mbedtls_pk_can_do(key_slot->pk, MBEDTLS_PK_RSA)) {
+                ret = mbedtls_pk_sign_ext(MBEDTLS_PK_RSASSA_PSS, key_slot->pk,
+                                          ctx->md_alg,
+                                          ctx->input, ctx->input_len,
+                                          output, output_size, output_len,
+                                          config_data->f_rng, config_data->p_rng);
+                break;
+            }
+#endif /* MBEDTLS_SSL_PROTO_TLS1_3 */
             ret = mbedtls_pk_sign(key_slot->pk,
                                   ctx->md_alg,
                                   ctx->input, ctx->input_len,
@@ -1680,6 +1696,7 @@ usage:
     opt.async_private_delay1 = DFL_ASYNC_PRIVATE_DELAY1;
     opt.async_private_delay2 = DFL_ASYNC_PRIVATE_DELAY2;
     opt.async_private_error = DFL_ASYNC_PRIVATE_ERROR;
+    opt.async_private_tls13 = DFL_ASYNC_PRIVATE_TLS13;
     opt.psk                 = DFL_PSK;
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     opt.psk_opaque          = DFL_PSK_OPAQUE;
@@ -1850,6 +1867,8 @@ usage:
                 goto usage;
             }
             opt.async_private_error = n;
+        } else if (strcmp(p, "async_private_tls13") == 0) {
+            opt.async_private_tls13 = atoi(q);
         }
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
 #if defined(MBEDTLS_SSL_DTLS_CONNECTION_ID)
@@ -3056,6 +3075,12 @@ usage:
                                           ssl_async_resume,
                                           ssl_async_cancel,
                                           &ssl_async_keys);
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+        /* ssl_async_resume() signs with RSASSA-PSS in TLS 1.3 */
+        mbedtls_ssl_conf_async_private_tls13(&conf, opt.async_private_tls13 ?
+                                             MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_ENABLED :
+                                             MBEDTLS_SSL_ASYNC_PRIVATE_TLS1_3_DISABLED);
+#endif
     }
 #endif /* MBEDTLS_SSL_ASYNC_PRIVATE */
 #endif /* MBEDTLS_SSL_HANDSHAKE_WITH_CERT_ENABLED */
@@ -362,6 +362,36 @@ int delayed_send(void *ctx, const unsigned char *buf, size_t len)
     return ret;
 }
 
+int loopback_handshake(mbedtls_ssl_context *client,
+                       mbedtls_ssl_context *server)
+{
+    int ret_cli = MBEDTLS_ERR_SSL_WANT_READ;
+    int ret_srv = MBEDTLS_ERR_SSL_WANT_READ;
+    int steps;
+
+    for (steps = 0; steps < 1000; steps++) {
+        if (ret_cli != 0) {
+            ret_cli = mbedtls_ssl_handshake(client);
+            if (ret_cli != 0 && ret_cli != MBEDTLS_ERR_SSL_WANT_READ &&
+                ret_cli != MBEDTLS_ERR_SSL_WANT_WRITE) {
+                return ret_cli;
+            }
+        }
+        if (ret_srv != 0) {
+            ret_srv = mbedtls_ssl_handshake(server);
+            if (ret_srv != 0 && ret_srv != MBEDTLS_ERR_SSL_WANT_READ &&
+                ret_srv != MBEDTLS_ERR_SSL_WANT_WRITE) {
+                return ret_srv;
+            }
+        }
+        if (ret_cli == 0 && ret_srv == 0) {
+            return 0;
+        }
+    }
+
+    return MBEDTLS_ERR_SSL_TIMEOUT;
+}
+
 #if !defined(MBEDTLS_TIMING_C)
 int idle(mbedtls_net_context *fd,
          int idle_reason)
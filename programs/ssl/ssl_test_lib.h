@@ -257,6 +257,19 @@ int ca_callback(void *data, mbedtls_x509_crt const *child,
 int delayed_recv(void *ctx, unsigned char *buf, size_t len);
 int delayed_send(void *ctx, const unsigned char *buf, size_t len);
 
+/** Drive a client and a server connected in the same thread (for example
+ * through a pair of mock sockets from the test helpers) until both have
+ * completed the handshake.
+ *
+ * \return              \c 0 on success.
+ * \return              The first fatal error returned by
+ *                      mbedtls_ssl_handshake() on either side.
+ * \return              #MBEDTLS_ERR_SSL_TIMEOUT if the handshake does not
+ *                      make progress.
+ */
+int loopback_handshake(mbedtls_ssl_context *client,
+                       mbedtls_ssl_context *server);
+
 /*
  * Wait for an event from the underlying transport or the timer
  * (Used in event-driven IO mode).
@@ -5,6 +5,11 @@
  *  SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+/* Ensure that sched_setaffinity() is available even with -std=c99 */
+#define _GNU_SOURCE
+#endif
+
 #define MBEDTLS_ALLOW_PRIVATE_ACCESS
 
 #include "mbedtls/build_info.h"
@@ -48,8 +53,19 @@ int main(void)
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/ecdh.h"
 
+#include "mbedtls/ssl_cache.h"
+#include "mbedtls/ssl_ticket.h"
+
 #include "mbedtls/error.h"
 
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+#include "psa/crypto.h"
+#endif
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include <pthread.h>
+#endif
+
 /* *INDENT-OFF* */
 #ifndef asm
 #define asm __asm
@@ -72,6 +88,9 @@ struct _hr_time {
 #include <sys/time.h>
 #include <signal.h>
 #include <time.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 struct _hr_time {
     struct timeval start;
@@ -101,54 +120,90 @@ static void mbedtls_set_alarm(int seconds);
 #define HEADER_FORMAT   "  %-24s :  "
 #define TITLE_LEN       25
 
+/*
+ * Limits for the options that control the measurements. Each cycles/byte
+ * measurement processes about TSC_BYTES bytes (1024 messages of the
+ * default size).
+ */
+#define MIN_MSG_LEN     16
+#define MAX_MSG_LEN     (16u << 20)  /* 16 MiB */
+#define MAX_SIZES       16
+#define MAX_REPEAT      100
+#define MAX_THREADS     256
+#define TSC_BYTES       (1024u * BUFSIZE)
+
 #define OPTIONS                                                         \
     "md5, ripemd160, sha1, sha256, sha512,\n"                           \
-    "sha3_224, sha3_256, sha3_384, sha3_512,\n"                         \
+    "sha3_224, sha3_256, sha3_384, sha3_512, shake128, shake256,\n"     \
     "des3, des, camellia, chacha20,\n"                                  \
     "aes_cbc, aes_gcm, aes_ccm, aes_xts, chachapoly,\n"                 \
     "aes_cmac, des3_cmac, poly1305\n"                                   \
     "ctr_drbg, hmac_drbg\n"                                             \
-    "rsa, dhm, ecdsa, ecdh.\n"
-
-#if defined(MBEDTLS_ERROR_C)
-#define PRINT_ERROR                                                     \
-    mbedtls_strerror(ret, (char *) tmp, sizeof(tmp));          \
-    mbedtls_printf("FAILED: %s\n", tmp);
-#else
-#define PRINT_ERROR                                                     \
-    mbedtls_printf("FAILED: -0x%04x\n", (unsigned int) -ret);
-#endif
+    "rsa, dhm, ecdsa, ecdh,\n"                                          \
+    "psa, ssl_cache, ssl_ticket (with --threads only).\n"              \
+    "\n"                                                                \
+    "Measurement options:\n"                                            \
+    "  --format=text|csv|json  output format (default: text)\n"         \
+    "  --repeat=N              measure N times, report the median and\n" \
+    "                          standard deviation (default: 1)\n"        \
+    "  --warmup=N              discard N measurements first (default: 0)\n" \
+    "  --sizes=A,B,...         message sizes in bytes for symmetric\n"   \
+    "                          algorithms, multiples of 16 between 16\n" \
+    "                          and 16777216 (default: 1024)\n"           \
+    "  --cpu=N                 pin the process to CPU N (Linux only)\n"  \
+    "  --threads=N             compare the aggregate throughput of N\n"  \
+    "                          threads with one thread for sha256,\n"    \
+    "                          aes_gcm, ctr_drbg, hmac_drbg, psa,\n"     \
+    "                          ssl_cache and ssl_ticket (requires\n"     \
+    "                          MBEDTLS_THREADING_PTHREAD)\n"
 
 #define TIME_AND_TSC(TITLE, CODE)                                     \
     do {                                                                    \
-        unsigned long ii, jj, tsc;                                          \
+        unsigned long ii, jj, tsc, iterations;                              \
+        size_t kk;                                                          \
+        int rr;                                                             \
         int ret = 0;                                                        \
                                                                         \
-        mbedtls_printf(HEADER_FORMAT, TITLE);                             \
-        fflush(stdout);                                                   \
-                                                                        \
-        mbedtls_set_alarm(1);                                             \
-        for (ii = 1; ret == 0 && !mbedtls_timing_alarmed; ii++)           \
+        for (kk = 0; ret == 0 && kk < bench_opt.sizes_count; kk++)         \
         {                                                                   \
-            ret = CODE;                                                     \
-        }                                                                   \
+            msg_len = bench_opt.sizes[kk];                                  \
+            iterations = (unsigned long) (TSC_BYTES / msg_len);             \
+            if (iterations == 0) {                                          \
+                iterations = 1;                                             \
+            }                                                               \
+            bench_header(TITLE);                                          \
                                                                         \
-        tsc = mbedtls_timing_hardclock();                                   \
-        for (jj = 0; ret == 0 && jj < 1024; jj++)                          \
-        {                                                                   \
-            ret = CODE;                                                     \
-        }                                                                   \
+            for (rr = -bench_opt.warmup; ret == 0 && rr < bench_opt.repeat; rr++) \
+            {                                                               \
+                mbedtls_set_alarm(1);                                     \
+                for (ii = 1; ret == 0 && !mbedtls_timing_alarmed; ii++)   \
+                {                                                           \
+                    ret = CODE;                                             \
+                }                                                           \
                                                                         \
-        if (ret != 0)                                                      \
-        {                                                                   \
-            PRINT_ERROR;                                                    \
-        }                                                                   \
-        else                                                                \
-        {                                                                   \
-            mbedtls_printf("%9lu KiB/s,  %9lu cycles/byte\n",              \
-                           ii * BUFSIZE / 1024,                           \
-                           (mbedtls_timing_hardclock() - tsc)           \
-                           / (jj * BUFSIZE));                          \
+                tsc = mbedtls_timing_hardclock();                           \
+                for (jj = 0; ret == 0 && jj < iterations; jj++)            \
+                {                                                           \
+                    ret = CODE;                                             \
+                }                                                           \
+                tsc = mbedtls_timing_hardclock() - tsc;                     \
+                                                                        \
+                if (rr >= 0)                                               \
+                {                                                           \
+                    bench_rate[rr] = (double) ii * msg_len / 1024;          \
+                    bench_cpb[rr] = (double) tsc / ((double) jj * msg_len); \
+                }                                                           \
+            }                                                               \
+                                                                        \
+            if (ret != 0)                                                  \
+            {                                                               \
+                bench_error(TITLE, ret);                                  \
+            }                                                               \
+            else                                                            \
+            {                                                               \
+                bench_report(TITLE, NULL);                                \
+                bench_newline();                                            \
+            }                                                               \
         }                                                                   \
     } while (0)
 
@@ -196,34 +251,45 @@ static void mbedtls_set_alarm(int seconds);
 #define TIME_PUBLIC(TITLE, TYPE, CODE)                                \
     do {                                                                    \
         unsigned long ii;                                                   \
+        int rr;                                                             \
         int ret;                                                            \
         MEMORY_MEASURE_INIT;                                                \
                                                                         \
-        mbedtls_printf(HEADER_FORMAT, TITLE);                             \
-        fflush(stdout);                                                   \
-        mbedtls_set_alarm(3);                                             \
+        bench_header_public(TITLE);                                       \
                                                                         \
         ret = 0;                                                            \
-        for (ii = 1; !mbedtls_timing_alarmed && !ret; ii++)             \
+        for (rr = -bench_opt.warmup; !ret && rr < bench_opt.repeat; rr++)  \
         {                                                                   \
-            MEMORY_MEASURE_RESET;                                           \
-            CODE;                                                           \
+            mbedtls_set_alarm(3);                                         \
+            for (ii = 1; !mbedtls_timing_alarmed && !ret; ii++)         \
+            {                                                               \
+                MEMORY_MEASURE_RESET;                                       \
+                CODE;                                                       \
+            }                                                               \
+                                                                        \
+            if (rr >= 0)                                                   \
+            {                                                               \
+                bench_rate[rr] = (double) (ii / 3);                         \
+            }                                                               \
         }                                                                   \
                                                                         \
         if (ret == MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED)               \
         {                                                                   \
-            mbedtls_printf("Feature Not Supported. Skipping.\n");         \
+            bench_notice("Feature Not Supported. Skipping.\n");           \
             ret = 0;                                                        \
         }                                                                   \
         else if (ret != 0)                                                 \
         {                                                                   \
-            PRINT_ERROR;                                                    \
+            bench_error(TITLE, ret);                                      \
         }                                                                   \
         else                                                                \
         {                                                                   \
-            mbedtls_printf("%6lu " TYPE "/s", ii / 3);                    \
-            MEMORY_MEASURE_PRINT(sizeof(TYPE) + 1);                     \
-            mbedtls_printf("\n");                                         \
+            bench_report(TITLE, TYPE);                                    \
+            if (bench_opt.format == FORMAT_TEXT)                           \
+            {                                                               \
+                MEMORY_MEASURE_PRINT(sizeof(TYPE) + 1);                 \
+            }                                                               \
+            bench_newline();                                                \
         }                                                                   \
     } while (0)
 
@@ -466,11 +532,398 @@ static int myrand(void *rng_state, unsigned char *output, size_t len)
     return 0;
 }
 
+typedef enum {
+    FORMAT_TEXT,
+    FORMAT_CSV,
+    FORMAT_JSON,
+} output_format;
+
+static struct {
+    output_format format;       /* how to print the results              */
+    int repeat;                 /* number of measurements to keep        */
+    int warmup;                 /* number of measurements to discard     */
+    int custom_sizes;           /* message sizes were given explicitly   */
+    size_t sizes[MAX_SIZES];    /* message sizes for symmetric algorithms */
+    size_t sizes_count;
+    int cpu;                    /* CPU to pin the process to, or -1      */
+    int threads;                /* scaling mode thread count, or 0       */
+} bench_opt;
+
+static unsigned char *buf;      /* message buffer, buf_len bytes          */
+static size_t buf_len;
+static size_t msg_len;          /* message size of the current algorithm  */
+static double bench_rate[MAX_REPEAT];
+static double bench_cpb[MAX_REPEAT];
+static int bench_first_result = 1;
+
+/*
+ * Diagnostics go to stdout in text mode, as they always have, and to
+ * stderr otherwise so that they do not corrupt the CSV or JSON output.
+ */
+static void bench_notice(const char *msg)
+{
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("%s", msg);
+    } else {
+        mbedtls_fprintf(stderr, "%s", msg);
+    }
+}
+
+static void bench_header(const char *title)
+{
+    char sized_title[TITLE_LEN + 16];
+
+    if (bench_opt.format != FORMAT_TEXT) {
+        return;
+    }
+
+    if (bench_opt.custom_sizes) {
+        mbedtls_snprintf(sized_title, sizeof(sized_title), "%s/%u",
+                         title, (unsigned) msg_len);
+        title = sized_title;
+    }
+    mbedtls_printf(HEADER_FORMAT, title);
+    fflush(stdout);
+}
+
+static void bench_header_public(const char *title)
+{
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf(HEADER_FORMAT, title);
+        fflush(stdout);
+    }
+}
+
+static void bench_newline(void)
+{
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("\n");
+    }
+}
+
+static void bench_error(const char *title, int ret)
+{
+#if defined(MBEDTLS_ERROR_C)
+    char error_buf[200];
+
+    mbedtls_strerror(ret, error_buf, sizeof(error_buf));
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("FAILED: %s\n", error_buf);
+    } else {
+        mbedtls_fprintf(stderr, "%s: FAILED: %s\n", title, error_buf);
+    }
+#else
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("FAILED: -0x%04x\n", (unsigned int) -ret);
+    } else {
+        mbedtls_fprintf(stderr, "%s: FAILED: -0x%04x\n", title,
+                        (unsigned int) -ret);
+    }
+#endif
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}
+
+static double median(const double *samples, int n)
+{
+    double sorted[MAX_REPEAT];
+
+    memcpy(sorted, samples, n * sizeof(double));
+    qsort(sorted, n, sizeof(double), compare_doubles);
+    return n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+}
+
+static double stddev(const double *samples, int n)
+{
+    double mean = 0, var = 0;
+    int i;
+
+    if (n < 2) {
+        return 0;
+    }
+    for (i = 0; i < n; i++) {
+        mean += samples[i];
+    }
+    mean /= n;
+    for (i = 0; i < n; i++) {
+        var += (samples[i] - mean) * (samples[i] - mean);
+    }
+    var /= n - 1;
+
+    /* Newton's method, to avoid depending on libm just for this. */
+    mean = var > 1 ? var : 1;
+    for (i = 0; i < 64; i++) {
+        mean = (mean + var / mean) / 2;
+    }
+    return mean;
+}
+
+/*
+ * Print the measurements in bench_rate (and bench_cpb for symmetric
+ * algorithms, which have type == NULL). For public-key operations, type
+ * is the operation name and bench_rate holds operations per second.
+ */
+static void bench_report(const char *title, const char *type)
+{
+    int n = bench_opt.repeat, i;
+    double rate = median(bench_rate, n);
+    double cpb = type == NULL ? median(bench_cpb, n) : 0;
+
+    /* Some operation names are padded with spaces for alignment in the
+     * text output only. */
+    if (type != NULL && bench_opt.format != FORMAT_TEXT) {
+        while (*type == ' ') {
+            type++;
+        }
+    }
+
+    if (bench_opt.format == FORMAT_TEXT) {
+        if (type == NULL) {
+            mbedtls_printf("%9lu KiB/s,  %9lu cycles/byte",
+                           (unsigned long) rate, (unsigned long) cpb);
+        } else {
+            mbedtls_printf("%6lu %s/s", (unsigned long) rate, type);
+        }
+        if (n > 1) {
+            mbedtls_printf("  (median of %d, stddev %.1f%%)", n,
+                           rate > 0 ? 100 * stddev(bench_rate, n) / rate : 0);
+        }
+    } else if (bench_opt.format == FORMAT_CSV) {
+        if (type == NULL) {
+            mbedtls_printf("\"%s\",%u,KiB/s,%d,%.2f,%.2f,%.2f,%.2f\n",
+                           title, (unsigned) msg_len, n, rate,
+                           stddev(bench_rate, n), cpb, stddev(bench_cpb, n));
+        } else {
+            mbedtls_printf("\"%s %s\",,%s/s,%d,%.2f,%.2f,,\n",
+                           title, type, type, n, rate, stddev(bench_rate, n));
+        }
+    } else {
+        mbedtls_printf("%s\n    {\"name\": \"%s%s%s\", ",
+                       bench_first_result ? "" : ",", title,
+                       type == NULL ? "" : " ", type == NULL ? "" : type);
+        if (type == NULL) {
+            mbedtls_printf("\"size\": %u, \"unit\": \"KiB/s\", ",
+                           (unsigned) msg_len);
+        } else {
+            mbedtls_printf("\"unit\": \"%s/s\", ", type);
+        }
+        mbedtls_printf("\"repetitions\": %d, \"median\": %.2f, \"stddev\": %.2f",
+                       n, rate, stddev(bench_rate, n));
+        if (type == NULL) {
+            mbedtls_printf(", \"cycles_per_byte\": %.2f"
+                           ", \"cycles_per_byte_stddev\": %.2f",
+                           cpb, stddev(bench_cpb, n));
+        }
+        mbedtls_printf(", \"samples\": [");
+        for (i = 0; i < n; i++) {
+            mbedtls_printf("%s%.2f", i == 0 ? "" : ", ", bench_rate[i]);
+        }
+        mbedtls_printf("]}");
+    }
+    bench_first_result = 0;
+}
+
+static int parse_sizes(const char *list)
+{
+    char *end;
+    unsigned long size;
+
+    bench_opt.sizes_count = 0;
+    do {
+        size = strtoul(list, &end, 10);
+        if (end == list || (*end != ',' && *end != '\0') ||
+            size < MIN_MSG_LEN || size > MAX_MSG_LEN || size % 16 != 0 ||
+            bench_opt.sizes_count == MAX_SIZES) {
+            return -1;
+        }
+        bench_opt.sizes[bench_opt.sizes_count++] = size;
+        list = end + 1;
+    } while (*end == ',');
+
+    return 0;
+}
+
+/*
+ * Parse an option of the form --name=value. Return 0 on success, -1 if the
+ * option is unknown or its value is invalid.
+ */
+static int parse_option(const char *option)
+{
+    char arg[16];
+    const char *value;
+
+    value = strchr(option, '=');
+    if (value == NULL || (size_t) (value - option) >= sizeof(arg)) {
+        return -1;
+    }
+    memcpy(arg, option, value - option);
+    arg[value - option] = '\0';
+    value++;
+
+    if (strcmp(arg, "--format") == 0) {
+        if (strcmp(value, "text") == 0) {
+            bench_opt.format = FORMAT_TEXT;
+        } else if (strcmp(value, "csv") == 0) {
+            bench_opt.format = FORMAT_CSV;
+        } else if (strcmp(value, "json") == 0) {
+            bench_opt.format = FORMAT_JSON;
+        } else {
+            return -1;
+        }
+    } else if (strcmp(arg, "--repeat") == 0) {
+        bench_opt.repeat = atoi(value);
+        if (bench_opt.repeat < 1 || bench_opt.repeat > MAX_REPEAT) {
+            return -1;
+        }
+    } else if (strcmp(arg, "--warmup") == 0) {
+        bench_opt.warmup = atoi(value);
+        if (bench_opt.warmup < 0 || bench_opt.warmup > MAX_REPEAT) {
+            return -1;
+        }
+    } else if (strcmp(arg, "--sizes") == 0) {
+        bench_opt.custom_sizes = 1;
+        return parse_sizes(value);
+    } else if (strcmp(arg, "--threads") == 0) {
+#if defined(MBEDTLS_THREADING_PTHREAD)
+        bench_opt.threads = atoi(value);
+        if (bench_opt.threads < 1 || bench_opt.threads > MAX_THREADS) {
+            return -1;
+        }
+#else
+        mbedtls_printf("--threads requires MBEDTLS_THREADING_PTHREAD\n");
+        return -1;
+#endif
+    } else if (strcmp(arg, "--cpu") == 0) {
+        bench_opt.cpu = atoi(value);
+        if (bench_opt.cpu < 0) {
+            return -1;
+        }
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+static int pin_to_cpu(int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set);
+#else
+    (void) cpu;
+    return -1;
+#endif
+}
+
+#if defined(MBEDTLS_SHA256_C) || defined(MBEDTLS_SHA512_C)
+/*
+ * Hash msg_len bytes as HASH_BATCH_COUNT independent messages of
+ * msg_len / HASH_BATCH_COUNT bytes each, so that the rate compares directly
+ * with hashing a single message of msg_len bytes. With the default size,
+ * the messages are 64 bytes long.
+ */
+#define HASH_BATCH_COUNT 16
+
+static int hash_batch(int sha512)
+{
+    static unsigned char digests[HASH_BATCH_COUNT][64];
+    const unsigned char *input[HASH_BATCH_COUNT];
+    size_t ilen[HASH_BATCH_COUNT];
+    unsigned char *output[HASH_BATCH_COUNT];
+    size_t i;
+
+    for (i = 0; i < HASH_BATCH_COUNT; i++) {
+        ilen[i] = msg_len / HASH_BATCH_COUNT;
+        input[i] = buf + i * ilen[i];
+        output[i] = digests[i];
+    }
+
+#if defined(MBEDTLS_SHA512_C)
+    if (sha512) {
+        return mbedtls_sha512_batch(HASH_BATCH_COUNT, input, ilen, output, 0);
+    }
+#endif
+#if defined(MBEDTLS_SHA256_C)
+    if (!sha512) {
+        return mbedtls_sha256_batch(HASH_BATCH_COUNT, input, ilen, output, 0);
+    }
+#endif
+    return MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+}
+#endif /* MBEDTLS_SHA256_C || MBEDTLS_SHA512_C */
+
+#if defined(MBEDTLS_SHA3_C)
+/*
+ * Hash msg_len bytes as four messages of msg_len / 4 bytes each with
+ * mbedtls_sha3_x4(), so that the rate compares directly with hashing a
+ * single message of msg_len bytes.
+ */
+static int sha3_x4(mbedtls_sha3_id id, size_t olen)
+{
+    static unsigned char digests[4][64];
+    const uint8_t *input[4];
+    uint8_t *output[4];
+    size_t i;
+
+    for (i = 0; i < 4; i++) {
+        input[i] = buf + i * (msg_len / 4);
+        output[i] = digests[i];
+    }
+
+    return mbedtls_sha3_x4(id, input, msg_len / 4, output, olen);
+}
+#endif /* MBEDTLS_SHA3_C */
+
+#if defined(MBEDTLS_CTR_DRBG_C)
+/* Generate msg_len bytes even when that exceeds the maximum request size. */
+static int ctr_drbg_fill(mbedtls_ctr_drbg_context *ctx,
+                         unsigned char *output, size_t len)
+{
+    size_t use_len;
+    int ret = 0;
+
+    while (ret == 0 && len > 0) {
+        use_len = len > MBEDTLS_CTR_DRBG_MAX_REQUEST ?
+                  MBEDTLS_CTR_DRBG_MAX_REQUEST : len;
+        ret = mbedtls_ctr_drbg_random(ctx, output, use_len);
+        output += use_len;
+        len -= use_len;
+    }
+    return ret;
+}
+#endif
+
+#if defined(MBEDTLS_HMAC_DRBG_C)
+static int hmac_drbg_fill(mbedtls_hmac_drbg_context *ctx,
+                          unsigned char *output, size_t len)
+{
+    size_t use_len;
+    int ret = 0;
+
+    while (ret == 0 && len > 0) {
+        use_len = len > MBEDTLS_HMAC_DRBG_MAX_REQUEST ?
+                  MBEDTLS_HMAC_DRBG_MAX_REQUEST : len;
+        ret = mbedtls_hmac_drbg_random(ctx, output, use_len);
+        output += use_len;
+        len -= use_len;
+    }
+    return ret;
+}
+#endif
+
 #define CHECK_AND_CONTINUE(R)                                         \
     {                                                                   \
         int CHECK_AND_CONTINUE_ret = (R);                             \
         if (CHECK_AND_CONTINUE_ret == MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED) { \
-            mbedtls_printf("Feature not supported. Skipping.\n");     \
+            bench_notice("Feature not supported. Skipping.\n");       \
             continue;                                                   \
         }                                                               \
         else if (CHECK_AND_CONTINUE_ret != 0) {                        \
@@ -492,24 +945,530 @@ static int set_ecp_curve(const char *string, mbedtls_ecp_curve_info *curve)
 }
 #endif
 
-unsigned char buf[BUFSIZE];
-
 typedef struct {
     char md5, ripemd160, sha1, sha256, sha512,
-         sha3_224, sha3_256, sha3_384, sha3_512,
+         sha3_224, sha3_256, sha3_384, sha3_512, shake128, shake256,
          des3, des,
          aes_cbc, aes_gcm, aes_ccm, aes_xts, chachapoly,
          aes_cmac, des3_cmac,
          aria, camellia, chacha20,
          poly1305,
          ctr_drbg, hmac_drbg,
-         rsa, dhm, ecdsa, ecdh;
+         rsa, dhm, ecdsa, ecdh,
+         psa, ssl_cache, ssl_ticket;
 } todo_list;
 
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Scaling mode (--threads=N): run a few representative workloads on 1 and
+ * then N threads at once, and report the aggregate throughput and how
+ * close it gets to N times the single-threaded figure. Each workload runs
+ * either with one context per thread, which measures how the primitive
+ * itself scales, or with a single context shared by all threads, which
+ * also measures contention on the mutex that protects it.
+ */
+typedef struct {
+    const char *name;
+    int per_byte;           /* 1 if each operation processes msg_len bytes */
+    int (*setup)(void **ctx);
+    int (*op)(void *ctx, unsigned char *out);
+    void (*teardown)(void *ctx);
+} scaling_workload;
+
+typedef struct {
+    const scaling_workload *workload;
+    void *ctx;
+    unsigned char *out;     /* per-thread output buffer, buf_len bytes */
+    unsigned long ops;
+    int ret;
+    pthread_t thread;
+} scaling_thread;
+
+static pthread_mutex_t scaling_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t scaling_cond = PTHREAD_COND_INITIALIZER;
+static int scaling_started;
+
+static void *scaling_worker(void *arg)
+{
+    scaling_thread *t = arg;
+
+    pthread_mutex_lock(&scaling_mutex);
+    while (!scaling_started) {
+        pthread_cond_wait(&scaling_cond, &scaling_mutex);
+    }
+    pthread_mutex_unlock(&scaling_mutex);
+
+    while (t->ret == 0 && !mbedtls_timing_alarmed) {
+        t->ret = t->workload->op(t->ctx, t->out);
+        t->ops++;
+    }
+    return NULL;
+}
+
+/*
+ * Run the workload on n threads for one second. Return the aggregate rate
+ * in KiB/s or operations per second, or a negative value on error.
+ */
+static double scaling_measure(const scaling_workload *w, int shared, int n)
+{
+    static scaling_thread threads[MAX_THREADS];
+    void *shared_ctx = NULL;
+    unsigned long ops = 0;
+    int i, created = 0, ret = 0;
+
+    memset(threads, 0, sizeof(threads));
+    if (shared && (ret = w->setup(&shared_ctx)) != 0) {
+        goto exit;
+    }
+
+    for (i = 0; i < n; i++) {
+        threads[i].workload = w;
+        threads[i].ctx = shared_ctx;
+        if (!shared && (ret = w->setup(&threads[i].ctx)) != 0) {
+            goto exit;
+        }
+        if ((threads[i].out = calloc(1, buf_len)) == NULL) {
+            ret = MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+            goto exit;
+        }
+        /* Distinct per-thread data, e.g. session IDs for the cache. */
+        memset(threads[i].out, i + 1, buf_len);
+    }
+
+    scaling_started = 0;
+    mbedtls_timing_alarmed = 0;
+    for (created = 0; created < n; created++) {
+        if (pthread_create(&threads[created].thread, NULL, scaling_worker,
+                           &threads[created]) != 0) {
+            ret = MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+            mbedtls_timing_alarmed = 1;
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&scaling_mutex);
+    scaling_started = 1;
+    if (ret == 0) {
+        mbedtls_set_alarm(1);
+    }
+    pthread_cond_broadcast(&scaling_cond);
+    pthread_mutex_unlock(&scaling_mutex);
+
+    for (i = 0; i < created; i++) {
+        pthread_join(threads[i].thread, NULL);
+        ops += threads[i].ops;
+        if (ret == 0) {
+            ret = threads[i].ret;
+        }
+    }
+
+exit:
+    for (i = 0; i < n; i++) {
+        if (!shared && threads[i].ctx != NULL) {
+            w->teardown(threads[i].ctx);
+        }
+        free(threads[i].out);
+    }
+    if (shared_ctx != NULL) {
+        w->teardown(shared_ctx);
+    }
+
+    if (ret != 0) {
+        bench_error(w->name, ret);
+        return -1;
+    }
+    return w->per_byte ? (double) ops * msg_len / 1024 : (double) ops;
+}
+
+static void scaling_run(const scaling_workload *w, int shared)
+{
+    int counts[2] = { 1, bench_opt.threads };
+    double rates[2];
+    char title[TITLE_LEN + 10];
+    int i, rr;
+
+    mbedtls_snprintf(title, sizeof(title), "%s %s", w->name,
+                     shared ? "shared" : "indep.");
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf(HEADER_FORMAT, title);
+        fflush(stdout);
+    }
+
+    for (i = 0; i < 2; i++) {
+        for (rr = -bench_opt.warmup; rr < bench_opt.repeat; rr++) {
+            double rate = scaling_measure(w, shared, counts[i]);
+            if (rate < 0) {
+                return;
+            }
+            if (rr >= 0) {
+                bench_rate[rr] = rate;
+            }
+        }
+        rates[i] = median(bench_rate, bench_opt.repeat);
+    }
+
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("%9lu %s x1, %9lu %s x%d,  efficiency %3.0f%%\n",
+                       (unsigned long) rates[0], w->per_byte ? "KiB/s" : "ops/s",
+                       (unsigned long) rates[1], w->per_byte ? "KiB/s" : "ops/s",
+                       bench_opt.threads,
+                       rates[0] > 0 ?
+                       100 * rates[1] / (rates[0] * bench_opt.threads) : 0);
+    } else if (bench_opt.format == FORMAT_CSV) {
+        if (w->per_byte) {
+            mbedtls_printf("\"%s\",%u,", title, (unsigned) msg_len);
+        } else {
+            mbedtls_printf("\"%s\",,", title);
+        }
+        mbedtls_printf("%s,%d,%.2f,%.2f,,,%d,%.2f,%.3f\n",
+                       w->per_byte ? "KiB/s" : "ops/s", bench_opt.repeat,
+                       rates[1], stddev(bench_rate, bench_opt.repeat),
+                       bench_opt.threads, rates[0],
+                       rates[0] > 0 ? rates[1] / (rates[0] * bench_opt.threads) : 0);
+    } else {
+        mbedtls_printf("%s\n    {\"name\": \"%s\", ",
+                       bench_first_result ? "" : ",", title);
+        if (w->per_byte) {
+            mbedtls_printf("\"size\": %u, ", (unsigned) msg_len);
+        }
+        mbedtls_printf("\"unit\": \"%s\", \"repetitions\": %d, "
+                       "\"median\": %.2f, \"stddev\": %.2f, \"threads\": %d, "
+                       "\"single_thread\": %.2f, \"efficiency\": %.3f}",
+                       w->per_byte ? "KiB/s" : "ops/s", bench_opt.repeat,
+                       rates[1], stddev(bench_rate, bench_opt.repeat),
+                       bench_opt.threads, rates[0],
+                       rates[0] > 0 ? rates[1] / (rates[0] * bench_opt.threads) : 0);
+        bench_first_result = 0;
+    }
+}
+
+static void scaling_free(void *ctx)
+{
+    free(ctx);
+}
+
+#if defined(MBEDTLS_SHA256_C)
+static int sha256_setup(void **ctx)
+{
+    *ctx = calloc(1, 1);
+    return *ctx == NULL ? MBEDTLS_ERR_ERROR_GENERIC_ERROR : 0;
+}
+
+static int sha256_op(void *ctx, unsigned char *out)
+{
+    (void) ctx;
+    return mbedtls_sha256(buf, msg_len, out, 0);
+}
+#endif /* MBEDTLS_SHA256_C */
+
+#if defined(MBEDTLS_GCM_C) && defined(MBEDTLS_AES_C)
+static int gcm_setup(void **ctx)
+{
+    unsigned char key[16] = { 0 };
+    mbedtls_gcm_context *gcm = calloc(1, sizeof(*gcm));
+    int ret;
+
+    if ((*ctx = gcm) == NULL) {
+        return MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+    }
+    mbedtls_gcm_init(gcm);
+    ret = mbedtls_gcm_setkey(gcm, MBEDTLS_CIPHER_ID_AES, key, 128);
+    return ret;
+}
+
+static int gcm_op(void *ctx, unsigned char *out)
+{
+    unsigned char iv[12] = { 0 };
+    unsigned char tag[16];
+
+    return mbedtls_gcm_crypt_and_tag(ctx, MBEDTLS_GCM_ENCRYPT, msg_len,
+                                     iv, sizeof(iv), NULL, 0, buf, out,
+                                     sizeof(tag), tag);
+}
+
+static void gcm_teardown(void *ctx)
+{
+    mbedtls_gcm_free(ctx);
+    free(ctx);
+}
+#endif /* MBEDTLS_GCM_C && MBEDTLS_AES_C */
+
+#if defined(MBEDTLS_CTR_DRBG_C)
+static int ctr_drbg_setup(void **ctx)
+{
+    mbedtls_ctr_drbg_context *drbg = calloc(1, sizeof(*drbg));
+
+    if ((*ctx = drbg) == NULL) {
+        return MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+    }
+    mbedtls_ctr_drbg_init(drbg);
+    return mbedtls_ctr_drbg_seed(drbg, myrand, NULL, NULL, 0);
+}
+
+static int ctr_drbg_op(void *ctx, unsigned char *out)
+{
+    return ctr_drbg_fill(ctx, out, msg_len);
+}
+
+static void ctr_drbg_teardown(void *ctx)
+{
+    mbedtls_ctr_drbg_free(ctx);
+    free(ctx);
+}
+#endif /* MBEDTLS_CTR_DRBG_C */
+
+#if defined(MBEDTLS_HMAC_DRBG_C) && defined(MBEDTLS_SHA256_C)
+static int hmac_drbg_setup(void **ctx)
+{
+    mbedtls_hmac_drbg_context *drbg = calloc(1, sizeof(*drbg));
+
+    if ((*ctx = drbg) == NULL) {
+        return MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+    }
+    mbedtls_hmac_drbg_init(drbg);
+    return mbedtls_hmac_drbg_seed(drbg,
+                                  mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+                                  myrand, NULL, NULL, 0);
+}
+
+static int hmac_drbg_op(void *ctx, unsigned char *out)
+{
+    return hmac_drbg_fill(ctx, out, msg_len);
+}
+
+static void hmac_drbg_teardown(void *ctx)
+{
+    mbedtls_hmac_drbg_free(ctx);
+    free(ctx);
+}
+#endif /* MBEDTLS_HMAC_DRBG_C && MBEDTLS_SHA256_C */
+
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+/* The PSA global state (key store, random generator) is always shared. */
+static int psa_setup(void **ctx)
+{
+    *ctx = calloc(1, 1);
+    return *ctx == NULL ? MBEDTLS_ERR_ERROR_GENERIC_ERROR : 0;
+}
+
+#if defined(PSA_WANT_ALG_SHA_256)
+static int psa_hash_op(void *ctx, unsigned char *out)
+{
+    size_t olen;
+
+    (void) ctx;
+    return psa_hash_compute(PSA_ALG_SHA_256, buf, msg_len, out,
+                            PSA_HASH_LENGTH(PSA_ALG_SHA_256), &olen) ==
+           PSA_SUCCESS ? 0 : MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+}
+#endif
+
+static int psa_random_op(void *ctx, unsigned char *out)
+{
+    (void) ctx;
+    return psa_generate_random(out, msg_len) == PSA_SUCCESS ?
+           0 : MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+}
+#endif /* MBEDTLS_PSA_CRYPTO_C */
+
+#if defined(MBEDTLS_SSL_CACHE_C) && defined(MBEDTLS_SSL_PROTO_TLS1_2)
+static int ssl_cache_setup(void **ctx)
+{
+    mbedtls_ssl_cache_context *cache = calloc(1, sizeof(*cache));
+
+    if ((*ctx = cache) == NULL) {
+        return MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+    }
+    mbedtls_ssl_cache_init(cache);
+    return 0;
+}
+
+/* Store and look up a session under an ID that is distinct per thread. */
+static int ssl_cache_op(void *ctx, unsigned char *out)
+{
+    mbedtls_ssl_session session;
+    int ret;
+
+    mbedtls_ssl_session_init(&session);
+    session.tls_version = MBEDTLS_SSL_VERSION_TLS1_2;
+    ret = mbedtls_ssl_cache_set(ctx, out, 32, &session);
+    if (ret == 0) {
+        mbedtls_ssl_session_free(&session);
+        ret = mbedtls_ssl_cache_get(ctx, out, 32, &session);
+    }
+    mbedtls_ssl_session_free(&session);
+    return ret;
+}
+
+static void ssl_cache_teardown(void *ctx)
+{
+    mbedtls_ssl_cache_free(ctx);
+    free(ctx);
+}
+#endif /* MBEDTLS_SSL_CACHE_C && MBEDTLS_SSL_PROTO_TLS1_2 */
+
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_PROTO_TLS1_2) && \
+    defined(MBEDTLS_CTR_DRBG_C) && defined(MBEDTLS_GCM_C)
+typedef struct {
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_ssl_ticket_context ticket;
+} ticket_state;
+
+static int ssl_ticket_setup(void **ctx)
+{
+    ticket_state *state = calloc(1, sizeof(*state));
+    int ret;
+
+    if ((*ctx = state) == NULL) {
+        return MBEDTLS_ERR_ERROR_GENERIC_ERROR;
+    }
+    mbedtls_ctr_drbg_init(&state->drbg);
+    mbedtls_ssl_ticket_init(&state->ticket);
+    if ((ret = mbedtls_ctr_drbg_seed(&state->drbg, myrand, NULL, NULL, 0)) != 0) {
+        return ret;
+    }
+    return mbedtls_ssl_ticket_setup(&state->ticket, mbedtls_ctr_drbg_random,
+                                    &state->drbg, MBEDTLS_CIPHER_AES_256_GCM,
+                                    86400);
+}
+
+/* Issue a ticket for a session and parse it back, as a server would. */
+static int ssl_ticket_op(void *ctx, unsigned char *out)
+{
+    ticket_state *state = ctx;
+    mbedtls_ssl_session session;
+    size_t tlen;
+    uint32_t lifetime;
+    int ret;
+
+    mbedtls_ssl_session_init(&session);
+    session.tls_version = MBEDTLS_SSL_VERSION_TLS1_2;
+    session.start = mbedtls_time(NULL);
+    ret = mbedtls_ssl_ticket_write(&state->ticket, &session, out,
+                                   out + buf_len, &tlen, &lifetime);
+    if (ret == 0) {
+        mbedtls_ssl_session_free(&session);
+        ret = mbedtls_ssl_ticket_parse(&state->ticket, &session, out, tlen);
+    }
+    mbedtls_ssl_session_free(&session);
+    return ret;
+}
+
+static void ssl_ticket_teardown(void *ctx)
+{
+    ticket_state *state = ctx;
+
+    mbedtls_ssl_ticket_free(&state->ticket);
+    mbedtls_ctr_drbg_free(&state->drbg);
+    free(state);
+}
+#endif /* MBEDTLS_SSL_TICKET_C && MBEDTLS_SSL_PROTO_TLS1_2 &&
+          MBEDTLS_CTR_DRBG_C && MBEDTLS_GCM_C */
+
+static void scaling_main(const todo_list *todo)
+{
+#if defined(MBEDTLS_SHA256_C)
+    static const scaling_workload sha256 =
+    { "SHA-256", 1, sha256_setup, sha256_op, scaling_free };
+#endif
+#if defined(MBEDTLS_GCM_C) && defined(MBEDTLS_AES_C)
+    static const scaling_workload gcm =
+    { "AES-GCM-128", 1, gcm_setup, gcm_op, gcm_teardown };
+#endif
+#if defined(MBEDTLS_CTR_DRBG_C)
+    static const scaling_workload ctr_drbg =
+    { "CTR_DRBG", 1, ctr_drbg_setup, ctr_drbg_op, ctr_drbg_teardown };
+#endif
+#if defined(MBEDTLS_HMAC_DRBG_C) && defined(MBEDTLS_SHA256_C)
+    static const scaling_workload hmac_drbg =
+    { "HMAC_DRBG SHA-256", 1, hmac_drbg_setup, hmac_drbg_op,
+      hmac_drbg_teardown };
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+#if defined(PSA_WANT_ALG_SHA_256)
+    static const scaling_workload psa_hash =
+    { "PSA SHA-256", 1, psa_setup, psa_hash_op, scaling_free };
+#endif
+    static const scaling_workload psa_random =
+    { "PSA random", 1, psa_setup, psa_random_op, scaling_free };
+#endif
+#if defined(MBEDTLS_SSL_CACHE_C) && defined(MBEDTLS_SSL_PROTO_TLS1_2)
+    static const scaling_workload ssl_cache =
+    { "SSL cache", 0, ssl_cache_setup, ssl_cache_op, ssl_cache_teardown };
+#endif
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_PROTO_TLS1_2) && \
+    defined(MBEDTLS_CTR_DRBG_C) && defined(MBEDTLS_GCM_C)
+    static const scaling_workload ssl_ticket =
+    { "SSL ticket", 0, ssl_ticket_setup, ssl_ticket_op, ssl_ticket_teardown };
+#endif
+
+    /* Unused in configurations with none of the workloads above. */
+    (void) todo;
+    (void) scaling_run;
+    (void) scaling_free;
+
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    if (psa_crypto_init() != PSA_SUCCESS) {
+        bench_notice("PSA initialization failed\n");
+        return;
+    }
+#endif
+
+#if defined(MBEDTLS_SHA256_C)
+    if (todo->sha256) {
+        scaling_run(&sha256, 0);
+    }
+#endif
+#if defined(MBEDTLS_GCM_C) && defined(MBEDTLS_AES_C)
+    if (todo->aes_gcm) {
+        scaling_run(&gcm, 0);
+    }
+#endif
+#if defined(MBEDTLS_CTR_DRBG_C)
+    if (todo->ctr_drbg) {
+        scaling_run(&ctr_drbg, 0);
+        scaling_run(&ctr_drbg, 1);
+    }
+#endif
+#if defined(MBEDTLS_HMAC_DRBG_C) && defined(MBEDTLS_SHA256_C)
+    if (todo->hmac_drbg) {
+        scaling_run(&hmac_drbg, 0);
+        scaling_run(&hmac_drbg, 1);
+    }
+#endif
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    if (todo->psa) {
+#if defined(PSA_WANT_ALG_SHA_256)
+        scaling_run(&psa_hash, 1);
+#endif
+        scaling_run(&psa_random, 1);
+    }
+#endif
+#if defined(MBEDTLS_SSL_CACHE_C) && defined(MBEDTLS_SSL_PROTO_TLS1_2)
+    if (todo->ssl_cache) {
+        scaling_run(&ssl_cache, 0);
+        scaling_run(&ssl_cache, 1);
+    }
+#endif
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_PROTO_TLS1_2) && \
+    defined(MBEDTLS_CTR_DRBG_C) && defined(MBEDTLS_GCM_C)
+    if (todo->ssl_ticket) {
+        scaling_run(&ssl_ticket, 0);
+        scaling_run(&ssl_ticket, 1);
+    }
+#endif
+
+#if defined(MBEDTLS_PSA_CRYPTO_C)
+    mbedtls_psa_crypto_free();
+#endif
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 
 int main(int argc, char *argv[])
 {
-    int i;
+    int i, selected = 0;
+    size_t k;
     unsigned char tmp[200];
     char title[TITLE_LEN];
     todo_list todo;
@@ -528,12 +1487,31 @@ int main(int argc, char *argv[])
     (void) curve_list; /* Unused in some configurations where no benchmark uses ECC */
 #endif
 
+    bench_opt.format = FORMAT_TEXT;
+    bench_opt.repeat = 1;
+    bench_opt.warmup = 0;
+    bench_opt.custom_sizes = 0;
+    bench_opt.sizes[0] = BUFSIZE;
+    bench_opt.sizes_count = 1;
+    bench_opt.cpu = -1;
+    bench_opt.threads = 0;
+
     if (argc <= 1) {
         memset(&todo, 1, sizeof(todo));
     } else {
         memset(&todo, 0, sizeof(todo));
 
         for (i = 1; i < argc; i++) {
+            if (strncmp(argv[i], "--", 2) == 0) {
+                if (parse_option(argv[i]) != 0) {
+                    mbedtls_printf("Invalid option: %s\n", argv[i]);
+                    mbedtls_printf("Available options: " OPTIONS);
+                    mbedtls_exit(1);
+                }
+                continue;
+            }
+
+            selected = 1;
             if (strcmp(argv[i], "md5") == 0) {
                 todo.md5 = 1;
             } else if (strcmp(argv[i], "ripemd160") == 0) {
@@ -552,6 +1530,10 @@ int main(int argc, char *argv[])
                 todo.sha3_384 = 1;
             } else if (strcmp(argv[i], "sha3_512") == 0) {
                 todo.sha3_512 = 1;
+            } else if (strcmp(argv[i], "shake128") == 0) {
+                todo.shake128 = 1;
+            } else if (strcmp(argv[i], "shake256") == 0) {
+                todo.shake256 = 1;
             } else if (strcmp(argv[i], "des3") == 0) {
                 todo.des3 = 1;
             } else if (strcmp(argv[i], "des") == 0) {
@@ -590,6 +1572,12 @@ int main(int argc, char *argv[])
                 todo.ecdsa = 1;
             } else if (strcmp(argv[i], "ecdh") == 0) {
                 todo.ecdh = 1;
+            } else if (strcmp(argv[i], "psa") == 0) {
+                todo.psa = 1;
+            } else if (strcmp(argv[i], "ssl_cache") == 0) {
+                todo.ssl_cache = 1;
+            } else if (strcmp(argv[i], "ssl_ticket") == 0) {
+                todo.ssl_ticket = 1;
             }
 #if defined(MBEDTLS_ECP_C)
             else if (set_ecp_curve(argv[i], single_curve)) {
@@ -601,61 +1589,113 @@ int main(int argc, char *argv[])
                 mbedtls_printf("Available options: " OPTIONS);
             }
         }
+
+        if (!selected) {
+            memset(&todo, 1, sizeof(todo));
+        }
     }
 
-    mbedtls_printf("\n");
+    if (bench_opt.cpu >= 0 && pin_to_cpu(bench_opt.cpu) != 0) {
+        mbedtls_printf("Failed to pin the process to CPU %d\n", bench_opt.cpu);
+        mbedtls_exit(1);
+    }
+
+    /* The message buffer is allocated outside the library heap, which may
+     * be a small static pool, so that large message sizes can be measured. */
+    buf_len = BUFSIZE;
+    for (k = 0; k < bench_opt.sizes_count; k++) {
+        if (bench_opt.sizes[k] > buf_len) {
+            buf_len = bench_opt.sizes[k];
+        }
+    }
+    buf = calloc(1, buf_len);
+    if (buf == NULL) {
+        mbedtls_printf("Failed to allocate %u bytes\n", (unsigned) buf_len);
+        mbedtls_exit(1);
+    }
+    msg_len = BUFSIZE;
+
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("\n");
+    } else if (bench_opt.format == FORMAT_CSV) {
+        mbedtls_printf("name,size,unit,repetitions,median,stddev,"
+                       "cycles_per_byte,cycles_per_byte_stddev%s\n",
+                       bench_opt.threads > 0 ?
+                       ",threads,single_thread,efficiency" : "");
+    } else {
+        mbedtls_printf("{\n  \"repetitions\": %d,\n  \"warmup\": %d,\n"
+                       "  \"results\": [", bench_opt.repeat, bench_opt.warmup);
+    }
 
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
     mbedtls_memory_buffer_alloc_init(alloc_buf, sizeof(alloc_buf));
 #endif
-    memset(buf, 0xAA, sizeof(buf));
+    memset(buf, 0xAA, buf_len);
     memset(tmp, 0xBB, sizeof(tmp));
 
     /* Avoid "unused static function" warning in configurations without
      * symmetric crypto. */
     (void) mbedtls_timing_hardclock;
 
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    if (bench_opt.threads > 0) {
+        scaling_main(&todo);
+        goto exit;
+    }
+#endif
+
 #if defined(MBEDTLS_MD5_C)
     if (todo.md5) {
-        TIME_AND_TSC("MD5", mbedtls_md5(buf, BUFSIZE, tmp));
+        TIME_AND_TSC("MD5", mbedtls_md5(buf, msg_len, tmp));
     }
 #endif
 
 #if defined(MBEDTLS_RIPEMD160_C)
     if (todo.ripemd160) {
-        TIME_AND_TSC("RIPEMD160", mbedtls_ripemd160(buf, BUFSIZE, tmp));
+        TIME_AND_TSC("RIPEMD160", mbedtls_ripemd160(buf, msg_len, tmp));
     }
 #endif
 
 #if defined(MBEDTLS_SHA1_C)
     if (todo.sha1) {
-        TIME_AND_TSC("SHA-1", mbedtls_sha1(buf, BUFSIZE, tmp));
+        TIME_AND_TSC("SHA-1", mbedtls_sha1(buf, msg_len, tmp));
     }
 #endif
 
 #if defined(MBEDTLS_SHA256_C)
     if (todo.sha256) {
-        TIME_AND_TSC("SHA-256", mbedtls_sha256(buf, BUFSIZE, tmp, 0));
+        TIME_AND_TSC("SHA-256", mbedtls_sha256(buf, msg_len, tmp, 0));
+        TIME_AND_TSC("SHA-256 batch x16", hash_batch(0));
     }
 #endif
 
 #if defined(MBEDTLS_SHA512_C)
     if (todo.sha512) {
-        TIME_AND_TSC("SHA-512", mbedtls_sha512(buf, BUFSIZE, tmp, 0));
+        TIME_AND_TSC("SHA-512", mbedtls_sha512(buf, msg_len, tmp, 0));
+        TIME_AND_TSC("SHA-512 batch x16", hash_batch(1));
     }
 #endif
 #if defined(MBEDTLS_SHA3_C)
     if (todo.sha3_224) {
-        TIME_AND_TSC("SHA3-224", mbedtls_sha3(MBEDTLS_SHA3_224, buf, BUFSIZE, tmp, 28));
+        TIME_AND_TSC("SHA3-224", mbedtls_sha3(MBEDTLS_SHA3_224, buf, msg_len, tmp, 28));
     }
     if (todo.sha3_256) {
-        TIME_AND_TSC("SHA3-256", mbedtls_sha3(MBEDTLS_SHA3_256, buf, BUFSIZE, tmp, 32));
+        TIME_AND_TSC("SHA3-256", mbedtls_sha3(MBEDTLS_SHA3_256, buf, msg_len, tmp, 32));
+        TIME_AND_TSC("SHA3-256 x4", sha3_x4(MBEDTLS_SHA3_256, 32));
     }
     if (todo.sha3_384) {
-        TIME_AND_TSC("SHA3-384", mbedtls_sha3(MBEDTLS_SHA3_384, buf, BUFSIZE, tmp, 48));
+        TIME_AND_TSC("SHA3-384", mbedtls_sha3(MBEDTLS_SHA3_384, buf, msg_len, tmp, 48));
     }
     if (todo.sha3_512) {
-        TIME_AND_TSC("SHA3-512", mbedtls_sha3(MBEDTLS_SHA3_512, buf, BUFSIZE, tmp, 64));
+        TIME_AND_TSC("SHA3-512", mbedtls_sha3(MBEDTLS_SHA3_512, buf, msg_len, tmp, 64));
+    }
+    if (todo.shake128) {
+        TIME_AND_TSC("SHAKE128", mbedtls_sha3(MBEDTLS_SHA3_SHAKE128, buf, msg_len, tmp, 32));
+        TIME_AND_TSC("SHAKE128 x4", sha3_x4(MBEDTLS_SHA3_SHAKE128, 32));
+    }
+    if (todo.shake256) {
+        TIME_AND_TSC("SHAKE256", mbedtls_sha3(MBEDTLS_SHA3_SHAKE256, buf, msg_len, tmp, 64));
+        TIME_AND_TSC("SHAKE256 x4", sha3_x4(MBEDTLS_SHA3_SHAKE256, 64));
     }
 #endif
 
@@ -668,7 +1708,7 @@ int main(int argc, char *argv[])
             mbedtls_exit(1);
         }
         TIME_AND_TSC("3DES",
-                     mbedtls_des3_crypt_cbc(&des3, MBEDTLS_DES_ENCRYPT, BUFSIZE, tmp, buf, buf));
+                     mbedtls_des3_crypt_cbc(&des3, MBEDTLS_DES_ENCRYPT, msg_len, tmp, buf, buf));
         mbedtls_des3_free(&des3);
     }
 
@@ -679,7 +1719,7 @@ int main(int argc, char *argv[])
             mbedtls_exit(1);
         }
         TIME_AND_TSC("DES",
-                     mbedtls_des_crypt_cbc(&des, MBEDTLS_DES_ENCRYPT, BUFSIZE, tmp, buf, buf));
+                     mbedtls_des_crypt_cbc(&des, MBEDTLS_DES_ENCRYPT, msg_len, tmp, buf, buf));
         mbedtls_des_free(&des);
     }
 
@@ -689,14 +1729,14 @@ int main(int argc, char *argv[])
         unsigned char output[8];
         const mbedtls_cipher_info_t *cipher_info;
 
-        memset(buf, 0, sizeof(buf));
+        memset(buf, 0, buf_len);
         memset(tmp, 0, sizeof(tmp));
 
         cipher_info = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_DES_EDE3_ECB);
 
         TIME_AND_TSC("3DES-CMAC",
                      mbedtls_cipher_cmac(cipher_info, tmp, 192, buf,
-                                         BUFSIZE, output));
+                                         msg_len, output));
     }
 #endif /* MBEDTLS_CMAC_C */
 #endif /* MBEDTLS_DES_C */
@@ -710,12 +1750,12 @@ int main(int argc, char *argv[])
         for (keysize = 128; keysize <= 256; keysize += 64) {
             mbedtls_snprintf(title, sizeof(title), "AES-CBC-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
             CHECK_AND_CONTINUE(mbedtls_aes_setkey_enc(&aes, tmp, keysize));
 
             TIME_AND_TSC(title,
-                         mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_ENCRYPT, BUFSIZE, tmp, buf, buf));
+                         mbedtls_aes_crypt_cbc(&aes, MBEDTLS_AES_ENCRYPT, msg_len, tmp, buf, buf));
         }
         mbedtls_aes_free(&aes);
     }
@@ -729,12 +1769,12 @@ int main(int argc, char *argv[])
         for (keysize = 128; keysize <= 256; keysize += 128) {
             mbedtls_snprintf(title, sizeof(title), "AES-XTS-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
             CHECK_AND_CONTINUE(mbedtls_aes_xts_setkey_enc(&ctx, tmp, keysize * 2));
 
             TIME_AND_TSC(title,
-                         mbedtls_aes_crypt_xts(&ctx, MBEDTLS_AES_ENCRYPT, BUFSIZE,
+                         mbedtls_aes_crypt_xts(&ctx, MBEDTLS_AES_ENCRYPT, msg_len,
                                                tmp, buf, buf));
 
             mbedtls_aes_xts_free(&ctx);
@@ -750,12 +1790,12 @@ int main(int argc, char *argv[])
         for (keysize = 128; keysize <= 256; keysize += 64) {
             mbedtls_snprintf(title, sizeof(title), "AES-GCM-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
             mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, tmp, keysize);
 
             TIME_AND_TSC(title,
-                         mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, BUFSIZE, tmp,
+                         mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, msg_len, tmp,
                                                    12, NULL, 0, buf, buf, 16, tmp));
 
             mbedtls_gcm_free(&gcm);
@@ -771,12 +1811,12 @@ int main(int argc, char *argv[])
         for (keysize = 128; keysize <= 256; keysize += 64) {
             mbedtls_snprintf(title, sizeof(title), "AES-CCM-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
             mbedtls_ccm_setkey(&ccm, MBEDTLS_CIPHER_ID_AES, tmp, keysize);
 
             TIME_AND_TSC(title,
-                         mbedtls_ccm_encrypt_and_tag(&ccm, BUFSIZE, tmp,
+                         mbedtls_ccm_encrypt_and_tag(&ccm, msg_len, tmp,
                                                      12, NULL, 0, buf, buf, tmp, 16));
 
             mbedtls_ccm_free(&ccm);
@@ -788,7 +1828,7 @@ int main(int argc, char *argv[])
         mbedtls_chachapoly_context chachapoly;
 
         mbedtls_chachapoly_init(&chachapoly);
-        memset(buf, 0, sizeof(buf));
+        memset(buf, 0, buf_len);
         memset(tmp, 0, sizeof(tmp));
 
         mbedtls_snprintf(title, sizeof(title), "ChaCha20-Poly1305");
@@ -797,7 +1837,7 @@ int main(int argc, char *argv[])
 
         TIME_AND_TSC(title,
                      mbedtls_chachapoly_encrypt_and_tag(&chachapoly,
-                                                        BUFSIZE, tmp, NULL, 0, buf, buf, tmp));
+                                                        msg_len, tmp, NULL, 0, buf, buf, tmp));
 
         mbedtls_chachapoly_free(&chachapoly);
     }
@@ -814,20 +1854,20 @@ int main(int argc, char *argv[])
              keysize += 64, cipher_type++) {
             mbedtls_snprintf(title, sizeof(title), "AES-CMAC-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
 
             cipher_info = mbedtls_cipher_info_from_type(cipher_type);
 
             TIME_AND_TSC(title,
                          mbedtls_cipher_cmac(cipher_info, tmp, keysize,
-                                             buf, BUFSIZE, output));
+                                             buf, msg_len, output));
         }
 
-        memset(buf, 0, sizeof(buf));
+        memset(buf, 0, buf_len);
         memset(tmp, 0, sizeof(tmp));
         TIME_AND_TSC("AES-CMAC-PRF-128",
-                     mbedtls_aes_cmac_prf_128(tmp, 16, buf, BUFSIZE,
+                     mbedtls_aes_cmac_prf_128(tmp, 16, buf, msg_len,
                                               output));
     }
 #endif /* MBEDTLS_CMAC_C */
@@ -841,13 +1881,13 @@ int main(int argc, char *argv[])
         for (keysize = 128; keysize <= 256; keysize += 64) {
             mbedtls_snprintf(title, sizeof(title), "ARIA-CBC-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
             mbedtls_aria_setkey_enc(&aria, tmp, keysize);
 
             TIME_AND_TSC(title,
                          mbedtls_aria_crypt_cbc(&aria, MBEDTLS_ARIA_ENCRYPT,
-                                                BUFSIZE, tmp, buf, buf));
+                                                msg_len, tmp, buf, buf));
         }
         mbedtls_aria_free(&aria);
     }
@@ -861,13 +1901,13 @@ int main(int argc, char *argv[])
         for (keysize = 128; keysize <= 256; keysize += 64) {
             mbedtls_snprintf(title, sizeof(title), "CAMELLIA-CBC-%d", keysize);
 
-            memset(buf, 0, sizeof(buf));
+            memset(buf, 0, buf_len);
             memset(tmp, 0, sizeof(tmp));
             mbedtls_camellia_setkey_enc(&camellia, tmp, keysize);
 
             TIME_AND_TSC(title,
                          mbedtls_camellia_crypt_cbc(&camellia, MBEDTLS_CAMELLIA_ENCRYPT,
-                                                    BUFSIZE, tmp, buf, buf));
+                                                    msg_len, tmp, buf, buf));
         }
         mbedtls_camellia_free(&camellia);
     }
@@ -875,13 +1915,13 @@ int main(int argc, char *argv[])
 
 #if defined(MBEDTLS_CHACHA20_C)
     if (todo.chacha20) {
-        TIME_AND_TSC("ChaCha20", mbedtls_chacha20_crypt(buf, buf, 0U, BUFSIZE, buf, buf));
+        TIME_AND_TSC("ChaCha20", mbedtls_chacha20_crypt(buf, buf, 0U, msg_len, buf, buf));
     }
 #endif
 
 #if defined(MBEDTLS_POLY1305_C)
     if (todo.poly1305) {
-        TIME_AND_TSC("Poly1305", mbedtls_poly1305_mac(buf, buf, BUFSIZE, buf));
+        TIME_AND_TSC("Poly1305", mbedtls_poly1305_mac(buf, buf, msg_len, buf));
     }
 #endif
 
@@ -894,7 +1934,7 @@ int main(int argc, char *argv[])
             mbedtls_exit(1);
         }
         TIME_AND_TSC("CTR_DRBG (NOPR)",
-                     mbedtls_ctr_drbg_random(&ctr_drbg, buf, BUFSIZE));
+                     ctr_drbg_fill(&ctr_drbg, buf, msg_len));
         mbedtls_ctr_drbg_free(&ctr_drbg);
 
         mbedtls_ctr_drbg_init(&ctr_drbg);
@@ -903,7 +1943,7 @@ int main(int argc, char *argv[])
         }
         mbedtls_ctr_drbg_set_prediction_resistance(&ctr_drbg, MBEDTLS_CTR_DRBG_PR_ON);
         TIME_AND_TSC("CTR_DRBG (PR)",
-                     mbedtls_ctr_drbg_random(&ctr_drbg, buf, BUFSIZE));
+                     ctr_drbg_fill(&ctr_drbg, buf, msg_len));
         mbedtls_ctr_drbg_free(&ctr_drbg);
     }
 #endif
@@ -925,7 +1965,7 @@ int main(int argc, char *argv[])
             mbedtls_exit(1);
         }
         TIME_AND_TSC("HMAC_DRBG SHA-1 (NOPR)",
-                     mbedtls_hmac_drbg_random(&hmac_drbg, buf, BUFSIZE));
+                     hmac_drbg_fill(&hmac_drbg, buf, msg_len));
 
         if (mbedtls_hmac_drbg_seed(&hmac_drbg, md_info, myrand, NULL, NULL, 0) != 0) {
             mbedtls_exit(1);
@@ -933,7 +1973,7 @@ int main(int argc, char *argv[])
         mbedtls_hmac_drbg_set_prediction_resistance(&hmac_drbg,
                                                     MBEDTLS_HMAC_DRBG_PR_ON);
         TIME_AND_TSC("HMAC_DRBG SHA-1 (PR)",
-                     mbedtls_hmac_drbg_random(&hmac_drbg, buf, BUFSIZE));
+                     hmac_drbg_fill(&hmac_drbg, buf, msg_len));
 #endif
 
 #if defined(MBEDTLS_SHA256_C)
@@ -945,7 +1985,7 @@ int main(int argc, char *argv[])
             mbedtls_exit(1);
         }
         TIME_AND_TSC("HMAC_DRBG SHA-256 (NOPR)",
-                     mbedtls_hmac_drbg_random(&hmac_drbg, buf, BUFSIZE));
+                     hmac_drbg_fill(&hmac_drbg, buf, msg_len));
 
         if (mbedtls_hmac_drbg_seed(&hmac_drbg, md_info, myrand, NULL, NULL, 0) != 0) {
             mbedtls_exit(1);
@@ -953,7 +1993,7 @@ int main(int argc, char *argv[])
         mbedtls_hmac_drbg_set_prediction_resistance(&hmac_drbg,
                                                     MBEDTLS_HMAC_DRBG_PR_ON);
         TIME_AND_TSC("HMAC_DRBG SHA-256 (PR)",
-                     mbedtls_hmac_drbg_random(&hmac_drbg, buf, BUFSIZE));
+                     hmac_drbg_fill(&hmac_drbg, buf, msg_len));
 #endif
         mbedtls_hmac_drbg_free(&hmac_drbg);
     }
@@ -1026,12 +2066,12 @@ int main(int argc, char *argv[])
                         ret |= mbedtls_dhm_make_public(&dhm, (int) n, buf, n,
                                                        myrand, NULL);
                         ret |=
-                            mbedtls_dhm_calc_secret(&dhm, buf, sizeof(buf), &olen, myrand, NULL));
+                            mbedtls_dhm_calc_secret(&dhm, buf, BUFSIZE, &olen, myrand, NULL));
 
             mbedtls_snprintf(title, sizeof(title), "DH-%d", dhm_sizes[i]);
             TIME_PUBLIC(title, "handshake",
                         ret |=
-                            mbedtls_dhm_calc_secret(&dhm, buf, sizeof(buf), &olen, myrand, NULL));
+                            mbedtls_dhm_calc_secret(&dhm, buf, BUFSIZE, &olen, myrand, NULL));
 
             mbedtls_dhm_free(&dhm);
         }
@@ -1044,7 +2084,7 @@ int main(int argc, char *argv[])
         const mbedtls_ecp_curve_info *curve_info;
         size_t sig_len;
 
-        memset(buf, 0x2A, sizeof(buf));
+        memset(buf, 0x2A, BUFSIZE);
 
         for (curve_info = curve_list;
              curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
@@ -1140,16 +2180,16 @@ int main(int argc, char *argv[])
             mbedtls_ecdh_init(&ecdh);
 
             CHECK_AND_CONTINUE(mbedtls_ecp_group_load(&ecdh.grp, curve_info->grp_id));
-            CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, sizeof(buf),
+            CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, BUFSIZE,
                                                         myrand, NULL));
             CHECK_AND_CONTINUE(mbedtls_ecp_copy(&ecdh.Qp, &ecdh.Q));
 
             mbedtls_snprintf(title, sizeof(title), "ECDHE-%s",
                              curve_info->name);
             TIME_PUBLIC(title, "handshake",
-                        CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, sizeof(buf),
+                        CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, BUFSIZE,
                                                                     myrand, NULL));
-                        CHECK_AND_CONTINUE(mbedtls_ecdh_calc_secret(&ecdh, &olen, buf, sizeof(buf),
+                        CHECK_AND_CONTINUE(mbedtls_ecdh_calc_secret(&ecdh, &olen, buf, BUFSIZE,
                                                                     myrand, NULL)));
             mbedtls_ecdh_free(&ecdh);
         }
@@ -1187,16 +2227,16 @@ int main(int argc, char *argv[])
             mbedtls_ecdh_init(&ecdh);
 
             CHECK_AND_CONTINUE(mbedtls_ecp_group_load(&ecdh.grp, curve_info->grp_id));
-            CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, sizeof(buf),
+            CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, BUFSIZE,
                                                         myrand, NULL));
             CHECK_AND_CONTINUE(mbedtls_ecp_copy(&ecdh.Qp, &ecdh.Q));
-            CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, sizeof(buf),
+            CHECK_AND_CONTINUE(mbedtls_ecdh_make_public(&ecdh, &olen, buf, BUFSIZE,
                                                         myrand, NULL));
 
             mbedtls_snprintf(title, sizeof(title), "ECDH-%s",
                              curve_info->name);
             TIME_PUBLIC(title, "handshake",
-                        CHECK_AND_CONTINUE(mbedtls_ecdh_calc_secret(&ecdh, &olen, buf, sizeof(buf),
+                        CHECK_AND_CONTINUE(mbedtls_ecdh_calc_secret(&ecdh, &olen, buf, BUFSIZE,
                                                                     myrand, NULL)));
             mbedtls_ecdh_free(&ecdh);
         }
@@ -1272,11 +2312,19 @@ int main(int argc, char *argv[])
     }
 #endif
 
-    mbedtls_printf("\n");
+#if defined(MBEDTLS_THREADING_PTHREAD)
+exit:
+#endif
+    if (bench_opt.format == FORMAT_TEXT) {
+        mbedtls_printf("\n");
+    } else if (bench_opt.format == FORMAT_JSON) {
+        mbedtls_printf("\n  ]\n}\n");
+    }
 
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
     mbedtls_memory_buffer_alloc_free();
 #endif
+    free(buf);
 
     mbedtls_exit(0);
 }
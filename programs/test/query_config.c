@@ -1084,6 +1084,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_GENPRIME */
 
+#if defined(MBEDTLS_MPI_EXP_MOD_FIXED_STACK)
+    if( strcmp( "MBEDTLS_MPI_EXP_MOD_FIXED_STACK", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_MPI_EXP_MOD_FIXED_STACK );
+        return( 0 );
+    }
+#endif /* MBEDTLS_MPI_EXP_MOD_FIXED_STACK */
+
 #if defined(MBEDTLS_FS_IO)
     if( strcmp( "MBEDTLS_FS_IO", config ) == 0 )
     {
@@ -1092,6 +1100,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_FS_IO */
 
+#if defined(MBEDTLS_FS_IO_MMAP)
+    if( strcmp( "MBEDTLS_FS_IO_MMAP", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_FS_IO_MMAP );
+        return( 0 );
+    }
+#endif /* MBEDTLS_FS_IO_MMAP */
+
 #if defined(MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES)
     if( strcmp( "MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES", config ) == 0 )
     {
@@ -1292,6 +1308,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_SSL_CONTEXT_SERIALIZATION */
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+    if( strcmp( "MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT );
+        return( 0 );
+    }
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 #if defined(MBEDTLS_SSL_DEBUG_ALL)
     if( strcmp( "MBEDTLS_SSL_DEBUG_ALL", config ) == 0 )
     {
@@ -1316,6 +1340,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_SSL_EXTENDED_MASTER_SECRET */
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+    if( strcmp( "MBEDTLS_SSL_HANDSHAKE_PROFILING", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_SSL_HANDSHAKE_PROFILING );
+        return( 0 );
+    }
+#endif /* MBEDTLS_SSL_HANDSHAKE_PROFILING */
+
 #if defined(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE)
     if( strcmp( "MBEDTLS_SSL_KEEP_PEER_CERTIFICATE", config ) == 0 )
     {
@@ -1476,6 +1508,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH */
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    if( strcmp( "MBEDTLS_SSL_RELEASE_BUFFERS", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_SSL_RELEASE_BUFFERS );
+        return( 0 );
+    }
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 #if defined(MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN)
     if( strcmp( "MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN", config ) == 0 )
     {
@@ -2324,6 +2364,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_HMAC_DRBG_MAX_SEED_INPUT */
 
+#if defined(MBEDTLS_DHM_FIXED_BASE_OPTIM)
+    if( strcmp( "MBEDTLS_DHM_FIXED_BASE_OPTIM", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_DHM_FIXED_BASE_OPTIM );
+        return( 0 );
+    }
+#endif /* MBEDTLS_DHM_FIXED_BASE_OPTIM */
+
 #if defined(MBEDTLS_ECP_WINDOW_SIZE)
     if( strcmp( "MBEDTLS_ECP_WINDOW_SIZE", config ) == 0 )
     {
@@ -2700,6 +2748,14 @@ int query_config(const char *config)
     }
 #endif /* MBEDTLS_SSL_DTLS_MAX_BUFFERING */
 
+#if defined(MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX)
+    if( strcmp( "MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX", config ) == 0 )
+    {
+        MACRO_EXPANSION_TO_STR( MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX );
+        return( 0 );
+    }
+#endif /* MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX */
+
 #if defined(MBEDTLS_PSK_MAX_LEN)
     if( strcmp( "MBEDTLS_PSK_MAX_LEN", config ) == 0 )
     {
@@ -3946,10 +4002,18 @@ void list_config(void)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_GENPRIME);
 #endif /* MBEDTLS_GENPRIME */
 
+#if defined(MBEDTLS_MPI_EXP_MOD_FIXED_STACK)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_MPI_EXP_MOD_FIXED_STACK);
+#endif /* MBEDTLS_MPI_EXP_MOD_FIXED_STACK */
+
 #if defined(MBEDTLS_FS_IO)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_FS_IO);
 #endif /* MBEDTLS_FS_IO */
 
+#if defined(MBEDTLS_FS_IO_MMAP)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_FS_IO_MMAP);
+#endif /* MBEDTLS_FS_IO_MMAP */
+
 #if defined(MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES);
 #endif /* MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES */
@@ -4050,6 +4114,10 @@ void list_config(void)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_CONTEXT_SERIALIZATION);
 #endif /* MBEDTLS_SSL_CONTEXT_SERIALIZATION */
 
+#if defined(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT);
+#endif /* MBEDTLS_SSL_TRAFFIC_KEYS_EXPORT */
+
 #if defined(MBEDTLS_SSL_DEBUG_ALL)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_DEBUG_ALL);
 #endif /* MBEDTLS_SSL_DEBUG_ALL */
@@ -4062,6 +4130,10 @@ void list_config(void)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_EXTENDED_MASTER_SECRET);
 #endif /* MBEDTLS_SSL_EXTENDED_MASTER_SECRET */
 
+#if defined(MBEDTLS_SSL_HANDSHAKE_PROFILING)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_HANDSHAKE_PROFILING);
+#endif /* MBEDTLS_SSL_HANDSHAKE_PROFILING */
+
 #if defined(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE);
 #endif /* MBEDTLS_SSL_KEEP_PEER_CERTIFICATE */
@@ -4142,6 +4214,10 @@ void list_config(void)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH);
 #endif /* MBEDTLS_SSL_VARIABLE_BUFFER_LENGTH */
 
+#if defined(MBEDTLS_SSL_RELEASE_BUFFERS)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_RELEASE_BUFFERS);
+#endif /* MBEDTLS_SSL_RELEASE_BUFFERS */
+
 #if defined(MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN);
 #endif /* MBEDTLS_TEST_CONSTANT_FLOW_MEMSAN */
@@ -4566,6 +4642,10 @@ void list_config(void)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_HMAC_DRBG_MAX_SEED_INPUT);
 #endif /* MBEDTLS_HMAC_DRBG_MAX_SEED_INPUT */
 
+#if defined(MBEDTLS_DHM_FIXED_BASE_OPTIM)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_DHM_FIXED_BASE_OPTIM);
+#endif /* MBEDTLS_DHM_FIXED_BASE_OPTIM */
+
 #if defined(MBEDTLS_ECP_WINDOW_SIZE)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_ECP_WINDOW_SIZE);
 #endif /* MBEDTLS_ECP_WINDOW_SIZE */
@@ -4754,6 +4834,10 @@ void list_config(void)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_DTLS_MAX_BUFFERING);
 #endif /* MBEDTLS_SSL_DTLS_MAX_BUFFERING */
 
+#if defined(MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX)
+    OUTPUT_MACRO_NAME_VALUE(MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX);
+#endif /* MBEDTLS_SSL_BUFFER_POOL_DEFAULT_MAX */
+
 #if defined(MBEDTLS_PSK_MAX_LEN)
     OUTPUT_MACRO_NAME_VALUE(MBEDTLS_PSK_MAX_LEN);
 #endif /* MBEDTLS_PSK_MAX_LEN */
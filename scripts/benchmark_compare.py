@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+
+"""
+Compare two result files produced by programs/test/benchmark with
+--format=json or --format=csv.
+
+For each measurement present in both files, print the old and new median
+and the relative change. Throughput is "higher is better", so a negative
+change is a slowdown. Measurements whose change is within the combined
+standard deviation of the two runs are marked as noise.
+
+Exit with status 1 if any measurement slowed down by more than the
+threshold given with --fail-above, so that the script can gate CI jobs.
+"""
+
+# Copyright The Mbed TLS Contributors
+# SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+
+import argparse
+import csv
+import json
+import sys
+import typing
+
+
+class Measurement(typing.NamedTuple):
+    """One line of benchmark output."""
+    name: str
+    size: typing.Optional[int]
+    unit: str
+    median: float
+    stddev: float
+
+
+Key = typing.Tuple[str, typing.Optional[int]]
+
+
+def read_json(filename: str) -> typing.List[Measurement]:
+    """Read the output of benchmark --format=json."""
+    with open(filename) as f:
+        data = json.load(f)
+    return [Measurement(r['name'], r.get('size'), r['unit'],
+                        float(r['median']), float(r['stddev']))
+            for r in data['results']]
+
+
+def read_csv(filename: str) -> typing.List[Measurement]:
+    """Read the output of benchmark --format=csv."""
+    with open(filename, newline='') as f:
+        return [Measurement(r['name'],
+                            int(r['size']) if r['size'] else None,
+                            r['unit'],
+                            float(r['median']), float(r['stddev'] or 0))
+                for r in csv.DictReader(f)]
+
+
+def read_results(filename: str) -> typing.Dict[Key, Measurement]:
+    """Read a benchmark result file, guessing its format from its content."""
+    with open(filename) as f:
+        is_json = f.read(1) == '{'
+    results = read_json(filename) if is_json else read_csv(filename)
+    return {(m.name, m.size): m for m in results}
+
+
+def describe(key: Key) -> str:
+    name, size = key
+    return name if size is None else '{}/{}'.format(name, size)
+
+
+def compare(old: typing.Dict[Key, Measurement],
+            new: typing.Dict[Key, Measurement],
+            show_all: bool) -> float:
+    """Print the comparison and return the largest slowdown in percent."""
+    worst = 0.0
+    print('{:<34} {:>14} {:>14} {:>9}'.format('measurement', 'old', 'new',
+                                              'change'))
+    for key in old:
+        if key not in new:
+            continue
+        o, n = old[key], new[key]
+        if o.median == 0:
+            continue
+        change = 100 * (n.median - o.median) / o.median
+        noise = abs(n.median - o.median) <= o.stddev + n.stddev
+        if not noise:
+            worst = min(worst, change)
+        if noise and not show_all:
+            continue
+        print('{:<34} {:>14.2f} {:>14.2f} {:>+8.1f}%{}'
+              .format(describe(key), o.median, n.median, change,
+                      ' (noise)' if noise else ''))
+    for key in sorted(set(old) ^ set(new), key=describe):
+        print('{:<34} only in {}'.format(describe(key),
+                                         'old' if key in old else 'new'))
+    return -worst
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('old', help='results of the reference run')
+    parser.add_argument('new', help='results of the run to evaluate')
+    parser.add_argument('--fail-above', type=float, metavar='PERCENT',
+                        help='exit with status 1 if any measurement '
+                        'slowed down by more than PERCENT')
+    parser.add_argument('--show-all', action='store_true',
+                        help='also show changes that are within noise')
+    args = parser.parse_args()
+
+    slowdown = compare(read_results(args.old), read_results(args.new),
+                       args.show_all)
+    if args.fail_above is not None and slowdown > args.fail_above:
+        print('Largest slowdown: {:.1f}%'.format(slowdown))
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
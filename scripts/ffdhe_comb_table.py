@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+Purpose
+
+This script dumps the fixed-base comb tables for the RFC 7919 groups, which
+are used by library/dhm_ffdhe.c to compute 2^x mod p. Run it from the root
+of the source tree and copy its output into library/dhm_ffdhe.c, replacing
+the existing ffdhe<bits>_T tables.
+
+For a group with an n-bit prime p, the exponent is split into
+DHM_FFDHE_COMB_TEETH blocks of d = ceil(n / teeth) bits. Entry i of
+the table is 2^(2^(i * d)) mod p, in the Montgomery representation with
+R = 2^n, written in big-endian order on n / 8 bytes. The value of R does not
+depend on the size of a limb, since n is a multiple of 64 for all groups.
+"""
+
+# Copyright The Mbed TLS Contributors
+# SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+
+import re
+import sys
+
+# Must match DHM_FFDHE_COMB_TEETH in library/dhm_ffdhe.c
+COMB_TEETH = 5
+
+DHM_H = 'include/mbedtls/dhm.h'
+
+BYTES_PER_LINE = 8
+
+
+def read_primes(path):
+    """Return a list of (bits, p) for the RFC 7919 groups defined in dhm.h."""
+    with open(path, encoding='utf-8') as f:
+        content = f.read()
+    primes = []
+    for m in re.finditer(r'#define MBEDTLS_DHM_RFC7919_FFDHE(\d+)_P_BIN\s*\{(.*?)\}',
+                         content, re.S):
+        bits = int(m.group(1))
+        data = bytes(int(b, 16) for b in re.findall(r'0x([0-9A-Fa-f]{2})',
+                                                    m.group(2)))
+        assert len(data) * 8 == bits
+        primes.append((bits, int.from_bytes(data, 'big')))
+    return primes
+
+
+def comb_entries(bits, p):
+    """Return the comb table entries for the group (bits, p)."""
+    d = (bits + COMB_TEETH - 1) // COMB_TEETH
+    r = 1 << bits
+    return [pow(2, 1 << (i * d), p) * r % p for i in range(COMB_TEETH)]
+
+
+def dump_table(bits, p):
+    """Return the C definition of the comb table for the group (bits, p)."""
+    size = bits // 8
+    lines = ['static const unsigned char ffdhe%d_T[%d * %d] = {' %
+             (bits, COMB_TEETH, size)]
+    for i, entry in enumerate(comb_entries(bits, p)):
+        data = entry.to_bytes(size, 'big')
+        if i != 0:
+            lines.append('')
+        for j in range(0, size, BYTES_PER_LINE):
+            chunk = data[j:j + BYTES_PER_LINE]
+            lines.append('    ' + ' '.join('0x%02X,' % b for b in chunk))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    primes = read_primes(DHM_H)
+    if not primes:
+        sys.exit('No RFC 7919 group found in ' + DHM_H)
+    print('\n\n'.join(dump_table(bits, p) for bits, p in primes))
+
+
+if __name__ == '__main__':
+    main()
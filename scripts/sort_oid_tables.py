@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""
+Purpose
+
+This script sorts the OID tables in library/oid.c. The lookup functions in
+that file do a binary search, so the entries of each table must be in the
+order of the DER encoding of their OID, compared byte by byte, with an OID
+that is a prefix of another one coming first. Run it from the root of the
+source tree after adding an entry to a table, wherever the entry was added.
+
+The set of entries in a table depends on the configuration, so each entry
+gets its own preprocessor condition: an entry that was guarded by
+`#if defined(B)` inside `#if defined(A)` is guarded by
+`#if defined(A) && defined(B)` once sorted. Consecutive entries with the same
+condition share a block.
+
+The functions that look up an OID from its attributes return the first
+matching entry. The script refuses to change the relative order of two
+entries with the same attributes, since it would change the result of these
+functions.
+
+With --check, the script does not modify library/oid.c and exits with a
+non-zero status if it is not up to date.
+"""
+
+# Copyright The Mbed TLS Contributors
+# SPDX-License-Identifier: Apache-2.0 OR GPL-2.0-or-later
+
+import argparse
+import re
+import sys
+
+OID_H = 'include/mbedtls/oid.h'
+OID_C = 'library/oid.c'
+
+TABLE_START_RE = re.compile(r'static const \w+ (oid_\w+)\[\] =$')
+OID_DESCRIPTOR_RE = re.compile(r'OID_DESCRIPTOR\((\w+),.*?\)\s*,', re.S)
+C_ESCAPE_RE = re.compile(r'\\(x[0-9A-Fa-f]+|[0-7]{1,3}|.)')
+
+
+def read_oid_macros(path):
+    """Return a dictionary mapping macro names to their replacement tokens."""
+    with open(path, encoding='utf-8') as f:
+        content = f.read()
+    content = content.replace('\\\n', ' ')
+    content = re.sub(r'/\*.*?\*/', ' ', content, flags=re.S)
+    macros = {}
+    for m in re.finditer(r'^#define\s+(MBEDTLS_OID_\w+)[ \t]+(.*)$',
+                         content, re.M):
+        macros[m.group(1)] = re.findall(r'"(?:[^"\\]|\\.)*"|\w+', m.group(2))
+    return macros
+
+
+def unescape(literal):
+    """Return the content of a C string literal as bytes."""
+    def replace(m):
+        esc = m.group(1)
+        if esc[0] == 'x':
+            return chr(int(esc[1:], 16))
+        if esc[0] in '01234567':
+            return chr(int(esc, 8))
+        return esc
+    return C_ESCAPE_RE.sub(replace, literal[1:-1]).encode('latin-1')
+
+
+def oid_value(macros, name):
+    """Return the DER content of the OID defined by the macro name."""
+    if name not in macros:
+        raise ValueError('Unknown OID macro: ' + name)
+    value = b''
+    for token in macros[name]:
+        if token.startswith('"'):
+            value += unescape(token)
+        else:
+            value += oid_value(macros, token)
+    return value
+
+
+class Entry:
+    """An entry of an OID table, with the conditions that guard it."""
+    #pylint: disable=too-few-public-methods
+
+    def __init__(self, lines, conditions):
+        self.lines = lines
+        self.conditions = conditions
+        text = '\n'.join(lines)
+        self.is_sentinel = 'NULL_OID_DESCRIPTOR' in text
+        m = OID_DESCRIPTOR_RE.search(text)
+        self.oid_name = m.group(1) if m else None
+        # What is left once the descriptor is removed identifies the
+        # attributes of the entry, for the lookups by attribute.
+        rest = OID_DESCRIPTOR_RE.sub('', text) if m else text
+        self.attributes = ' '.join(re.sub(r'[{},]', ' ', rest).split())
+        self.oid = b''
+
+
+def paren_depth(line):
+    """Return the nesting depth of brackets at the end of a line."""
+    line = re.sub(r'"(?:[^"\\]|\\.)*"', '""', line)
+    return (sum(line.count(c) for c in '({[') -
+            sum(line.count(c) for c in ')}]'))
+
+
+def parse_table(name, body):
+    """Parse the lines of the body of a table into a list of entries."""
+    entries = []
+    conditions = []
+    current = []
+    depth = 0
+    for line in body:
+        directive = line.strip()
+        if not current and directive.startswith('#'):
+            if directive.startswith('#if '):
+                conditions.append(directive[4:].strip())
+            elif directive.startswith('#endif'):
+                conditions.pop()
+            else:
+                raise ValueError('{}: unsupported directive: {}'
+                                 .format(name, directive))
+            continue
+        if not current and not directive:
+            continue
+        current.append(line)
+        depth += paren_depth(line)
+        if depth == 0 and line.rstrip().endswith((',', '}')):
+            entries.append(Entry(current, tuple(conditions)))
+            current = []
+    if current or conditions:
+        raise ValueError(name + ': unterminated entry or condition')
+    return entries
+
+
+def format_condition(conditions):
+    """Return the #if and #endif lines for a tuple of conditions."""
+    exprs = ['(' + c + ')' if '||' in c else c for c in conditions]
+    names = [re.sub(r'defined\((\w+)\)', r'\1', c) for c in exprs]
+    return ('#if ' + ' && '.join(exprs),
+            '#endif /* ' + ' && '.join(names) + ' */')
+
+
+def sort_table(name, body, macros):
+    """Return the sorted lines of the body of a table."""
+    entries = parse_table(name, body)
+    if not entries or not entries[-1].is_sentinel or \
+       entries[-1].conditions:
+        raise ValueError(name + ': the last entry must be an unconditional '
+                         'NULL_OID_DESCRIPTOR')
+    sentinel = entries.pop()
+    for entry in entries:
+        if entry.oid_name is None:
+            raise ValueError(name + ': entry without OID_DESCRIPTOR: ' +
+                             ' '.join(entry.lines))
+        entry.oid = oid_value(macros, entry.oid_name)
+    sorted_entries = sorted(entries, key=lambda entry: entry.oid)
+    for i, entry in enumerate(sorted_entries):
+        if i > 0 and entry.oid == sorted_entries[i - 1].oid:
+            raise ValueError('{}: duplicate OID {}'
+                             .format(name, entry.oid_name))
+    for i, a in enumerate(entries):
+        for b in entries[i + 1:]:
+            if a.attributes and a.attributes == b.attributes and \
+               sorted_entries.index(a) > sorted_entries.index(b):
+                raise ValueError('{}: sorting would move {} after {}, '
+                                 'which have the same attributes'
+                                 .format(name, a.oid_name, b.oid_name))
+    lines = []
+    previous = ()
+    for entry in sorted_entries:
+        if entry.conditions != previous:
+            if previous:
+                lines.append(format_condition(previous)[1])
+            if entry.conditions:
+                lines.append(format_condition(entry.conditions)[0])
+            previous = entry.conditions
+        lines += entry.lines
+    if previous:
+        lines.append(format_condition(previous)[1])
+    return lines + sentinel.lines
+
+
+def sort_oid_tables(content, macros):
+    """Return the content of oid.c with all its tables sorted."""
+    lines = content.split('\n')
+    out = []
+    i = 0
+    while i < len(lines):
+        out.append(lines[i])
+        m = TABLE_START_RE.match(lines[i])
+        i += 1
+        if not m:
+            continue
+        if lines[i] != '{':
+            raise ValueError(m.group(1) + ': expected "{" after the name')
+        out.append(lines[i])
+        end = lines.index('};', i)
+        out += sort_table(m.group(1), lines[i + 1:end], macros)
+        i = end
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[1])
+    parser.add_argument('--check', action='store_true',
+                        help='check that the tables are sorted, '
+                        'do not modify ' + OID_C)
+    args = parser.parse_args()
+    macros = read_oid_macros(OID_H)
+    with open(OID_C, encoding='utf-8') as f:
+        content = f.read()
+    try:
+        new_content = sort_oid_tables(content, macros)
+    except ValueError as e:
+        sys.exit(OID_C + ': ' + str(e))
+    if new_content == content:
+        return
+    if args.check:
+        sys.exit(OID_C + ': the OID tables are not sorted, run ' + sys.argv[0])
+    with open(OID_C, 'w', encoding='utf-8') as f:
+        f.write(new_content)
+
+
+if __name__ == '__main__':
+    main()
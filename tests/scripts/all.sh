@@ -1001,6 +1001,11 @@ component_check_generated_files () {
     # This is necessary for subsequent components!
 }
 
+component_check_oid_tables () {
+    msg "Check: OID tables are sorted" # < 1s
+    scripts/sort_oid_tables.py --check
+}
+
 component_check_doxy_blocks () {
     msg "Check: doxygen markup outside doxygen blocks" # < 1s
     tests/scripts/check-doxy-blocks.pl
@@ -1269,6 +1274,18 @@ component_test_no_pem_no_fs () {
     tests/ssl-opt.sh
 }
 
+component_test_fs_io_mmap () {
+    msg "build: full + MBEDTLS_FS_IO_MMAP (ASan build)"
+    scripts/config.py full
+    scripts/config.py set MBEDTLS_FS_IO_MMAP
+    CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
+    make
+
+    msg "test: MBEDTLS_FS_IO_MMAP - suites that load files (ASan build)"
+    ( cd tests; ./test_suite_pkparse && ./test_suite_x509parse &&
+      ./test_suite_dhm && ./test_suite_platform )
+}
+
 component_test_rsa_no_crt () {
     msg "build: Default + RSA_NO_CRT (ASan build)" # ~ 6 min
     scripts/config.py set MBEDTLS_RSA_NO_CRT
@@ -4879,6 +4896,15 @@ component_build_arm_clang_thumb () {
     make CC="clang" CFLAGS='-std=c99 -Werror -Os --target=arm-linux-gnueabihf -mcpu=arm1136j-s -mthumb' lib
 }
 
+component_build_sha3_x4_a64_clang () {
+    msg "build: clang aarch64 with FEAT_SHA3, baremetal, make" # ~ 30s
+    scripts/config.py baremetal
+    make CC="clang" CFLAGS='-std=c99 -Werror -Wall -Wextra -O1 --target=aarch64-linux-gnu -march=armv8.2-a+sha3' lib
+
+    msg "check: the four-way SHA-3 code uses the FEAT_SHA3 instructions"
+    clang -std=c99 -O1 --target=aarch64-linux-gnu -march=armv8.2-a+sha3 -Iinclude -Ilibrary -E -dM library/sha3.c | grep -q 'define MBEDTLS_SHA3_X4_A64'
+}
+
 component_build_armcc () {
     msg "build: ARM Compiler 5"
     scripts/config.py baremetal
@@ -8731,6 +8731,76 @@ run_test    "SSL async private: sign, SNI" \
             -c "issuer name *: C=NL, O=PolarSSL, CN=PolarSSL Test CA" \
             -c "subject name *: C=NL, O=PolarSSL, CN=polarssl.example"
 
+requires_config_enabled MBEDTLS_SSL_ASYNC_PRIVATE
+requires_config_enabled MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL_ENABLED
+run_test    "SSL async private: TLS 1.3 sign ECDSA, delay=0" \
+            "$P_SRV force_version=tls13 \
+             crt_file=data_files/server5.crt key_file=data_files/server5.key \
+             async_operations=s async_private_tls13=1 async_private_delay1=0 async_private_delay2=0" \
+            "$P_CLI" \
+            0 \
+            -s "Async sign callback: using key slot " \
+            -s "Async resume (slot [0-9]): sign done, status=0" \
+            -s "Protocol is TLSv1.3"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_PRIVATE
+requires_config_enabled MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL_ENABLED
+requires_config_enabled MBEDTLS_RSA_C
+run_test    "SSL async private: TLS 1.3 sign RSA-PSS, delay=2" \
+            "$P_SRV force_version=tls13 \
+             crt_file=data_files/server2.crt key_file=data_files/server2.key \
+             async_operations=s async_private_tls13=1 async_private_delay1=2 async_private_delay2=2" \
+            "$P_CLI debug_level=3" \
+            0 \
+            -c "Certificate Verify: Signature algorithm ( 080[456] )" \
+            -s "Async sign callback: using key slot " \
+            -U "Async sign callback: using key slot " \
+            -s "Async resume (slot [0-9]): call 1 more times." \
+            -s "Async resume (slot [0-9]): call 0 more times." \
+            -s "Async resume (slot [0-9]): sign done, status=0" \
+            -s "Protocol is TLSv1.3"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_PRIVATE
+requires_config_enabled MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL_ENABLED
+run_test    "SSL async private: TLS 1.3 sign, error in start" \
+            "$P_SRV force_version=tls13 \
+             crt_file=data_files/server5.crt key_file=data_files/server5.key \
+             async_operations=s async_private_tls13=1 async_private_delay1=1 async_private_delay2=1 \
+             async_private_error=1" \
+            "$P_CLI" \
+            1 \
+            -s "Async sign callback: injected error" \
+            -S "Async resume" \
+            -S "Async cancel" \
+            -s "! mbedtls_ssl_handshake returned"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_PRIVATE
+requires_config_enabled MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL_ENABLED
+run_test    "SSL async private: TLS 1.3 sign, cancel after start" \
+            "$P_SRV force_version=tls13 \
+             crt_file=data_files/server5.crt key_file=data_files/server5.key \
+             async_operations=s async_private_tls13=1 async_private_delay1=1 async_private_delay2=1 \
+             async_private_error=2" \
+            "$P_CLI" \
+            1 \
+            -s "Async sign callback: using key slot " \
+            -S "Async resume" \
+            -s "Async cancel"
+
+requires_config_enabled MBEDTLS_SSL_ASYNC_PRIVATE
+requires_config_enabled MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL_ENABLED
+requires_config_enabled MBEDTLS_RSA_C
+run_test    "SSL async private: TLS 1.3 sign, not enabled for TLS 1.3" \
+            "$P_SRV force_version=tls13 \
+             crt_file=data_files/server2.crt key_file=data_files/server2.key \
+             debug_level=1 async_operations=s async_private_delay1=1 async_private_delay2=1" \
+            "$P_CLI" \
+            1 \
+            -S "Async sign callback" \
+            -S "Async resume" \
+            -s "got no private key" \
+            -s "! mbedtls_ssl_handshake returned -0x7600"
+
 requires_config_enabled MBEDTLS_SSL_ASYNC_PRIVATE
 run_test    "SSL async private: decrypt, delay=0" \
             "$P_SRV \
@@ -13381,6 +13451,20 @@ run_test    "TLS 1.3: no HRR in case of PSK key exchange mode" \
             -c "Selected key exchange mode: psk$" \
             -c "HTTP/1.0 200 OK"
 
+requires_config_enabled MBEDTLS_SSL_PROTO_TLS1_3
+requires_config_enabled MBEDTLS_SSL_SRV_C
+requires_config_enabled MBEDTLS_SSL_CLI_C
+requires_config_enabled MBEDTLS_SSL_SESSION_TICKETS
+requires_config_enabled MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK_ENABLED
+run_test    "TLS 1.3: external PSK, server without ticket parser" \
+            "$P_SRV tickets=0 debug_level=3 psk=010203 psk_identity=0a0b0c tls13_kex_modes=psk" \
+            "$P_CLI debug_level=3 psk=010203 psk_identity=0a0b0c tls13_kex_modes=psk" \
+            0 \
+            -S "Ticket-resumed PSK" \
+            -s "Pre shared key found" \
+            -c "Selected key exchange mode: psk$" \
+            -c "HTTP/1.0 200 OK"
+
 # Test heap memory usage after handshake
 requires_config_enabled MBEDTLS_SSL_PROTO_TLS1_2
 requires_config_enabled MBEDTLS_MEMORY_DEBUG